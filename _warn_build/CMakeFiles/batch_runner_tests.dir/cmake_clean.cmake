@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/batch_runner_tests.dir/tests/unit/text_processing/test_batch_runner.cpp.o"
+  "CMakeFiles/batch_runner_tests.dir/tests/unit/text_processing/test_batch_runner.cpp.o.d"
+  "batch_runner_tests"
+  "batch_runner_tests.pdb"
+  "batch_runner_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/batch_runner_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
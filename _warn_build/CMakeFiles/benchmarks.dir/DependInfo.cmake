@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/benchmarks/bench_main.cpp" "CMakeFiles/benchmarks.dir/benchmarks/bench_main.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmarks/bench_main.cpp.o.d"
+  "/root/repo/benchmarks/bench_pipeline.cpp" "CMakeFiles/benchmarks.dir/benchmarks/bench_pipeline.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmarks/bench_pipeline.cpp.o.d"
+  "/root/repo/benchmarks/bench_support.cpp" "CMakeFiles/benchmarks.dir/benchmarks/bench_support.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmarks/bench_support.cpp.o.d"
+  "/root/repo/benchmarks/bench_text.cpp" "CMakeFiles/benchmarks.dir/benchmarks/bench_text.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmarks/bench_text.cpp.o.d"
+  "/root/repo/benchmarks/corpus_generator.cpp" "CMakeFiles/benchmarks.dir/benchmarks/corpus_generator.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmarks/corpus_generator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_warn_build/CMakeFiles/text_processing.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarks.dir/benchmarks/bench_main.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmarks/bench_main.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmarks/bench_pipeline.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmarks/bench_pipeline.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmarks/bench_support.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmarks/bench_support.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmarks/bench_text.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmarks/bench_text.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmarks/corpus_generator.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmarks/corpus_generator.cpp.o.d"
+  "benchmarks"
+  "benchmarks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
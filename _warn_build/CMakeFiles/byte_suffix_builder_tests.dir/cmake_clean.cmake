@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/byte_suffix_builder_tests.dir/tests/unit/text_processing/test_byte_suffix_builder.cpp.o"
+  "CMakeFiles/byte_suffix_builder_tests.dir/tests/unit/text_processing/test_byte_suffix_builder.cpp.o.d"
+  "byte_suffix_builder_tests"
+  "byte_suffix_builder_tests.pdb"
+  "byte_suffix_builder_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/byte_suffix_builder_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
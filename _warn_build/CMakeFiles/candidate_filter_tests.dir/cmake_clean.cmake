@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/candidate_filter_tests.dir/tests/unit/text_processing/test_candidate_filter.cpp.o"
+  "CMakeFiles/candidate_filter_tests.dir/tests/unit/text_processing/test_candidate_filter.cpp.o.d"
+  "candidate_filter_tests"
+  "candidate_filter_tests.pdb"
+  "candidate_filter_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/candidate_filter_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
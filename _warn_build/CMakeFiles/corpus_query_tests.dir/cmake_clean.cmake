@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/corpus_query_tests.dir/tests/unit/text_processing/test_corpus_query.cpp.o"
+  "CMakeFiles/corpus_query_tests.dir/tests/unit/text_processing/test_corpus_query.cpp.o.d"
+  "corpus_query_tests"
+  "corpus_query_tests.pdb"
+  "corpus_query_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/corpus_query_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/document_store.dir/tests/unit/data/test_document_store.cpp.o"
+  "CMakeFiles/document_store.dir/tests/unit/data/test_document_store.cpp.o.d"
+  "document_store"
+  "document_store.pdb"
+  "document_store[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/document_store.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duplicate_finder.dir/tests/unit/text_processing/test_duplicate_finder.cpp.o"
+  "CMakeFiles/duplicate_finder.dir/tests/unit/text_processing/test_duplicate_finder.cpp.o.d"
+  "duplicate_finder"
+  "duplicate_finder.pdb"
+  "duplicate_finder[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duplicate_finder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duplicate_remover_tests.dir/tests/unit/text_processing/test_duplicate_remover.cpp.o"
+  "CMakeFiles/duplicate_remover_tests.dir/tests/unit/text_processing/test_duplicate_remover.cpp.o.d"
+  "duplicate_remover_tests"
+  "duplicate_remover_tests.pdb"
+  "duplicate_remover_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duplicate_remover_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
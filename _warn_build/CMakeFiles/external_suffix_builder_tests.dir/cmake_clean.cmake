@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/external_suffix_builder_tests.dir/tests/unit/text_processing/test_external_suffix_builder.cpp.o"
+  "CMakeFiles/external_suffix_builder_tests.dir/tests/unit/text_processing/test_external_suffix_builder.cpp.o.d"
+  "external_suffix_builder_tests"
+  "external_suffix_builder_tests.pdb"
+  "external_suffix_builder_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/external_suffix_builder_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
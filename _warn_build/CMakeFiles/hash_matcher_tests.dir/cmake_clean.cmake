@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hash_matcher_tests.dir/tests/unit/text_processing/test_hash_matcher.cpp.o"
+  "CMakeFiles/hash_matcher_tests.dir/tests/unit/text_processing/test_hash_matcher.cpp.o.d"
+  "hash_matcher_tests"
+  "hash_matcher_tests.pdb"
+  "hash_matcher_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hash_matcher_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/index_file_tests.dir/tests/unit/text_processing/test_index_file.cpp.o"
+  "CMakeFiles/index_file_tests.dir/tests/unit/text_processing/test_index_file.cpp.o.d"
+  "index_file_tests"
+  "index_file_tests.pdb"
+  "index_file_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/index_file_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/index_vector_tests.dir/tests/unit/text_processing/test_index_vector.cpp.o"
+  "CMakeFiles/index_vector_tests.dir/tests/unit/text_processing/test_index_vector.cpp.o.d"
+  "index_vector_tests"
+  "index_vector_tests.pdb"
+  "index_vector_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/index_vector_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
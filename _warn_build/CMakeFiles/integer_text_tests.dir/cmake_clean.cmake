@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/integer_text_tests.dir/tests/unit/text_processing/test_integer_text.cpp.o"
+  "CMakeFiles/integer_text_tests.dir/tests/unit/text_processing/test_integer_text.cpp.o.d"
+  "integer_text_tests"
+  "integer_text_tests.pdb"
+  "integer_text_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/integer_text_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/match_table_tests.dir/tests/unit/text_processing/test_match_table.cpp.o"
+  "CMakeFiles/match_table_tests.dir/tests/unit/text_processing/test_match_table.cpp.o.d"
+  "match_table_tests"
+  "match_table_tests.pdb"
+  "match_table_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/match_table_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
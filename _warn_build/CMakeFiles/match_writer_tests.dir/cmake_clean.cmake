@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/match_writer_tests.dir/tests/unit/data/test_match_writer.cpp.o"
+  "CMakeFiles/match_writer_tests.dir/tests/unit/data/test_match_writer.cpp.o.d"
+  "match_writer_tests"
+  "match_writer_tests.pdb"
+  "match_writer_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/match_writer_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/naive_suffix_builder_tests.dir/tests/unit/text_processing/test_naive_suffix_builder.cpp.o"
+  "CMakeFiles/naive_suffix_builder_tests.dir/tests/unit/text_processing/test_naive_suffix_builder.cpp.o.d"
+  "naive_suffix_builder_tests"
+  "naive_suffix_builder_tests.pdb"
+  "naive_suffix_builder_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/naive_suffix_builder_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
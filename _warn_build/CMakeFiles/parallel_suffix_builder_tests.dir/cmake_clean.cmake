@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parallel_suffix_builder_tests.dir/tests/unit/text_processing/test_parallel_suffix_builder.cpp.o"
+  "CMakeFiles/parallel_suffix_builder_tests.dir/tests/unit/text_processing/test_parallel_suffix_builder.cpp.o.d"
+  "parallel_suffix_builder_tests"
+  "parallel_suffix_builder_tests.pdb"
+  "parallel_suffix_builder_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parallel_suffix_builder_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
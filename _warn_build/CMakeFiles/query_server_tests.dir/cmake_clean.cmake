@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/query_server_tests.dir/tests/unit/text_processing/test_query_server.cpp.o"
+  "CMakeFiles/query_server_tests.dir/tests/unit/text_processing/test_query_server.cpp.o.d"
+  "query_server_tests"
+  "query_server_tests.pdb"
+  "query_server_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/query_server_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rank_bitvector_tests.dir/tests/unit/text_processing/test_rank_bitvector.cpp.o"
+  "CMakeFiles/rank_bitvector_tests.dir/tests/unit/text_processing/test_rank_bitvector.cpp.o.d"
+  "rank_bitvector_tests"
+  "rank_bitvector_tests.pdb"
+  "rank_bitvector_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rank_bitvector_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
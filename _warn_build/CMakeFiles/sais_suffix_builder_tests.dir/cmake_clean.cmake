@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sais_suffix_builder_tests.dir/tests/unit/text_processing/test_sais_suffix_builder.cpp.o"
+  "CMakeFiles/sais_suffix_builder_tests.dir/tests/unit/text_processing/test_sais_suffix_builder.cpp.o.d"
+  "sais_suffix_builder_tests"
+  "sais_suffix_builder_tests.pdb"
+  "sais_suffix_builder_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sais_suffix_builder_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sql_handler.dir/tests/unit/sql/test_sql_handler.cpp.o"
+  "CMakeFiles/sql_handler.dir/tests/unit/sql/test_sql_handler.cpp.o.d"
+  "sql_handler"
+  "sql_handler.pdb"
+  "sql_handler[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sql_handler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/data/document_store.cpp" "CMakeFiles/text_processing.dir/src/data/document_store.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/data/document_store.cpp.o.d"
+  "/root/repo/src/data/match_writer.cpp" "CMakeFiles/text_processing.dir/src/data/match_writer.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/data/match_writer.cpp.o.d"
+  "/root/repo/src/data/shard_result.cpp" "CMakeFiles/text_processing.dir/src/data/shard_result.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/data/shard_result.cpp.o.d"
+  "/root/repo/src/sql/sql_handler.cpp" "CMakeFiles/text_processing.dir/src/sql/sql_handler.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/sql/sql_handler.cpp.o.d"
+  "/root/repo/src/text_processing/batch_runner.cpp" "CMakeFiles/text_processing.dir/src/text_processing/batch_runner.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/batch_runner.cpp.o.d"
+  "/root/repo/src/text_processing/byte_suffix_builder.cpp" "CMakeFiles/text_processing.dir/src/text_processing/byte_suffix_builder.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/byte_suffix_builder.cpp.o.d"
+  "/root/repo/src/text_processing/candidate_filter.cpp" "CMakeFiles/text_processing.dir/src/text_processing/candidate_filter.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/candidate_filter.cpp.o.d"
+  "/root/repo/src/text_processing/corpus_query.cpp" "CMakeFiles/text_processing.dir/src/text_processing/corpus_query.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/corpus_query.cpp.o.d"
+  "/root/repo/src/text_processing/duplicate_finder.cpp" "CMakeFiles/text_processing.dir/src/text_processing/duplicate_finder.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/duplicate_finder.cpp.o.d"
+  "/root/repo/src/text_processing/duplicate_remover.cpp" "CMakeFiles/text_processing.dir/src/text_processing/duplicate_remover.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/duplicate_remover.cpp.o.d"
+  "/root/repo/src/text_processing/external_suffix_builder.cpp" "CMakeFiles/text_processing.dir/src/text_processing/external_suffix_builder.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/external_suffix_builder.cpp.o.d"
+  "/root/repo/src/text_processing/hash_matcher.cpp" "CMakeFiles/text_processing.dir/src/text_processing/hash_matcher.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/hash_matcher.cpp.o.d"
+  "/root/repo/src/text_processing/index_file.cpp" "CMakeFiles/text_processing.dir/src/text_processing/index_file.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/index_file.cpp.o.d"
+  "/root/repo/src/text_processing/integer_text.cpp" "CMakeFiles/text_processing.dir/src/text_processing/integer_text.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/integer_text.cpp.o.d"
+  "/root/repo/src/text_processing/metrics.cpp" "CMakeFiles/text_processing.dir/src/text_processing/metrics.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/metrics.cpp.o.d"
+  "/root/repo/src/text_processing/naive_suffix_builder.cpp" "CMakeFiles/text_processing.dir/src/text_processing/naive_suffix_builder.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/naive_suffix_builder.cpp.o.d"
+  "/root/repo/src/text_processing/parallel_suffix_builder.cpp" "CMakeFiles/text_processing.dir/src/text_processing/parallel_suffix_builder.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/parallel_suffix_builder.cpp.o.d"
+  "/root/repo/src/text_processing/query_server.cpp" "CMakeFiles/text_processing.dir/src/text_processing/query_server.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/query_server.cpp.o.d"
+  "/root/repo/src/text_processing/sais_suffix_builder.cpp" "CMakeFiles/text_processing.dir/src/text_processing/sais_suffix_builder.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/sais_suffix_builder.cpp.o.d"
+  "/root/repo/src/text_processing/suffix_array_builder.cpp" "CMakeFiles/text_processing.dir/src/text_processing/suffix_array_builder.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/suffix_array_builder.cpp.o.d"
+  "/root/repo/src/text_processing/suffix_workspace.cpp" "CMakeFiles/text_processing.dir/src/text_processing/suffix_workspace.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/suffix_workspace.cpp.o.d"
+  "/root/repo/src/text_processing/utf8_handler.cpp" "CMakeFiles/text_processing.dir/src/text_processing/utf8_handler.cpp.o" "gcc" "CMakeFiles/text_processing.dir/src/text_processing/utf8_handler.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/text_processing.dir/src/data/document_store.cpp.o"
+  "CMakeFiles/text_processing.dir/src/data/document_store.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/data/match_writer.cpp.o"
+  "CMakeFiles/text_processing.dir/src/data/match_writer.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/data/shard_result.cpp.o"
+  "CMakeFiles/text_processing.dir/src/data/shard_result.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/sql/sql_handler.cpp.o"
+  "CMakeFiles/text_processing.dir/src/sql/sql_handler.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/batch_runner.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/batch_runner.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/byte_suffix_builder.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/byte_suffix_builder.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/candidate_filter.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/candidate_filter.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/corpus_query.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/corpus_query.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/duplicate_finder.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/duplicate_finder.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/duplicate_remover.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/duplicate_remover.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/external_suffix_builder.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/external_suffix_builder.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/hash_matcher.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/hash_matcher.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/index_file.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/index_file.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/integer_text.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/integer_text.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/metrics.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/metrics.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/naive_suffix_builder.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/naive_suffix_builder.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/parallel_suffix_builder.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/parallel_suffix_builder.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/query_server.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/query_server.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/sais_suffix_builder.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/sais_suffix_builder.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/suffix_array_builder.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/suffix_array_builder.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/suffix_workspace.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/suffix_workspace.cpp.o.d"
+  "CMakeFiles/text_processing.dir/src/text_processing/utf8_handler.cpp.o"
+  "CMakeFiles/text_processing.dir/src/text_processing/utf8_handler.cpp.o.d"
+  "libtext_processing.a"
+  "libtext_processing.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/text_processing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
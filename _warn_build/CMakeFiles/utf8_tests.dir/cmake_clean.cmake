@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utf8_tests.dir/tests/unit/text_processing/test_utf8_handler.cpp.o"
+  "CMakeFiles/utf8_tests.dir/tests/unit/text_processing/test_utf8_handler.cpp.o.d"
+  "utf8_tests"
+  "utf8_tests.pdb"
+  "utf8_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utf8_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
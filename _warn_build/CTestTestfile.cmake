@@ -0,0 +1,29 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_warn_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_warn_build/utf8_tests[1]_include.cmake")
+include("/root/repo/_warn_build/index_vector_tests[1]_include.cmake")
+include("/root/repo/_warn_build/rank_bitvector_tests[1]_include.cmake")
+include("/root/repo/_warn_build/match_table_tests[1]_include.cmake")
+include("/root/repo/_warn_build/integer_text_tests[1]_include.cmake")
+include("/root/repo/_warn_build/naive_suffix_builder_tests[1]_include.cmake")
+include("/root/repo/_warn_build/sais_suffix_builder_tests[1]_include.cmake")
+include("/root/repo/_warn_build/byte_suffix_builder_tests[1]_include.cmake")
+include("/root/repo/_warn_build/parallel_suffix_builder_tests[1]_include.cmake")
+include("/root/repo/_warn_build/external_suffix_builder_tests[1]_include.cmake")
+include("/root/repo/_warn_build/index_file_tests[1]_include.cmake")
+include("/root/repo/_warn_build/document_store[1]_include.cmake")
+include("/root/repo/_warn_build/match_writer_tests[1]_include.cmake")
+include("/root/repo/_warn_build/duplicate_finder[1]_include.cmake")
+include("/root/repo/_warn_build/sql_handler[1]_include.cmake")
+include("/root/repo/_warn_build/batch_runner_tests[1]_include.cmake")
+include("/root/repo/_warn_build/duplicate_remover_tests[1]_include.cmake")
+include("/root/repo/_warn_build/metrics_tests[1]_include.cmake")
+include("/root/repo/_warn_build/candidate_filter_tests[1]_include.cmake")
+include("/root/repo/_warn_build/corpus_query_tests[1]_include.cmake")
+include("/root/repo/_warn_build/query_server_tests[1]_include.cmake")
+include("/root/repo/_warn_build/hash_matcher_tests[1]_include.cmake")
+subdirs("_deps/googletest-build")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/batch_runner_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/batch_runner_tests[1]_tests.cmake")
+else()
+  add_test(batch_runner_tests_NOT_BUILT batch_runner_tests_NOT_BUILT)
+endif()
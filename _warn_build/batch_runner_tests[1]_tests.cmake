@@ -0,0 +1,15 @@
+add_test([=[BatchRunnerTest.AllDomains]=]  /root/repo/_warn_build/batch_runner_tests [==[--gtest_filter=BatchRunnerTest.AllDomains]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchRunnerTest.AllDomains]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchRunnerTest.SelectedDomains]=]  /root/repo/_warn_build/batch_runner_tests [==[--gtest_filter=BatchRunnerTest.SelectedDomains]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchRunnerTest.SelectedDomains]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchRunnerTest.NdjsonFormat]=]  /root/repo/_warn_build/batch_runner_tests [==[--gtest_filter=BatchRunnerTest.NdjsonFormat]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchRunnerTest.NdjsonFormat]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchRunnerTest.PerDomainMetrics]=]  /root/repo/_warn_build/batch_runner_tests [==[--gtest_filter=BatchRunnerTest.PerDomainMetrics]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchRunnerTest.PerDomainMetrics]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchRunnerTest.InvalidSource]=]  /root/repo/_warn_build/batch_runner_tests [==[--gtest_filter=BatchRunnerTest.InvalidSource]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchRunnerTest.InvalidSource]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchRunnerTest.OutputFileName]=]  /root/repo/_warn_build/batch_runner_tests [==[--gtest_filter=BatchRunnerTest.OutputFileName]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchRunnerTest.OutputFileName]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LargestFirstTest.SingleWorkerOrder]=]  /root/repo/_warn_build/batch_runner_tests [==[--gtest_filter=LargestFirstTest.SingleWorkerOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LargestFirstTest.SingleWorkerOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  batch_runner_tests_TESTS BatchRunnerTest.AllDomains BatchRunnerTest.SelectedDomains BatchRunnerTest.NdjsonFormat BatchRunnerTest.PerDomainMetrics BatchRunnerTest.InvalidSource BatchRunnerTest.OutputFileName LargestFirstTest.SingleWorkerOrder)
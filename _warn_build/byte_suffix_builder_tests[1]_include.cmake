@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/byte_suffix_builder_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/byte_suffix_builder_tests[1]_tests.cmake")
+else()
+  add_test(byte_suffix_builder_tests_NOT_BUILT byte_suffix_builder_tests_NOT_BUILT)
+endif()
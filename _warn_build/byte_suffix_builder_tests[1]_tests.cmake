@@ -0,0 +1,17 @@
+add_test([=[ByteSuffixBuilderTest.EmptyString]=]  /root/repo/_warn_build/byte_suffix_builder_tests [==[--gtest_filter=ByteSuffixBuilderTest.EmptyString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ByteSuffixBuilderTest.EmptyString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ByteSuffixBuilderTest.AsciiMatchesCharacterOrder]=]  /root/repo/_warn_build/byte_suffix_builder_tests [==[--gtest_filter=ByteSuffixBuilderTest.AsciiMatchesCharacterOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ByteSuffixBuilderTest.AsciiMatchesCharacterOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ByteSuffixBuilderTest.PositionsAreByteOffsets]=]  /root/repo/_warn_build/byte_suffix_builder_tests [==[--gtest_filter=ByteSuffixBuilderTest.PositionsAreByteOffsets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ByteSuffixBuilderTest.PositionsAreByteOffsets]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ByteSuffixBuilderTest.LcpStopsAtCharacterBoundary]=]  /root/repo/_warn_build/byte_suffix_builder_tests [==[--gtest_filter=ByteSuffixBuilderTest.LcpStopsAtCharacterBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ByteSuffixBuilderTest.LcpStopsAtCharacterBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ByteSuffixBuilderTest.TextWithNulCharacters]=]  /root/repo/_warn_build/byte_suffix_builder_tests [==[--gtest_filter=ByteSuffixBuilderTest.TextWithNulCharacters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ByteSuffixBuilderTest.TextWithNulCharacters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ByteSuffixBuilderTest.FactoryCreation]=]  /root/repo/_warn_build/byte_suffix_builder_tests [==[--gtest_filter=ByteSuffixBuilderTest.FactoryCreation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ByteSuffixBuilderTest.FactoryCreation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ByteSuffixBuilderTest.MatchesNaiveOnDocumentLikeText]=]  /root/repo/_warn_build/byte_suffix_builder_tests [==[--gtest_filter=ByteSuffixBuilderTest.MatchesNaiveOnDocumentLikeText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ByteSuffixBuilderTest.MatchesNaiveOnDocumentLikeText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ByteSuffixBuilderTest.MatchesNaiveOnRandomText]=]  /root/repo/_warn_build/byte_suffix_builder_tests [==[--gtest_filter=ByteSuffixBuilderTest.MatchesNaiveOnRandomText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ByteSuffixBuilderTest.MatchesNaiveOnRandomText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  byte_suffix_builder_tests_TESTS ByteSuffixBuilderTest.EmptyString ByteSuffixBuilderTest.AsciiMatchesCharacterOrder ByteSuffixBuilderTest.PositionsAreByteOffsets ByteSuffixBuilderTest.LcpStopsAtCharacterBoundary ByteSuffixBuilderTest.TextWithNulCharacters ByteSuffixBuilderTest.FactoryCreation ByteSuffixBuilderTest.MatchesNaiveOnDocumentLikeText ByteSuffixBuilderTest.MatchesNaiveOnRandomText)
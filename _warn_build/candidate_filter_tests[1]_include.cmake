@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/candidate_filter_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/candidate_filter_tests[1]_tests.cmake")
+else()
+  add_test(candidate_filter_tests_NOT_BUILT candidate_filter_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,9 @@
+add_test([=[CandidateFilterTest.WinnowingOfShortTexts]=]  /root/repo/_warn_build/candidate_filter_tests [==[--gtest_filter=CandidateFilterTest.WinnowingOfShortTexts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CandidateFilterTest.WinnowingOfShortTexts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CandidateFilterTest.SharedSubstringIsAlwaysFound]=]  /root/repo/_warn_build/candidate_filter_tests [==[--gtest_filter=CandidateFilterTest.SharedSubstringIsAlwaysFound]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CandidateFilterTest.SharedSubstringIsAlwaysFound]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CandidateFilterTest.DropsDocumentsWithoutSharedFingerprints]=]  /root/repo/_warn_build/candidate_filter_tests [==[--gtest_filter=CandidateFilterTest.DropsDocumentsWithoutSharedFingerprints]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CandidateFilterTest.DropsDocumentsWithoutSharedFingerprints]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CandidateFilterTest.SelectDocumentsKeepsIdsAndSeparator]=]  /root/repo/_warn_build/candidate_filter_tests [==[--gtest_filter=CandidateFilterTest.SelectDocumentsKeepsIdsAndSeparator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CandidateFilterTest.SelectDocumentsKeepsIdsAndSeparator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  candidate_filter_tests_TESTS CandidateFilterTest.WinnowingOfShortTexts CandidateFilterTest.SharedSubstringIsAlwaysFound CandidateFilterTest.DropsDocumentsWithoutSharedFingerprints CandidateFilterTest.SelectDocumentsKeepsIdsAndSeparator)
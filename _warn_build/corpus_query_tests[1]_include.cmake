@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/corpus_query_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/corpus_query_tests[1]_tests.cmake")
+else()
+  add_test(corpus_query_tests_NOT_BUILT corpus_query_tests_NOT_BUILT)
+endif()
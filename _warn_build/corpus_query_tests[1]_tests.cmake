@@ -0,0 +1,7 @@
+add_test([=[CorpusQueryTest.FindsMaximalSubstrings]=]  /root/repo/_warn_build/corpus_query_tests [==[--gtest_filter=CorpusQueryTest.FindsMaximalSubstrings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CorpusQueryTest.FindsMaximalSubstrings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CorpusQueryTest.MatchesBruteForceOnRandomTexts]=]  /root/repo/_warn_build/corpus_query_tests [==[--gtest_filter=CorpusQueryTest.MatchesBruteForceOnRandomTexts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CorpusQueryTest.MatchesBruteForceOnRandomTexts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CorpusQueryTest.Errors]=]  /root/repo/_warn_build/corpus_query_tests [==[--gtest_filter=CorpusQueryTest.Errors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CorpusQueryTest.Errors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  corpus_query_tests_TESTS CorpusQueryTest.FindsMaximalSubstrings CorpusQueryTest.MatchesBruteForceOnRandomTexts CorpusQueryTest.Errors)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/document_store[1]_tests.cmake")
+  include("/root/repo/_warn_build/document_store[1]_tests.cmake")
+else()
+  add_test(document_store_NOT_BUILT document_store_NOT_BUILT)
+endif()
@@ -0,0 +1,23 @@
+add_test([=[DocumentStoreTest.AddDocument]=]  /root/repo/_warn_build/document_store [==[--gtest_filter=DocumentStoreTest.AddDocument]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentStoreTest.AddDocument]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentStoreTest.FindDocumentId]=]  /root/repo/_warn_build/document_store [==[--gtest_filter=DocumentStoreTest.FindDocumentId]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentStoreTest.FindDocumentId]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentStoreTest.ConcatenatedText]=]  /root/repo/_warn_build/document_store [==[--gtest_filter=DocumentStoreTest.ConcatenatedText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentStoreTest.ConcatenatedText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentStoreTest.CustomSeparator]=]  /root/repo/_warn_build/document_store [==[--gtest_filter=DocumentStoreTest.CustomSeparator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentStoreTest.CustomSeparator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentStoreTest.FindDocumentByByte]=]  /root/repo/_warn_build/document_store [==[--gtest_filter=DocumentStoreTest.FindDocumentByByte]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentStoreTest.FindDocumentByByte]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentStoreTest.DocumentIndex]=]  /root/repo/_warn_build/document_store [==[--gtest_filter=DocumentStoreTest.DocumentIndex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentStoreTest.DocumentIndex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentStoreTest.EmptyDocumentsWithoutSeparator]=]  /root/repo/_warn_build/document_store [==[--gtest_filter=DocumentStoreTest.EmptyDocumentsWithoutSeparator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentStoreTest.EmptyDocumentsWithoutSeparator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentStoreTest.ClearForReuse]=]  /root/repo/_warn_build/document_store [==[--gtest_filter=DocumentStoreTest.ClearForReuse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentStoreTest.ClearForReuse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentStoreTest.AddDocumentsMatchesAddDocument]=]  /root/repo/_warn_build/document_store [==[--gtest_filter=DocumentStoreTest.AddDocumentsMatchesAddDocument]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentStoreTest.AddDocumentsMatchesAddDocument]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentStoreTest.AddDocumentFromBytes]=]  /root/repo/_warn_build/document_store [==[--gtest_filter=DocumentStoreTest.AddDocumentFromBytes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentStoreTest.AddDocumentFromBytes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentStoreTest.AddDocumentsSkipsDuplicates]=]  /root/repo/_warn_build/document_store [==[--gtest_filter=DocumentStoreTest.AddDocumentsSkipsDuplicates]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentStoreTest.AddDocumentsSkipsDuplicates]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  document_store_TESTS DocumentStoreTest.AddDocument DocumentStoreTest.FindDocumentId DocumentStoreTest.ConcatenatedText DocumentStoreTest.CustomSeparator DocumentStoreTest.FindDocumentByByte DocumentStoreTest.DocumentIndex DocumentStoreTest.EmptyDocumentsWithoutSeparator DocumentStoreTest.ClearForReuse DocumentStoreTest.AddDocumentsMatchesAddDocument DocumentStoreTest.AddDocumentFromBytes DocumentStoreTest.AddDocumentsSkipsDuplicates)
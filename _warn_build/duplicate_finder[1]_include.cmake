@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/duplicate_finder[1]_tests.cmake")
+  include("/root/repo/_warn_build/duplicate_finder[1]_tests.cmake")
+else()
+  add_test(duplicate_finder_NOT_BUILT duplicate_finder_NOT_BUILT)
+endif()
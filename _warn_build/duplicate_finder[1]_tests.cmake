@@ -0,0 +1,63 @@
+add_test([=[DuplicateFinderTest.EmptyStore]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.EmptyStore]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.EmptyStore]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.SingleDocument]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.SingleDocument]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.SingleDocument]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.NoMatches]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.NoMatches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.NoMatches]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.SimpleMatch]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.SimpleMatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.SimpleMatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.MultipleMatches]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.MultipleMatches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.MultipleMatches]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.UTF8Match]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.UTF8Match]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.UTF8Match]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.UTF8MatchMultiple]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.UTF8MatchMultiple]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.UTF8MatchMultiple]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.ThresholdFiltering]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.ThresholdFiltering]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.ThresholdFiltering]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.ZeroThreshold]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.ZeroThreshold]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.ZeroThreshold]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.LargeThreshold]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.LargeThreshold]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.LargeThreshold]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.SaveMatchesToJson]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.SaveMatchesToJson]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.SaveMatchesToJson]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.SAISBuilderMatchesNaive]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.SAISBuilderMatchesNaive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.SAISBuilderMatchesNaive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.ByteBuilderMatchesNaive]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.ByteBuilderMatchesNaive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.ByteBuilderMatchesNaive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.DepthLimitedExtendsMatches]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.DepthLimitedExtendsMatches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.DepthLimitedExtendsMatches]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.DepthLimitedReportsGenuineMatches]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.DepthLimitedReportsGenuineMatches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.DepthLimitedReportsGenuineMatches]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.DepthLimitedExtendsLongDuplicates]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.DepthLimitedExtendsLongDuplicates]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.DepthLimitedExtendsLongDuplicates]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.ShardedMatchingIsDeterministic]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.ShardedMatchingIsDeterministic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.ShardedMatchingIsDeterministic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.TopMatchesArePrefixOfAllMatches]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.TopMatchesArePrefixOfAllMatches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.TopMatchesArePrefixOfAllMatches]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.AnyMatchStopsAtFirstMatch]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.AnyMatchStopsAtFirstMatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.AnyMatchStopsAtFirstMatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.AnyMatchIsTheSameForEveryThreadCount]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.AnyMatchIsTheSameForEveryThreadCount]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.AnyMatchIsTheSameForEveryThreadCount]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.HashEngineMatchesSuffixArrays]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.HashEngineMatchesSuffixArrays]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.HashEngineMatchesSuffixArrays]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateFinderTest.ExternalBuilderMatchesNaive]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=DuplicateFinderTest.ExternalBuilderMatchesNaive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateFinderTest.ExternalBuilderMatchesNaive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ClusterTest.BoilerplateIsOneCluster]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=ClusterTest.BoilerplateIsOneCluster]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ClusterTest.BoilerplateIsOneCluster]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ClusterTest.OnlyMaximalRepeats]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=ClusterTest.OnlyMaximalRepeats]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ClusterTest.OnlyMaximalRepeats]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ClusterTest.MatchesBruteForce]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=ClusterTest.MatchesBruteForce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ClusterTest.MatchesBruteForce]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ClusterTest.ShardedClustersAreDeterministic]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=ClusterTest.ShardedClustersAreDeterministic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ClusterTest.ShardedClustersAreDeterministic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PrefixShardTest.MatchesUnshardedRun]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=PrefixShardTest.MatchesUnshardedRun]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PrefixShardTest.MatchesUnshardedRun]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PrefixShardTest.ShardsPartitionTheSuffixes]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=PrefixShardTest.ShardsPartitionTheSuffixes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PrefixShardTest.ShardsPartitionTheSuffixes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PrefixShardTest.EmptyAndTinyStores]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=PrefixShardTest.EmptyAndTinyStores]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PrefixShardTest.EmptyAndTinyStores]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PrefixShardTest.RejectsIncompleteResults]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=PrefixShardTest.RejectsIncompleteResults]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PrefixShardTest.RejectsIncompleteResults]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PrefixShardTest.PrefilterKeepsMatches]=]  /root/repo/_warn_build/duplicate_finder [==[--gtest_filter=PrefixShardTest.PrefilterKeepsMatches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PrefixShardTest.PrefilterKeepsMatches]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  duplicate_finder_TESTS DuplicateFinderTest.EmptyStore DuplicateFinderTest.SingleDocument DuplicateFinderTest.NoMatches DuplicateFinderTest.SimpleMatch DuplicateFinderTest.MultipleMatches DuplicateFinderTest.UTF8Match DuplicateFinderTest.UTF8MatchMultiple DuplicateFinderTest.ThresholdFiltering DuplicateFinderTest.ZeroThreshold DuplicateFinderTest.LargeThreshold DuplicateFinderTest.SaveMatchesToJson DuplicateFinderTest.SAISBuilderMatchesNaive DuplicateFinderTest.ByteBuilderMatchesNaive DuplicateFinderTest.DepthLimitedExtendsMatches DuplicateFinderTest.DepthLimitedReportsGenuineMatches DuplicateFinderTest.DepthLimitedExtendsLongDuplicates DuplicateFinderTest.ShardedMatchingIsDeterministic DuplicateFinderTest.TopMatchesArePrefixOfAllMatches DuplicateFinderTest.AnyMatchStopsAtFirstMatch DuplicateFinderTest.AnyMatchIsTheSameForEveryThreadCount DuplicateFinderTest.HashEngineMatchesSuffixArrays DuplicateFinderTest.ExternalBuilderMatchesNaive ClusterTest.BoilerplateIsOneCluster ClusterTest.OnlyMaximalRepeats ClusterTest.MatchesBruteForce ClusterTest.ShardedClustersAreDeterministic PrefixShardTest.MatchesUnshardedRun PrefixShardTest.ShardsPartitionTheSuffixes PrefixShardTest.EmptyAndTinyStores PrefixShardTest.RejectsIncompleteResults PrefixShardTest.PrefilterKeepsMatches)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/duplicate_remover_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/duplicate_remover_tests[1]_tests.cmake")
+else()
+  add_test(duplicate_remover_tests_NOT_BUILT duplicate_remover_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,9 @@
+add_test([=[DuplicateRemoverTest.CutsSecondCopies]=]  /root/repo/_warn_build/duplicate_remover_tests [==[--gtest_filter=DuplicateRemoverTest.CutsSecondCopies]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateRemoverTest.CutsSecondCopies]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateRemoverTest.MergesOverlappingSpans]=]  /root/repo/_warn_build/duplicate_remover_tests [==[--gtest_filter=DuplicateRemoverTest.MergesOverlappingSpans]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateRemoverTest.MergesOverlappingSpans]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateRemoverTest.IgnoresUnknownAndEmptyMatches]=]  /root/repo/_warn_build/duplicate_remover_tests [==[--gtest_filter=DuplicateRemoverTest.IgnoresUnknownAndEmptyMatches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateRemoverTest.IgnoresUnknownAndEmptyMatches]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DuplicateRemoverTest.KeepsOneCopyOfFoundDuplicates]=]  /root/repo/_warn_build/duplicate_remover_tests [==[--gtest_filter=DuplicateRemoverTest.KeepsOneCopyOfFoundDuplicates]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DuplicateRemoverTest.KeepsOneCopyOfFoundDuplicates]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  duplicate_remover_tests_TESTS DuplicateRemoverTest.CutsSecondCopies DuplicateRemoverTest.MergesOverlappingSpans DuplicateRemoverTest.IgnoresUnknownAndEmptyMatches DuplicateRemoverTest.KeepsOneCopyOfFoundDuplicates)
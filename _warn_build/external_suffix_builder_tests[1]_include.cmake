@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/external_suffix_builder_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/external_suffix_builder_tests[1]_tests.cmake")
+else()
+  add_test(external_suffix_builder_tests_NOT_BUILT external_suffix_builder_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,21 @@
+add_test([=[ExternalSuffixBuilderTest.EmptyString]=]  /root/repo/_warn_build/external_suffix_builder_tests [==[--gtest_filter=ExternalSuffixBuilderTest.EmptyString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExternalSuffixBuilderTest.EmptyString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExternalSuffixBuilderTest.AsciiMatchesByteBuilder]=]  /root/repo/_warn_build/external_suffix_builder_tests [==[--gtest_filter=ExternalSuffixBuilderTest.AsciiMatchesByteBuilder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExternalSuffixBuilderTest.AsciiMatchesByteBuilder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExternalSuffixBuilderTest.SmallBudgetSplitsIntoBuckets]=]  /root/repo/_warn_build/external_suffix_builder_tests [==[--gtest_filter=ExternalSuffixBuilderTest.SmallBudgetSplitsIntoBuckets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExternalSuffixBuilderTest.SmallBudgetSplitsIntoBuckets]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExternalSuffixBuilderTest.LcpStopsAtCharacterBoundary]=]  /root/repo/_warn_build/external_suffix_builder_tests [==[--gtest_filter=ExternalSuffixBuilderTest.LcpStopsAtCharacterBoundary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExternalSuffixBuilderTest.LcpStopsAtCharacterBoundary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExternalSuffixBuilderTest.RepetitiveText]=]  /root/repo/_warn_build/external_suffix_builder_tests [==[--gtest_filter=ExternalSuffixBuilderTest.RepetitiveText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExternalSuffixBuilderTest.RepetitiveText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExternalSuffixBuilderTest.TextWithNulCharacters]=]  /root/repo/_warn_build/external_suffix_builder_tests [==[--gtest_filter=ExternalSuffixBuilderTest.TextWithNulCharacters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExternalSuffixBuilderTest.TextWithNulCharacters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExternalSuffixBuilderTest.MatchesByteBuilderOnRandomText]=]  /root/repo/_warn_build/external_suffix_builder_tests [==[--gtest_filter=ExternalSuffixBuilderTest.MatchesByteBuilderOnRandomText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExternalSuffixBuilderTest.MatchesByteBuilderOnRandomText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExternalSuffixBuilderTest.ReadArraysReturnsRanges]=]  /root/repo/_warn_build/external_suffix_builder_tests [==[--gtest_filter=ExternalSuffixBuilderTest.ReadArraysReturnsRanges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExternalSuffixBuilderTest.ReadArraysReturnsRanges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExternalSuffixBuilderTest.ScratchFilesAreRemoved]=]  /root/repo/_warn_build/external_suffix_builder_tests [==[--gtest_filter=ExternalSuffixBuilderTest.ScratchFilesAreRemoved]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExternalSuffixBuilderTest.ScratchFilesAreRemoved]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExternalSuffixBuilderTest.FactoryCreation]=]  /root/repo/_warn_build/external_suffix_builder_tests [==[--gtest_filter=ExternalSuffixBuilderTest.FactoryCreation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExternalSuffixBuilderTest.FactoryCreation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  external_suffix_builder_tests_TESTS ExternalSuffixBuilderTest.EmptyString ExternalSuffixBuilderTest.AsciiMatchesByteBuilder ExternalSuffixBuilderTest.SmallBudgetSplitsIntoBuckets ExternalSuffixBuilderTest.LcpStopsAtCharacterBoundary ExternalSuffixBuilderTest.RepetitiveText ExternalSuffixBuilderTest.TextWithNulCharacters ExternalSuffixBuilderTest.MatchesByteBuilderOnRandomText ExternalSuffixBuilderTest.ReadArraysReturnsRanges ExternalSuffixBuilderTest.ScratchFilesAreRemoved ExternalSuffixBuilderTest.FactoryCreation)
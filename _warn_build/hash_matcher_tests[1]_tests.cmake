@@ -0,0 +1,9 @@
+add_test([=[HashMatcherTest.MatchesBruteForce]=]  /root/repo/_warn_build/hash_matcher_tests [==[--gtest_filter=HashMatcherTest.MatchesBruteForce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HashMatcherTest.MatchesBruteForce]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HashMatcherTest.AgreesWithSuffixArrays]=]  /root/repo/_warn_build/hash_matcher_tests [==[--gtest_filter=HashMatcherTest.AgreesWithSuffixArrays]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HashMatcherTest.AgreesWithSuffixArrays]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HashMatcherTest.FirstOnlyAndStats]=]  /root/repo/_warn_build/hash_matcher_tests [==[--gtest_filter=HashMatcherTest.FirstOnlyAndStats]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HashMatcherTest.FirstOnlyAndStats]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HashMatcherTest.FirstOnlyIsTheSameForEveryThreadCount]=]  /root/repo/_warn_build/hash_matcher_tests [==[--gtest_filter=HashMatcherTest.FirstOnlyIsTheSameForEveryThreadCount]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HashMatcherTest.FirstOnlyIsTheSameForEveryThreadCount]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  hash_matcher_tests_TESTS HashMatcherTest.MatchesBruteForce HashMatcherTest.AgreesWithSuffixArrays HashMatcherTest.FirstOnlyAndStats HashMatcherTest.FirstOnlyIsTheSameForEveryThreadCount)
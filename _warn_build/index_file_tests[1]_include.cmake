@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/index_file_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/index_file_tests[1]_tests.cmake")
+else()
+  add_test(index_file_tests_NOT_BUILT index_file_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,25 @@
+add_test([=[IndexFileTest.RoundTripsDocumentsAndText]=]  /root/repo/_warn_build/index_file_tests [==[--gtest_filter=IndexFileTest.RoundTripsDocumentsAndText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IndexFileTest.RoundTripsDocumentsAndText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IndexFileTest.ByteOffsetsAndIds]=]  /root/repo/_warn_build/index_file_tests [==[--gtest_filter=IndexFileTest.ByteOffsetsAndIds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IndexFileTest.ByteOffsetsAndIds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IndexFileTest.MatchesStoreForEveryThreshold]=]  /root/repo/_warn_build/index_file_tests [==[--gtest_filter=IndexFileTest.MatchesStoreForEveryThreshold]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IndexFileTest.MatchesStoreForEveryThreshold]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IndexFileTest.ClustersMatchStore]=]  /root/repo/_warn_build/index_file_tests [==[--gtest_filter=IndexFileTest.ClustersMatchStore]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IndexFileTest.ClustersMatchStore]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IndexFileTest.ShardedQueryIsDeterministic]=]  /root/repo/_warn_build/index_file_tests [==[--gtest_filter=IndexFileTest.ShardedQueryIsDeterministic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IndexFileTest.ShardedQueryIsDeterministic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IndexFileTest.EmptyStore]=]  /root/repo/_warn_build/index_file_tests [==[--gtest_filter=IndexFileTest.EmptyStore]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IndexFileTest.EmptyStore]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IndexFileTest.MoveKeepsMapping]=]  /root/repo/_warn_build/index_file_tests [==[--gtest_filter=IndexFileTest.MoveKeepsMapping]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IndexFileTest.MoveKeepsMapping]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IndexFileTest.RejectsInvalidFiles]=]  /root/repo/_warn_build/index_file_tests [==[--gtest_filter=IndexFileTest.RejectsInvalidFiles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IndexFileTest.RejectsInvalidFiles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IndexFileTest.ShardsFromDocumentsFile]=]  /root/repo/_warn_build/index_file_tests [==[--gtest_filter=IndexFileTest.ShardsFromDocumentsFile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IndexFileTest.ShardsFromDocumentsFile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IndexFileTest.RejectsInvalidShardFiles]=]  /root/repo/_warn_build/index_file_tests [==[--gtest_filter=IndexFileTest.RejectsInvalidShardFiles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IndexFileTest.RejectsInvalidShardFiles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IncrementalTest.MatchesRebuildForNewDocuments]=]  /root/repo/_warn_build/index_file_tests [==[--gtest_filter=IncrementalTest.MatchesRebuildForNewDocuments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IncrementalTest.MatchesRebuildForNewDocuments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IncrementalTest.EmptyIndexOrDelta]=]  /root/repo/_warn_build/index_file_tests [==[--gtest_filter=IncrementalTest.EmptyIndexOrDelta]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IncrementalTest.EmptyIndexOrDelta]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  index_file_tests_TESTS IndexFileTest.RoundTripsDocumentsAndText IndexFileTest.ByteOffsetsAndIds IndexFileTest.MatchesStoreForEveryThreshold IndexFileTest.ClustersMatchStore IndexFileTest.ShardedQueryIsDeterministic IndexFileTest.EmptyStore IndexFileTest.MoveKeepsMapping IndexFileTest.RejectsInvalidFiles IndexFileTest.ShardsFromDocumentsFile IndexFileTest.RejectsInvalidShardFiles IncrementalTest.MatchesRebuildForNewDocuments IncrementalTest.EmptyIndexOrDelta)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/index_vector_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/index_vector_tests[1]_tests.cmake")
+else()
+  add_test(index_vector_tests_NOT_BUILT index_vector_tests_NOT_BUILT)
+endif()
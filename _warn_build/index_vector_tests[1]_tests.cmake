@@ -0,0 +1,11 @@
+add_test([=[IndexVectorTest.WidthSelection]=]  /root/repo/_warn_build/index_vector_tests [==[--gtest_filter=IndexVectorTest.WidthSelection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IndexVectorTest.WidthSelection]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IndexVectorTest.ValueAccessInBothWidths]=]  /root/repo/_warn_build/index_vector_tests [==[--gtest_filter=IndexVectorTest.ValueAccessInBothWidths]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IndexVectorTest.ValueAccessInBothWidths]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IndexVectorTest.HalvesMemoryBelowFourBillion]=]  /root/repo/_warn_build/index_vector_tests [==[--gtest_filter=IndexVectorTest.HalvesMemoryBelowFourBillion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IndexVectorTest.HalvesMemoryBelowFourBillion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IndexVectorTest.PushBackWidensOnOverflow]=]  /root/repo/_warn_build/index_vector_tests [==[--gtest_filter=IndexVectorTest.PushBackWidensOnOverflow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IndexVectorTest.PushBackWidensOnOverflow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IndexVectorTest.AdoptsTypedStorage]=]  /root/repo/_warn_build/index_vector_tests [==[--gtest_filter=IndexVectorTest.AdoptsTypedStorage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IndexVectorTest.AdoptsTypedStorage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  index_vector_tests_TESTS IndexVectorTest.WidthSelection IndexVectorTest.ValueAccessInBothWidths IndexVectorTest.HalvesMemoryBelowFourBillion IndexVectorTest.PushBackWidensOnOverflow IndexVectorTest.AdoptsTypedStorage)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/integer_text_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/integer_text_tests[1]_tests.cmake")
+else()
+  add_test(integer_text_tests_NOT_BUILT integer_text_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,11 @@
+add_test([=[IntegerTextTest.EmptyText]=]  /root/repo/_warn_build/integer_text_tests [==[--gtest_filter=IntegerTextTest.EmptyText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntegerTextTest.EmptyText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntegerTextTest.RanksPreserveOrder]=]  /root/repo/_warn_build/integer_text_tests [==[--gtest_filter=IntegerTextTest.RanksPreserveOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntegerTextTest.RanksPreserveOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntegerTextTest.MultiByteCharacters]=]  /root/repo/_warn_build/integer_text_tests [==[--gtest_filter=IntegerTextTest.MultiByteCharacters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntegerTextTest.MultiByteCharacters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntegerTextTest.VisitExposesSentinel]=]  /root/repo/_warn_build/integer_text_tests [==[--gtest_filter=IntegerTextTest.VisitExposesSentinel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntegerTextTest.VisitExposesSentinel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IntegerTextTest.WidensForLargeAlphabets]=]  /root/repo/_warn_build/integer_text_tests [==[--gtest_filter=IntegerTextTest.WidensForLargeAlphabets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IntegerTextTest.WidensForLargeAlphabets]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  integer_text_tests_TESTS IntegerTextTest.EmptyText IntegerTextTest.RanksPreserveOrder IntegerTextTest.MultiByteCharacters IntegerTextTest.VisitExposesSentinel IntegerTextTest.WidensForLargeAlphabets)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/match_table_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/match_table_tests[1]_tests.cmake")
+else()
+  add_test(match_table_tests_NOT_BUILT match_table_tests_NOT_BUILT)
+endif()
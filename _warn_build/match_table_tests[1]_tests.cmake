@@ -0,0 +1,9 @@
+add_test([=[MatchTableTest.KeepsLongestAndFirstOfEqual]=]  /root/repo/_warn_build/match_table_tests [==[--gtest_filter=MatchTableTest.KeepsLongestAndFirstOfEqual]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchTableTest.KeepsLongestAndFirstOfEqual]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchTableTest.MatchesOrderedMapUnderGrowth]=]  /root/repo/_warn_build/match_table_tests [==[--gtest_filter=MatchTableTest.MatchesOrderedMapUnderGrowth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchTableTest.MatchesOrderedMapUnderGrowth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TopMatchesTest.HoldsBestPairsOfFullTable]=]  /root/repo/_warn_build/match_table_tests [==[--gtest_filter=TopMatchesTest.HoldsBestPairsOfFullTable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TopMatchesTest.HoldsBestPairsOfFullTable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TopMatchesTest.EvictedPairComesBackLonger]=]  /root/repo/_warn_build/match_table_tests [==[--gtest_filter=TopMatchesTest.EvictedPairComesBackLonger]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TopMatchesTest.EvictedPairComesBackLonger]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  match_table_tests_TESTS MatchTableTest.KeepsLongestAndFirstOfEqual MatchTableTest.MatchesOrderedMapUnderGrowth TopMatchesTest.HoldsBestPairsOfFullTable TopMatchesTest.EvictedPairComesBackLonger)
@@ -0,0 +1,19 @@
+add_test([=[MatchWriterTest.JsonMatchesToJsonArray]=]  /root/repo/_warn_build/match_writer_tests [==[--gtest_filter=MatchWriterTest.JsonMatchesToJsonArray]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchWriterTest.JsonMatchesToJsonArray]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchWriterTest.Ndjson]=]  /root/repo/_warn_build/match_writer_tests [==[--gtest_filter=MatchWriterTest.Ndjson]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchWriterTest.Ndjson]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchWriterTest.Binary]=]  /root/repo/_warn_build/match_writer_tests [==[--gtest_filter=MatchWriterTest.Binary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchWriterTest.Binary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchWriterTest.ManyMatches]=]  /root/repo/_warn_build/match_writer_tests [==[--gtest_filter=MatchWriterTest.ManyMatches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchWriterTest.ManyMatches]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchWriterTest.SpanLongerThanBuffer]=]  /root/repo/_warn_build/match_writer_tests [==[--gtest_filter=MatchWriterTest.SpanLongerThanBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchWriterTest.SpanLongerThanBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MatchWriterTest.Errors]=]  /root/repo/_warn_build/match_writer_tests [==[--gtest_filter=MatchWriterTest.Errors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MatchWriterTest.Errors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ClusterWriterTest.Json]=]  /root/repo/_warn_build/match_writer_tests [==[--gtest_filter=ClusterWriterTest.Json]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ClusterWriterTest.Json]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ClusterWriterTest.Ndjson]=]  /root/repo/_warn_build/match_writer_tests [==[--gtest_filter=ClusterWriterTest.Ndjson]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ClusterWriterTest.Ndjson]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ClusterWriterTest.Binary]=]  /root/repo/_warn_build/match_writer_tests [==[--gtest_filter=ClusterWriterTest.Binary]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ClusterWriterTest.Binary]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  match_writer_tests_TESTS MatchWriterTest.JsonMatchesToJsonArray MatchWriterTest.Ndjson MatchWriterTest.Binary MatchWriterTest.ManyMatches MatchWriterTest.SpanLongerThanBuffer MatchWriterTest.Errors ClusterWriterTest.Json ClusterWriterTest.Ndjson ClusterWriterTest.Binary)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/metrics_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/metrics_tests[1]_tests.cmake")
+else()
+  add_test(metrics_tests_NOT_BUILT metrics_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,13 @@
+add_test([=[MetricsTest.RecordsPhasesCountsAndPeaks]=]  /root/repo/_warn_build/metrics_tests [==[--gtest_filter=MetricsTest.RecordsPhasesCountsAndPeaks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MetricsTest.RecordsPhasesCountsAndPeaks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MetricsTest.ScopedTimer]=]  /root/repo/_warn_build/metrics_tests [==[--gtest_filter=MetricsTest.ScopedTimer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MetricsTest.ScopedTimer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MetricsTest.Json]=]  /root/repo/_warn_build/metrics_tests [==[--gtest_filter=MetricsTest.Json]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MetricsTest.Json]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MetricsTest.ConcurrentRecords]=]  /root/repo/_warn_build/metrics_tests [==[--gtest_filter=MetricsTest.ConcurrentRecords]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MetricsTest.ConcurrentRecords]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MetricsTest.DuplicateFinder]=]  /root/repo/_warn_build/metrics_tests [==[--gtest_filter=MetricsTest.DuplicateFinder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MetricsTest.DuplicateFinder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MetricsTest.LatencyPercentiles]=]  /root/repo/_warn_build/metrics_tests [==[--gtest_filter=MetricsTest.LatencyPercentiles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MetricsTest.LatencyPercentiles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  metrics_tests_TESTS MetricsTest.RecordsPhasesCountsAndPeaks MetricsTest.ScopedTimer MetricsTest.Json MetricsTest.ConcurrentRecords MetricsTest.DuplicateFinder MetricsTest.LatencyPercentiles)
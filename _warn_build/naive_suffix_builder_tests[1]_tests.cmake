@@ -0,0 +1,51 @@
+add_test([=[NaiveSuffixBuilderTest.EmptyString]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.EmptyString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.EmptyString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.SingleCharacter]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.SingleCharacter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.SingleCharacter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.SimpleUniqueChars]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.SimpleUniqueChars]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.SimpleUniqueChars]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.RepeatingChars]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.RepeatingChars]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.RepeatingChars]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.BasicPattern]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.BasicPattern]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.BasicPattern]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.NonUniqueTerminator]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.NonUniqueTerminator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.NonUniqueTerminator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.GeorgianText]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.GeorgianText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.GeorgianText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.MixedASCIIAndUTF8]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.MixedASCIIAndUTF8]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.MixedASCIIAndUTF8]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.EmojiText]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.EmojiText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.EmojiText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.BananaTest]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.BananaTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.BananaTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.SimpleLCPTest]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.SimpleLCPTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.SimpleLCPTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.RepeatingPatternLCP]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.RepeatingPatternLCP]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.RepeatingPatternLCP]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.SpecialCharacters]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.SpecialCharacters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.SpecialCharacters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.FactoryCreationAndUsage]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.FactoryCreationAndUsage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.FactoryCreationAndUsage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.BuilderStateTransitions]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.BuilderStateTransitions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.BuilderStateTransitions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.SuffixArrayProperties]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.SuffixArrayProperties]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.SuffixArrayProperties]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.LCPArrayProperties]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.LCPArrayProperties]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.LCPArrayProperties]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.DepthLimitedBuild]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.DepthLimitedBuild]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.DepthLimitedBuild]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.DepthLimitedBuildFinishesEarly]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.DepthLimitedBuildFinishesEarly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.DepthLimitedBuildFinishesEarly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.ReusesWorkspaceAcrossBuilds]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.ReusesWorkspaceAcrossBuilds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.ReusesWorkspaceAcrossBuilds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.HugePagesGiveSameArrays]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.HugePagesGiveSameArrays]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.HugePagesGiveSameArrays]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NaiveSuffixBuilderTest.PackedInitialSortMatchesSAIS]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=NaiveSuffixBuilderTest.PackedInitialSortMatchesSAIS]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NaiveSuffixBuilderTest.PackedInitialSortMatchesSAIS]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SuffixWorkspaceTest.HugePageBuffers]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=SuffixWorkspaceTest.HugePageBuffers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SuffixWorkspaceTest.HugePageBuffers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SuffixWorkspaceTest.BuffersKeepCapacityAndWidth]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=SuffixWorkspaceTest.BuffersKeepCapacityAndWidth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SuffixWorkspaceTest.BuffersKeepCapacityAndWidth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SuffixWorkspaceTest.GrowingPastCapacityZeroesEntries]=]  /root/repo/_warn_build/naive_suffix_builder_tests [==[--gtest_filter=SuffixWorkspaceTest.GrowingPastCapacityZeroesEntries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SuffixWorkspaceTest.GrowingPastCapacityZeroesEntries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  naive_suffix_builder_tests_TESTS NaiveSuffixBuilderTest.EmptyString NaiveSuffixBuilderTest.SingleCharacter NaiveSuffixBuilderTest.SimpleUniqueChars NaiveSuffixBuilderTest.RepeatingChars NaiveSuffixBuilderTest.BasicPattern NaiveSuffixBuilderTest.NonUniqueTerminator NaiveSuffixBuilderTest.GeorgianText NaiveSuffixBuilderTest.MixedASCIIAndUTF8 NaiveSuffixBuilderTest.EmojiText NaiveSuffixBuilderTest.BananaTest NaiveSuffixBuilderTest.SimpleLCPTest NaiveSuffixBuilderTest.RepeatingPatternLCP NaiveSuffixBuilderTest.SpecialCharacters NaiveSuffixBuilderTest.FactoryCreationAndUsage NaiveSuffixBuilderTest.BuilderStateTransitions NaiveSuffixBuilderTest.SuffixArrayProperties NaiveSuffixBuilderTest.LCPArrayProperties NaiveSuffixBuilderTest.DepthLimitedBuild NaiveSuffixBuilderTest.DepthLimitedBuildFinishesEarly NaiveSuffixBuilderTest.ReusesWorkspaceAcrossBuilds NaiveSuffixBuilderTest.HugePagesGiveSameArrays NaiveSuffixBuilderTest.PackedInitialSortMatchesSAIS SuffixWorkspaceTest.HugePageBuffers SuffixWorkspaceTest.BuffersKeepCapacityAndWidth SuffixWorkspaceTest.GrowingPastCapacityZeroesEntries)
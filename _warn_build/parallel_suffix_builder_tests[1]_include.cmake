@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/parallel_suffix_builder_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/parallel_suffix_builder_tests[1]_tests.cmake")
+else()
+  add_test(parallel_suffix_builder_tests_NOT_BUILT parallel_suffix_builder_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,19 @@
+add_test([=[ParallelSuffixBuilderTest.EmptyString]=]  /root/repo/_warn_build/parallel_suffix_builder_tests [==[--gtest_filter=ParallelSuffixBuilderTest.EmptyString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParallelSuffixBuilderTest.EmptyString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParallelSuffixBuilderTest.BananaTest]=]  /root/repo/_warn_build/parallel_suffix_builder_tests [==[--gtest_filter=ParallelSuffixBuilderTest.BananaTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParallelSuffixBuilderTest.BananaTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParallelSuffixBuilderTest.FactoryCreation]=]  /root/repo/_warn_build/parallel_suffix_builder_tests [==[--gtest_filter=ParallelSuffixBuilderTest.FactoryCreation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParallelSuffixBuilderTest.FactoryCreation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParallelSuffixBuilderTest.MatchesNaiveOnSmallInputs]=]  /root/repo/_warn_build/parallel_suffix_builder_tests [==[--gtest_filter=ParallelSuffixBuilderTest.MatchesNaiveOnSmallInputs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParallelSuffixBuilderTest.MatchesNaiveOnSmallInputs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParallelSuffixBuilderTest.MatchesNaiveOnRandomText]=]  /root/repo/_warn_build/parallel_suffix_builder_tests [==[--gtest_filter=ParallelSuffixBuilderTest.MatchesNaiveOnRandomText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParallelSuffixBuilderTest.MatchesNaiveOnRandomText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParallelSuffixBuilderTest.MatchesNaiveOnLargeGroups]=]  /root/repo/_warn_build/parallel_suffix_builder_tests [==[--gtest_filter=ParallelSuffixBuilderTest.MatchesNaiveOnLargeGroups]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParallelSuffixBuilderTest.MatchesNaiveOnLargeGroups]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParallelLcpTest.MatchesKasai]=]  /root/repo/_warn_build/parallel_suffix_builder_tests [==[--gtest_filter=ParallelLcpTest.MatchesKasai]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParallelLcpTest.MatchesKasai]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParallelTest.ParallelForCoversRangeInChunks]=]  /root/repo/_warn_build/parallel_suffix_builder_tests [==[--gtest_filter=ParallelTest.ParallelForCoversRangeInChunks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParallelTest.ParallelForCoversRangeInChunks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParallelTest.ParallelSortMatchesSort]=]  /root/repo/_warn_build/parallel_suffix_builder_tests [==[--gtest_filter=ParallelTest.ParallelSortMatchesSort]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParallelTest.ParallelSortMatchesSort]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  parallel_suffix_builder_tests_TESTS ParallelSuffixBuilderTest.EmptyString ParallelSuffixBuilderTest.BananaTest ParallelSuffixBuilderTest.FactoryCreation ParallelSuffixBuilderTest.MatchesNaiveOnSmallInputs ParallelSuffixBuilderTest.MatchesNaiveOnRandomText ParallelSuffixBuilderTest.MatchesNaiveOnLargeGroups ParallelLcpTest.MatchesKasai ParallelTest.ParallelForCoversRangeInChunks ParallelTest.ParallelSortMatchesSort)
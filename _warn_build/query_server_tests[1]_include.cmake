@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/query_server_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/query_server_tests[1]_tests.cmake")
+else()
+  add_test(query_server_tests_NOT_BUILT query_server_tests_NOT_BUILT)
+endif()
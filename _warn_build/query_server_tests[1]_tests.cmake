@@ -0,0 +1,7 @@
+add_test([=[QueryServerTest.ParsesRequests]=]  /root/repo/_warn_build/query_server_tests [==[--gtest_filter=QueryServerTest.ParsesRequests]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[QueryServerTest.ParsesRequests]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[QueryServerTest.AnswersFromTheDomainsIndex]=]  /root/repo/_warn_build/query_server_tests [==[--gtest_filter=QueryServerTest.AnswersFromTheDomainsIndex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[QueryServerTest.AnswersFromTheDomainsIndex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[QueryServerTest.ServesLinesInBatches]=]  /root/repo/_warn_build/query_server_tests [==[--gtest_filter=QueryServerTest.ServesLinesInBatches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[QueryServerTest.ServesLinesInBatches]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  query_server_tests_TESTS QueryServerTest.ParsesRequests QueryServerTest.AnswersFromTheDomainsIndex QueryServerTest.ServesLinesInBatches)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/rank_bitvector_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/rank_bitvector_tests[1]_tests.cmake")
+else()
+  add_test(rank_bitvector_tests_NOT_BUILT rank_bitvector_tests_NOT_BUILT)
+endif()
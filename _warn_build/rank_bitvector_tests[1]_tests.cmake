@@ -0,0 +1,7 @@
+add_test([=[RankBitvectorTest.EmptyVector]=]  /root/repo/_warn_build/rank_bitvector_tests [==[--gtest_filter=RankBitvectorTest.EmptyVector]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RankBitvectorTest.EmptyVector]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RankBitvectorTest.PushAndRank]=]  /root/repo/_warn_build/rank_bitvector_tests [==[--gtest_filter=RankBitvectorTest.PushAndRank]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RankBitvectorTest.PushAndRank]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RankBitvectorTest.MatchesPrefixCountsAcrossBlocks]=]  /root/repo/_warn_build/rank_bitvector_tests [==[--gtest_filter=RankBitvectorTest.MatchesPrefixCountsAcrossBlocks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RankBitvectorTest.MatchesPrefixCountsAcrossBlocks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  rank_bitvector_tests_TESTS RankBitvectorTest.EmptyVector RankBitvectorTest.PushAndRank RankBitvectorTest.MatchesPrefixCountsAcrossBlocks)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/sais_suffix_builder_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/sais_suffix_builder_tests[1]_tests.cmake")
+else()
+  add_test(sais_suffix_builder_tests_NOT_BUILT sais_suffix_builder_tests_NOT_BUILT)
+endif()
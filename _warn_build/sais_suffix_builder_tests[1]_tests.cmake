@@ -0,0 +1,21 @@
+add_test([=[SAISSuffixBuilderTest.EmptyString]=]  /root/repo/_warn_build/sais_suffix_builder_tests [==[--gtest_filter=SAISSuffixBuilderTest.EmptyString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SAISSuffixBuilderTest.EmptyString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SAISSuffixBuilderTest.SingleCharacter]=]  /root/repo/_warn_build/sais_suffix_builder_tests [==[--gtest_filter=SAISSuffixBuilderTest.SingleCharacter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SAISSuffixBuilderTest.SingleCharacter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SAISSuffixBuilderTest.RepeatingChars]=]  /root/repo/_warn_build/sais_suffix_builder_tests [==[--gtest_filter=SAISSuffixBuilderTest.RepeatingChars]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SAISSuffixBuilderTest.RepeatingChars]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SAISSuffixBuilderTest.BananaTest]=]  /root/repo/_warn_build/sais_suffix_builder_tests [==[--gtest_filter=SAISSuffixBuilderTest.BananaTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SAISSuffixBuilderTest.BananaTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SAISSuffixBuilderTest.GeorgianText]=]  /root/repo/_warn_build/sais_suffix_builder_tests [==[--gtest_filter=SAISSuffixBuilderTest.GeorgianText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SAISSuffixBuilderTest.GeorgianText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SAISSuffixBuilderTest.SimpleLCPTest]=]  /root/repo/_warn_build/sais_suffix_builder_tests [==[--gtest_filter=SAISSuffixBuilderTest.SimpleLCPTest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SAISSuffixBuilderTest.SimpleLCPTest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SAISSuffixBuilderTest.FactoryCreation]=]  /root/repo/_warn_build/sais_suffix_builder_tests [==[--gtest_filter=SAISSuffixBuilderTest.FactoryCreation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SAISSuffixBuilderTest.FactoryCreation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SAISSuffixBuilderTest.BuilderStateTransitions]=]  /root/repo/_warn_build/sais_suffix_builder_tests [==[--gtest_filter=SAISSuffixBuilderTest.BuilderStateTransitions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SAISSuffixBuilderTest.BuilderStateTransitions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SAISSuffixBuilderTest.MatchesNaiveOnDocumentLikeText]=]  /root/repo/_warn_build/sais_suffix_builder_tests [==[--gtest_filter=SAISSuffixBuilderTest.MatchesNaiveOnDocumentLikeText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SAISSuffixBuilderTest.MatchesNaiveOnDocumentLikeText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SAISSuffixBuilderTest.MatchesNaiveOnRandomText]=]  /root/repo/_warn_build/sais_suffix_builder_tests [==[--gtest_filter=SAISSuffixBuilderTest.MatchesNaiveOnRandomText]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SAISSuffixBuilderTest.MatchesNaiveOnRandomText]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  sais_suffix_builder_tests_TESTS SAISSuffixBuilderTest.EmptyString SAISSuffixBuilderTest.SingleCharacter SAISSuffixBuilderTest.RepeatingChars SAISSuffixBuilderTest.BananaTest SAISSuffixBuilderTest.GeorgianText SAISSuffixBuilderTest.SimpleLCPTest SAISSuffixBuilderTest.FactoryCreation SAISSuffixBuilderTest.BuilderStateTransitions SAISSuffixBuilderTest.MatchesNaiveOnDocumentLikeText SAISSuffixBuilderTest.MatchesNaiveOnRandomText)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/sql_handler[1]_tests.cmake")
+  include("/root/repo/_warn_build/sql_handler[1]_tests.cmake")
+else()
+  add_test(sql_handler_NOT_BUILT sql_handler_NOT_BUILT)
+endif()
@@ -0,0 +1,47 @@
+add_test([=[SQLiteHandlerTest.CreateDocumentStore]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.CreateDocumentStore]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.CreateDocumentStore]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.FilterByOtherColumn]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.FilterByOtherColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.FilterByOtherColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.UTF8ContentFromParquet]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.UTF8ContentFromParquet]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.UTF8ContentFromParquet]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.EmptyFilterResult]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.EmptyFilterResult]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.EmptyFilterResult]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.ValidTableAndColumns]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.ValidTableAndColumns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.ValidTableAndColumns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.InvalidTableName]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.InvalidTableName]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.InvalidTableName]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.InvalidColumnName]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.InvalidColumnName]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.InvalidColumnName]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.MalformedTableName]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.MalformedTableName]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.MalformedTableName]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.MalformedColumnNames]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.MalformedColumnNames]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.MalformedColumnNames]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.MoveConstructor]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.MoveConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.MoveConstructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.MoveAssignment]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.MoveAssignment]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.MoveAssignment]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.UpdateRow]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.UpdateRow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.UpdateRow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.UpdateRows]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.UpdateRows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.UpdateRows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.UpdateRowsRollsBackFailedBatch]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.UpdateRowsRollsBackFailedBatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.UpdateRowsRollsBackFailedBatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.EnableWriteAheadLog]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.EnableWriteAheadLog]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.EnableWriteAheadLog]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.ListFilterGroups]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.ListFilterGroups]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.ListFilterGroups]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.LoadDocumentStoreReusesStore]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.LoadDocumentStoreReusesStore]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.LoadDocumentStoreReusesStore]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.LoadDocumentStoreMetrics]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.LoadDocumentStoreMetrics]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.LoadDocumentStoreMetrics]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.LoadDocumentStoreAfterRowid]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.LoadDocumentStoreAfterRowid]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.LoadDocumentStoreAfterRowid]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.StatementsAreCached]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.StatementsAreCached]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.StatementsAreCached]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SQLiteHandlerTest.BulkReadProfile]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=SQLiteHandlerTest.BulkReadProfile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SQLiteHandlerTest.BulkReadProfile]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PipelinedLoadTest.MatchesSequentialLoad]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=PipelinedLoadTest.MatchesSequentialLoad]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PipelinedLoadTest.MatchesSequentialLoad]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PipelinedLoadTest.InvalidContentThrows]=]  /root/repo/_warn_build/sql_handler [==[--gtest_filter=PipelinedLoadTest.InvalidContentThrows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PipelinedLoadTest.InvalidContentThrows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  sql_handler_TESTS SQLiteHandlerTest.CreateDocumentStore SQLiteHandlerTest.FilterByOtherColumn SQLiteHandlerTest.UTF8ContentFromParquet SQLiteHandlerTest.EmptyFilterResult SQLiteHandlerTest.ValidTableAndColumns SQLiteHandlerTest.InvalidTableName SQLiteHandlerTest.InvalidColumnName SQLiteHandlerTest.MalformedTableName SQLiteHandlerTest.MalformedColumnNames SQLiteHandlerTest.MoveConstructor SQLiteHandlerTest.MoveAssignment SQLiteHandlerTest.UpdateRow SQLiteHandlerTest.UpdateRows SQLiteHandlerTest.UpdateRowsRollsBackFailedBatch SQLiteHandlerTest.EnableWriteAheadLog SQLiteHandlerTest.ListFilterGroups SQLiteHandlerTest.LoadDocumentStoreReusesStore SQLiteHandlerTest.LoadDocumentStoreMetrics SQLiteHandlerTest.LoadDocumentStoreAfterRowid SQLiteHandlerTest.StatementsAreCached SQLiteHandlerTest.BulkReadProfile PipelinedLoadTest.MatchesSequentialLoad PipelinedLoadTest.InvalidContentThrows)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_warn_build/utf8_tests[1]_tests.cmake")
+  include("/root/repo/_warn_build/utf8_tests[1]_tests.cmake")
+else()
+  add_test(utf8_tests_NOT_BUILT utf8_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,65 @@
+add_test([=[UTF8BasicTest.BasicSetup]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8BasicTest.BasicSetup]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8BasicTest.BasicSetup]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.Construction]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.Construction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.Construction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.InvalidUTF8]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.InvalidUTF8]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.InvalidUTF8]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.CharacterAccess]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.CharacterAccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.CharacterAccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.Iteration]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.Iteration]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.Iteration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.Substring]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.Substring]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.Substring]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.CharacterComparison]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.CharacterComparison]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.CharacterComparison]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.CharacterComparisonBetweenCodes]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.CharacterComparisonBetweenCodes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.CharacterComparisonBetweenCodes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.StringComparison]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.StringComparison]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.StringComparison]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.StringComparisonBetweenCodes]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.StringComparisonBetweenCodes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.StringComparisonBetweenCodes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.EmojiHandling]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.EmojiHandling]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.EmojiHandling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.EmptyString]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.EmptyString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.EmptyString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.Concatenation]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.Concatenation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.Concatenation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.BasicAppend]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.BasicAppend]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.BasicAppend]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.EmptyStrings]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.EmptyStrings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.EmptyStrings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.UTF8Characters]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.UTF8Characters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.UTF8Characters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.ChainedOperations]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.ChainedOperations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.ChainedOperations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.MixedCharacterSets]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.MixedCharacterSets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.MixedCharacterSets]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.LargeStrings]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.LargeStrings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.LargeStrings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.StdStringAppend]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.StdStringAppend]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.StdStringAppend]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.SelfAppend]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.SelfAppend]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.SelfAppend]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.MultipleAppends]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.MultipleAppends]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.MultipleAppends]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.StringBoundaries]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.StringBoundaries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.StringBoundaries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.SampledIndexAcrossBlocks]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.SampledIndexAcrossBlocks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.SampledIndexAcrossBlocks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.AsciiStringsKeepNoIndex]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.AsciiStringsKeepNoIndex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.AsciiStringsKeepNoIndex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.AppendIntoPartialBlock]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.AppendIntoPartialBlock]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.AppendIntoPartialBlock]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.CharIndexInvertsByteOffset]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.CharIndexInvertsByteOffset]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.CharIndexInvertsByteOffset]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.AsciiRunsBetweenMultiByteCharacters]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.AsciiRunsBetweenMultiByteCharacters]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.AsciiRunsBetweenMultiByteCharacters]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.InvalidByteAfterAsciiRun]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.InvalidByteAfterAsciiRun]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.InvalidByteAfterAsciiRun]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.AppendBytes]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.AppendBytes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.AppendBytes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.KernelsAgreeWithScalar]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.KernelsAgreeWithScalar]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.KernelsAgreeWithScalar]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UTF8StringTest.IsValidRejectsWhatConstructorsReject]=]  /root/repo/_warn_build/utf8_tests [==[--gtest_filter=UTF8StringTest.IsValidRejectsWhatConstructorsReject]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UTF8StringTest.IsValidRejectsWhatConstructorsReject]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_warn_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  utf8_tests_TESTS UTF8BasicTest.BasicSetup UTF8StringTest.Construction UTF8StringTest.InvalidUTF8 UTF8StringTest.CharacterAccess UTF8StringTest.Iteration UTF8StringTest.Substring UTF8StringTest.CharacterComparison UTF8StringTest.CharacterComparisonBetweenCodes UTF8StringTest.StringComparison UTF8StringTest.StringComparisonBetweenCodes UTF8StringTest.EmojiHandling UTF8StringTest.EmptyString UTF8StringTest.Concatenation UTF8StringTest.BasicAppend UTF8StringTest.EmptyStrings UTF8StringTest.UTF8Characters UTF8StringTest.ChainedOperations UTF8StringTest.MixedCharacterSets UTF8StringTest.LargeStrings UTF8StringTest.StdStringAppend UTF8StringTest.SelfAppend UTF8StringTest.MultipleAppends UTF8StringTest.StringBoundaries UTF8StringTest.SampledIndexAcrossBlocks UTF8StringTest.AsciiStringsKeepNoIndex UTF8StringTest.AppendIntoPartialBlock UTF8StringTest.CharIndexInvertsByteOffset UTF8StringTest.AsciiRunsBetweenMultiByteCharacters UTF8StringTest.InvalidByteAfterAsciiRun UTF8StringTest.AppendBytes UTF8StringTest.KernelsAgreeWithScalar UTF8StringTest.IsValidRejectsWhatConstructorsReject)
@@ -0,0 +1,80 @@
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "bench_support.hpp"
+
+using namespace text_processing::bench;
+
+namespace {
+    void print_corpus_usage() {
+        std::cerr << "Corpus options, before or among the --benchmark_* flags:" << std::endl;
+        std::cerr << "  --corpus_mib=<n>: Content size per alphabet (default 2)" << std::endl;
+        std::cerr << "  --alphabet=<list>: Comma-separated alphabets: ascii, georgian, mixed (default all)" << std::endl;
+        std::cerr << "  --duplication=<share>: Share of text copied from earlier documents (default 0.3)" << std::endl;
+        std::cerr << "  --doc_length=<n>: Mean document length in characters (default 2000)" << std::endl;
+        std::cerr << "  --lengths=<distribution>: fixed, uniform or lognormal (default)" << std::endl;
+        std::cerr << "  --seed=<n>: Random seed (default 42)" << std::endl;
+    }
+
+    // The value of --name=value, or nullptr for other arguments
+    const char *flag_value(const char *arg, const char *name) {
+        const size_t length = std::strlen(name);
+        if (std::strncmp(arg, name, length) == 0 && arg[length] == '=') return arg + length + 1;
+        return nullptr;
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    CorpusOptions &options = corpus_options();
+    std::vector<Alphabet> alphabets = {Alphabet::ASCII, Alphabet::GEORGIAN, Alphabet::MIXED};
+
+    // Take the corpus flags out, the rest goes to Google Benchmark
+    std::vector<char *> rest = {argv[0]};
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const char *arg = argv[i];
+            if (const char *value = flag_value(arg, "--corpus_mib")) {
+                options.bytes = static_cast<size_t>(std::stod(value) * (1 << 20));
+            } else if (const char *value = flag_value(arg, "--alphabet")) {
+                alphabets.clear();
+                std::string list = value;
+                for (size_t begin = 0; begin <= list.size();) {
+                    size_t end = list.find(',', begin);
+                    if (end == std::string::npos) end = list.size();
+                    if (end > begin) alphabets.push_back(alphabet_from_string(list.substr(begin, end - begin)));
+                    begin = end + 1;
+                }
+            } else if (const char *value = flag_value(arg, "--duplication")) {
+                options.duplication = std::stod(value);
+            } else if (const char *value = flag_value(arg, "--doc_length")) {
+                options.doc_length = std::stoull(value);
+            } else if (const char *value = flag_value(arg, "--lengths")) {
+                options.lengths = lengths_from_string(value);
+            } else if (const char *value = flag_value(arg, "--seed")) {
+                options.seed = static_cast<uint32_t>(std::stoul(value));
+            } else {
+                if (std::strcmp(arg, "--help") == 0) print_corpus_usage();
+                rest.push_back(argv[i]);
+            }
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        print_corpus_usage();
+        return 1;
+    }
+
+    register_text_benchmarks(alphabets);
+    register_pipeline_benchmarks(alphabets);
+
+    int rest_count = static_cast<int>(rest.size());
+    benchmark::Initialize(&rest_count, rest.data());
+    if (benchmark::ReportUnrecognizedArguments(rest_count, rest.data())) return 1;
+    benchmark::AddCustomContext("corpus_mib", std::to_string(static_cast<double>(options.bytes) / (1 << 20)));
+    benchmark::AddCustomContext("duplication", std::to_string(options.duplication));
+    benchmark::AddCustomContext("doc_length", std::to_string(options.doc_length));
+    benchmark::AddCustomContext("seed", std::to_string(options.seed));
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
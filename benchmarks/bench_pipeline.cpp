@@ -0,0 +1,103 @@
+#include <filesystem>
+#include <map>
+#include <unistd.h>
+#include "bench_support.hpp"
+#include "data/match_writer.hpp"
+#include "sql/sql_handler.hpp"
+#include "text_processing/duplicate_finder.hpp"
+#include "text_processing/index_file.hpp"
+
+namespace text_processing::bench {
+    namespace {
+        constexpr size_t MIN_LENGTH = 50;
+
+        std::string temp_file(const std::string &name) {
+            return (std::filesystem::temp_directory_path() /
+                    ("dupfind_bench_" + std::to_string(getpid()) + "_" + name)).string();
+        }
+
+        // Building and scanning, as a run of main does after loading
+        void find_duplicates(benchmark::State &state, Alphabet alphabet, SuffixArrayBuilder::BuilderType type) {
+            const Corpus &input = corpus(alphabet);
+            FinderOptions options;
+            options.builder_type = type;
+            options.threads = static_cast<size_t>(state.range(0));
+            DuplicateFinder finder(options);
+            MemoryWatch memory;
+            size_t matches = 0;
+            for (auto _: state) {
+                matches = finder.find_duplicates(input.store, MIN_LENGTH).size();
+            }
+            report(state, input.bytes, memory);
+            state.counters["matches"] = static_cast<double>(matches);
+        }
+
+        // Only the scan of the adjacent suffixes, over arrays built beforehand and mapped from an index file
+        void scan_matches(benchmark::State &state, Alphabet alphabet) {
+            const Corpus &input = corpus(alphabet);
+            const std::string path = temp_file(to_string(alphabet) + ".idx");
+            DuplicateFinder finder(SuffixArrayBuilder::BuilderType::SAIS, static_cast<size_t>(state.range(0)));
+            finder.build_index(input.store, path);
+            {
+                IndexFile index(path);
+                MemoryWatch memory;
+                for (auto _: state) {
+                    benchmark::DoNotOptimize(finder.find_duplicates(index, MIN_LENGTH).size());
+                }
+                report(state, input.bytes, memory);
+            }
+            std::filesystem::remove(path);
+        }
+
+        void load_store(benchmark::State &state, Alphabet alphabet) {
+            const std::string &db = corpus_database(alphabet);
+            SQLiteHandler sql(db, false, ConnectionProfile::BULK_READ);
+            DocumentStore store{UTF8String("\x01")};
+            MemoryWatch memory;
+            for (auto _: state) {
+                sql.loadDocumentStore(store, "data_table", "domains", "doc_content", "bench.com",
+                                      static_cast<size_t>(state.range(0)));
+                benchmark::DoNotOptimize(store.document_count());
+            }
+            report(state, corpus(alphabet).bytes, memory);
+        }
+
+        void save(benchmark::State &state, Alphabet alphabet, MatchWriter::Format format) {
+            static std::map<Alphabet, std::vector<Match>> found;
+            auto &matches = found[alphabet];
+            if (matches.empty()) {
+                matches = DuplicateFinder(SuffixArrayBuilder::BuilderType::SAIS).find_duplicates(corpus(alphabet).store, MIN_LENGTH);
+            }
+            const std::string path = temp_file("matches" + MatchWriter::extension(format));
+            MemoryWatch memory;
+            for (auto _: state) {
+                save_matches(matches, path, format);
+            }
+            const size_t bytes = std::filesystem::file_size(path);
+            std::filesystem::remove(path);
+            report(state, bytes, memory);
+            state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * matches.size()));
+        }
+    } // namespace
+
+    void register_pipeline_benchmarks(const std::vector<Alphabet> &alphabets) {
+        for (Alphabet alphabet: alphabets) {
+            const std::string suffix = "/" + to_string(alphabet);
+            for (const char *name: {"sais", "byte", "parallel"}) {
+                const auto type = SuffixArrayBuilder::type_from_string(name);
+                benchmark::RegisterBenchmark(("FindDuplicates/" + std::string(name) + suffix).c_str(),
+                                             find_duplicates, alphabet, type)
+                    ->Unit(benchmark::kMillisecond)->UseRealTime()->ArgName("threads")->Arg(1)->Arg(4);
+            }
+            benchmark::RegisterBenchmark(("ScanMatches" + suffix).c_str(), scan_matches, alphabet)
+                ->Unit(benchmark::kMillisecond)->UseRealTime()->ArgName("threads")->Arg(1)->Arg(4);
+            benchmark::RegisterBenchmark(("CreateDocumentStore" + suffix).c_str(), load_store, alphabet)
+                ->Unit(benchmark::kMillisecond)->UseRealTime()->ArgName("threads")->Arg(1)->Arg(4);
+            for (auto format: {MatchWriter::Format::JSON, MatchWriter::Format::NDJSON, MatchWriter::Format::BINARY}) {
+                const std::string name = MatchWriter::extension(format).substr(1);
+                benchmark::RegisterBenchmark(("SaveMatches/" + name + suffix).c_str(), save, alphabet, format)
+                    ->Unit(benchmark::kMillisecond)->UseRealTime();
+            }
+        }
+    }
+} // namespace text_processing::bench
@@ -0,0 +1,105 @@
+#include "bench_support.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <sqlite3.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+namespace text_processing::bench {
+    CorpusOptions &corpus_options() {
+        static CorpusOptions options;
+        return options;
+    }
+
+    const Corpus &corpus(Alphabet alphabet) {
+        static std::map<Alphabet, std::unique_ptr<Corpus>> corpora;
+        auto &entry = corpora[alphabet];
+        if (!entry) {
+            CorpusOptions options = corpus_options();
+            options.alphabet = alphabet;
+            entry = std::make_unique<Corpus>();
+            entry->documents = generate_corpus(options);
+            for (size_t i = 0; i < entry->documents.size(); ++i) {
+                entry->store.add_document(UTF8String(entry->documents[i]), static_cast<int64_t>(i + 1));
+                entry->bytes += entry->documents[i].size();
+            }
+        }
+        return *entry;
+    }
+
+    const std::string &corpus_database(Alphabet alphabet) {
+        static std::map<Alphabet, std::string> paths;
+        auto &path = paths[alphabet];
+        if (!path.empty()) return path;
+
+        const std::string name = "dupfind_bench_" + std::to_string(getpid()) + "_" + to_string(alphabet) + ".db";
+        const std::string file = (std::filesystem::temp_directory_path() / name).string();
+        std::filesystem::remove(file);
+        sqlite3 *db = nullptr;
+        if (sqlite3_open(file.c_str(), &db) != SQLITE_OK) {
+            sqlite3_close(db);
+            throw std::runtime_error("Unable to create " + file);
+        }
+        sqlite3_exec(db, "CREATE TABLE data_table (domains TEXT, doc_content TEXT); BEGIN", nullptr, nullptr, nullptr);
+        sqlite3_stmt *stmt = nullptr;
+        sqlite3_prepare_v2(db, "INSERT INTO data_table VALUES ('bench.com', ?1)", -1, &stmt, nullptr);
+        for (const auto &doc: corpus(alphabet).documents) {
+            sqlite3_bind_text(stmt, 1, doc.data(), static_cast<int>(doc.size()), SQLITE_STATIC);
+            sqlite3_step(stmt);
+            sqlite3_reset(stmt);
+        }
+        sqlite3_finalize(stmt);
+        sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr);
+        sqlite3_close(db);
+
+        // Removed when the process exits
+        static struct Cleanup {
+            ~Cleanup() {
+                for (const auto &[alphabet, path]: paths) std::filesystem::remove(path);
+            }
+        } cleanup;
+        path = file;
+        return path;
+    }
+
+    namespace {
+        // A field of /proc/self/status in MiB, or -1 if missing
+        double status_mib(const std::string &field) {
+            std::ifstream status("/proc/self/status");
+            std::string line;
+            while (std::getline(status, line)) {
+                if (line.rfind(field, 0) == 0) {
+                    return std::stod(line.substr(field.size())) / 1024.0;
+                }
+            }
+            return -1;
+        }
+    } // namespace
+
+    MemoryWatch::MemoryWatch() {
+        // "5" resets VmHWM (Linux 4.0+), elsewhere the peak is that of the whole process
+        std::ofstream clear("/proc/self/clear_refs");
+        if (clear) clear << "5";
+        clear.close();
+        start_ = std::max(status_mib("VmRSS:"), 0.0);
+    }
+
+    double MemoryWatch::peak() const {
+        const double peak = status_mib("VmHWM:");
+        if (peak >= 0) return peak;
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return static_cast<double>(usage.ru_maxrss) / 1024.0;
+    }
+
+    void report(benchmark::State &state, size_t bytes, const MemoryWatch &memory) {
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+        state.counters["input_MiB"] = static_cast<double>(bytes) / (1 << 20);
+        state.counters["peak_rss_MiB"] = memory.peak();
+        state.counters["rss_growth_MiB"] = memory.growth();
+    }
+} // namespace text_processing::bench
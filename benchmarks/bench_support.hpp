@@ -0,0 +1,70 @@
+#ifndef BENCHMARKS_BENCH_SUPPORT_HPP
+#define BENCHMARKS_BENCH_SUPPORT_HPP
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "corpus_generator.hpp"
+#include "data/document_store.hpp"
+
+namespace text_processing::bench {
+    /**
+     * @brief Generated documents with their store, built once per alphabet
+     */
+    struct Corpus {
+        std::vector<std::string> documents;
+        DocumentStore store{UTF8String("\x01")};
+        size_t bytes = 0; ///< Content bytes, the throughput unit
+    };
+
+    /**
+     * @brief Settings of every corpus, set from the command line before the benchmarks run
+     */
+    CorpusOptions &corpus_options();
+
+    /**
+     * @brief Corpus of the current settings for an alphabet, generated on first use
+     */
+    const Corpus &corpus(Alphabet alphabet);
+
+    /**
+     * @brief SQLite file holding a corpus in data_table(domains, doc_content), written on first use
+     */
+    const std::string &corpus_database(Alphabet alphabet);
+
+    /**
+     * @brief Peak resident set size from construction on
+     *
+     * Resets the kernel's high-water mark (Linux), so earlier benchmarks do
+     * not count. The corpora already generated stay resident and are part of
+     * the peak, growth() excludes them.
+     */
+    class MemoryWatch {
+    public:
+        MemoryWatch();
+
+        /**
+         * @brief Peak resident set size in MiB
+         */
+        [[nodiscard]] double peak() const;
+
+        /**
+         * @brief Peak minus the resident set size at construction, in MiB
+         */
+        [[nodiscard]] double growth() const { return peak() - start_; }
+
+    private:
+        double start_;
+    };
+
+    /**
+     * @brief Report bytes per iteration as throughput, and the memory of the benchmark
+     */
+    void report(benchmark::State &state, size_t bytes, const MemoryWatch &memory);
+
+    void register_text_benchmarks(const std::vector<Alphabet> &alphabets);
+    void register_pipeline_benchmarks(const std::vector<Alphabet> &alphabets);
+} // namespace text_processing::bench
+
+#endif //BENCHMARKS_BENCH_SUPPORT_HPP
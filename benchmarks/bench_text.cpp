@@ -0,0 +1,120 @@
+#include <random>
+#include "bench_support.hpp"
+#include "text_processing/suffix_array_builder.hpp"
+#include "text_processing/utf8_handler.hpp"
+
+namespace text_processing::bench {
+    namespace {
+        // Validating and indexing the concatenated text, as the store does while loading
+        void utf8_construct(benchmark::State &state, Alphabet alphabet) {
+            const std::string &text = corpus(alphabet).store.get_concatenated_text().str();
+            MemoryWatch memory;
+            for (auto _: state) {
+                UTF8String string(text);
+                benchmark::DoNotOptimize(string.length());
+            }
+            report(state, text.size(), memory);
+        }
+
+        // One kernel on its own, validating or counting without building an index
+        template<typename Fn>
+        void utf8_scan(benchmark::State &state, Alphabet alphabet, UTF8String::Kernel kernel, Fn scan) {
+            const std::string &text = corpus(alphabet).store.get_concatenated_text().str();
+            const UTF8String::Kernel original = UTF8String::kernel();
+            UTF8String::set_kernel(kernel);
+            MemoryWatch memory;
+            for (auto _: state) {
+                benchmark::DoNotOptimize(scan(text));
+            }
+            UTF8String::set_kernel(original);
+            report(state, text.size(), memory);
+        }
+
+        void utf8_construct_with(benchmark::State &state, Alphabet alphabet, UTF8String::Kernel kernel) {
+            utf8_scan(state, alphabet, kernel, [](const std::string &text) { return UTF8String(text).length(); });
+        }
+
+        void utf8_validate(benchmark::State &state, Alphabet alphabet, UTF8String::Kernel kernel) {
+            utf8_scan(state, alphabet, kernel, [](const std::string &text) { return UTF8String::is_valid(text); });
+        }
+
+        void utf8_count(benchmark::State &state, Alphabet alphabet, UTF8String::Kernel kernel) {
+            utf8_scan(state, alphabet, kernel,
+                      [](const std::string &text) { return UTF8String::count_characters(text); });
+        }
+
+        std::string to_string(UTF8String::Kernel kernel) {
+            switch (kernel) {
+                case UTF8String::Kernel::SCALAR: return "scalar";
+                case UTF8String::Kernel::SSSE3: return "ssse3";
+                case UTF8String::Kernel::AVX2: return "avx2";
+                case UTF8String::Kernel::NEON: return "neon";
+            }
+            return "unknown";
+        }
+
+        // Character to byte lookups at random positions, e.g. to cut matches out of documents
+        void utf8_index(benchmark::State &state, Alphabet alphabet) {
+            const UTF8String &text = corpus(alphabet).store.get_concatenated_text();
+            std::mt19937 rng(1);
+            std::vector<size_t> positions(1 << 16);
+            for (auto &pos: positions) pos = rng() % text.length();
+            MemoryWatch memory;
+            for (auto _: state) {
+                size_t sum = 0;
+                for (size_t pos: positions) sum += text.byte_offset(pos);
+                benchmark::DoNotOptimize(sum);
+            }
+            state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * positions.size()));
+            state.counters["peak_rss_MiB"] = memory.peak();
+        }
+
+        void build(benchmark::State &state, Alphabet alphabet, SuffixArrayBuilder::BuilderType type) {
+            const Corpus &input = corpus(alphabet);
+            SuffixArrayBuilder::Options options;
+            options.threads = static_cast<size_t>(state.range(0));
+            MemoryWatch memory;
+            for (auto _: state) {
+                auto builder = SuffixArrayBuilder::create(type, options);
+                if (!builder->build(input.store.get_concatenated_text())) {
+                    state.SkipWithError("Build failed");
+                    return;
+                }
+                benchmark::DoNotOptimize(builder->suffix_count());
+            }
+            report(state, input.bytes, memory);
+        }
+    } // namespace
+
+    void register_text_benchmarks(const std::vector<Alphabet> &alphabets) {
+        for (Alphabet alphabet: alphabets) {
+            const std::string suffix = "/" + to_string(alphabet);
+            benchmark::RegisterBenchmark(("UTF8String/construct" + suffix).c_str(), utf8_construct, alphabet)
+                ->Unit(benchmark::kMillisecond);
+            benchmark::RegisterBenchmark(("UTF8String/byte_offset" + suffix).c_str(), utf8_index, alphabet);
+
+            // Every kernel the CPU supports, to compare them on multi-byte text
+            const UTF8String::Kernel selected = UTF8String::kernel();
+            for (auto kernel: {UTF8String::Kernel::SCALAR, UTF8String::Kernel::SSSE3, UTF8String::Kernel::AVX2,
+                               UTF8String::Kernel::NEON}) {
+                if (!UTF8String::set_kernel(kernel)) continue;
+                const std::string name = "/" + to_string(kernel) + suffix;
+                benchmark::RegisterBenchmark(("UTF8String/construct" + name).c_str(), utf8_construct_with, alphabet,
+                                             kernel)->Unit(benchmark::kMillisecond);
+                benchmark::RegisterBenchmark(("UTF8String/validate" + name).c_str(), utf8_validate, alphabet, kernel)
+                    ->Unit(benchmark::kMillisecond);
+                benchmark::RegisterBenchmark(("UTF8String/count" + name).c_str(), utf8_count, alphabet, kernel)
+                    ->Unit(benchmark::kMillisecond);
+            }
+            UTF8String::set_kernel(selected);
+
+            for (const char *name: {"naive", "sais", "byte", "parallel", "external"}) {
+                const auto type = SuffixArrayBuilder::type_from_string(name);
+                auto *bench = benchmark::RegisterBenchmark(("SuffixArrayBuilder/" + std::string(name) + suffix).c_str(),
+                                                           build, alphabet, type);
+                bench->Unit(benchmark::kMillisecond)->UseRealTime()->ArgName("threads")->Arg(1);
+                if (type == SuffixArrayBuilder::BuilderType::PARALLEL) bench->Arg(4);
+            }
+        }
+    }
+} // namespace text_processing::bench
@@ -0,0 +1,141 @@
+#include "corpus_generator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+namespace text_processing::bench {
+    namespace {
+        constexpr size_t VOCABULARY_SIZE = 5000;
+
+        // U+10D0 to U+10F0, the 33 letters of Mkhedruli
+        std::string georgian_letter(uint32_t index) {
+            const uint32_t code = 0x10D0 + index;
+            return {
+                static_cast<char>(0xE0 | code >> 12),
+                static_cast<char>(0x80 | (code >> 6 & 0x3F)),
+                static_cast<char>(0x80 | (code & 0x3F))
+            };
+        }
+
+        std::vector<std::string> make_vocabulary(Alphabet alphabet, std::mt19937 &rng) {
+            std::vector<std::string> words;
+            words.reserve(VOCABULARY_SIZE);
+            for (size_t i = 0; i < VOCABULARY_SIZE; ++i) {
+                const bool georgian = alphabet == Alphabet::GEORGIAN || (alphabet == Alphabet::MIXED && rng() % 2);
+                const size_t letters = 2 + rng() % 8;
+                std::string word;
+                for (size_t l = 0; l < letters; ++l) {
+                    if (georgian) {
+                        word += georgian_letter(rng() % 33);
+                    } else {
+                        word += static_cast<char>('a' + rng() % 26);
+                    }
+                }
+                words.push_back(std::move(word));
+            }
+            return words;
+        }
+
+        size_t char_count(const std::string &text) {
+            return static_cast<size_t>(std::count_if(text.begin(), text.end(), [](char c) {
+                return (static_cast<unsigned char>(c) & 0xC0) != 0x80;
+            }));
+        }
+
+        bool is_continuation(const std::string &text, size_t byte) {
+            return byte < text.size() && (static_cast<unsigned char>(text[byte]) & 0xC0) == 0x80;
+        }
+    } // namespace
+
+    std::vector<std::string> generate_corpus(const CorpusOptions &options) {
+        std::mt19937 rng(options.seed);
+        const auto words = make_vocabulary(options.alphabet, rng);
+        // Squaring a uniform draw favours the first words, a rough Zipf curve
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        auto next_word = [&]() -> const std::string & {
+            const double u = unit(rng);
+            return words[static_cast<size_t>(u * u * (words.size() - 1))];
+        };
+
+        const double mean = static_cast<double>(std::max<size_t>(options.doc_length, 1));
+        // sigma 1 gives a long tail; mu keeps the mean at doc_length
+        std::lognormal_distribution<double> lognormal(std::log(mean) - 0.5, 1.0);
+        std::uniform_real_distribution<double> uniform(0.0, 2.0 * mean);
+        auto next_length = [&]() {
+            switch (options.lengths) {
+                case LengthDistribution::FIXED:
+                    return static_cast<size_t>(mean);
+                case LengthDistribution::UNIFORM:
+                    return static_cast<size_t>(uniform(rng)) + 1;
+                default:
+                    return static_cast<size_t>(lognormal(rng)) + 1;
+            }
+        };
+        const size_t passage = std::max<size_t>(options.passage_length, 1);
+
+        std::vector<std::string> documents;
+        size_t total = 0;
+        while (total < options.bytes) {
+            const size_t length = next_length();
+            std::string doc;
+            size_t chars = 0;
+            while (chars < length) {
+                const size_t want = std::min(length - chars, passage / 2 + rng() % passage + 1);
+                if (!documents.empty() && unit(rng) < options.duplication) {
+                    // Copy about want characters of an earlier document, on character boundaries
+                    const std::string &source = documents[rng() % documents.size()];
+                    size_t begin = rng() % source.size();
+                    while (is_continuation(source, begin)) --begin;
+                    size_t end = begin;
+                    size_t copied = 0;
+                    while (end < source.size() && copied < want) {
+                        ++end;
+                        while (is_continuation(source, end)) ++end;
+                        ++copied;
+                    }
+                    doc.append(source, begin, end - begin);
+                    chars += copied;
+                } else {
+                    size_t added = 0;
+                    while (added < want) {
+                        const std::string &word = next_word();
+                        doc += word;
+                        doc += ' ';
+                        added += char_count(word) + 1;
+                    }
+                    chars += added;
+                }
+            }
+            total += doc.size();
+            documents.push_back(std::move(doc));
+        }
+        return documents;
+    }
+
+    Alphabet alphabet_from_string(const std::string &name) {
+        if (name == "ascii") return Alphabet::ASCII;
+        if (name == "georgian") return Alphabet::GEORGIAN;
+        if (name == "mixed") return Alphabet::MIXED;
+        throw std::invalid_argument("Unknown alphabet: " + name);
+    }
+
+    LengthDistribution lengths_from_string(const std::string &name) {
+        if (name == "fixed") return LengthDistribution::FIXED;
+        if (name == "uniform") return LengthDistribution::UNIFORM;
+        if (name == "lognormal") return LengthDistribution::LOGNORMAL;
+        throw std::invalid_argument("Unknown length distribution: " + name);
+    }
+
+    std::string to_string(Alphabet alphabet) {
+        switch (alphabet) {
+            case Alphabet::ASCII:
+                return "ascii";
+            case Alphabet::GEORGIAN:
+                return "georgian";
+            default:
+                return "mixed";
+        }
+    }
+} // namespace text_processing::bench
@@ -0,0 +1,67 @@
+#ifndef BENCHMARKS_CORPUS_GENERATOR_HPP
+#define BENCHMARKS_CORPUS_GENERATOR_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace text_processing::bench {
+    /**
+     * @brief Letters the generated words are made of
+     */
+    enum class Alphabet {
+        ASCII,    ///< a-z, 1 byte per character
+        GEORGIAN, ///< Mkhedruli letters, 3 bytes per character
+        MIXED     ///< Each word ASCII or Georgian
+    };
+
+    /**
+     * @brief How document lengths vary around the mean
+     */
+    enum class LengthDistribution {
+        FIXED,     ///< Every document has the mean length
+        UNIFORM,   ///< Uniform between 0 and twice the mean
+        LOGNORMAL  ///< Many short documents and a long tail, as in crawled pages
+    };
+
+    /**
+     * @brief Settings of a synthetic corpus
+     */
+    struct CorpusOptions {
+        size_t bytes = 2 << 20;                                  ///< Total content size to reach
+        Alphabet alphabet = Alphabet::MIXED;                     ///< Letters of the words
+        double duplication = 0.3;                                ///< Share of text copied from earlier documents
+        size_t doc_length = 2000;                                ///< Mean document length in characters
+        LengthDistribution lengths = LengthDistribution::LOGNORMAL; ///< Spread of document lengths
+        size_t passage_length = 200;                             ///< Mean characters per copied or fresh passage
+        uint32_t seed = 42;                                      ///< Same seed, same corpus
+    };
+
+    /**
+     * @brief Generate documents of words drawn with a skewed frequency
+     *
+     * Documents are built passage by passage. With probability duplication a
+     * passage is copied from a random earlier document, otherwise it is new
+     * words, so about that share of the text repeats elsewhere.
+     *
+     * @param options Corpus settings
+     * @return std::vector<std::string> Valid UTF-8 documents totalling at least options.bytes
+     */
+    std::vector<std::string> generate_corpus(const CorpusOptions &options);
+
+    /**
+     * @brief Alphabet named by "ascii", "georgian" or "mixed"
+     * @throw std::invalid_argument for other names
+     */
+    Alphabet alphabet_from_string(const std::string &name);
+
+    /**
+     * @brief Distribution named by "fixed", "uniform" or "lognormal"
+     * @throw std::invalid_argument for other names
+     */
+    LengthDistribution lengths_from_string(const std::string &name);
+
+    std::string to_string(Alphabet alphabet);
+} // namespace text_processing::bench
+
+#endif //BENCHMARKS_CORPUS_GENERATOR_HPP
@@ -3,8 +3,10 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <set>
+#include <unordered_set>
+#include "text_processing/rank_bitvector.hpp"
 #include "text_processing/utf8_handler.hpp"
 
 namespace text_processing {
@@ -16,6 +18,8 @@ struct DocumentPosition {
     int64_t sql_id;         ///< SQL database ID of the document
     size_t start_pos;       ///< Start position in concatenated text
     size_t length;          ///< Length in UTF-8 characters
+    size_t byte_start = 0;  ///< Start byte offset in concatenated text
+    size_t byte_length = 0; ///< Length in bytes
 
     // Adding comparison operators for sorting
     bool operator<(const DocumentPosition& other) const {
@@ -51,6 +55,34 @@ public:
      */
     bool add_document(const UTF8String& content, int64_t sql_id);
 
+    /**
+     * @brief Add a document from raw UTF-8 bytes, appended straight into the concatenated text
+     *
+     * Saves the temporary string of add_document(const UTF8String&, ...)
+     * when the bytes live in a reader's buffer.
+     *
+     * @param content Document content, validated while appending
+     * @param sql_id SQL database ID of the document
+     * @return true if document was added successfully
+     * @throw UTF8Error if content is not valid UTF-8; the store is unchanged then
+     */
+    bool add_document(std::string_view content, int64_t sql_id);
+
+    /**
+     * @brief Add many documents at once
+     *
+     * The text, position index and start bitvectors are reserved for the whole
+     * batch once and every document is appended straight into the
+     * concatenated text. Like add_document(), documents whose ID is already
+     * in the store (or earlier in the batch) are skipped.
+     *
+     * @param contents Document contents
+     * @param sql_ids SQL database ID of every document
+     * @return Number of documents added
+     * @throw std::invalid_argument if the vectors differ in size
+     */
+    size_t add_documents(const std::vector<UTF8String>& contents, const std::vector<int64_t>& sql_ids);
+
     /**
      * @brief Find which document contains a given position
      * @param pos Position in concatenated text
@@ -59,28 +91,106 @@ public:
      */
     [[nodiscard]] DocumentPosition find_document_id(size_t pos) const;
 
+    /**
+     * @brief Find which document contains a given byte offset
+     * @param byte_pos Byte offset in concatenated text (for byte-unit suffix arrays)
+     * @return DocumentPosition structure with position information
+     * @throw std::out_of_range if position is not found in any document
+     */
+    [[nodiscard]] DocumentPosition find_document_by_byte(size_t byte_pos) const;
+
+    /**
+     * @brief Returned by document_index() for positions outside every document
+     */
+    static constexpr size_t NO_DOCUMENT = SIZE_MAX;
+
+    /**
+     * @brief Index of the document containing pos in constant time, without exceptions
+     *
+     * Follows find_document_id(): a document owns the separator after it,
+     * except for the last one.
+     *
+     * @param pos Position in concatenated text
+     * @return Index for document(), or NO_DOCUMENT
+     */
+    [[nodiscard]] size_t document_index(size_t pos) const {
+        return lookup(char_starts_, pos, &DocumentPosition::start_pos, &DocumentPosition::length);
+    }
+
+    /**
+     * @brief Index of the document containing a byte offset, see document_index()
+     */
+    [[nodiscard]] size_t document_index_by_byte(size_t byte_pos) const {
+        return lookup(byte_starts_, byte_pos, &DocumentPosition::byte_start, &DocumentPosition::byte_length);
+    }
+
+    /**
+     * @brief Document at an index returned by document_index()
+     */
+    [[nodiscard]] const DocumentPosition& document(size_t index) const { return pos_index_[index]; }
+
+    /**
+     * @brief Number of documents
+     */
+    [[nodiscard]] size_t document_count() const { return pos_index_.size(); }
+
     /**
      * @brief Get concatenated text of all documents
      */
     [[nodiscard]] const UTF8String& get_concatenated_text() const { return concatenated_text_; }
 
+    /**
+     * @brief Separator appended after every document
+     */
+    [[nodiscard]] const UTF8String& separator() const { return separator_; }
+
+    /**
+     * @brief Remove all documents, keeping the separator and the allocated memory for reuse
+     */
+    void clear();
+
     void reserve(size_t total_size) {
         concatenated_text_.reserve(total_size);
         pos_index_.reserve(total_size / 1000);
+        char_starts_.reserve(total_size);
+        byte_starts_.reserve(total_size);
     }
 
 private:
     UTF8String separator_;                      ///< Document separator character
     UTF8String concatenated_text_;              ///< All documents concatenated
-    std::set<DocumentPosition> documents_;    ///< Document positions, sorted by sql_id
+    std::unordered_set<int64_t> sql_ids_;       ///< IDs of all documents, for duplicate checks
     std::vector<DocumentPosition> pos_index_;    ///< Document positions, sorted by start_pos
+    RankBitvector char_starts_;                 ///< Set at every document start, one bit per character
+    RankBitvector byte_starts_;                 ///< Set at every document start, one bit per byte
+    std::vector<size_t> start_document_;        ///< Document index of the k-th set bit
 
     /**
-     * @brief Find document by SQL ID using binary search
-     * @param sql_id SQL ID to find
-     * @return iterator to document if found, documents_.end() if not
+     * @brief Append a document whose ID is known to be new
      */
-    [[nodiscard]] std::set<DocumentPosition>::const_iterator find_by_sql_id(int64_t sql_id) const;
+    void append(const UTF8String& content, int64_t sql_id);
+
+    /**
+     * @brief Record the document whose content was just appended to the text, then its separator
+     */
+    void index_document(int64_t sql_id, size_t start_pos, size_t byte_start);
+
+    /**
+     * @brief Document containing pos, measured by the given start bits and fields
+     */
+    [[nodiscard]] size_t lookup(const RankBitvector& starts, size_t pos,
+                                size_t DocumentPosition::*start, size_t DocumentPosition::*length) const {
+        if (pos >= starts.size()) {
+            return NO_DOCUMENT;
+        }
+        size_t index = start_document_[starts.rank1(pos + 1) - 1];
+        const DocumentPosition& doc = pos_index_[index];
+        if (index + 1 == pos_index_.size() && pos >= doc.*start + doc.*length) {
+            // Separator after the last document
+            return NO_DOCUMENT;
+        }
+        return index;
+    }
 };
 
 } // namespace text_processing
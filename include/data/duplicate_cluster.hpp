@@ -0,0 +1,61 @@
+#ifndef DUPLICATE_CLUSTER_HPP
+#define DUPLICATE_CLUSTER_HPP
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace text_processing {
+    /**
+     * @brief One place a repeated substring occurs
+     */
+    struct Occurrence {
+        int64_t doc_id; ///< SQL ID of the document
+        size_t start_pos; ///< Start position in the document
+
+        bool operator<(const Occurrence &other) const {
+            if (doc_id != other.doc_id) return doc_id < other.doc_id;
+            return start_pos < other.start_pos;
+        }
+
+        bool operator==(const Occurrence &other) const {
+            return doc_id == other.doc_id && start_pos == other.start_pos;
+        }
+    };
+
+    /**
+     * @brief A maximal repeated substring and every place it occurs
+     *
+     * Maximal means that the occurrences can be extended neither to the
+     * right nor to the left without losing one of them.
+     */
+    struct Cluster {
+        size_t length; ///< Length of the repeated substring
+        std::vector<Occurrence> occurrences; ///< Sorted by document ID, then position
+
+        // Longest first, then the most widespread, then by first occurrence
+        bool operator<(const Cluster &other) const {
+            if (length != other.length) return length > other.length;
+            if (occurrences.size() != other.occurrences.size()) return occurrences.size() > other.occurrences.size();
+            return occurrences < other.occurrences;
+        }
+
+        bool operator==(const Cluster &other) const {
+            return length == other.length && occurrences == other.occurrences;
+        }
+
+        [[nodiscard]] std::string to_json() const {
+            std::ostringstream json;
+            json << "{\"length\": " << length << ", \"occurrences\": [";
+            for (size_t i = 0; i < occurrences.size(); ++i) {
+                if (i > 0) json << ", ";
+                json << "{\"doc_id\": " << occurrences[i].doc_id << ", \"start_pos\": " << occurrences[i].start_pos << "}";
+            }
+            json << "]}";
+            return json.str();
+        }
+    };
+} // namespace text_processing
+
+#endif //DUPLICATE_CLUSTER_HPP
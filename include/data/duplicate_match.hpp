@@ -2,6 +2,8 @@
 #define DUPLICATE_MATCH_HPP
 #include <cstdint>
 #include <sstream>
+#include <string>
+#include <vector>
 
 
 namespace text_processing {
@@ -58,6 +60,7 @@ namespace text_processing {
             return json.str();
         }
     };
+} // namespace text_processing
 
 #endif //DUPLICATE_MATCH_HPP
-}
+
@@ -0,0 +1,243 @@
+#ifndef MATCH_WRITER_HPP
+#define MATCH_WRITER_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "data/duplicate_cluster.hpp"
+#include "data/duplicate_match.hpp"
+
+namespace text_processing {
+    /**
+     * @brief File written through a fixed buffer, with the number formatting of the match writers
+     *
+     * Write errors are remembered and reported by check() and close(), so
+     * the formatting helpers stay cheap.
+     */
+    class BufferedFile {
+    public:
+        static constexpr size_t BUFFER_SIZE = 1 << 16;
+
+        /**
+         * @brief Open a file for writing, replacing its contents
+         * @throw std::runtime_error if the file cannot be opened
+         */
+        explicit BufferedFile(const std::string &filename);
+
+        /**
+         * @brief Close the file if still open, ignoring errors
+         */
+        ~BufferedFile();
+
+        BufferedFile(const BufferedFile &) = delete;
+        BufferedFile &operator=(const BufferedFile &) = delete;
+
+        void put(char c) {
+            if (used_ == buffer_.size()) flush();
+            buffer_[used_++] = c;
+        }
+
+        void put(const char *data, size_t length);
+
+        template<size_t N>
+        void put(const char (&literal)[N]) {
+            put(literal, N - 1);
+        }
+
+        /**
+         * @brief Append the decimal digits of a value
+         */
+        void put_integer(uint64_t value);
+        void put_integer(int64_t value);
+
+        /**
+         * @brief Append a value as 8 little-endian bytes
+         */
+        void put_le64(uint64_t value);
+
+        /**
+         * @brief Overwrite 8 bytes at an offset with a little-endian value, e.g. a count in a header
+         */
+        void patch_le64(size_t offset, uint64_t value);
+
+        /**
+         * @brief Throw if a write fell short so far
+         * @throw std::runtime_error naming the file
+         */
+        void check() const;
+
+        /**
+         * @brief Flush and close the file, further calls do nothing
+         * @throw std::runtime_error if any write fell short
+         */
+        void close();
+
+        [[nodiscard]] bool is_open() const { return file_ != nullptr; }
+
+        [[nodiscard]] const std::string &filename() const { return filename_; }
+
+    private:
+        std::FILE *file_ = nullptr;
+        std::string filename_;
+        std::vector<char> buffer_;
+        size_t used_ = 0;
+        bool failed_ = false; ///< A write to the file fell short
+
+        /**
+         * @brief Write the buffer to the file, setting failed_ if that falls short
+         */
+        void flush();
+    };
+
+    /**
+     * @brief Streaming writer of matches to a file
+     *
+     * Matches are formatted straight into a fixed buffer that is flushed to
+     * the file whenever it fills, so writing a result never holds more than
+     * the buffer in memory, whatever the number of matches.
+     *
+     * Formats:
+     * - JSON: one array, byte for byte the output of Match::to_json_array()
+     * - NDJSON: one match object per line
+     * - BINARY: a 24-byte header ("DUPMATCH", uint32 version, uint32 record
+     *   size, uint64 match count) followed by one 40-byte record per match
+     *   (doc1_id, doc2_id as int64; start_pos1, start_pos2, length as uint64),
+     *   all little-endian
+     *
+     * Example:
+     * @code
+     *     MatchWriter writer("out.ndjson", MatchWriter::Format::NDJSON);
+     *     for (const auto &match : matches) writer.write(match);
+     *     writer.close();
+     * @endcode
+     */
+    class MatchWriter {
+    public:
+        enum class Format {
+            JSON,
+            NDJSON,
+            BINARY
+        };
+
+        static constexpr uint32_t BINARY_VERSION = 1;
+        static constexpr size_t BINARY_HEADER_SIZE = 24;
+        static constexpr size_t BINARY_RECORD_SIZE = 40;
+
+        /**
+         * @brief Format named by "json", "ndjson" or "binary"
+         * @throw std::invalid_argument for other names
+         */
+        static Format format_from_string(const std::string &name);
+
+        /**
+         * @brief Usual file extension of a format, including the dot
+         */
+        static std::string extension(Format format);
+
+        /**
+         * @brief Open a file for writing, replacing its contents
+         * @throw std::runtime_error if the file cannot be opened
+         */
+        explicit MatchWriter(const std::string &filename, Format format = Format::JSON);
+
+        ~MatchWriter();
+
+        MatchWriter(const MatchWriter &) = delete;
+        MatchWriter &operator=(const MatchWriter &) = delete;
+
+        /**
+         * @brief Append one match
+         * @throw std::runtime_error if the writer is closed or the file cannot be written
+         */
+        void write(const Match &match);
+
+        /**
+         * @brief Append matches in order
+         */
+        void write(const std::vector<Match> &matches);
+
+        /**
+         * @brief Finish the format and close the file
+         *
+         * Called by the destructor if needed, which however cannot report
+         * errors. Further calls do nothing.
+         *
+         * @throw std::runtime_error if the file cannot be written
+         */
+        void close();
+
+        /**
+         * @brief Matches written so far
+         */
+        [[nodiscard]] size_t count() const { return count_; }
+
+    private:
+        BufferedFile out_;
+        Format format_;
+        size_t count_ = 0;
+    };
+
+    /**
+     * @brief Streaming writer of duplicate clusters, in the formats of MatchWriter
+     *
+     * - JSON: one array of Cluster::to_json() objects
+     * - NDJSON: one cluster object per line
+     * - BINARY: a 24-byte header ("DUPCLUST", uint32 version, uint32
+     *   occurrence size, uint64 cluster count), then per cluster its length
+     *   and occurrence count as uint64 followed by 16 bytes per occurrence
+     *   (doc_id as int64, start_pos as uint64), all little-endian
+     */
+    class ClusterWriter {
+    public:
+        static constexpr uint32_t BINARY_VERSION = 1;
+        static constexpr size_t BINARY_HEADER_SIZE = 24;
+        static constexpr size_t BINARY_OCCURRENCE_SIZE = 16;
+
+        /**
+         * @brief Open a file for writing, replacing its contents
+         * @throw std::runtime_error if the file cannot be opened
+         */
+        explicit ClusterWriter(const std::string &filename, MatchWriter::Format format = MatchWriter::Format::JSON);
+
+        ~ClusterWriter();
+
+        ClusterWriter(const ClusterWriter &) = delete;
+        ClusterWriter &operator=(const ClusterWriter &) = delete;
+
+        /**
+         * @brief Append one cluster
+         * @throw std::runtime_error if the writer is closed or the file cannot be written
+         */
+        void write(const Cluster &cluster);
+
+        /**
+         * @brief Finish the format and close the file, see MatchWriter::close()
+         */
+        void close();
+
+        /**
+         * @brief Clusters written so far
+         */
+        [[nodiscard]] size_t count() const { return count_; }
+
+    private:
+        BufferedFile out_;
+        MatchWriter::Format format_;
+        size_t count_ = 0;
+    };
+
+    /**
+     * @brief Write matches to a file in one of the MatchWriter formats
+     */
+    void save_matches(const std::vector<Match> &matches, const std::string &filename,
+                      MatchWriter::Format format = MatchWriter::Format::JSON);
+
+    /**
+     * @brief Write clusters to a file in one of the ClusterWriter formats
+     */
+    void save_clusters(const std::vector<Cluster> &clusters, const std::string &filename,
+                       MatchWriter::Format format = MatchWriter::Format::JSON);
+} // namespace text_processing
+
+#endif //MATCH_WRITER_HPP
@@ -0,0 +1,171 @@
+#ifndef DATA_PARQUET_SOURCE_HPP
+#define DATA_PARQUET_SOURCE_HPP
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "data/document_store.hpp"
+#include "text_processing/metrics.hpp"
+
+namespace parquet::arrow {
+class FileReader;
+} // namespace parquet::arrow
+
+namespace text_processing {
+
+/**
+ * @brief Exception class for Parquet files that cannot be read
+ */
+class ParquetError : public std::runtime_error {
+public:
+    explicit ParquetError(const std::string& message) : std::runtime_error(message) {}
+};
+
+/**
+ * @brief Document source reading a Parquet file directly with Arrow, in place of SQLiteHandler
+ *
+ * Only built when Arrow and Parquet are found, which defines
+ * TEXT_PROCESSING_WITH_PARQUET.
+ *
+ * Documents get the 1-based row number in the file as their ID, which is
+ * the rowid parquet_to_sqlite.py gives a row, so matches and index files
+ * are interchangeable between both sources of the same file.
+ *
+ * Example:
+ * @code
+ *     ParquetSource source("dump.parquet");
+ *     auto store = source.create_document_store("domains", "doc_content", "example.com", "\x01");
+ * @endcode
+ */
+class ParquetSource {
+public:
+    /**
+     * @brief Row number bound passed to load_document_store() to load every row
+     */
+    static constexpr int64_t ALL_ROWS = std::numeric_limits<int64_t>::min();
+
+    /**
+     * @brief Open a Parquet file and read its footer
+     *
+     * @param path Path to the Parquet file
+     * @param verbose Print progress information
+     * @throw ParquetError if the file cannot be opened or is not a Parquet file
+     */
+    explicit ParquetSource(const std::string& path, bool verbose = false);
+
+    ~ParquetSource();
+
+    ParquetSource(const ParquetSource&) = delete;
+    ParquetSource& operator=(const ParquetSource&) = delete;
+    ParquetSource(ParquetSource&&) noexcept;
+    ParquetSource& operator=(ParquetSource&&) noexcept;
+
+    /**
+     * @brief Record what load_document_store() does, nullptr to stop
+     *
+     * Adds the phase "load_documents", the counts of SQLiteHandler and
+     * "row_groups" and "row_groups_skipped", and the peak sizes "text" and
+     * "text_index". Not owned.
+     */
+    void set_metrics(Metrics* metrics) { metrics_ = metrics; }
+
+    /**
+     * @brief Check that the file has all of these columns as string columns
+     *
+     * @return Pair of success and the first missing or unusable column
+     */
+    [[nodiscard]] std::pair<bool, std::string> validate_columns(const std::vector<std::string>& columns) const;
+
+    /**
+     * @brief Create a DocumentStore from the rows whose filter column equals a value
+     *
+     * @param separator Separator of the new store
+     * @param threads Decoding threads, see load_document_store()
+     */
+    DocumentStore create_document_store(
+        const std::string& filter_column,
+        const std::string& content_column,
+        const std::string& filter_value,
+        const std::string& separator = "$",
+        size_t threads = 1
+    );
+
+    /**
+     * @brief Fill an existing DocumentStore with the rows whose filter column equals a value
+     *
+     * The store is cleared first and uses its own separator. Row groups
+     * whose minimum and maximum of the filter column exclude the value are
+     * skipped without being read, so files sorted or grouped by domain
+     * read little more than the domain's own rows. The filter and content
+     * columns of the other row groups are read one row group at a time, and
+     * every matching row is appended from Arrow's buffers straight into the
+     * store's text, validated on the way, without a per-row string.
+     * Rows with a null filter value are skipped, null contents are empty
+     * documents.
+     *
+     * @param store Store to fill
+     * @param filter_column Name of the column to filter by (e.g., "domains")
+     * @param content_column Name of the column containing text content
+     * @param filter_value Value to filter the rows by
+     * @param threads 1 decodes on the calling thread, other values on Arrow's CPU thread pool
+     * @param after_row Load only rows with a larger row number, e.g. the rows added since an index was built
+     * @throw ParquetError if the file cannot be read or a column is missing or not a string column
+     * @throw UTF8Error if a document is not valid UTF-8
+     */
+    void load_document_store(
+        DocumentStore& store,
+        const std::string& filter_column,
+        const std::string& content_column,
+        const std::string& filter_value,
+        size_t threads = 1,
+        int64_t after_row = ALL_ROWS
+    );
+
+    /**
+     * @brief Number of rows in the file
+     */
+    [[nodiscard]] int64_t row_count() const;
+
+    /**
+     * @brief Number of row groups in the file
+     */
+    [[nodiscard]] int row_group_count() const;
+
+private:
+    std::string path_;
+    bool verbose_;
+    std::unique_ptr<parquet::arrow::FileReader> reader_;
+    Metrics* metrics_ = nullptr; ///< Not owned, may be null
+
+    /**
+     * @brief Leaf column index of a top-level string column
+     * @throw ParquetError if the column does not exist or holds no byte arrays
+     */
+    [[nodiscard]] int column_index(const std::string& name) const;
+
+    /**
+     * @brief False if the statistics of a row group rule out filter_value in the column
+     */
+    [[nodiscard]] bool may_contain(int row_group, int column, const std::string& filter_value) const;
+};
+
+/**
+ * @brief True if a path names a Parquet file by its extension (.parquet or .parq)
+ *
+ * Available without TEXT_PROCESSING_WITH_PARQUET, so callers can say that
+ * Parquet support is missing.
+ */
+inline bool is_parquet_path(const std::string& path) {
+    auto ends_with = [&path](const std::string& suffix) {
+        return path.size() >= suffix.size() && path.compare(path.size() - suffix.size(), suffix.size(), suffix) == 0;
+    };
+    return ends_with(".parquet") || ends_with(".parq");
+}
+
+} // namespace text_processing
+
+#endif // DATA_PARQUET_SOURCE_HPP
@@ -0,0 +1,65 @@
+#ifndef SHARD_RESULT_HPP
+#define SHARD_RESULT_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "data/duplicate_match.hpp"
+
+namespace text_processing {
+    /**
+     * @brief Best match of a pair of documents, keyed by their document indices
+     */
+    struct ShardMatch {
+        uint64_t key1; ///< Smaller document index
+        uint64_t key2; ///< Larger document index
+        Match match;
+
+        bool operator==(const ShardMatch &other) const {
+            return key1 == other.key1 && key2 == other.key2 && match == other.match;
+        }
+    };
+
+    /**
+     * @brief Best matches among the suffixes of one shard, see DuplicateFinder::find_shard()
+     *
+     * A shard is a stretch of the suffix array; the shards of a text are
+     * numbered in suffix order. Merging needs the first and last suffix of
+     * every shard to compare the neighbours on both sides of a shard border.
+     *
+     * The file format is a 24-byte header ("DUPSHARD", uint32 version, uint32
+     * record size, uint64 match count), the eight fields from shard to
+     * last_suffix as uint64, then one 56-byte record per match (key1, key2 as
+     * uint64; doc1_id, doc2_id as int64; start_pos1, start_pos2, length as
+     * uint64), all little-endian.
+     */
+    struct ShardResult {
+        static constexpr uint32_t VERSION = 1;
+        static constexpr size_t HEADER_SIZE = 24 + 8 * 8;
+        static constexpr size_t RECORD_SIZE = 56;
+
+        uint64_t shard = 0;        ///< Index of the shard
+        uint64_t shards = 1;       ///< Number of shards the text was split into
+        uint64_t min_length = 0;   ///< Threshold the matches were found with
+        uint64_t text_size = 0;    ///< Bytes of the text, to tell shards of other texts apart
+        uint64_t suffix_begin = 0; ///< Suffixes in the shards before this one
+        uint64_t suffix_count = 0; ///< Suffixes in this shard
+        uint64_t first_suffix = 0; ///< Byte position of the shard's smallest suffix, if it has any
+        uint64_t last_suffix = 0;  ///< Byte position of the shard's largest suffix, if it has any
+        std::vector<ShardMatch> matches;
+
+        /**
+         * @brief Write the result to a file, replacing its contents
+         * @throw std::runtime_error if the file cannot be written
+         */
+        void save(const std::string &filename) const;
+
+        /**
+         * @brief Read a file written by save()
+         * @throw std::runtime_error if the file cannot be read, is truncated or has another version
+         */
+        static ShardResult load(const std::string &filename);
+    };
+} // namespace text_processing
+
+#endif //SHARD_RESULT_HPP
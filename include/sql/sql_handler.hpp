@@ -1,10 +1,15 @@
 #ifndef DB_SQLITE_HANDLER_HPP
 #define DB_SQLITE_HANDLER_HPP
 
+#include <cstdint>
+#include <limits>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <sqlite3.h>
 #include "data/document_store.hpp"
+#include "text_processing/metrics.hpp"
 
 namespace text_processing {
 
@@ -16,19 +21,58 @@ public:
     explicit SQLiteError(const std::string& message) : std::runtime_error(message) {}
 };
 
+/**
+ * @brief Rows sharing one value of a filter column
+ */
+struct FilterGroup {
+    std::string value;     ///< Value of the filter column
+    size_t documents = 0;  ///< Number of rows with the value
+    size_t bytes = 0;      ///< Total content size in bytes
+};
+
+/**
+ * @brief Connection settings chosen when opening a database
+ */
+enum class ConnectionProfile {
+    DEFAULT,   ///< SQLite's defaults, reads and writes
+    /**
+     * Scans of large tables: a 1 GiB memory map, a 64 MiB page cache,
+     * temporary tables in memory and query_only, so the connection cannot
+     * change rows. Filter columns get an index on first use, see
+     * loadDocumentStore().
+     */
+    BULK_READ
+};
+
 /**
  * @brief Handler for SQLite database operations with focus on document grouping
+ *
+ * Every statement is prepared once per connection and kept for reuse; values
+ * are bound as parameters instead of being written into the SQL, so one
+ * statement serves all filter values.
  */
 class SQLiteHandler {
 public:
+    /**
+     * @brief Row ID bound passed to loadDocumentStore() to load every row
+     */
+    static constexpr int64_t ALL_ROWS = std::numeric_limits<int64_t>::min();
+
+    /**
+     * @brief Rows updated per transaction by updateRows() unless given
+     */
+    static constexpr size_t WRITE_BATCH_ROWS = 10000;
+
     /**
      * @brief Constructor that initializes database connection
      *
      * @param db_path Path to SQLite database file
      * @param verbose If true, will print progress
+     * @param profile Pragmas to apply to the connection
      * @throw SQLiteError if connection cannot be established
      */
-    explicit SQLiteHandler(const std::string& db_path, bool verbose = false);
+    explicit SQLiteHandler(const std::string& db_path, bool verbose = false,
+                           ConnectionProfile profile = ConnectionProfile::DEFAULT);
 
     /**
      * @brief Destructor ensuring proper cleanup of database connection
@@ -42,10 +86,29 @@ public:
     SQLiteHandler& operator=(SQLiteHandler&&) noexcept;
 
     /**
-     * @brief Explicitly close the database connection
+     * @brief Explicitly close the database connection, finalizing the cached statements
      */
     void close();
 
+    /**
+     * @brief Profile the connection was opened with
+     */
+    [[nodiscard]] ConnectionProfile profile() const { return profile_; }
+
+    /**
+     * @brief Number of prepared statements kept for reuse
+     */
+    [[nodiscard]] size_t cachedStatements() const { return statements_.size(); }
+
+    /**
+     * @brief Record loading into metrics from now on, nullptr stops recording
+     *
+     * loadDocumentStore() adds the phase "load_documents", the counts
+     * "documents", "bytes_loaded" and "characters_loaded", and the peak sizes
+     * "text" and "text_index" of the store's text. Not owned.
+     */
+    void setMetrics(Metrics* metrics) { metrics_ = metrics; }
+
     /**
      * @brief Creates DocumentStore from content filtered by a column value
      *
@@ -53,15 +116,83 @@ public:
      * @param filter_column Name of the column to filter by (e.g., "domain")
      * @param content_column Name of the column containing text content
      * @param filter_value Value to filter the rows by
+     * @param separator Document separator
+     * @param threads Loading threads, see loadDocumentStore()
      * @return DocumentStore Store containing concatenated documents matching the filter
      * @throw SQLiteError if query fails or columns don't exist
+     * @throw UTF8Error if a document is not valid UTF-8
      */
     DocumentStore createDocumentStore(
         const std::string& table_name,
         const std::string& filter_column,
         const std::string& content_column,
         const std::string& filter_value,
-        const std::string& separator = "$"
+        const std::string& separator = "$",
+        size_t threads = 1
+    );
+
+    /**
+     * @brief Fill an existing DocumentStore with content filtered by a column value
+     *
+     * The store is cleared first and uses its own separator. Reusing one store
+     * for many filter values keeps its buffers allocated between them.
+     *
+     * The rows are read in a single pass over the table; the row count for
+     * verbose progress is taken from the filter column alone. With the
+     * BULK_READ profile an index on the filter column is created the first
+     * time a table is filtered by it (if the file is writable), so each
+     * filter value reads only its own rows.
+     *
+     * Every row's bytes are copied once out of SQLite and moved into the
+     * document. With more than one thread the calling thread only steps the
+     * statement, while the other threads validate and index the UTF-8 of
+     * batches of rows and append them to the store in row order. The result
+     * does not depend on the thread count.
+     *
+     * @param store Store to fill
+     * @param table_name Name of the table to query
+     * @param filter_column Name of the column to filter by (e.g., "domain")
+     * @param content_column Name of the column containing text content
+     * @param filter_value Value to filter the rows by
+     * @param threads Loading threads including the reader (0 = hardware threads)
+     * @param after_rowid Load only rows with a larger rowid, e.g. the rows added since an index was built
+     * @throw SQLiteError if query fails or columns don't exist
+     * @throw UTF8Error if a document is not valid UTF-8
+     */
+    void loadDocumentStore(
+        DocumentStore& store,
+        const std::string& table_name,
+        const std::string& filter_column,
+        const std::string& content_column,
+        const std::string& filter_value,
+        size_t threads = 1,
+        int64_t after_rowid = ALL_ROWS
+    );
+
+    /**
+     * @brief Create an index idx_<table>_<column> unless an index already starts with the column
+     *
+     * Lifts query_only for the statement in the BULK_READ profile. Failing
+     * to create the index, e.g. for a read-only file, is not an error.
+     *
+     * @return bool True if the index exists afterwards
+     * @throw SQLiteError if names are invalid
+     */
+    bool ensureIndex(const std::string& table_name, const std::string& column_name);
+
+    /**
+     * @brief List every distinct value of a filter column with its content size
+     *
+     * @param table_name Name of the table to query
+     * @param filter_column Name of the column to group by
+     * @param content_column Name of the column containing text content
+     * @return Groups sorted by total content size, largest first
+     * @throw SQLiteError if query fails or names are invalid
+     */
+    std::vector<FilterGroup> listFilterGroups(
+        const std::string& table_name,
+        const std::string& filter_column,
+        const std::string& content_column
     );
 
     /**
@@ -79,11 +210,13 @@ public:
     /**
      * @brief Update a single row in the specified table
      *
+     * For many rows use updateRows(), which commits them in batches.
+     *
      * @param table_name Name of the table to update
      * @param row_id ID of the row to update
      * @param column_name Name of the column to update
      * @param new_value New value to set for the specified column
-     * @throw SQLiteError if update fails
+     * @throw SQLiteError if update fails or names are invalid
      */
     void updateRow(
         const std::string& table_name,
@@ -92,44 +225,129 @@ public:
         const std::string& new_value
     );
 
+    /**
+     * @brief Set one column of many rows, batch_rows rows per transaction
+     *
+     * One prepared UPDATE is reset and rebound for every row, and values are
+     * bound as they are instead of being escaped into the SQL. A million rows
+     * thus cost a hundred commits rather than a million. If a row fails, its
+     * batch is rolled back but earlier batches stay committed.
+     *
+     * @param table_name Name of the table to update
+     * @param column_name Name of the column to set
+     * @param row_ids Row IDs to update
+     * @param values New value per row ID
+     * @param batch_rows Rows per transaction (0 = all in one)
+     * @return size_t Number of rows changed, missing row IDs are not counted
+     * @throw SQLiteError if an update fails, names are invalid or the vectors differ in size
+     */
+    size_t updateRows(
+        const std::string& table_name,
+        const std::string& column_name,
+        const std::vector<int64_t>& row_ids,
+        const std::vector<std::string>& values,
+        size_t batch_rows = WRITE_BATCH_ROWS
+    );
+
+    /**
+     * @brief Switch the database to write-ahead logging with NORMAL synchronization
+     *
+     * Commits then append to the log instead of rewriting pages, and are
+     * synced at checkpoints only, while readers keep working during writes.
+     * The journal mode is stored in the database file and stays in effect.
+     *
+     * @return bool False if SQLite kept another mode, e.g. for in-memory databases
+     * @throw SQLiteError if the pragmas fail
+     */
+    bool enableWriteAheadLog();
+
 private:
     sqlite3* db_connection_{};  ///< SQLite database connection handle
     bool verbose_;
+    ConnectionProfile profile_;
+    Metrics* metrics_ = nullptr;  ///< Not owned, may be null
+    std::unordered_map<std::string, sqlite3_stmt*> statements_; ///< Prepared statements by SQL
+    std::unordered_set<std::string> indexed_;                     ///< "table.column" passed to ensureIndex()
+
+    /**
+     * @brief Cached statement in use, reset and unbound when released
+     *
+     * A statement already running, as in a nested query with the same SQL,
+     * is not shared: the lease then owns a fresh statement it finalizes.
+     */
+    class StatementLease {
+    public:
+        StatementLease(sqlite3_stmt* stmt, bool owned) : stmt_(stmt), owned_(owned) {}
+        ~StatementLease();
+        StatementLease(const StatementLease&) = delete;
+        StatementLease& operator=(const StatementLease&) = delete;
+        [[nodiscard]] sqlite3_stmt* get() const { return stmt_; }
+
+    private:
+        sqlite3_stmt* stmt_;
+        bool owned_;
+    };
+
+    /**
+     * @brief Prepared statement for a query, from the cache or prepared and cached now
+     * @throw SQLiteError if the query cannot be prepared
+     */
+    StatementLease prepare(const std::string& query);
 
     /**
      * @brief Execute SQLite query and process results
      *
      * @tparam Callback Type of the callback function
+     * @tparam Params std::string or integer types bound to ?1, ?2, ...
      * @param query SQL query string
      * @param callback Function to process each row
+     * @param params Values of the query's parameters
      * @throw SQLiteError if query execution fails
      */
-    template <typename Callback>
-    void executeQuery(const std::string& query, Callback callback);
+    template <typename Callback, typename... Params>
+    void executeQuery(const std::string& query, Callback callback, const Params&... params);
+
+    /**
+     * @brief Execute a statement without results, such as BEGIN or COMMIT
+     * @throw SQLiteError with SQLite's message if it fails
+     */
+    void execute(const std::string& statement);
 
     /**
-     * @brief Sanitize input to prevent SQL injection
+     * @brief Read the rows of a document query on the calling thread and
+     *        validate them on worker threads, appending in row order
      *
-     * @param input String to sanitize
-     * @return std::string Sanitized string
+     * @param store Cleared store to append to
+     * @param query Query returning content and rowid, see buildQuery()
+     * @param filter_value Value bound to the query's filter
+     * @param after_rowid Value bound to the query's rowid bound, if it has one
+     * @param workers Validating threads besides the reader
+     * @param doc_count Expected number of rows, for progress output
+     */
+    void loadPipelined(DocumentStore& store, const std::string& query, const std::string& filter_value,
+                       int64_t after_rowid, size_t workers, size_t doc_count);
+
+    /**
+     * @brief Print loading progress every 1% (at least every 100 documents)
      */
-    static std::string sanitizeInput(const std::string& input);
+    void reportProgress(size_t current, size_t doc_count) const;
 
     /**
      * @brief Build SQL query for document selection
      *
-     * Builds a SELECT query to fetch the 'content' column filtered by the provided 'filter_value'.
+     * Builds a SELECT query to fetch the 'content' column filtered by the value bound to ?1.
      * The query is of the form:
-     *   SELECT <content_column>
+     *   SELECT <content_column>, rowid
      *   FROM <table_name>
-     *   WHERE <filter_column> = '<filter_value>'
+     *   WHERE <filter_column> = ?1 [AND rowid > ?2]
+     * where the rowid bound is present unless after_rowid is ALL_ROWS.
      *   @throw SQLiteError if query is malformed
      */
     static std::string buildQuery(
         const std::string& table_name,
         const std::string& filter_column,
         const std::string& content_column,
-        const std::string& filter_value
+        int64_t after_rowid = ALL_ROWS
     );
 };
 
@@ -0,0 +1,118 @@
+#ifndef TEXT_PROCESSING_BATCH_RUNNER_HPP
+#define TEXT_PROCESSING_BATCH_RUNNER_HPP
+
+#include <string>
+#include <vector>
+#include "sql/sql_handler.hpp"
+#include "text_processing/duplicate_finder.hpp"
+
+namespace text_processing {
+    /**
+     * @brief Where a batch reads its documents from
+     */
+    struct BatchSource {
+        std::string db_path;                         ///< SQLite database file
+        std::string table_name = "data_table";       ///< Table holding the documents
+        std::string filter_column = "domains";       ///< Column naming the domain of a row
+        std::string content_column = "doc_content";  ///< Column holding the text
+        std::string separator = "\x01";              ///< Document separator
+        ConnectionProfile profile = ConnectionProfile::BULK_READ; ///< Settings of every connection
+    };
+
+    /**
+     * @brief Outcome of one domain of a batch
+     */
+    struct BatchResult {
+        std::string domain;       ///< Filter value
+        std::string output_path;  ///< Match file written for the domain
+        size_t documents = 0;     ///< Documents loaded
+        size_t bytes = 0;         ///< Content size the domain was scheduled by
+        size_t matches = 0;       ///< Matches written
+        std::string error;        ///< Failure message, empty on success
+        Metrics metrics;          ///< Loading, matching and saving of the domain, see FinderOptions::metrics
+
+        /**
+         * @brief The result as a JSON object
+         *
+         * {"domain": "...", "documents": n, "matches": n, "error": "...", "metrics": {...}},
+         * with metrics as Metrics::to_json().
+         */
+        [[nodiscard]] std::string to_json() const;
+    };
+
+    /**
+     * @brief Find duplicates for many domains in one process
+     *
+     * Domains are run on a pool of workers, largest content first, so the
+     * small domains fill the gaps left by the big ones. Every worker opens one
+     * database connection and keeps one DuplicateFinder and one DocumentStore
+     * for all of its domains, so connections, builders and buffers are reused.
+     * A failing domain is reported in its result and does not stop the batch.
+     * Every domain records into the metrics of its own result, so
+     * FinderOptions::metrics is not used here.
+     *
+     * Example:
+     * @code
+     *     BatchRunner runner(BatchSource{"docs.db"}, FinderOptions{}, 8);
+     *     auto results = runner.run({}, "out", 50); // every domain, out/<domain>.json
+     * @endcode
+     */
+    class BatchRunner {
+    public:
+        /**
+         * @brief Constructor
+         * @param source Database and columns to read
+         * @param options Finder settings used by every worker
+         * @param workers Domains processed at once (0 = hardware threads)
+         * @param format Format of the match files
+         */
+        BatchRunner(BatchSource source, FinderOptions options, size_t workers = 0,
+                    MatchWriter::Format format = MatchWriter::Format::JSON);
+
+        /**
+         * @brief Process domains and write one match file per domain into output_dir
+         *
+         * @param domains Domains to process, empty processes every domain in the table
+         * @param output_dir Directory for the match files, created if missing
+         * @param min_length Minimum duplicate substring length
+         * @param verbose Print a line per finished domain
+         * @return One result per distinct domain, in request order (size order for all domains)
+         * @throw SQLiteError if the database or its columns cannot be read
+         */
+        std::vector<BatchResult> run(
+            const std::vector<std::string> &domains,
+            const std::string &output_dir,
+            size_t min_length,
+            bool verbose = false
+        ) const;
+
+        /**
+         * @brief File name of a domain's output
+         *
+         * Letters, digits, '-', '_' and inner '.' are kept. Names needing other
+         * replacements get a hash of the domain appended, so distinct domains
+         * never share a file. The name ends in the extension of the format.
+         */
+        static std::string output_file_name(const std::string &domain,
+                                            MatchWriter::Format format = MatchWriter::Format::JSON);
+
+        /**
+         * @brief Statistics of a batch as one JSON object, for the --stats file
+         *
+         * {"run": {...}, "domains": [...]}: the totals of the run, then every
+         * result's to_json() in order, so slow domains can be told apart.
+         *
+         * @param run Metrics of the whole run
+         * @param results Results of run()
+         */
+        static std::string stats_json(const Metrics &run, const std::vector<BatchResult> &results);
+
+    private:
+        BatchSource source_;
+        FinderOptions options_;
+        size_t workers_;
+        MatchWriter::Format format_;
+    };
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_BATCH_RUNNER_HPP
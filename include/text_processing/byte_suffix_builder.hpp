@@ -0,0 +1,103 @@
+#ifndef TEXT_PROCESSING_BYTE_SUFFIX_BUILDER_HPP
+#define TEXT_PROCESSING_BYTE_SUFFIX_BUILDER_HPP
+
+#include <vector>
+#include "text_processing/suffix_array_builder.hpp"
+#include "text_processing/index_vector.hpp"
+#include "text_processing/utf8_handler.hpp"
+
+namespace text_processing {
+
+/**
+ * @brief SA-IS suffix array construction directly over the UTF-8 bytes
+ *
+ * UTF-8 byte order matches code point order and the encoding is prefix-free,
+ * so the suffixes starting on character boundaries sort the same way whether
+ * compared byte by byte or character by character. This builder runs SA-IS on
+ * the raw bytes of UTF8String::str() (a 256-symbol alphabet, no decoding and
+ * no IntegerText), then keeps only the character-boundary suffixes.
+ *
+ * Suffix array entries are byte offsets and LCP values are byte lengths,
+ * trimmed back to the last complete common character (see unit()). The order
+ * of the suffixes is the same as NaiveSuffixBuilder's.
+ *
+ * Space complexity: O(n) in bytes of the text
+ * Time complexity: O(n) in bytes of the text
+ */
+class ByteSuffixBuilder : public SuffixArrayBuilder {
+public:
+    /**
+     * @brief Default constructor
+     */
+    ByteSuffixBuilder() = default;
+
+    /**
+     * @brief Build suffix array from UTF8String
+     *
+     * @param text Input text to build suffix array from
+     * @return true if building was successful
+     * @throw std::runtime_error if building fails or text is empty
+     */
+    bool build(const UTF8String& text) override;
+
+    /**
+     * @brief Get the constructed suffix array (byte offsets)
+     *
+     * @return const reference to the suffix array vector
+     * @throw std::runtime_error if array hasn't been built
+     */
+    [[nodiscard]] const IndexVector& get_array() const override;
+
+    /**
+     * @brief Get the Longest Common Prefix (LCP) array (byte lengths)
+     *
+     * @return const reference to the LCP array
+     * @throw std::runtime_error if array hasn't been built
+     */
+    [[nodiscard]] const IndexVector& get_lcp_array() const override;
+
+    /**
+     * @brief Get original text the suffix array was built from
+     *
+     * @return const reference to the original text
+     */
+    [[nodiscard]] const UTF8String& get_text() const override;
+
+    /**
+     * @brief Check if suffix array has been built
+     *
+     * @return true if suffix array is built and ready
+     */
+    bool is_built() const override;
+
+    /**
+     * @brief Positions and lengths are in bytes
+     */
+    [[nodiscard]] Unit unit() const override { return Unit::BYTE; }
+
+private:
+    UTF8String text_;                    ///< Original text
+    IndexVector suffix_array_;           ///< Constructed suffix array
+    IndexVector lcp_array_;              ///< LCP array
+    bool is_built_ = false;              ///< Construction state flag
+
+    /**
+     * @brief Run SA-IS and the LCP pass with Index-typed arrays
+     *
+     * Instantiated for uint32_t when the text has fewer than 4G bytes.
+     */
+    template<typename Index>
+    void build_arrays();
+
+    /**
+     * @brief Validate input text
+     *
+     * @param text Text to validate
+     * @throw std::runtime_error if text is empty
+     */
+    static void validate_input(const UTF8String& text);
+};
+
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_BYTE_SUFFIX_BUILDER_HPP
@@ -0,0 +1,60 @@
+#ifndef TEXT_PROCESSING_CANDIDATE_FILTER_HPP
+#define TEXT_PROCESSING_CANDIDATE_FILTER_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include "data/document_store.hpp"
+
+namespace text_processing {
+    /**
+     * @brief Bytes hashed into one fingerprint, fewer for smaller thresholds
+     */
+    constexpr size_t CANDIDATE_SHINGLE_BYTES = 16;
+
+    /**
+     * @brief Smallest threshold the filter is used for; below it nearly every document is a candidate
+     */
+    constexpr size_t CANDIDATE_MIN_LENGTH = 8;
+
+    /**
+     * @brief Winnowing fingerprints of a document's bytes, sorted and without repeats
+     *
+     * Every window of min_length - w + 1 consecutive w-byte shingles (w =
+     * min(min_length, CANDIDATE_SHINGLE_BYTES)) contributes the smallest
+     * shingle hash in it. A substring of min_length characters has at least
+     * min_length bytes and so covers a whole window, whose smallest hash
+     * depends only on its bytes: two documents sharing such a substring
+     * always share a fingerprint.
+     *
+     * @param bytes UTF-8 bytes of the document
+     * @param min_length Threshold in characters, at least 1
+     */
+    [[nodiscard]] std::vector<uint64_t> winnow_fingerprints(std::string_view bytes, size_t min_length);
+
+    /**
+     * @brief Documents that may share a substring of at least min_length characters with another one
+     *
+     * A document is a candidate if one of its winnowing fingerprints also
+     * belongs to another document. No document with a match is left out,
+     * hash collisions only add candidates.
+     *
+     * @param store Documents to filter
+     * @param min_length Threshold in characters, at least 1
+     * @param threads Threads computing fingerprints and sorting them (0 = hardware threads)
+     * @param fingerprints If not null, receives the number of fingerprints of all documents
+     * @return Indices of the candidate documents in the store, ascending
+     */
+    [[nodiscard]] std::vector<size_t> find_candidate_documents(const DocumentStore &store, size_t min_length,
+                                                               size_t threads = 1, size_t *fingerprints = nullptr);
+
+    /**
+     * @brief Store with a copy of some documents of another, in its order and with its separator
+     *
+     * @param store Store to take the documents from
+     * @param documents Indices of the documents, ascending
+     */
+    [[nodiscard]] DocumentStore select_documents(const DocumentStore &store, const std::vector<size_t> &documents);
+} // namespace text_processing
+
+#endif //TEXT_PROCESSING_CANDIDATE_FILTER_HPP
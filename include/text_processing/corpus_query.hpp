@@ -0,0 +1,84 @@
+#ifndef TEXT_PROCESSING_CORPUS_QUERY_HPP
+#define TEXT_PROCESSING_CORPUS_QUERY_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "text_processing/index_file.hpp"
+
+namespace text_processing {
+    /**
+     * @brief A substring of a query that occurs in an indexed document
+     */
+    struct QueryHit {
+        size_t query_pos; ///< Character offset in the query
+        size_t length;    ///< Length in characters
+        int64_t doc_id;   ///< SQL ID of a document containing the substring
+        size_t doc_pos;   ///< Character offset of the substring in that document
+
+        bool operator==(const QueryHit &other) const {
+            return query_pos == other.query_pos && length == other.length &&
+                   doc_id == other.doc_id && doc_pos == other.doc_pos;
+        }
+
+        [[nodiscard]] std::string to_json() const;
+    };
+
+    /**
+     * @brief Finds the substrings of a text that occur in the documents of an index
+     *
+     * For every character of a query the longest substring starting there
+     * that occurs in a document is found by binary search in the index's
+     * suffix array, skipping the bytes shared with both search bounds, so a
+     * search costs O(log n) comparisons of little more than the match itself.
+     * These lengths are the matching statistics of the query; the maximal
+     * substrings among them, those not contained in the one of the previous
+     * character, are reported. Nothing is copied from the index, so a query
+     * only touches the pages its searches visit, and queries may run on
+     * several threads at once.
+     *
+     * Example:
+     * @code
+     *     IndexFile index("docs.idx");
+     *     CorpusQuery query(index);
+     *     auto hits = query.find(incoming_text, 50);
+     * @endcode
+     */
+    class CorpusQuery {
+    public:
+        /**
+         * @brief Query the documents of an index, which must outlive this object
+         * @throw std::invalid_argument if the index has no suffix arrays
+         */
+        explicit CorpusQuery(const IndexFile &index);
+
+        /**
+         * @brief Find the maximal substrings of a text of at least min_length characters occurring in a document
+         *
+         * A substring never spans two documents. Each hit names one of the
+         * documents the substring occurs in.
+         *
+         * @param text UTF-8 text to look up
+         * @param min_length Minimum length in characters, at least 1
+         * @return std::vector<QueryHit> Hits by query position
+         * @throw UTF8Error if text is not valid UTF-8
+         */
+        [[nodiscard]] std::vector<QueryHit> find(std::string_view text, size_t min_length) const;
+
+        [[nodiscard]] const IndexFile &index() const { return index_; }
+
+    private:
+        const IndexFile &index_;
+
+        /**
+         * @brief Longest prefix of suffix, in bytes on a character boundary, occurring within a document
+         *
+         * @param byte_pos Receives the byte offset of an occurrence in the index text
+         */
+        template<typename SuffixArray>
+        size_t longest_prefix(const SuffixArray &sa, std::string_view suffix, size_t &byte_pos) const;
+    };
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_CORPUS_QUERY_HPP
@@ -2,12 +2,107 @@
 #define TEXT_PROCESSING_DUPLICATE_FINDER_HPP
 
 #include <fstream>
+#include <string>
+#include <string_view>
 #include <vector>
 #include "data/document_store.hpp"
 #include "text_processing/suffix_array_builder.hpp"
+#include "data/duplicate_cluster.hpp"
 #include "data/duplicate_match.hpp"
+#include "data/match_writer.hpp"
+#include "data/shard_result.hpp"
+#include "text_processing/match_table.hpp"
+#include "text_processing/metrics.hpp"
 
 namespace text_processing {
+    class IndexFile;
+
+    /**
+     * @brief How find_duplicates() of a store finds the matches
+     */
+    enum class MatchEngine {
+        SUFFIX_ARRAY, ///< Adjacent suffixes of the suffix and LCP arrays of builder_type
+        ROLLING_HASH, ///< Rolling hashes of sampled windows, see find_hashed_matches()
+    };
+
+    /**
+     * @brief Settings of a DuplicateFinder
+     */
+    struct FinderOptions {
+        SuffixArrayBuilder::BuilderType builder_type = SuffixArrayBuilder::BuilderType::NAIVE; ///< Builder to use
+        size_t threads = 1; ///< Threads for multithreaded builders and matching, 0 uses one per hardware thread
+
+        /**
+         * Sort suffixes only to min_length characters and extend the candidate
+         * matches afterwards. Reported lengths stay exact, but when several
+         * suffixes share min_length characters their order is arbitrary, so a
+         * different (possibly shorter) match may be reported for a document pair.
+         */
+        bool depth_limited = false;
+
+        size_t memory_budget = 0; ///< Bytes per bucket for the external builder, 0 uses its default
+        std::string scratch_dir;  ///< Directory for the external builder's files, empty uses the system temporary directory
+        bool huge_pages = false;  ///< Advise the naive builder's scratch arrays as transparent huge pages
+
+        /**
+         * Receives phase timings ("build_suffix_array", "scan_matches",
+         * "merge_matches", "sort_matches", "scan_clusters", "write_index"), counts
+         * ("suffixes", "pairs_scanned", "pairs_kept", "clusters") and peak
+         * sizes ("suffix_array", "lcp_array", "match_tables"). Not owned.
+         */
+        Metrics *metrics = nullptr;
+
+        /**
+         * Before building, drop the documents of find_duplicates(store, ...)
+         * that share no winnowing fingerprint with another document, see
+         * find_candidate_documents(). Those documents cannot be part of a
+         * match, and the suffix arrays only cover the candidates. A suffix
+         * running into a separator is ordered by the documents after it,
+         * though: where candidates end in the same min_length characters,
+         * dropping documents can reorder those suffixes, and the pairs of the
+         * documents ending that way may get another match or none. Every
+         * other pair keeps its match, and every match is still a common
+         * substring of at least min_length characters. Used for thresholds of at least
+         * CANDIDATE_MIN_LENGTH. Adds the phase "prefilter" and the counts
+         * "fingerprints", "candidate_documents" and "dropped_documents".
+         */
+        bool prefilter = false;
+
+        /**
+         * Return only the first top_k matches of find_duplicates() of a store
+         * or an index, 0 returns all. The scan keeps the best top_k pairs of
+         * each shard in a TopMatches, so only those are merged and sorted.
+         */
+        size_t top_k = 0;
+
+        /**
+         * Stop find_duplicates() of a store or an index at the first match
+         * and return only that one, for a yes/no answer. With the suffix
+         * arrays it is the first match in suffix order, the one a single
+         * thread finds, for any thread count: shards after the first one with
+         * a match stop, the ones before it scan on; the rolling hash engine
+         * likewise returns the match of the first document with one, see
+         * find_hashed_matches(). The count "pairs_scanned" is the number of
+         * pairs scanned before stopping, which does depend on timing. Takes
+         * precedence over top_k.
+         */
+        bool any_match = false;
+
+        /**
+         * Engine of find_duplicates() of a store. ROLLING_HASH builds no
+         * suffix array; its memory grows with the text over the threshold
+         * and with the matches found rather than 16 or more bytes per
+         * character, so it suits large thresholds. It reports the longest
+         * common substring of every pair, which includes every pair the
+         * suffix arrays report and may add pairs they miss, see
+         * find_hashed_matches(). Adds the phase "hash_matches", the counts
+         * "anchors" and "anchor_hits" and the peak size "anchor_table";
+         * builder_type and depth_limited are not used. Indexes, clusters,
+         * shards and incremental runs always use the suffix arrays.
+         */
+        MatchEngine engine = MatchEngine::SUFFIX_ARRAY;
+    };
+
     /**
      * @brief Class for finding duplicate text between documents using suffix arrays
      */
@@ -16,14 +111,25 @@ namespace text_processing {
         /**
          * @brief Constructor
          * @param builder_type Type of suffix array builder to use
+         * @param threads Threads for multithreaded builders and matching, 0 uses one per hardware thread
          */
         explicit DuplicateFinder(
-            SuffixArrayBuilder::BuilderType builder_type = SuffixArrayBuilder::BuilderType::NAIVE
+            SuffixArrayBuilder::BuilderType builder_type = SuffixArrayBuilder::BuilderType::NAIVE,
+            size_t threads = 1
         );
 
+        /**
+         * @brief Constructor
+         * @param options Builder and search settings
+         */
+        explicit DuplicateFinder(const FinderOptions &options);
+
         /**
          * @brief Find duplicate text between documents
          *
+         * With FinderOptions::top_k only the first top_k matches are returned,
+         * with FinderOptions::any_match at most one.
+         *
          * @param store Document store containing the texts to analyze
          * @param min_length Minimum length of duplicate substring to report
          * @return std::vector<Match> Vector of found matches, sorted by length (descending)
@@ -31,25 +137,208 @@ namespace text_processing {
          */
         std::vector<Match> find_duplicates(const DocumentStore &store, size_t min_length, bool verbose=false);
 
+        /**
+         * @brief find_duplicates() over every document, whether or not prefilter is set
+         */
+        std::vector<Match> find_all_duplicates(const DocumentStore &store, size_t min_length, bool verbose=false);
+
+        /**
+         * @brief Find duplicate text between the documents of a mapped index file
+         *
+         * Reads the arrays straight from the mapping, nothing is built.
+         * FinderOptions::top_k and FinderOptions::any_match apply as for a store.
+         *
+         * @param index Index written by build_index() or IndexFile::write()
+         * @param min_length Minimum length of duplicate substring to report
+         * @return std::vector<Match> Vector of found matches, sorted by length (descending)
+         */
+        [[nodiscard]] std::vector<Match> find_duplicates(const IndexFile &index, size_t min_length) const;
+
+        /**
+         * @brief Find the duplicates that involve documents added after an index was built
+         *
+         * Only the new documents get a suffix array. Each of their suffixes is
+         * binary searched in the index's suffix array, which tells where it
+         * would land in a rebuilt array. The adjacent pairs of that merged
+         * order that involve a new suffix are matched as find_duplicates()
+         * would, so pairs of two new documents and pairs of a new and an
+         * indexed document are both reported. Pairs of two indexed documents
+         * are not, they are unchanged by the new ones.
+         *
+         * Takes O(m log n) suffix comparisons for m new and n indexed
+         * characters instead of a rebuild. Suffixes that compare equal up to
+         * the end of one of the texts may be ordered differently than in a
+         * rebuild, which only matters for matches ending there.
+         *
+         * @param index Index of the existing documents
+         * @param delta New documents, none of them in the index
+         * @param min_length Minimum length of duplicate substring to report
+         * @return std::vector<Match> Matches involving a new document, sorted by length (descending)
+         */
+        [[nodiscard]] std::vector<Match> find_new_duplicates(
+            const IndexFile &index,
+            const DocumentStore &delta,
+            size_t min_length
+        ) const;
+
+        /**
+         * @brief Find maximal repeated substrings shared by several documents
+         *
+         * Instead of a best match per adjacent document pair, every repeat is
+         * reported once with all of its occurrences: boilerplate in 10k
+         * documents is one cluster rather than thousands of pairs. The LCP
+         * intervals of the suffix array are walked with a stack in a single
+         * linear pass, and an interval becomes a cluster if
+         * - its common prefix, cut at document ends, is at least min_length,
+         * - its suffixes are not all preceded by the same character, so the
+         *   repeat cannot be extended to the left (or to the right), and
+         * - it occurs in at least two documents.
+         *
+         * A repeat nested in a longer one is reported as well when it occurs
+         * at more places. Always builds the complete arrays, depth_limited is
+         * ignored.
+         *
+         * @param store Document store containing the texts to analyze
+         * @param min_length Minimum length of a repeated substring to report (at least 1)
+         * @return std::vector<Cluster> Clusters sorted by length (descending), then by occurrence count (descending)
+         * @throw std::runtime_error if suffix array construction fails
+         */
+        std::vector<Cluster> find_clusters(const DocumentStore &store, size_t min_length);
+
+        /**
+         * @brief Find maximal repeated substrings shared by several documents of a mapped index file
+         *
+         * @param index Index written by build_index() or IndexFile::write()
+         * @param min_length Minimum length of a repeated substring to report (at least 1)
+         * @return std::vector<Cluster> Clusters, in the order of find_clusters(const DocumentStore &, size_t)
+         */
+        [[nodiscard]] std::vector<Cluster> find_clusters(const IndexFile &index, size_t min_length) const;
+
+        /**
+         * @brief Build the suffix arrays of a store and save them with its documents as an index file
+         *
+         * Always builds the complete arrays, depth_limited is ignored, so the
+         * index answers every threshold.
+         *
+         * @param store Documents to index
+         * @param path Index file to create or replace
+         * @param label Free text stored with the index, e.g. the domain it covers
+         * @throw std::runtime_error if construction fails or the file cannot be written
+         */
+        void build_index(const DocumentStore &store, const std::string &path, const std::string &label = "");
+
+        /**
+         * @brief Find the best matches among the suffixes of one shard of a store's text
+         *
+         * The suffixes are split by their first bytes into prefix buckets of
+         * at most memory_budget bytes (16 per suffix, 1 GiB by default), and
+         * the buckets, in suffix order, into shards of about equal size. The
+         * plan depends only on the text, the shard count and the budget, so
+         * separate processes agree on it. Only the shard's buckets are
+         * collected, sorted and scanned, one at a time: besides the text a
+         * shard holds one bucket and its match table. The builder type and
+         * depth_limited are not used.
+         *
+         * @param store Document store containing the texts to analyze
+         * @param min_length Minimum length of duplicate substring to report
+         * @param shard Index of the shard, less than shards
+         * @param shards Number of shards
+         * @return ShardResult Result to pass to merge_shards() with those of the other shards
+         * @throw std::invalid_argument if shard is not less than shards
+         */
+        [[nodiscard]] ShardResult find_shard(const DocumentStore &store, size_t min_length, size_t shard,
+                                             size_t shards) const;
+
+        /**
+         * @brief Find the best matches of one shard of the text of an index file
+         *
+         * Uses the text and documents only, so a file of
+         * IndexFile::write_documents() is enough.
+         */
+        [[nodiscard]] ShardResult find_shard(const IndexFile &index, size_t min_length, size_t shard,
+                                             size_t shards) const;
+
+        /**
+         * @brief Merge the results of all shards of a text into the matches of find_duplicates()
+         *
+         * The neighbours on both sides of every shard border are compared,
+         * and the pairs are merged in shard order, so the result equals that
+         * of an unsharded run, ties included.
+         *
+         * @param store Store the shards were found in
+         * @param results One result per shard, in any order
+         * @return std::vector<Match> Matches sorted by length (descending)
+         * @throw std::invalid_argument if the results are not the complete shards of this text and threshold
+         */
+        [[nodiscard]] std::vector<Match> merge_shards(const DocumentStore &store,
+                                                      std::vector<ShardResult> results) const;
+
+        /**
+         * @brief Merge shard results found in an index file, see merge_shards(const DocumentStore &, ...)
+         */
+        [[nodiscard]] std::vector<Match> merge_shards(const IndexFile &index, std::vector<ShardResult> results) const;
+
+        /**
+         * @brief find_duplicates() as local shards, up to threads of them at once
+         *
+         * Each running shard holds one bucket, see find_shard(), so memory
+         * is bounded by the budget and the thread count instead of the text
+         * size.
+         */
+        [[nodiscard]] std::vector<Match> find_duplicates_sharded(const DocumentStore &store, size_t min_length,
+                                                                 size_t shards) const;
+
         static void save_matches_to_json(
             const std::vector<Match> &matches,
             const std::string &filename
         ) {
-            std::ofstream out_file(filename);
-            if (!out_file.is_open()) {
-                throw std::runtime_error("Unable to open file: " + filename);
-            }
-
-            out_file << Match::to_json_array(matches);
-            out_file.close();
+            save_matches(matches, filename, MatchWriter::Format::JSON);
         }
 
+        /**
+         * @brief Record into metrics from now on, nullptr stops recording
+         */
+        void set_metrics(Metrics *metrics) { metrics_ = metrics; }
+
+        /**
+         * @brief Parse an engine from its command line name
+         *
+         * @param name "suffix-array" or "hash"
+         * @throw std::invalid_argument if name is unknown
+         */
+        static MatchEngine engine_from_string(const std::string &name);
+
     private:
         std::unique_ptr<SuffixArrayBuilder> suffix_builder_;
+        DocumentStore selected_; ///< Documents kept by the prefilter, whose text suffix_builder_ refers to
+        bool depth_limited_ = false; ///< Build only to min_length characters
+        size_t threads_ = 1; ///< Matching shards
+        size_t memory_budget_ = 0; ///< Bytes per prefix bucket of find_shard(), 0 uses the external builder's default
+        bool prefilter_ = false; ///< Drop documents without shared fingerprints before building
+        size_t top_k_ = 0; ///< Matches returned by find_duplicates(), 0 returns all
+        bool any_match_ = false; ///< Stop find_duplicates() at the first match
+        MatchEngine engine_ = MatchEngine::SUFFIX_ARRAY; ///< Engine of find_duplicates() of a store
+        Metrics *metrics_ = nullptr; ///< Not owned, may be null
+
+        /**
+         * @brief Build the arrays of a text, timed and measured into metrics_
+         * @throw std::runtime_error if construction fails
+         */
+        void build_arrays(const UTF8String &text, size_t min_length, bool depth_limited);
+
+        /**
+         * @brief find_all_duplicates() with the ROLLING_HASH engine, honouring top_k and any_match
+         */
+        [[nodiscard]] std::vector<Match> find_hashed_duplicates(const DocumentStore &store, size_t min_length) const;
 
         /**
          * @brief Process the LCP array to find duplicate substrings
          *
+         * The LCP array is split into one range per thread. Each range is
+         * reduced into its own MatchTable, then the tables are merged per hash
+         * partition in range order, so ties resolve exactly as in a single pass.
+         * Builders that keep their arrays on disk are read block by block.
+         *
          * @param store Document store for position lookup
          * @param min_length Minimum length threshold
          * @return std::vector<Match> Vector of matches found
@@ -58,6 +347,118 @@ namespace text_processing {
             const DocumentStore &store,
             size_t min_length
         ) const;
+
+        /**
+         * @brief Shard the adjacent suffix pairs, reduce each shard with collect and merge the tables
+         *
+         * @param pairs Number of adjacent suffix pairs
+         * @param min_length Minimum length threshold
+         * @param collect Called as collect(begin, end, table) once per shard
+         * @return std::vector<Match> Matches sorted by length (descending)
+         */
+        template<typename Collect>
+        [[nodiscard]] std::vector<Match> reduce_matches(size_t pairs, size_t min_length, Collect &&collect) const;
+
+        /**
+         * @brief reduce_matches() keeping only the limit best pairs of each shard, see TopMatches
+         *
+         * @param collect Called as collect(begin, end, table) once per shard with a TopMatches
+         * @return std::vector<Match> The first limit matches reduce_matches() would return
+         */
+        template<typename Collect>
+        [[nodiscard]] std::vector<Match> reduce_top_matches(size_t pairs, size_t min_length, size_t limit,
+                                                            Collect &&collect) const;
+
+        /**
+         * @brief Scan the shards until one of them finds a match
+         *
+         * @param collect Called as collect(begin, end, sink) once per shard, returning the pairs it scanned
+         * @return std::vector<Match> The match found, or none
+         */
+        template<typename Collect>
+        [[nodiscard]] std::vector<Match> reduce_any_match(size_t pairs, Collect &&collect) const;
+
+        /**
+         * @brief reduce_matches(), reduce_top_matches() or reduce_any_match(), as the options ask
+         */
+        template<typename Collect>
+        [[nodiscard]] std::vector<Match> reduce_in_mode(size_t pairs, size_t min_length, Collect &&collect) const;
+
+        /**
+         * @brief Sort and scan the prefix buckets of one shard of a text
+         *
+         * @param corpus Document lookup for byte positions
+         * @param text Bytes of the concatenated text
+         * @param threads Threads for sorting a bucket
+         */
+        template<typename Corpus>
+        [[nodiscard]] ShardResult collect_shard(Corpus &corpus, std::string_view text, size_t min_length,
+                                                size_t shard, size_t shards, size_t threads) const;
+
+        /**
+         * @brief Merge shard results in shard order, adding the pairs across shard borders
+         */
+        template<typename Corpus>
+        [[nodiscard]] std::vector<Match> merge_shard_results(Corpus &corpus, std::string_view text,
+                                                           std::vector<ShardResult> results) const;
+
+        /**
+         * @brief Shard the suffix array, collect clusters per shard and sort them
+         *
+         * @param suffixes Number of suffix array entries
+         * @param collect Called as collect(begin, end, clusters) once per shard
+         */
+        template<typename Collect>
+        [[nodiscard]] std::vector<Cluster> reduce_clusters(size_t suffixes, Collect &&collect) const;
+
+        /**
+         * @brief Collect the clusters of the runs starting in the suffix array entries [begin, end)
+         *
+         * A run is a stretch of entries whose neighbours share at least
+         * min_length units, so no cluster spans two runs. A run starting
+         * before begin is skipped, one starting before end is followed to its
+         * end.
+         *
+         * @param corpus Document lookup for the arrays' positions
+         * @param arrays Access to the suffix and LCP arrays by index
+         * @param begin First suffix array index
+         * @param end One past the last suffix array index
+         * @param min_length Minimum length threshold
+         * @param clusters Receives the clusters found
+         */
+        template<typename Corpus, typename Arrays>
+        static void collect_clusters(
+            Corpus &corpus,
+            Arrays &arrays,
+            size_t begin,
+            size_t end,
+            size_t min_length,
+            std::vector<Cluster> &clusters
+        );
+
+        /**
+         * @brief Reduce the adjacent suffix pairs [begin, end) into best matches per document pair
+         *
+         * @param corpus Document lookup for the arrays' positions
+         * @param suffix_array Suffix array, or a block of it covering [begin, end]
+         * @param lcp_array LCP array, or a block of it covering [begin, end)
+         * @param begin First LCP array index
+         * @param end One past the last LCP array index
+         * @param min_length Minimum length threshold
+         * @param best Table receiving the best match per pair of document indices,
+         *             a MatchTable, a TopMatches or a sink that may stop the scan
+         * @return size_t Pairs scanned, fewer than end - begin if best stopped the scan
+         */
+        template<typename Corpus, typename SuffixArray, typename LcpArray, typename Table>
+        static size_t collect_matches(
+            Corpus &corpus,
+            const SuffixArray &suffix_array,
+            const LcpArray &lcp_array,
+            size_t begin,
+            size_t end,
+            size_t min_length,
+            Table &best
+        );
     };
 } // namespace text_processing
 
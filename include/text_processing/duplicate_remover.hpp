@@ -0,0 +1,40 @@
+#ifndef TEXT_PROCESSING_DUPLICATE_REMOVER_HPP
+#define TEXT_PROCESSING_DUPLICATE_REMOVER_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "data/document_store.hpp"
+#include "data/duplicate_match.hpp"
+
+namespace text_processing {
+    /**
+     * @brief New contents of the documents changed by remove_duplicate_spans()
+     *
+     * Parallel vectors, in the order of the documents in the store, ready
+     * for SQLiteHandler::updateRows().
+     */
+    struct DocumentEdits {
+        std::vector<int64_t> sql_ids;      ///< SQL IDs of the changed documents
+        std::vector<std::string> contents; ///< Content left of each document
+        size_t removed = 0;                ///< Characters removed in total
+    };
+
+    /**
+     * @brief Cut the second copy of every match out of its document
+     *
+     * The span [start_pos2, start_pos2 + length) of doc2 is removed, while
+     * doc1, the document with the smaller ID, keeps its copy. Since a removed
+     * span always has a copy in a document with a smaller ID, the text of
+     * every match survives in some document even when matches chain. Spans of
+     * one document are merged before cutting, and matches of documents absent
+     * from the store are ignored.
+     *
+     * @param store Store the matches were found in
+     * @param matches Matches as returned by DuplicateFinder::find_duplicates()
+     * @return DocumentEdits Contents of the documents that lost text
+     */
+    DocumentEdits remove_duplicate_spans(const DocumentStore &store, const std::vector<Match> &matches);
+} // namespace text_processing
+
+#endif //TEXT_PROCESSING_DUPLICATE_REMOVER_HPP
@@ -0,0 +1,175 @@
+#ifndef TEXT_PROCESSING_EXTERNAL_SUFFIX_BUILDER_HPP
+#define TEXT_PROCESSING_EXTERNAL_SUFFIX_BUILDER_HPP
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include "text_processing/suffix_array_builder.hpp"
+#include "text_processing/index_vector.hpp"
+#include "text_processing/utf8_handler.hpp"
+
+namespace text_processing {
+
+/**
+ * @brief Disk-backed suffix array construction by prefix buckets
+ *
+ * Works on the UTF-8 bytes like ByteSuffixBuilder, which yields the same
+ * order and LCP values, but never holds more than one bucket of suffixes:
+ * 1. Counting scans over the text split the suffixes by their first bytes
+ *    into buckets that fit the memory budget; a prefix shared by too many
+ *    suffixes is extended and split again
+ * 2. Each bucket, in lexicographic order, is collected by one scan, sorted by
+ *    comparing its suffixes and appended to the suffix array file
+ * 3. LCP values of adjacent suffixes are computed while sorting and appended
+ *    to the LCP array file
+ *
+ * Both arrays live in a scratch directory that is removed with the builder;
+ * read_arrays() streams them back. Only the text and one bucket are kept in
+ * memory, at the cost of one pass over the text per bucket. The text is the
+ * caller's, referenced and not copied, so it must outlive any get_text()
+ * call. Texts made of long runs of a single repeated piece are sorted slowly,
+ * as every comparison walks the repeat.
+ *
+ * Space complexity: text plus memory_budget bytes, O(n) on disk
+ * Time complexity: O(n * buckets + n log n * average LCP)
+ */
+class ExternalSuffixBuilder : public SuffixArrayBuilder {
+public:
+    /**
+     * @brief Default memory budget for suffix buckets (1 GiB)
+     */
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = size_t{1} << 30;
+
+    /**
+     * @brief Constructor
+     *
+     * @param memory_budget Bytes for the suffixes of one bucket and their LCP values (0 = default)
+     * @param scratch_dir Directory for the array files (empty = system temporary directory)
+     */
+    explicit ExternalSuffixBuilder(size_t memory_budget = DEFAULT_MEMORY_BUDGET, std::string scratch_dir = "");
+
+    /**
+     * @brief Removes the array files
+     */
+    ~ExternalSuffixBuilder() override;
+
+    ExternalSuffixBuilder(const ExternalSuffixBuilder&) = delete;
+    ExternalSuffixBuilder& operator=(const ExternalSuffixBuilder&) = delete;
+
+    /**
+     * @brief Build suffix array from UTF8String into the scratch directory
+     *
+     * @param text Input text to build suffix array from, kept by reference for get_text()
+     * @return true if building was successful
+     * @throw std::runtime_error if building fails, text is empty or files cannot be written
+     */
+    bool build(const UTF8String& text) override;
+
+    /**
+     * @brief Get the suffix array (byte offsets), read completely into memory on first use
+     *
+     * Prefer read_arrays(), which keeps memory bounded.
+     *
+     * @return const reference to the suffix array vector
+     * @throw std::runtime_error if array hasn't been built
+     */
+    [[nodiscard]] const IndexVector& get_array() const override;
+
+    /**
+     * @brief Get the LCP array (byte lengths), read completely into memory on first use
+     *
+     * @return const reference to the LCP array
+     * @throw std::runtime_error if array hasn't been built
+     */
+    [[nodiscard]] const IndexVector& get_lcp_array() const override;
+
+    /**
+     * @brief Get original text the suffix array was built from
+     *
+     * @return const reference to the text passed to the last build, empty before the first
+     */
+    [[nodiscard]] const UTF8String& get_text() const override;
+
+    /**
+     * @brief Check if suffix array has been built
+     *
+     * @return true if suffix array is built and ready
+     */
+    bool is_built() const override;
+
+    /**
+     * @brief Positions and lengths are in bytes
+     */
+    [[nodiscard]] Unit unit() const override { return Unit::BYTE; }
+
+    /**
+     * @brief The arrays are kept on disk
+     */
+    [[nodiscard]] bool in_memory() const override { return false; }
+
+    [[nodiscard]] size_t suffix_count() const override;
+
+    /**
+     * @brief Read a range of both arrays from disk; safe to call from several threads
+     */
+    void read_arrays(size_t begin, size_t end, std::vector<size_t>& sa, std::vector<size_t>& lcp) const override;
+
+    /**
+     * @brief Number of buckets the last build was split into
+     */
+    [[nodiscard]] size_t bucket_count() const { return bucket_count_; }
+
+    /**
+     * @brief Directory holding the array files of the last build
+     */
+    [[nodiscard]] const std::string& scratch_path() const { return scratch_path_; }
+
+private:
+    size_t memory_budget_;               ///< Bytes for one bucket
+    std::string scratch_dir_;            ///< Parent of the per-build directory
+    std::string scratch_path_;           ///< Directory of the array files, empty before a build
+    const UTF8String* text_ = nullptr;   ///< Text of the last build, not owned
+    IndexVector::Width width_ = IndexVector::Width::UINT32; ///< Entry width of the files
+    size_t suffix_count_ = 0;            ///< Number of suffix array entries
+    size_t bucket_count_ = 0;            ///< Buckets of the last build
+    bool is_built_ = false;              ///< Construction state flag
+
+    mutable std::mutex load_mutex_;      ///< Guards the arrays loaded by get_array()
+    mutable IndexVector suffix_array_;   ///< Loaded suffix array, empty until requested
+    mutable IndexVector lcp_array_;      ///< Loaded LCP array, empty until requested
+    mutable bool arrays_loaded_ = false; ///< Whether suffix_array_ and lcp_array_ are filled
+
+    /**
+     * @brief Sort all buckets and write the arrays with Index-typed entries
+     */
+    template<typename Index>
+    void build_arrays();
+
+    /**
+     * @brief Read entries [begin, end) of one array file
+     */
+    template<typename Index>
+    void read_file(const std::string& name, size_t begin, size_t end, std::vector<size_t>& out) const;
+
+    /**
+     * @brief Load both arrays into memory for get_array() and get_lcp_array()
+     */
+    void load_arrays() const;
+
+    /**
+     * @brief Delete the files of the last build
+     */
+    void remove_scratch();
+
+    /**
+     * @brief Validate input text
+     *
+     * @param text Text to validate
+     * @throw std::runtime_error if text is empty
+     */
+    static void validate_input(const UTF8String& text);
+};
+
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_EXTERNAL_SUFFIX_BUILDER_HPP
@@ -0,0 +1,59 @@
+#ifndef TEXT_PROCESSING_HASH_MATCHER_HPP
+#define TEXT_PROCESSING_HASH_MATCHER_HPP
+
+#include <cstddef>
+#include <vector>
+#include "data/document_store.hpp"
+#include "data/duplicate_match.hpp"
+
+namespace text_processing {
+    /**
+     * @brief Sizes of a find_hashed_matches() run
+     */
+    struct HashMatchStats {
+        size_t anchors = 0;      ///< Sampled windows indexed
+        size_t anchor_hits = 0;  ///< Window hash hits extended into matches
+        size_t anchor_bytes = 0; ///< Bytes of the anchor table and its bucket index
+    };
+
+    /**
+     * @brief Best match per document pair from Karp-Rabin fingerprints, without a suffix array
+     *
+     * A substring of min_length characters starting at character a of a
+     * document contains the window of w = min_length - s + 1 characters
+     * starting at the first multiple of s = max(1, min_length / 2) from a.
+     * Only those sampled windows (anchors) are hashed into a table, about
+     * one per s characters. Then every window of every document is hashed
+     * and looked up among the anchors of the documents before it; each hit
+     * is compared character by character and extended to both sides into a
+     * maximal match, once per diagonal. So the work beyond hashing is
+     * proportional to the number of hits, and hash collisions cost only a
+     * comparison.
+     *
+     * Hashes are computed over the IntegerText view of the store's text,
+     * from prefix hashes, so every window is the same independent multiply
+     * and subtract and documents are hashed in parallel.
+     *
+     * Every pair gets its longest common substring, on ties the one
+     * starting first in the later of its documents in store order. That is
+     * the length the suffix array scan of DuplicateFinder reports when the
+     * pair's occurrences are adjacent suffixes, as they always are for two
+     * documents; with a third document's copy sorted between them, that
+     * scan reports a shorter match or none, so this returns every pair it
+     * does and possibly more.
+     *
+     * @param store Documents to match
+     * @param min_length Minimum match length in characters, at least 1
+     * @param threads Threads hashing and matching documents (0 = hardware threads)
+     * @param first_only Stop at the first match and return only it: the first document in store
+     *        order with one, at its first window with one, against the earliest document there.
+     *        That is the same for any thread count; only stats->anchor_hits depends on timing
+     * @param stats If not null, receives the sizes of the run
+     * @return std::vector<Match> One match per document pair, in no particular order
+     */
+    [[nodiscard]] std::vector<Match> find_hashed_matches(const DocumentStore &store, size_t min_length,
+                                                         size_t threads = 1, bool first_only = false,
+                                                         HashMatchStats *stats = nullptr);
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_HASH_MATCHER_HPP
@@ -0,0 +1,208 @@
+#ifndef TEXT_PROCESSING_INDEX_FILE_HPP
+#define TEXT_PROCESSING_INDEX_FILE_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "data/document_store.hpp"
+#include "text_processing/suffix_array_builder.hpp"
+
+namespace text_processing {
+
+/**
+ * @brief Read-only view of a typed array inside a mapped file
+ */
+template<typename T>
+struct ArrayView {
+    const T* data = nullptr;
+    size_t count = 0;
+
+    size_t operator[](size_t index) const { return data[index]; }
+    [[nodiscard]] size_t size() const { return count; }
+};
+
+/**
+ * @brief Versioned on-disk index of a document store and its suffix arrays
+ *
+ * The file holds the concatenated text, the suffix and LCP arrays, the
+ * document table, a character count per 64-byte block and a byte offset
+ * per 64-character block, each section
+ * 8-byte aligned behind a fixed header. Opening maps the file read-only and
+ * points into it, so nothing is parsed or copied: a query costs only the
+ * pages it touches.
+ *
+ * The format uses the native byte order and is rejected on machines with
+ * another one, like any other version mismatch.
+ *
+ * Example:
+ * @code
+ *     IndexFile::write("docs.idx", store, builder, "example.com");
+ *     IndexFile index("docs.idx");
+ *     auto matches = finder.find_duplicates(index, 50);
+ * @endcode
+ */
+class IndexFile {
+public:
+    /**
+     * @brief Format version written by write() and accepted by the constructor
+     */
+    static constexpr uint32_t VERSION = 2;
+
+    /**
+     * @brief Write an index of store using the arrays of a builder built on its text
+     *
+     * The file is written next to path and renamed into place, so readers
+     * never see a partial index.
+     *
+     * @param path File to create or replace
+     * @param store Documents the builder was built on
+     * @param builder Suffix array builder built on the store's text (unused for an empty store)
+     * @param label Free text stored with the index, e.g. the domain it covers
+     * @throw std::runtime_error if the builder is not built or the file cannot be written
+     */
+    static void write(const std::string& path, const DocumentStore& store,
+                      const SuffixArrayBuilder& builder, const std::string& label = "");
+
+    /**
+     * @brief Write an index of store without suffix arrays, e.g. as the shared input of shard workers
+     *
+     * Holds everything but the arrays, so it costs no suffix array build;
+     * has_arrays() is false for it unless the store is empty.
+     *
+     * @throw std::runtime_error if the file cannot be written
+     */
+    static void write_documents(const std::string& path, const DocumentStore& store, const std::string& label = "");
+
+    /**
+     * @brief Map an index file
+     *
+     * @param path File written by write()
+     * @throw std::runtime_error if the file cannot be mapped, is truncated or has another version
+     */
+    explicit IndexFile(const std::string& path);
+
+    ~IndexFile();
+
+    IndexFile(const IndexFile&) = delete;
+    IndexFile& operator=(const IndexFile&) = delete;
+    IndexFile(IndexFile&& other) noexcept;
+    IndexFile& operator=(IndexFile&& other) noexcept;
+
+    /**
+     * @brief Label given to write()
+     */
+    [[nodiscard]] std::string_view label() const { return label_; }
+
+    /**
+     * @brief Concatenated text of all documents
+     */
+    [[nodiscard]] std::string_view text() const { return text_; }
+
+    /**
+     * @brief Number of characters in text()
+     */
+    [[nodiscard]] size_t char_count() const { return char_count_; }
+
+    /**
+     * @brief Unit of the suffix array positions and LCP values
+     */
+    [[nodiscard]] SuffixArrayBuilder::Unit unit() const { return unit_; }
+
+    /**
+     * @brief Number of suffix array entries
+     */
+    [[nodiscard]] size_t suffix_count() const { return suffix_count_; }
+
+    /**
+     * @brief False for a file of write_documents(), whose suffix queries need a build first
+     */
+    [[nodiscard]] bool has_arrays() const { return suffix_count_ > 0 || char_count_ == 0; }
+
+    /**
+     * @brief Number of documents
+     */
+    [[nodiscard]] size_t document_count() const { return document_count_; }
+
+    /**
+     * @brief Document at an index returned by document_index()
+     */
+    [[nodiscard]] DocumentPosition document(size_t index) const;
+
+    /**
+     * @brief Index of the document containing pos (in unit()), or DocumentStore::NO_DOCUMENT
+     *
+     * Follows DocumentStore::document_index(): a document owns the separator
+     * after it, except for the last one. Takes O(log documents).
+     */
+    [[nodiscard]] size_t document_index(size_t pos) const;
+
+    /**
+     * @brief Index of the document containing a byte offset, see document_index()
+     */
+    [[nodiscard]] size_t document_index_by_byte(size_t byte_pos) const;
+
+    /**
+     * @brief Largest SQL ID of all documents, INT64_MIN if there are none
+     */
+    [[nodiscard]] int64_t max_sql_id() const;
+
+    /**
+     * @brief Character index of a byte offset on a character boundary, like UTF8String::char_index()
+     */
+    [[nodiscard]] size_t char_index(size_t byte_pos) const;
+
+    /**
+     * @brief Byte offset of a character index, like UTF8String::byte_offset()
+     */
+    [[nodiscard]] size_t byte_offset(size_t char_pos) const;
+
+    /**
+     * @brief Call fn(sa, lcp) with ArrayView<uint32_t> or ArrayView<uint64_t> views of both arrays
+     */
+    template<typename Fn>
+    decltype(auto) visit_arrays(Fn&& fn) const {
+        if (width_ == sizeof(uint32_t)) {
+            return fn(ArrayView<uint32_t>{static_cast<const uint32_t*>(sa_), suffix_count_},
+                      ArrayView<uint32_t>{static_cast<const uint32_t*>(lcp_), lcp_count()});
+        }
+        return fn(ArrayView<uint64_t>{static_cast<const uint64_t*>(sa_), suffix_count_},
+                  ArrayView<uint64_t>{static_cast<const uint64_t*>(lcp_), lcp_count()});
+    }
+
+private:
+    struct Document; ///< Record of the document table
+
+    void* mapping_ = nullptr;    ///< Start of the mapped file
+    size_t mapping_size_ = 0;    ///< Mapped bytes
+    std::string_view label_;
+    std::string_view text_;
+    SuffixArrayBuilder::Unit unit_ = SuffixArrayBuilder::Unit::CHARACTER;
+    size_t width_ = 0;           ///< Bytes per array entry
+    size_t char_count_ = 0;      ///< Characters in the text
+    size_t suffix_count_ = 0;
+    size_t document_count_ = 0;
+    const void* sa_ = nullptr;
+    const void* lcp_ = nullptr;
+    const Document* documents_ = nullptr;
+    const uint64_t* block_chars_ = nullptr;  ///< Characters before every 64-byte block
+    const uint64_t* char_samples_ = nullptr; ///< Byte offset of every 64th character
+
+    [[nodiscard]] size_t lcp_count() const { return suffix_count_ == 0 ? 0 : suffix_count_ - 1; }
+
+    /**
+     * @brief Write a file with the arrays of builder, or none for nullptr
+     */
+    static void write_file(const std::string& path, const DocumentStore& store,
+                           const SuffixArrayBuilder* builder, const std::string& label);
+
+    /**
+     * @brief Document containing pos, measured by the given record fields
+     */
+    [[nodiscard]] size_t lookup(size_t pos, size_t total, uint64_t Document::*start, uint64_t Document::*length) const;
+
+    void unmap();
+};
+
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_INDEX_FILE_HPP
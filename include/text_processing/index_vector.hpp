@@ -0,0 +1,245 @@
+#ifndef TEXT_PROCESSING_INDEX_VECTOR_HPP
+#define TEXT_PROCESSING_INDEX_VECTOR_HPP
+
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace text_processing {
+    /**
+     * @brief Vector of text positions stored in 32 or 64 bits, chosen at runtime
+     *
+     * Suffix arrays, LCP arrays and character indexes of texts shorter than 4G
+     * positions only need 32-bit entries, which halves their memory and doubles
+     * the number of entries per cache line. Values are always exposed as size_t;
+     * hot loops can use visit() to work on the typed storage directly.
+     *
+     * Example:
+     * @code
+     *     IndexVector sa(IndexVector::width_for(n), n);
+     *     sa.visit([](auto &values) {
+     *         // values is std::vector<uint32_t> or std::vector<uint64_t>
+     *     });
+     * @endcode
+     */
+    class IndexVector {
+    public:
+        class const_iterator; // Forward declaration
+
+        /**
+         * @brief Storage width of the entries
+         */
+        enum class Width {
+            UINT32, ///< Values below 2^32 - 1
+            UINT64, ///< Any value
+        };
+
+        /**
+         * @brief Default constructor creates an empty 32-bit vector
+         */
+        IndexVector() = default;
+
+        /**
+         * @brief Create a zero-filled vector of given width and size
+         */
+        explicit IndexVector(Width width, size_t size = 0) : width_(width) {
+            resize(size);
+        }
+
+        /**
+         * @brief Adopt typed storage without copying
+         */
+        explicit IndexVector(std::vector<uint32_t> &&values) : u32_(std::move(values)), width_(Width::UINT32) {
+        }
+
+        explicit IndexVector(std::vector<uint64_t> &&values) : u64_(std::move(values)), width_(Width::UINT64) {
+        }
+
+        /**
+         * @brief Narrowest width able to hold values up to max_value
+         *
+         * The largest 32-bit value is kept free so algorithms can use it as a marker.
+         */
+        static Width width_for(size_t max_value) {
+            return max_value < std::numeric_limits<uint32_t>::max() ? Width::UINT32 : Width::UINT64;
+        }
+
+        /**
+         * @brief Call visitor with the typed storage vector
+         */
+        template<typename Visitor>
+        decltype(auto) visit(Visitor &&visitor) {
+            return width_ == Width::UINT32 ? visitor(u32_) : visitor(u64_);
+        }
+
+        template<typename Visitor>
+        decltype(auto) visit(Visitor &&visitor) const {
+            return width_ == Width::UINT32 ? visitor(u32_) : visitor(u64_);
+        }
+
+        [[nodiscard]] Width width() const { return width_; }
+
+        [[nodiscard]] size_t size() const { return width_ == Width::UINT32 ? u32_.size() : u64_.size(); }
+
+        [[nodiscard]] bool empty() const { return size() == 0; }
+
+        /**
+         * @brief Get value at index (no bounds check, like std::vector)
+         */
+        size_t operator[](size_t index) const {
+            return width_ == Width::UINT32 ? u32_[index] : u64_[index];
+        }
+
+        /**
+         * @brief Set value at index, the value must fit the current width
+         */
+        void set(size_t index, size_t value) {
+            if (width_ == Width::UINT32) {
+                u32_[index] = static_cast<uint32_t>(value);
+            } else {
+                u64_[index] = value;
+            }
+        }
+
+        /**
+         * @brief Append a value, widening the storage if it does not fit
+         */
+        void push_back(size_t value) {
+            if (width_ == Width::UINT32) {
+                if (value < std::numeric_limits<uint32_t>::max()) {
+                    u32_.push_back(static_cast<uint32_t>(value));
+                    return;
+                }
+                widen();
+            }
+            u64_.push_back(value);
+        }
+
+        void reserve(size_t size) {
+            visit([size](auto &values) { values.reserve(size); });
+        }
+
+        void resize(size_t size) {
+            visit([size](auto &values) { values.resize(size); });
+        }
+
+        void clear() {
+            visit([](auto &values) { values.clear(); });
+        }
+
+        void shrink_to_fit() {
+            visit([](auto &values) { values.shrink_to_fit(); });
+        }
+
+        /**
+         * @brief Convert 32-bit storage to 64-bit storage
+         */
+        void widen() {
+            if (width_ == Width::UINT64) {
+                return;
+            }
+            u64_.assign(u32_.begin(), u32_.end());
+            u32_ = std::vector<uint32_t>();
+            width_ = Width::UINT64;
+        }
+
+        /**
+         * @brief Bytes held by the storage
+         */
+        [[nodiscard]] size_t memory_bytes() const {
+            return u32_.capacity() * sizeof(uint32_t) + u64_.capacity() * sizeof(uint64_t);
+        }
+
+        /**
+         * @brief Copy values into a std::vector<size_t>
+         */
+        [[nodiscard]] std::vector<size_t> to_vector() const {
+            std::vector<size_t> out(size());
+            for (size_t i = 0; i < out.size(); ++i) {
+                out[i] = (*this)[i];
+            }
+            return out;
+        }
+
+        [[nodiscard]] const_iterator begin() const;
+
+        [[nodiscard]] const_iterator end() const;
+
+        /**
+         * @brief Value comparison, independent of the storage width
+         */
+        bool operator==(const IndexVector &other) const {
+            if (size() != other.size()) return false;
+            for (size_t i = 0; i < size(); ++i) {
+                if ((*this)[i] != other[i]) return false;
+            }
+            return true;
+        }
+
+        bool operator!=(const IndexVector &other) const { return !(*this == other); }
+
+        friend bool operator==(const IndexVector &lhs, const std::vector<size_t> &rhs) {
+            if (lhs.size() != rhs.size()) return false;
+            for (size_t i = 0; i < rhs.size(); ++i) {
+                if (lhs[i] != rhs[i]) return false;
+            }
+            return true;
+        }
+
+        friend bool operator==(const std::vector<size_t> &lhs, const IndexVector &rhs) { return rhs == lhs; }
+
+        friend bool operator!=(const IndexVector &lhs, const std::vector<size_t> &rhs) { return !(lhs == rhs); }
+
+        friend bool operator!=(const std::vector<size_t> &lhs, const IndexVector &rhs) { return !(rhs == lhs); }
+
+    private:
+        std::vector<uint32_t> u32_; ///< Values when width_ == UINT32
+        std::vector<uint64_t> u64_; ///< Values when width_ == UINT64
+        Width width_ = Width::UINT32; ///< Active storage
+    };
+
+    /**
+     * @brief Read-only iterator yielding size_t values
+     */
+    class IndexVector::const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const size_t *;
+        using reference = size_t;
+
+        const_iterator() = default;
+
+        const_iterator(const IndexVector *vec, size_t pos) : vec_(vec), pos_(pos) {
+        }
+
+        size_t operator*() const { return (*vec_)[pos_]; }
+
+        const_iterator &operator++() {
+            ++pos_;
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator tmp = *this;
+            ++pos_;
+            return tmp;
+        }
+
+        bool operator==(const const_iterator &other) const { return vec_ == other.vec_ && pos_ == other.pos_; }
+
+        bool operator!=(const const_iterator &other) const { return !(*this == other); }
+
+    private:
+        const IndexVector *vec_ = nullptr;
+        size_t pos_ = 0;
+    };
+
+    inline IndexVector::const_iterator IndexVector::begin() const { return {this, 0}; }
+
+    inline IndexVector::const_iterator IndexVector::end() const { return {this, size()}; }
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_INDEX_VECTOR_HPP
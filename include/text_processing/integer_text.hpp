@@ -0,0 +1,110 @@
+#ifndef TEXT_PROCESSING_INTEGER_TEXT_HPP
+#define TEXT_PROCESSING_INTEGER_TEXT_HPP
+
+#include <cstdint>
+#include <vector>
+#include "text_processing/utf8_handler.hpp"
+
+namespace text_processing {
+    /**
+     * @brief Compact integer view of a UTF8String for suffix array construction
+     *
+     * Every character is replaced by its rank in the sorted alphabet of the text.
+     * Ranks start at 1 and preserve code point (and therefore UTF-8 byte) order;
+     * 0 is reserved for a terminating sentinel stored right after the last symbol.
+     * Symbols are stored in the narrowest unsigned type that fits the alphabet,
+     * so the hot loops of the builders read contiguous memory and never allocate.
+     *
+     * Example:
+     * @code
+     *     IntegerText view(UTF8String("banana"));
+     *     // view[0] == 2 ('b'), view[1] == 1 ('a'), view[2] == 3 ('n')
+     *     view.visit([](const auto* symbols) {
+     *         // symbols[0..length()] with symbols[length()] == 0
+     *     });
+     * @endcode
+     */
+    class IntegerText {
+    public:
+        /**
+         * @brief Storage width of the symbols
+         */
+        enum class Width {
+            UINT8, ///< Up to 255 distinct characters
+            UINT16, ///< Up to 65535 distinct characters
+            UINT32, ///< Any alphabet
+        };
+
+        /**
+         * @brief Default constructor creates an empty view
+         */
+        IntegerText() : u8_(1, 0) {
+        }
+
+        /**
+         * @brief Build the view of a UTF-8 string
+         *
+         * @param text Validated UTF-8 text
+         */
+        explicit IntegerText(const UTF8String &text);
+
+        /**
+         * @brief Number of symbols (characters), sentinel excluded
+         */
+        [[nodiscard]] size_t length() const { return length_; }
+
+        /**
+         * @brief Number of distinct characters, sentinel excluded
+         */
+        [[nodiscard]] size_t alphabet_size() const { return alphabet_.size(); }
+
+        /**
+         * @brief Storage width chosen for this alphabet
+         */
+        [[nodiscard]] Width width() const { return width_; }
+
+        /**
+         * @brief Get symbol at index, index == length() returns the sentinel
+         * @throws std::out_of_range if index is invalid
+         */
+        [[nodiscard]] uint32_t operator[](size_t index) const;
+
+        /**
+         * @brief Map a symbol back to its Unicode code point
+         * @throws std::out_of_range if symbol is not part of the alphabet
+         */
+        [[nodiscard]] uint32_t code_point(uint32_t symbol) const;
+
+        /**
+         * @brief Call visitor with a typed pointer to the symbols
+         *
+         * The pointer addresses length() + 1 symbols, the last one being the 0 sentinel.
+         * Lets callers instantiate their inner loops once per storage width.
+         */
+        template<typename Visitor>
+        decltype(auto) visit(Visitor &&visitor) const {
+            switch (width_) {
+                case Width::UINT8:
+                    return visitor(u8_.data());
+                case Width::UINT16:
+                    return visitor(u16_.data());
+                default:
+                    return visitor(u32_.data());
+            }
+        }
+
+    private:
+        std::vector<uint8_t> u8_; ///< Symbols when width_ == UINT8
+        std::vector<uint16_t> u16_; ///< Symbols when width_ == UINT16
+        std::vector<uint32_t> u32_; ///< Symbols when width_ == UINT32
+        std::vector<uint32_t> alphabet_; ///< alphabet_[symbol - 1] = code point
+        Width width_ = Width::UINT8; ///< Active storage
+        size_t length_ = 0; ///< Number of symbols
+
+        template<typename Symbol>
+        void fill(std::vector<Symbol> &out, const std::string &data,
+                  const std::vector<uint32_t> &rank_of);
+    };
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_INTEGER_TEXT_HPP
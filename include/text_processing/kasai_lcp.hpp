@@ -0,0 +1,173 @@
+#ifndef TEXT_PROCESSING_KASAI_LCP_HPP
+#define TEXT_PROCESSING_KASAI_LCP_HPP
+
+#include <limits>
+#include <vector>
+#include "text_processing/parallel.hpp"
+
+namespace text_processing {
+    /**
+     * @brief Build the LCP array of a suffix array using Kasai's algorithm
+     *
+     * lcp[i] is the length of the longest common prefix of the suffixes
+     * sa[i] and sa[i + 1]. The symbols must be followed by a unique sentinel
+     * (as provided by IntegerText), which ends every comparison without
+     * bounds checks.
+     *
+     * Time complexity: O(n)
+     *
+     * @param s Symbols of the text, s[sa.size()] is the sentinel
+     * @param sa Suffix array of the text (sentinel excluded)
+     * @param lcp Output LCP array, resized to sa.size() - 1
+     * @param rank Scratch array for the rank of every suffix, resized to sa.size()
+     */
+    template<typename Symbol, typename Index>
+    void kasai_lcp(const Symbol *s, const std::vector<Index> &sa, std::vector<Index> &lcp,
+                   std::vector<Index> &rank) {
+        const size_t n = sa.size();
+        rank.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            rank[sa[i]] = static_cast<Index>(i);
+        }
+        lcp.assign(n - 1, 0);
+
+        size_t k = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (rank[i] == n - 1) {
+                k = 0;
+                continue;
+            }
+
+            size_t j = sa[rank[i] + 1];
+            while (s[i + k] == s[j + k]) {
+                k++;
+            }
+
+            lcp[rank[i]] = static_cast<Index>(k);
+            if (k > 0) k--;
+        }
+    }
+
+    template<typename Symbol, typename Index>
+    void kasai_lcp(const Symbol *s, const std::vector<Index> &sa, std::vector<Index> &lcp) {
+        std::vector<Index> rank;
+        kasai_lcp(s, sa, lcp, rank);
+    }
+
+    /**
+     * @brief Kasai's algorithm over a suffix array sorted only to depth characters
+     *
+     * cls holds the equivalence class of the first len >= depth symbols of
+     * every suffix, as left by prefix doubling. Adjacent suffixes of the same
+     * class share at least depth symbols and get depth without comparing
+     * anything. Other pairs are compared up to depth; Kasai's lower bound only
+     * holds below depth, so the running match restarts after a capped value.
+     *
+     * @param s Symbols of the text, s[sa.size()] is the sentinel
+     * @param sa Suffix array of the text sorted by the first len symbols (sentinel excluded)
+     * @param cls Class of every position's first len symbols
+     * @param depth LCP cap, at most len
+     * @param lcp Output LCP array, resized to sa.size() - 1
+     * @param rank Scratch array for the rank of every suffix, resized to sa.size()
+     */
+    template<typename Symbol, typename Index>
+    void capped_kasai_lcp(const Symbol *s, const std::vector<Index> &sa, const std::vector<Index> &cls,
+                          size_t depth, std::vector<Index> &lcp, std::vector<Index> &rank) {
+        const size_t n = sa.size();
+        rank.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            rank[sa[i]] = static_cast<Index>(i);
+        }
+        lcp.assign(n - 1, 0);
+
+        size_t k = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (rank[i] == n - 1) {
+                k = 0;
+                continue;
+            }
+
+            size_t j = sa[rank[i] + 1];
+            if (cls[i] == cls[j]) {
+                lcp[rank[i]] = static_cast<Index>(depth);
+                k = 0;
+                continue;
+            }
+            while (k < depth && s[i + k] == s[j + k]) {
+                k++;
+            }
+
+            lcp[rank[i]] = static_cast<Index>(k);
+            if (k == depth) {
+                k = 0;
+            } else if (k > 0) {
+                k--;
+            }
+        }
+    }
+
+    template<typename Symbol, typename Index>
+    void capped_kasai_lcp(const Symbol *s, const std::vector<Index> &sa, const std::vector<Index> &cls,
+                          size_t depth, std::vector<Index> &lcp) {
+        std::vector<Index> rank;
+        capped_kasai_lcp(s, sa, cls, depth, lcp, rank);
+    }
+
+    /**
+     * @brief Build the LCP array with the permuted LCP (PLCP) method on several threads
+     *
+     * phi[sa[i]] = sa[i - 1] links every suffix to its predecessor in suffix
+     * order. PLCP[i] = lcp(i, phi[i]) satisfies PLCP[i + 1] >= PLCP[i] - 1 in
+     * text order, so each chunk of text positions is solved independently
+     * like Kasai, restarting from zero at the chunk start. The result equals
+     * kasai_lcp() for any thread count.
+     *
+     * Time complexity: O(n) work, plus at most one longest match per chunk
+     *
+     * @param s Symbols of the text, s[sa.size()] is the sentinel
+     * @param sa Suffix array of the text (sentinel excluded)
+     * @param lcp Output LCP array, resized to sa.size() - 1
+     * @param threads Number of threads (0 = hardware threads)
+     */
+    template<typename Symbol, typename Index>
+    void parallel_plcp_lcp(const Symbol *s, const std::vector<Index> &sa, std::vector<Index> &lcp,
+                           size_t threads) {
+        constexpr Index NONE = std::numeric_limits<Index>::max();
+        const size_t n = sa.size();
+
+        // plcp holds phi first and is overwritten in place position by position
+        std::vector<Index> plcp(n);
+        plcp[sa[0]] = NONE;
+        parallel_for(1, n, threads, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; i++) {
+                plcp[sa[i]] = sa[i - 1];
+            }
+        });
+
+        parallel_for(0, n, threads, [&](size_t begin, size_t end, size_t) {
+            size_t k = 0;
+            for (size_t i = begin; i < end; i++) {
+                size_t j = plcp[i];
+                if (j == NONE) {
+                    plcp[i] = 0;
+                    k = 0;
+                    continue;
+                }
+                while (s[i + k] == s[j + k]) {
+                    k++;
+                }
+                plcp[i] = static_cast<Index>(k);
+                if (k > 0) k--;
+            }
+        });
+
+        lcp.resize(n - 1);
+        parallel_for(0, n - 1, threads, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; i++) {
+                lcp[i] = plcp[sa[i + 1]];
+            }
+        });
+    }
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_KASAI_LCP_HPP
@@ -0,0 +1,232 @@
+#ifndef TEXT_PROCESSING_MATCH_TABLE_HPP
+#define TEXT_PROCESSING_MATCH_TABLE_HPP
+
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+#include "data/duplicate_match.hpp"
+
+namespace text_processing {
+    /**
+     * @brief Flat open-addressing table holding the best match per document pair
+     *
+     * Keys are pairs of document indices. Slots live in one array with linear
+     * probing, so an update touches one or two cache lines and never
+     * allocates except when the table doubles.
+     *
+     * Example:
+     * @code
+     *     MatchTable best;
+     *     best.update(0, 3, match);    // kept
+     *     best.update(0, 3, shorter);  // ignored
+     * @endcode
+     */
+    class MatchTable {
+    public:
+        /**
+         * @brief Create a table sized for about expected pairs
+         */
+        explicit MatchTable(size_t expected = 0) {
+            size_t capacity = MIN_CAPACITY;
+            while (capacity < expected * 2) {
+                capacity *= 2;
+            }
+            slots_.resize(capacity);
+        }
+
+        /**
+         * @brief Store match for the pair unless an equally long or longer one is stored
+         *
+         * The first of several equally long matches wins, as with the ordered map
+         * this table replaces.
+         *
+         * @param key1 Smaller document index
+         * @param key2 Larger document index
+         * @param match Candidate match
+         */
+        void update(size_t key1, size_t key2, const Match &match) {
+            Slot &slot = find(key1, key2);
+            if (slot.key1 == EMPTY) {
+                slot.key1 = key1;
+                slot.key2 = key2;
+                slot.match = match;
+                if (++size_ * 2 > slots_.size()) {
+                    grow();
+                }
+            } else if (match.length > slot.match.length) {
+                slot.match = match;
+            }
+        }
+
+        [[nodiscard]] size_t size() const { return size_; }
+
+        /**
+         * @brief Bytes held by the slots
+         */
+        [[nodiscard]] size_t memory_bytes() const { return slots_.capacity() * sizeof(Slot); }
+
+        /**
+         * @brief Call fn(key1, key2, match) for every stored pair, in slot order
+         */
+        template<typename Fn>
+        void for_each(Fn &&fn) const {
+            for (const auto &slot: slots_) {
+                if (slot.key1 != EMPTY) {
+                    fn(slot.key1, slot.key2, slot.match);
+                }
+            }
+        }
+
+        /**
+         * @brief Hash of a pair of document indices (splitmix64 finalizer)
+         */
+        static uint64_t hash(size_t key1, size_t key2) {
+            uint64_t x = static_cast<uint64_t>(key1) * 0x9E3779B97F4A7C15ULL ^ static_cast<uint64_t>(key2);
+            x ^= x >> 30;
+            x *= 0xBF58476D1CE4E5B9ULL;
+            x ^= x >> 27;
+            x *= 0x94D049BB133111EBULL;
+            x ^= x >> 31;
+            return x;
+        }
+
+    private:
+        static constexpr size_t EMPTY = SIZE_MAX;
+        static constexpr size_t MIN_CAPACITY = 16;
+
+        struct Slot {
+            size_t key1 = EMPTY;
+            size_t key2 = 0;
+            Match match{};
+        };
+
+        std::vector<Slot> slots_; ///< Power-of-two number of slots
+        size_t size_ = 0;         ///< Occupied slots
+
+        Slot &find(size_t key1, size_t key2) {
+            const size_t mask = slots_.size() - 1;
+            for (size_t i = hash(key1, key2) & mask;; i = (i + 1) & mask) {
+                Slot &slot = slots_[i];
+                if (slot.key1 == EMPTY || (slot.key1 == key1 && slot.key2 == key2)) {
+                    return slot;
+                }
+            }
+        }
+
+        void grow() {
+            std::vector<Slot> old(slots_.size() * 2);
+            old.swap(slots_);
+            for (const auto &slot: old) {
+                if (slot.key1 != EMPTY) {
+                    find(slot.key1, slot.key2) = slot;
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief Best match per document pair, for only the limit best pairs seen so far
+     *
+     * Pairs are ranked by their best match in the order of Match::operator<,
+     * so its entries are the first limit matches a MatchTable fed the same
+     * updates would give after sorting. Once limit pairs are held, a match
+     * shorter than the worst of them is rejected after one comparison,
+     * without a lookup; a better match of a new pair evicts the worst. An
+     * evicted pair can come back with a longer match.
+     *
+     * Example:
+     * @code
+     *     TopMatches top(10);
+     *     top.update(0, 3, match);
+     * @endcode
+     */
+    class TopMatches {
+    public:
+        /**
+         * @brief Create a table for at most limit pairs
+         */
+        explicit TopMatches(size_t limit = 0) : limit_(limit) {
+        }
+
+        /**
+         * @brief Store match for the pair if it is longer than the pair's, and the pair is among the best
+         *
+         * As with MatchTable::update(), the first of several equally long
+         * matches of a pair wins.
+         *
+         * @param key1 Smaller document index
+         * @param key2 Larger document index
+         * @param match Candidate match
+         */
+        void update(size_t key1, size_t key2, const Match &match) {
+            if (limit_ == 0 || (ranked_.size() == limit_ && match.length < ranked_.rbegin()->match.length)) {
+                return;
+            }
+            const Entry entry{match, key1, key2};
+            auto stored = best_.find({key1, key2});
+            if (stored != best_.end()) {
+                if (match.length > stored->second.length) {
+                    ranked_.erase(Entry{stored->second, key1, key2});
+                    stored->second = match;
+                    ranked_.insert(entry);
+                }
+                return;
+            }
+            if (ranked_.size() == limit_) {
+                auto worst = std::prev(ranked_.end());
+                if (!(entry < *worst)) {
+                    return;
+                }
+                best_.erase({worst->key1, worst->key2});
+                ranked_.erase(worst);
+            }
+            best_.emplace(std::make_pair(key1, key2), match);
+            ranked_.insert(entry);
+        }
+
+        [[nodiscard]] size_t size() const { return ranked_.size(); }
+
+        [[nodiscard]] size_t limit() const { return limit_; }
+
+        /**
+         * @brief Bytes held by the entries, counting a tree node of each container as four pointers
+         */
+        [[nodiscard]] size_t memory_bytes() const {
+            constexpr size_t NODE = 4 * sizeof(void *);
+            return ranked_.size() * (sizeof(Entry) + sizeof(std::pair<size_t, size_t>) + sizeof(Match) + 2 * NODE);
+        }
+
+        /**
+         * @brief Call fn(key1, key2, match) for every stored pair, best first
+         */
+        template<typename Fn>
+        void for_each(Fn &&fn) const {
+            for (const auto &entry: ranked_) {
+                fn(entry.key1, entry.key2, entry.match);
+            }
+        }
+
+    private:
+        struct Entry {
+            Match match;
+            size_t key1;
+            size_t key2;
+
+            bool operator<(const Entry &other) const {
+                if (match < other.match) return true;
+                if (other.match < match) return false;
+                // Pairs of documents with equal IDs still get a strict order
+                return std::make_pair(key1, key2) < std::make_pair(other.key1, other.key2);
+            }
+        };
+
+        size_t limit_;
+        std::set<Entry> ranked_;                          ///< Held pairs, best first
+        std::map<std::pair<size_t, size_t>, Match> best_; ///< Match of every held pair
+    };
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_MATCH_TABLE_HPP
@@ -0,0 +1,169 @@
+#ifndef TEXT_PROCESSING_METRICS_HPP
+#define TEXT_PROCESSING_METRICS_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace text_processing {
+    /**
+     * @brief Phase timings, counters and peak structure sizes of a run
+     *
+     * Components take a nullable Metrics pointer and record into it only when
+     * one is given, so the instrumentation costs nothing otherwise. Records
+     * are coarse (per phase, not per suffix) and thread-safe.
+     *
+     * Example:
+     * @code
+     *     Metrics metrics;
+     *     {
+     *         ScopedTimer timer(&metrics, "load_documents");
+     *         ...
+     *     }
+     *     metrics.add_count("documents", store.document_count());
+     *     metrics.record_peak("text", text.str().capacity());
+     *     metrics.save("stats.json");
+     * @endcode
+     */
+    class Metrics {
+    public:
+        /**
+         * @brief Total time and number of runs of a phase
+         */
+        struct Phase {
+            double seconds = 0;
+            uint64_t calls = 0;
+        };
+
+        /**
+         * @brief Distribution of the durations of a repeated operation, such as a query
+         *
+         * Durations are counted in logarithmic buckets of 1/16 of a power of
+         * two microseconds, so percentiles are within 5% and the memory
+         * stays bounded however many are recorded.
+         */
+        struct Latency {
+            uint64_t count = 0;
+            double seconds = 0; ///< Sum of all durations
+            double max = 0;     ///< Longest duration in seconds
+            std::vector<uint64_t> buckets;
+
+            /**
+             * @brief Duration in seconds that a fraction q of the recorded ones do not exceed, 0 if none
+             */
+            [[nodiscard]] double percentile(double q) const;
+        };
+
+        Metrics() = default;
+        Metrics(const Metrics &other);
+        Metrics &operator=(const Metrics &other);
+
+        /**
+         * @brief Add one run of a phase
+         */
+        void add_time(const std::string &phase, double seconds);
+
+        /**
+         * @brief Add to a counter such as documents or pairs kept
+         */
+        void add_count(const std::string &name, uint64_t value);
+
+        /**
+         * @brief Raise the peak size of a structure in bytes to at least bytes
+         */
+        void record_peak(const std::string &structure, uint64_t bytes);
+
+        /**
+         * @brief Add one duration of an operation, e.g. the answer to one query
+         */
+        void record_latency(const std::string &operation, double seconds);
+
+        /**
+         * @brief Set a descriptive value, e.g. the domain or the builder
+         */
+        void set_info(const std::string &key, const std::string &value);
+
+        [[nodiscard]] Phase phase(const std::string &phase) const;
+        [[nodiscard]] uint64_t count(const std::string &name) const;
+        [[nodiscard]] uint64_t peak(const std::string &structure) const;
+        [[nodiscard]] Latency latency(const std::string &operation) const;
+
+        /**
+         * @brief Forget everything recorded
+         */
+        void clear();
+
+        /**
+         * @brief All records as one JSON object
+         *
+         * {"info": {...}, "phases": {"<phase>": {"seconds": s, "calls": n}},
+         *  "counts": {...}, "peak_bytes": {...}}, keys sorted. Recorded latencies
+         * add "latencies": {"<operation>": {"count": n, "p50_ms": t,
+         * "p99_ms": t, "max_ms": t}}.
+         */
+        [[nodiscard]] std::string to_json() const;
+
+        /**
+         * @brief Write to_json() to a file
+         * @throw std::runtime_error if the file cannot be written
+         */
+        void save(const std::string &filename) const;
+
+        /**
+         * @brief Write a JSON document and a newline to a file, e.g. one embedding several to_json()
+         * @throw std::runtime_error if the file cannot be written
+         */
+        static void write_json(const std::string &filename, const std::string &json);
+
+        /**
+         * @brief A string as a quoted JSON string
+         */
+        static std::string json_string(const std::string &value);
+
+    private:
+        mutable std::mutex mutex_;
+        std::map<std::string, std::string> info_;
+        std::map<std::string, Phase> phases_;
+        std::map<std::string, uint64_t> counts_;
+        std::map<std::string, uint64_t> peaks_;
+        std::map<std::string, Latency> latencies_;
+    };
+
+    /**
+     * @brief Adds the time from construction to destruction to a phase, if metrics is set
+     */
+    class ScopedTimer {
+    public:
+        ScopedTimer(Metrics *metrics, const char *phase)
+            : metrics_(metrics)
+              , phase_(phase) {
+            if (metrics_) start_ = std::chrono::steady_clock::now();
+        }
+
+        ~ScopedTimer() { stop(); }
+
+        /**
+         * @brief Record the time so far and stop, further calls do nothing
+         */
+        void stop() {
+            if (metrics_) {
+                const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_;
+                metrics_->add_time(phase_, elapsed.count());
+                metrics_ = nullptr;
+            }
+        }
+
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    private:
+        Metrics *metrics_;
+        const char *phase_;
+        std::chrono::steady_clock::time_point start_;
+    };
+} // namespace text_processing
+
+#endif //TEXT_PROCESSING_METRICS_HPP
@@ -2,7 +2,10 @@
 #define TEXT_PROCESSING_NAIVE_SUFFIX_BUILDER_HPP
 
 #include <vector>
+#include "text_processing/index_vector.hpp"
+#include "text_processing/integer_text.hpp"
 #include "text_processing/suffix_array_builder.hpp"
+#include "text_processing/suffix_workspace.hpp"
 #include "text_processing/utf8_handler.hpp"
 
 namespace text_processing {
@@ -10,12 +13,26 @@ namespace text_processing {
 /**
  * @brief O(n*log(n)) implementation of suffix array construction using cyclic shifts
  *
+ * The text is extended with a virtual sentinel smaller than every character,
+ * so the sorted cyclic shifts give the order of the suffixes.
+ *
  * This implementation uses the following approach:
- * 1. Sort single characters and assign equivalence classes
- * 2. For k=1..log(n):
- *    - Use previous sorting of length 2^(k-1) to sort length 2^k substrings
+ * 1. Sort the first q characters and assign equivalence classes
+ * 2. Until every class is a single suffix:
+ *    - Use previous sorting of length q*2^(k-1) to sort length q*2^k substrings
  *    - Update equivalence classes
  * 3. Build LCP array using Kasai's algorithm
+ *
+ * For small alphabets (ASCII, or ASCII and one script) q characters are
+ * packed into one integer code and sorted in a single counting sort, which
+ * replaces the first log2(q) doubling rounds. q is the largest length whose
+ * codes fit PACKED_BUCKETS buckets, and 1 for large alphabets.
+ *
+ * The scratch arrays of all rounds live in a SuffixWorkspace and the result
+ * arrays of a build are reused by the next one, so a builder kept for many
+ * texts (as by a DuplicateFinder in batch mode) only allocates when a text
+ * is larger than the ones before. The workspace stays allocated between
+ * builds until release_workspace().
  * 
  * Space complexity: O(n)
  * Time complexity: O(n*log(n))
@@ -23,26 +40,42 @@ namespace text_processing {
 class NaiveSuffixBuilder : public SuffixArrayBuilder {
 public:
     /**
-     * @brief Default constructor
+     * @brief Constructor
+     * @param huge_pages Advise the large scratch arrays as transparent huge pages, see SuffixWorkspace
      */
-    NaiveSuffixBuilder() = default;
+    explicit NaiveSuffixBuilder(bool huge_pages = false) : workspace_(huge_pages) {}
 
     /**
      * @brief Build suffix array from UTF8String
      * 
+     * The text is referenced, not copied, and must outlive the use of get_text().
+     *
      * @param text Input text to build suffix array from
      * @return true if building was successful
      * @throw std::runtime_error if building fails or text is empty
      */
     bool build(const UTF8String& text) override;
 
+    /**
+     * @brief Build suffix array sorted by the first depth characters only
+     *
+     * Doubling stops once the sorted prefix length reaches depth (or every
+     * suffix is already distinct) and LCP values are capped at depth.
+     *
+     * @param text Input text to build suffix array from
+     * @param depth Number of characters to sort by, 0 sorts fully
+     * @return true if building was successful
+     * @throw std::runtime_error if building fails or text is empty
+     */
+    bool build_to_depth(const UTF8String& text, size_t depth) override;
+
     /**
      * @brief Get the constructed suffix array
      * 
      * @return const reference to the suffix array vector
      * @throw std::runtime_error if array hasn't been built
      */
-    [[nodiscard]] const std::vector<size_t>& get_array() const override;
+    [[nodiscard]] const IndexVector& get_array() const override;
 
     /**
      * @brief Get the Longest Common Prefix (LCP) array
@@ -50,12 +83,12 @@ public:
      * @return const reference to the LCP array
      * @throw std::runtime_error if array hasn't been built
      */
-    [[nodiscard]] const std::vector<size_t>& get_lcp_array() const override;
+    [[nodiscard]] const IndexVector& get_lcp_array() const override;
 
     /**
      * @brief Get original text the suffix array was built from
      * 
-     * @return const reference to the original text
+     * @return const reference to the text passed to the last build, empty before the first
      */
     [[nodiscard]] const UTF8String& get_text() const override;
 
@@ -66,53 +99,101 @@ public:
      */
     bool is_built() const override;
 
+    /**
+     * @brief Most counting sort buckets of the packed initial sort
+     */
+    static constexpr size_t PACKED_BUCKETS = size_t{1} << 20;
+
+    /**
+     * @brief Depth of the last build, 0 if it ended fully sorted
+     */
+    [[nodiscard]] size_t depth_limit() const override { return depth_limit_; }
+
+    /**
+     * @brief Scratch arrays kept for the next build
+     */
+    [[nodiscard]] const SuffixWorkspace& workspace() const { return workspace_; }
+
+    /**
+     * @brief Free the scratch arrays, e.g. before a long phase that no longer builds
+     */
+    void release_workspace() { workspace_.release(); }
+
 private:
-    UTF8String text_;                    ///< Original text
-    std::vector<size_t> suffix_array_;   ///< Constructed suffix array
-    std::vector<size_t> lcp_array_;      ///< LCP array
+    const UTF8String* text_ = nullptr;   ///< Text of the last build, not owned
+    SuffixWorkspace workspace_;          ///< Scratch arrays of the doubling rounds and Kasai's algorithm
+    IndexVector suffix_array_;           ///< Constructed suffix array
+    IndexVector lcp_array_;              ///< LCP array
     bool is_built_ = false;              ///< Construction state flag
+    size_t depth_limit_ = 0;             ///< Sorting depth of the arrays, 0 = full
+
+    /**
+     * @brief Run the construction with Index-typed scratch and result arrays
+     *
+     * Instantiated for uint32_t when the text has fewer than 4G characters,
+     * which halves the memory of p, c and the scratch vectors.
+     *
+     * @param symbols Integer view of the text
+     * @param depth Number of characters to sort by, 0 sorts fully
+     */
+    template<typename Index>
+    void build_arrays(const IntegerText& symbols, size_t depth);
 
     /**
      * @brief Initial sorting of single characters
      * 
      * Creates initial suffix array and equivalence classes based on first characters.
-     * Uses counting sort for O(n) complexity.
+     * Uses counting sort over the integer symbols for O(n) complexity.
      * 
+     * @param symbols Integer view of the text
      * @param p Permutation array (suffix array)
      * @param c Equivalence classes array
      * @return Number of distinct equivalence classes
      */
-    size_t sort_characters(std::vector<size_t>& p, std::vector<size_t>& c) const;
+    template<typename Index>
+    size_t sort_characters(const IntegerText& symbols, std::vector<Index>& p,
+                           std::vector<Index>& c);
 
     /**
-     * @brief Sort cyclic substrings of length 2^k
-     * 
-     * Uses previous sorting of length 2^(k-1) to sort substrings of length 2^k.
-     * 
-     * @param k Current power (length = 2^k)
-     * @param p Permutation array (suffix array)
-     * @param c Equivalence classes array
-     * @param classes Number of equivalence classes
-     * @return New number of equivalence classes
+     * @brief Number of characters sorted at once by sort_packed()
+     *
+     * @param alphabet_size Distinct characters of the text
+     * @param n Number of suffixes, sentinel included
+     * @param depth Sorting depth, 0 for none; the result never exceeds it
+     * @return Largest length whose codes fit min(n, PACKED_BUCKETS) buckets, 1 to sort single characters
      */
-    size_t sort_doubled(size_t k, std::vector<size_t>& p, std::vector<size_t>& c, size_t classes) const;
+    static size_t packed_length(size_t alphabet_size, size_t n, size_t depth);
 
     /**
-     * @brief Build the LCP array using Kasai's algorithm
-     * 
-     * Constructs LCP array in O(n) time using the constructed suffix array.
+     * @brief Initial sorting of the first length characters of every position
+     *
+     * Codes of length symbols in base alphabet_size + 1 are computed with a
+     * rolling update and sorted with one counting sort. Leaves the classes in
+     * the CLASSES buffer of the workspace.
+     *
+     * @param s Symbols of the text, s[p.size() - 1] is the sentinel
+     * @param alphabet_size Largest symbol
+     * @param length Characters per code, from packed_length()
+     * @param p Receives the positions sorted by their first length characters
+     * @return Number of distinct equivalence classes
      */
-    void build_lcp_array();
+    template<typename Symbol, typename Index>
+    size_t sort_packed(const Symbol* s, size_t alphabet_size, size_t length, std::vector<Index>& p);
 
     /**
-     * @brief Create rank array from suffix array
+     * @brief Sort cyclic substrings of length 2^k
      * 
-     * Inverse of the suffix array - for each position in the text,
-     * stores its position in the suffix array. Used in Kasai's algorithm.
+     * Uses previous sorting of length 2^(k-1) to sort substrings of length 2^k.
+     * The equivalence classes are read from and left in the CLASSES buffer
+     * of the workspace.
      * 
-     * @return vector of ranks
+     * @param k Current power (length = 2^k)
+     * @param p Permutation array (suffix array)
+     * @param classes Number of equivalence classes
+     * @return New number of equivalence classes
      */
-    [[nodiscard]] std::vector<size_t> create_rank_array() const;
+    template<typename Index>
+    size_t sort_doubled(size_t k, std::vector<Index>& p, size_t classes);
 
     /**
      * @brief Validate input text
@@ -0,0 +1,161 @@
+#ifndef TEXT_PROCESSING_PARALLEL_HPP
+#define TEXT_PROCESSING_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace text_processing {
+    /**
+     * @brief Number of worker threads to use, 0 means one per hardware thread
+     */
+    inline size_t resolve_threads(size_t threads) {
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+        return std::max<size_t>(threads, 1);
+    }
+
+    /**
+     * @brief Split [begin, end) into contiguous chunks and process them in parallel
+     *
+     * Chunk boundaries depend only on the range and the thread count, so work
+     * that writes per-chunk results is deterministic. The calling thread
+     * processes the first chunk. The first exception thrown by a chunk is
+     * rethrown once all chunks have finished.
+     *
+     * @param begin First index
+     * @param end One past the last index
+     * @param threads Maximum number of chunks (0 = hardware threads)
+     * @param fn Callable as fn(chunk_begin, chunk_end, chunk_index)
+     */
+    template<typename Fn>
+    void parallel_for(size_t begin, size_t end, size_t threads, Fn &&fn) {
+        if (begin >= end) {
+            return;
+        }
+        const size_t count = end - begin;
+        const size_t chunks = std::min(resolve_threads(threads), count);
+        if (chunks == 1) {
+            fn(begin, end, size_t{0});
+            return;
+        }
+
+        std::vector<std::exception_ptr> errors(chunks);
+        auto run = [&](size_t chunk) {
+            try {
+                fn(begin + count * chunk / chunks, begin + count * (chunk + 1) / chunks, chunk);
+            } catch (...) {
+                errors[chunk] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(chunks - 1);
+        for (size_t chunk = 1; chunk < chunks; ++chunk) {
+            workers.emplace_back(run, chunk);
+        }
+        run(0);
+        for (auto &worker: workers) {
+            worker.join();
+        }
+        for (const auto &error: errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    /**
+     * @brief Process items [0, count) on several threads, handing them out one at a time
+     *
+     * For uneven work items whose results do not depend on which thread ran them.
+     *
+     * @param count Number of items
+     * @param threads Number of threads (0 = hardware threads)
+     * @param fn Callable as fn(item)
+     */
+    template<typename Fn>
+    void parallel_for_each_dynamic(size_t count, size_t threads, Fn &&fn) {
+        std::atomic<size_t> next{0};
+        parallel_for(0, std::min(resolve_threads(threads), count), threads,
+                     [&](size_t, size_t, size_t) {
+                         for (size_t item = next++; item < count; item = next++) {
+                             fn(item);
+                         }
+                     });
+    }
+
+    /**
+     * @brief Process items on several threads, largest first
+     *
+     * Items are handed out in decreasing size, so the long ones start early
+     * and the short ones fill the gaps while they finish. Ties keep their
+     * index order. fn also receives the worker index, which is stable for the
+     * thread, so per-worker state can be kept and reused across items.
+     *
+     * @param sizes Estimated cost of every item
+     * @param threads Number of threads (0 = hardware threads)
+     * @param fn Callable as fn(item, worker)
+     */
+    template<typename Fn>
+    void parallel_for_each_largest_first(const std::vector<size_t> &sizes, size_t threads, Fn &&fn) {
+        std::vector<size_t> order(sizes.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&sizes](size_t a, size_t b) {
+            return sizes[a] > sizes[b];
+        });
+
+        std::atomic<size_t> next{0};
+        const size_t count = order.size();
+        parallel_for(0, std::min(resolve_threads(threads), count), threads,
+                     [&](size_t, size_t, size_t worker) {
+                         for (size_t i = next++; i < count; i = next++) {
+                             fn(order[i], worker);
+                         }
+                     });
+    }
+
+    /**
+     * @brief Sort [first, last) with several threads: sorted chunks merged pairwise
+     */
+    template<typename RandomIt, typename Compare>
+    void parallel_sort(RandomIt first, RandomIt last, size_t threads, Compare comp) {
+        const size_t count = last - first;
+        const size_t chunks = std::min(resolve_threads(threads), std::max<size_t>(count / 4096, 1));
+        if (chunks == 1) {
+            std::sort(first, last, comp);
+            return;
+        }
+
+        std::vector<size_t> bounds(chunks + 1);
+        for (size_t i = 0; i <= chunks; ++i) {
+            bounds[i] = count * i / chunks;
+        }
+        parallel_for(0, chunks, chunks, [&](size_t b, size_t e, size_t) {
+            for (size_t i = b; i < e; ++i) {
+                std::sort(first + bounds[i], first + bounds[i + 1], comp);
+            }
+        });
+
+        for (size_t width = 1; width < chunks; width *= 2) {
+            const size_t merges = (chunks + 2 * width - 1) / (2 * width);
+            parallel_for(0, merges, merges, [&](size_t b, size_t e, size_t) {
+                for (size_t m = b; m < e; ++m) {
+                    size_t lo = 2 * m * width;
+                    size_t mid = std::min(lo + width, chunks);
+                    size_t hi = std::min(lo + 2 * width, chunks);
+                    if (mid < hi) {
+                        std::inplace_merge(first + bounds[lo], first + bounds[mid], first + bounds[hi], comp);
+                    }
+                }
+            });
+        }
+    }
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_PARALLEL_HPP
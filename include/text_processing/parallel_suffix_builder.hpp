@@ -0,0 +1,134 @@
+#ifndef TEXT_PROCESSING_PARALLEL_SUFFIX_BUILDER_HPP
+#define TEXT_PROCESSING_PARALLEL_SUFFIX_BUILDER_HPP
+
+#include <utility>
+#include <vector>
+#include "text_processing/suffix_array_builder.hpp"
+#include "text_processing/index_vector.hpp"
+#include "text_processing/integer_text.hpp"
+#include "text_processing/utf8_handler.hpp"
+
+namespace text_processing {
+
+/**
+ * @brief Multithreaded prefix doubling suffix array construction
+ *
+ * Suffixes are kept in groups that share their first h characters, where
+ * the rank of a suffix is the start of its group in the suffix array:
+ * 1. Counting sort by first character (per-thread histograms)
+ * 2. While unsorted groups remain, sort every group by the rank h
+ *    positions ahead, split it into subgroups and double h. Small groups
+ *    are spread over the threads and large groups are sorted in parallel.
+ * 3. Build the LCP array with the parallel PLCP method
+ *
+ * Only unsorted groups are touched in later rounds, so texts without long
+ * repeats finish in a few passes. The output is identical to
+ * NaiveSuffixBuilder for every thread count.
+ *
+ * Space complexity: O(n)
+ * Time complexity: O(n*log^2(n)) work in the worst case, about 1/threads of it per thread
+ */
+class ParallelSuffixBuilder : public SuffixArrayBuilder {
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param threads Number of threads, 0 uses one per hardware thread
+     */
+    explicit ParallelSuffixBuilder(size_t threads = 0);
+
+    /**
+     * @brief Build suffix array from UTF8String
+     *
+     * @param text Input text to build suffix array from
+     * @return true if building was successful
+     * @throw std::runtime_error if building fails or text is empty
+     */
+    bool build(const UTF8String& text) override;
+
+    /**
+     * @brief Get the constructed suffix array
+     *
+     * @return const reference to the suffix array vector
+     * @throw std::runtime_error if array hasn't been built
+     */
+    [[nodiscard]] const IndexVector& get_array() const override;
+
+    /**
+     * @brief Get the Longest Common Prefix (LCP) array
+     *
+     * @return const reference to the LCP array
+     * @throw std::runtime_error if array hasn't been built
+     */
+    [[nodiscard]] const IndexVector& get_lcp_array() const override;
+
+    /**
+     * @brief Get original text the suffix array was built from
+     *
+     * @return const reference to the original text
+     */
+    [[nodiscard]] const UTF8String& get_text() const override;
+
+    /**
+     * @brief Check if suffix array has been built
+     *
+     * @return true if suffix array is built and ready
+     */
+    bool is_built() const override;
+
+    /**
+     * @brief Number of threads used for construction
+     */
+    [[nodiscard]] size_t threads() const { return threads_; }
+
+private:
+    UTF8String text_;                    ///< Original text
+    IndexVector suffix_array_;           ///< Constructed suffix array
+    IndexVector lcp_array_;              ///< LCP array
+    bool is_built_ = false;              ///< Construction state flag
+    size_t threads_;                     ///< Worker thread count
+
+    /**
+     * @brief Run the construction with Index-typed arrays
+     *
+     * @param symbols Integer view of the text
+     */
+    template<typename Index>
+    void build_arrays(const IntegerText& symbols);
+
+    /**
+     * @brief Counting sort of all positions (sentinel included) by first character
+     *
+     * @param symbols Integer view of the text
+     * @param p Output positions sorted by first character
+     * @param rank Output rank of every position (start of its bucket in p)
+     * @return Bucket ranges [begin, end) holding more than one position
+     */
+    template<typename Index>
+    std::vector<std::pair<Index, Index>> sort_characters(const IntegerText& symbols, std::vector<Index>& p,
+                                                         std::vector<Index>& rank) const;
+
+    /**
+     * @brief One doubling round over the unsorted groups
+     *
+     * @param h Number of characters the groups already agree on
+     * @param p Positions in suffix order up to h characters
+     * @param rank Rank of every position
+     * @param groups Unsorted groups, replaced by the groups still unsorted after 2h characters
+     */
+    template<typename Index>
+    void sort_doubled(size_t h, std::vector<Index>& p, std::vector<Index>& rank,
+                      std::vector<std::pair<Index, Index>>& groups) const;
+
+    /**
+     * @brief Validate input text
+     *
+     * @param text Text to validate
+     * @throw std::runtime_error if text is empty
+     */
+    static void validate_input(const UTF8String& text);
+};
+
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_PARALLEL_SUFFIX_BUILDER_HPP
@@ -0,0 +1,198 @@
+#ifndef TEXT_PROCESSING_PREFIX_BUCKETS_HPP
+#define TEXT_PROCESSING_PREFIX_BUCKETS_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace text_processing {
+    /**
+     * @brief Suffixes starting with prefix and continuing with a symbol in [lo, hi]
+     *
+     * Symbol 0 ends the text, b + 1 is byte b.
+     */
+    struct PrefixBucket {
+        std::string prefix;
+        size_t lo;
+        size_t hi;
+        size_t count; ///< Suffixes in the bucket
+    };
+
+    /**
+     * @brief Splits the character-boundary suffixes of UTF-8 bytes into buckets by their first bytes
+     *
+     * Buckets are planned in lexicographic order, so sorting each one on its
+     * own and appending them yields the suffix array; only the LCP of the
+     * last suffix of a bucket and the first of the next needs both. Used by
+     * ExternalSuffixBuilder and for sharded matching.
+     */
+    class PrefixScanner {
+    public:
+        /**
+         * @brief Number of symbols after a prefix: 0 ends the text, b + 1 is byte b
+         */
+        static constexpr size_t SYMBOLS = 257;
+
+        PrefixScanner(const unsigned char *bytes, size_t n) : bytes_(bytes), n_(n) {
+        }
+
+        /**
+         * @brief True if the byte starts a UTF-8 character (is not a continuation byte)
+         */
+        static bool is_char_start(unsigned char byte) {
+            return (byte & 0xC0) != 0x80;
+        }
+
+        /**
+         * @brief Number of character-boundary suffixes
+         */
+        [[nodiscard]] size_t suffix_count() const {
+            size_t suffixes = 0;
+            for (size_t i = 0; i < n_; i++) {
+                suffixes += is_char_start(bytes_[i]);
+            }
+            return suffixes;
+        }
+
+        /**
+         * @brief Call fn(position, next symbol) for every suffix starting with prefix
+         */
+        template<typename Fn>
+        void for_each(const std::string &prefix, Fn &&fn) const {
+            const size_t len = prefix.size();
+            if (len > n_) return;
+            const auto *p = reinterpret_cast<const unsigned char *>(prefix.data());
+            // The empty suffix at n_ is no suffix of the text
+            for (size_t i = 0; i + len <= n_ && i < n_; i++) {
+                if (len == 0 ? !is_char_start(bytes_[i])
+                             : bytes_[i] != p[0] || std::memcmp(bytes_ + i, p, len) != 0) {
+                    continue;
+                }
+                fn(i, i + len < n_ ? size_t{bytes_[i + len]} + 1 : 0);
+            }
+        }
+
+        /**
+         * @brief Split the suffixes starting with prefix into buckets of at most capacity suffixes
+         *
+         * Buckets are appended in lexicographic order. When every suffix
+         * continues with the same symbol the prefix is extended by all bytes
+         * they share at once, instead of one scan per byte.
+         */
+        void plan(std::string prefix, size_t count, size_t capacity, std::vector<PrefixBucket> &out) const {
+            while (count > capacity) {
+                std::vector<size_t> counts(SYMBOLS, 0);
+                for_each(prefix, [&counts](size_t, size_t symbol) { counts[symbol]++; });
+
+                if (std::find(counts.begin(), counts.end(), count) != counts.end()) {
+                    prefix += shared_extension(prefix);
+                    continue;
+                }
+
+                size_t symbol = 0;
+                while (symbol < SYMBOLS) {
+                    if (counts[symbol] > capacity) {
+                        plan(prefix + static_cast<char>(symbol - 1), counts[symbol], capacity, out);
+                        symbol++;
+                        continue;
+                    }
+                    // Merge neighbouring symbols while the bucket fits
+                    size_t lo = symbol;
+                    size_t total = 0;
+                    while (symbol < SYMBOLS && counts[symbol] <= capacity && total + counts[symbol] <= capacity) {
+                        total += counts[symbol++];
+                    }
+                    if (total > 0) {
+                        out.push_back({prefix, lo, symbol - 1, total});
+                    }
+                }
+                return;
+            }
+            out.push_back({prefix, 0, SYMBOLS - 1, count});
+        }
+
+        /**
+         * @brief Append the suffixes of a bucket in text order
+         */
+        template<typename Index>
+        void collect(const PrefixBucket &bucket, std::vector<Index> &positions) const {
+            for_each(bucket.prefix, [&](size_t pos, size_t symbol) {
+                if (symbol >= bucket.lo && symbol <= bucket.hi) {
+                    positions.push_back(static_cast<Index>(pos));
+                }
+            });
+        }
+
+        /**
+         * @brief Suffix a is smaller than suffix b, both starting with the same depth bytes
+         */
+        [[nodiscard]] bool less(size_t a, size_t b, size_t depth) const {
+            const size_t la = n_ - a - depth;
+            const size_t lb = n_ - b - depth;
+            int order = std::memcmp(bytes_ + a + depth, bytes_ + b + depth, std::min(la, lb));
+            return order != 0 ? order < 0 : la < lb;
+        }
+
+        /**
+         * @brief LCP of two suffixes sharing depth bytes, cut back to a character boundary
+         */
+        [[nodiscard]] size_t lcp(size_t a, size_t b, size_t depth) const {
+            size_t k = depth + common_prefix(bytes_ + a + depth, bytes_ + b + depth,
+                                             std::min(n_ - a, n_ - b) - depth);
+            // The end of the text is a character boundary
+            while (k > 0 && a + k < n_ && !is_char_start(bytes_[a + k])) {
+                k--;
+            }
+            return k;
+        }
+
+    private:
+        const unsigned char *bytes_;
+        size_t n_;
+
+        /**
+         * @brief Length of the common prefix of two byte ranges, at most max bytes
+         */
+        static size_t common_prefix(const unsigned char *a, const unsigned char *b, size_t max) {
+            size_t k = 0;
+            // Eight bytes per step, the mismatching word is finished bytewise
+            while (k + 8 <= max) {
+                uint64_t x;
+                uint64_t y;
+                std::memcpy(&x, a + k, sizeof(x));
+                std::memcpy(&y, b + k, sizeof(y));
+                if (x != y) break;
+                k += 8;
+            }
+            while (k < max && a[k] == b[k]) {
+                k++;
+            }
+            return k;
+        }
+
+        /**
+         * @brief Bytes that every suffix starting with prefix continues with
+         */
+        [[nodiscard]] std::string shared_extension(const std::string &prefix) const {
+            const size_t len = prefix.size();
+            bool first = true;
+            size_t ref = 0;
+            size_t shared = 0;
+            for_each(prefix, [&](size_t pos, size_t) {
+                if (first) {
+                    ref = pos;
+                    shared = n_ - pos - len;
+                    first = false;
+                    return;
+                }
+                shared = common_prefix(bytes_ + ref + len, bytes_ + pos + len,
+                                       std::min(shared, n_ - pos - len));
+            });
+            return {reinterpret_cast<const char *>(bytes_) + ref + len, shared};
+        }
+    };
+} // namespace text_processing
+
+#endif //TEXT_PROCESSING_PREFIX_BUCKETS_HPP
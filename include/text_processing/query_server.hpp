@@ -0,0 +1,126 @@
+#ifndef TEXT_PROCESSING_QUERY_SERVER_HPP
+#define TEXT_PROCESSING_QUERY_SERVER_HPP
+
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "text_processing/corpus_query.hpp"
+#include "text_processing/index_file.hpp"
+#include "text_processing/metrics.hpp"
+
+namespace text_processing {
+    /**
+     * @brief One line of a query server's input
+     *
+     * A JSON object with the string fields "id", "domain" and "text" and the
+     * number "threshold", e.g.
+     * {"id": "17", "domain": "example.com", "text": "...", "threshold": 50}.
+     * Missing fields keep their defaults, unknown ones are ignored.
+     * {"command": "stats"} asks for the server's metrics instead.
+     */
+    struct QueryRequest {
+        std::string id;         ///< Echoed in the response
+        std::string domain;     ///< Label of the index to query, may be empty if only one is loaded
+        std::string text;       ///< Text to look up
+        size_t threshold = 0;   ///< Minimum hit length in characters, 0 uses the server's
+        std::string command;    ///< Empty for a query, "stats" for the metrics
+
+        /**
+         * @brief Parse one input line
+         * @throw std::invalid_argument if the line is not a JSON object of strings and numbers
+         */
+        static QueryRequest parse(const std::string &line);
+    };
+
+    /**
+     * @brief Answer to one QueryRequest
+     */
+    struct QueryResponse {
+        std::string id;
+        std::vector<QueryHit> hits;
+        std::string error; ///< Failure message, empty on success
+        std::string body;  ///< Raw JSON value of "stats" for a stats command
+
+        /**
+         * @brief One line of JSON: {"id": ..., "hits": [...]} or {"id": ..., "error": ...}
+         */
+        [[nodiscard]] std::string to_json() const;
+    };
+
+    /**
+     * @brief Settings of a QueryServer
+     */
+    struct QueryServerOptions {
+        size_t threads = 1;      ///< Threads answering a batch, 0 uses one per hardware thread
+        size_t batch_size = 64;  ///< Most requests answered together, fewer when no more are waiting
+        size_t threshold = 50;   ///< Threshold of requests that give none
+
+        /**
+         * Receives the phase "answer_batch", the counts "queries", "batches",
+         * "query_hits" and "query_errors", and the latency "query" from a
+         * request being read to its answer being written. Not owned.
+         */
+        Metrics *metrics = nullptr;
+    };
+
+    /**
+     * @brief Long-running lookups of texts in resident indexes
+     *
+     * Every index file is mapped once and stays mapped, keyed by its label
+     * (the domain it was built for), so a query costs only its suffix array
+     * searches, see CorpusQuery. serve() reads one request per line and
+     * answers the requests that have already arrived together, up to
+     * batch_size, spread over the threads; responses are written in request
+     * order, one line each. A failing request gets an error response and
+     * does not stop the server.
+     *
+     * Example:
+     * @code
+     *     QueryServer server(QueryServerOptions{8, 64, 50, &metrics});
+     *     server.add_index("example.com.idx");
+     *     server.serve(std::cin, std::cout);
+     * @endcode
+     */
+    class QueryServer {
+    public:
+        explicit QueryServer(const QueryServerOptions &options);
+
+        /**
+         * @brief Map an index file and answer queries for its label
+         * @throw std::runtime_error if the file cannot be read, has no arrays or its label is taken
+         */
+        void add_index(const std::string &path);
+
+        /**
+         * @brief Labels of the loaded indexes, sorted
+         */
+        [[nodiscard]] std::vector<std::string> domains() const;
+
+        /**
+         * @brief Answer a batch of requests, one response per request in order
+         */
+        [[nodiscard]] std::vector<QueryResponse> answer(const std::vector<QueryRequest> &requests) const;
+
+        /**
+         * @brief Answer request lines from in until it ends, writing response lines to out
+         *
+         * @return size_t Requests answered
+         */
+        size_t serve(std::istream &in, std::ostream &out) const;
+
+    private:
+        struct Corpus {
+            std::unique_ptr<IndexFile> index;
+            std::unique_ptr<CorpusQuery> query;
+        };
+
+        QueryServerOptions options_;
+        std::map<std::string, Corpus, std::less<>> corpora_;
+
+        [[nodiscard]] QueryResponse answer_one(const QueryRequest &request) const;
+    };
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_QUERY_SERVER_HPP
@@ -0,0 +1,164 @@
+#ifndef TEXT_PROCESSING_SAIS_HPP
+#define TEXT_PROCESSING_SAIS_HPP
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace text_processing {
+    namespace detail {
+        /**
+         * @brief Marker for unfilled suffix array slots
+         */
+        template<typename Index>
+        constexpr Index EMPTY = std::numeric_limits<Index>::max();
+
+        /**
+         * @brief Compute bucket heads (end = false) or tails (end = true)
+         */
+        template<typename Symbol, typename Index>
+        void get_buckets(const Symbol* s, size_t n, std::vector<Index>& bkt, bool end) {
+            std::fill(bkt.begin(), bkt.end(), 0);
+            for (size_t i = 0; i < n; i++) {
+                bkt[s[i]]++;
+            }
+            Index sum = 0;
+            for (auto& b : bkt) {
+                sum += b;
+                b = end ? sum : sum - b;
+            }
+        }
+
+        /**
+         * @brief Induce L-type suffixes left to right, then S-type right to left
+         */
+        template<typename Symbol, typename Index>
+        void induce(const Symbol* s, Index* sa, size_t n,
+                    const std::vector<bool>& stype, std::vector<Index>& bkt) {
+            get_buckets(s, n, bkt, false);
+            for (size_t i = 0; i < n; i++) {
+                Index j = sa[i];
+                if (j != EMPTY<Index> && j > 0 && !stype[j - 1]) {
+                    sa[bkt[s[j - 1]]++] = j - 1;
+                }
+            }
+
+            get_buckets(s, n, bkt, true);
+            for (size_t i = n; i > 0; i--) {
+                Index j = sa[i - 1];
+                if (j != EMPTY<Index> && j > 0 && stype[j - 1]) {
+                    sa[--bkt[s[j - 1]]] = j - 1;
+                }
+            }
+        }
+    } // namespace detail
+
+    /**
+     * @brief Suffix array construction by induced sorting (Nong, Zhang and Chan)
+     *
+     * Time complexity: O(n)
+     *
+     * @param s Symbols in [0, k), s[n - 1] must be a unique 0 sentinel
+     * @param sa Output suffix array of n entries, sa[0] == n - 1
+     * @param n Number of symbols including the sentinel
+     * @param k Alphabet size
+     */
+    template<typename Symbol, typename Index>
+    void sais(const Symbol* s, Index* sa, size_t n, size_t k) {
+        if (n == 1) {
+            sa[0] = 0;
+            return;
+        }
+
+        // Classify suffixes: true = S-type, false = L-type
+        std::vector<bool> stype(n);
+        stype[n - 1] = true;
+        for (size_t i = n - 1; i > 0; i--) {
+            stype[i - 1] = s[i - 1] < s[i] || (s[i - 1] == s[i] && stype[i]);
+        }
+        auto is_lms = [&stype](size_t i) {
+            return i > 0 && stype[i] && !stype[i - 1];
+        };
+
+        // Stage 1: sort LMS substrings
+        std::vector<Index> bkt(k);
+        detail::get_buckets(s, n, bkt, true);
+        std::fill(sa, sa + n, detail::EMPTY<Index>);
+        for (size_t i = 1; i < n; i++) {
+            if (is_lms(i)) {
+                sa[--bkt[s[i]]] = static_cast<Index>(i);
+            }
+        }
+        detail::induce(s, sa, n, stype, bkt);
+
+        // Compact the sorted LMS substrings into the front of sa
+        size_t n1 = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (is_lms(sa[i])) {
+                sa[n1++] = sa[i];
+            }
+        }
+
+        // Name LMS substrings; LMS positions are at least two apart,
+        // so pos / 2 gives each one a distinct slot after the first n1
+        std::fill(sa + n1, sa + n, detail::EMPTY<Index>);
+        size_t names = 0;
+        size_t prev = detail::EMPTY<size_t>;
+        for (size_t i = 0; i < n1; i++) {
+            size_t pos = sa[i];
+            bool diff = prev == detail::EMPTY<size_t>;
+            for (size_t d = 0; !diff; d++) {
+                if (s[pos + d] != s[prev + d] || stype[pos + d] != stype[prev + d]) {
+                    diff = true;
+                } else if (d > 0 && is_lms(pos + d)) {
+                    break;
+                }
+            }
+            if (diff) {
+                names++;
+                prev = pos;
+            }
+            sa[n1 + pos / 2] = static_cast<Index>(names - 1);
+        }
+
+        // Stage 2: solve the reduced problem
+        std::vector<Index> s1;
+        s1.reserve(n1);
+        for (size_t i = n1; i < n; i++) {
+            if (sa[i] != detail::EMPTY<Index>) {
+                s1.push_back(sa[i]);
+            }
+        }
+
+        std::vector<Index> sa1(n1);
+        if (names < n1) {
+            sais(s1.data(), sa1.data(), n1, names);
+        } else {
+            for (size_t i = 0; i < n1; i++) {
+                sa1[s1[i]] = static_cast<Index>(i);
+            }
+        }
+
+        // Map reduced suffixes back to LMS positions
+        size_t j = 0;
+        for (size_t i = 1; i < n; i++) {
+            if (is_lms(i)) {
+                s1[j++] = static_cast<Index>(i);
+            }
+        }
+        for (size_t i = 0; i < n1; i++) {
+            sa1[i] = s1[sa1[i]];
+        }
+
+        // Stage 3: induce the final order from sorted LMS suffixes
+        std::fill(sa, sa + n, detail::EMPTY<Index>);
+        detail::get_buckets(s, n, bkt, true);
+        for (size_t i = n1; i > 0; i--) {
+            Index pos = sa1[i - 1];
+            sa[--bkt[s[pos]]] = pos;
+        }
+        detail::induce(s, sa, n, stype, bkt);
+    }
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_SAIS_HPP
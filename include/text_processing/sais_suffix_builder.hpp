@@ -0,0 +1,100 @@
+#ifndef TEXT_PROCESSING_SAIS_SUFFIX_BUILDER_HPP
+#define TEXT_PROCESSING_SAIS_SUFFIX_BUILDER_HPP
+
+#include <vector>
+#include "text_processing/suffix_array_builder.hpp"
+#include "text_processing/index_vector.hpp"
+#include "text_processing/integer_text.hpp"
+#include "text_processing/utf8_handler.hpp"
+
+namespace text_processing {
+
+/**
+ * @brief Linear time suffix array construction using induced sorting (SA-IS)
+ *
+ * This implementation follows Nong, Zhang and Chan:
+ * 1. Classify suffixes as S- or L-type and find the LMS positions
+ * 2. Induce-sort the LMS substrings and name them
+ * 3. Recurse on the reduced string if the names are not unique
+ * 4. Induce the final order from the sorted LMS suffixes
+ * 5. Build LCP array using Kasai's algorithm
+ *
+ * Produces exactly the same suffix and LCP arrays as NaiveSuffixBuilder.
+ *
+ * Space complexity: O(n)
+ * Time complexity: O(n)
+ */
+class SAISSuffixBuilder : public SuffixArrayBuilder {
+public:
+    /**
+     * @brief Default constructor
+     */
+    SAISSuffixBuilder() = default;
+
+    /**
+     * @brief Build suffix array from UTF8String
+     *
+     * @param text Input text to build suffix array from
+     * @return true if building was successful
+     * @throw std::runtime_error if building fails or text is empty
+     */
+    bool build(const UTF8String& text) override;
+
+    /**
+     * @brief Get the constructed suffix array
+     *
+     * @return const reference to the suffix array vector
+     * @throw std::runtime_error if array hasn't been built
+     */
+    [[nodiscard]] const IndexVector& get_array() const override;
+
+    /**
+     * @brief Get the Longest Common Prefix (LCP) array
+     *
+     * @return const reference to the LCP array
+     * @throw std::runtime_error if array hasn't been built
+     */
+    [[nodiscard]] const IndexVector& get_lcp_array() const override;
+
+    /**
+     * @brief Get original text the suffix array was built from
+     *
+     * @return const reference to the original text
+     */
+    [[nodiscard]] const UTF8String& get_text() const override;
+
+    /**
+     * @brief Check if suffix array has been built
+     *
+     * @return true if suffix array is built and ready
+     */
+    bool is_built() const override;
+
+private:
+    UTF8String text_;                    ///< Original text
+    IndexVector suffix_array_;           ///< Constructed suffix array
+    IndexVector lcp_array_;              ///< LCP array
+    bool is_built_ = false;              ///< Construction state flag
+
+    /**
+     * @brief Run SA-IS and Kasai with Index-typed arrays
+     *
+     * Instantiated for uint32_t when the text has fewer than 4G characters.
+     *
+     * @param symbols Integer view of the text
+     */
+    template<typename Index>
+    void build_arrays(const IntegerText& symbols);
+
+    /**
+     * @brief Validate input text
+     *
+     * @param text Text to validate
+     * @throw std::invalid_argument if text is empty
+     */
+    static void validate_input(const UTF8String& text);
+};
+
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_SAIS_SUFFIX_BUILDER_HPP
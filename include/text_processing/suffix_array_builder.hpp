@@ -1,7 +1,10 @@
 #ifndef TEXT_PROCESSING_SUFFIX_ARRAY_BUILDER_HPP
 #define TEXT_PROCESSING_SUFFIX_ARRAY_BUILDER_HPP
 
+#include <memory>
+#include <string>
 #include <vector>
+#include "text_processing/index_vector.hpp"
 #include "text_processing/utf8_handler.hpp"
 
 namespace text_processing {
@@ -19,11 +22,32 @@ namespace text_processing {
          */
         enum class BuilderType {
             NAIVE, ///< Naive O(n*log(n)) implementation
+            SAIS, ///< SA-IS O(n) induced sorting implementation
+            BYTE, ///< SA-IS over raw UTF-8 bytes, positions in bytes
+            PARALLEL, ///< Multithreaded prefix doubling implementation
+            EXTERNAL, ///< Disk-backed prefix buckets over raw UTF-8 bytes, positions in bytes
             // Future implementations can be added here
-            // SAIS,    ///< SA-IS algorithm implementation
             // KS,      ///< Kärkkäinen-Sanders algorithm implementation
         };
 
+        /**
+         * @brief Unit of the positions and lengths stored in the arrays
+         */
+        enum class Unit {
+            CHARACTER, ///< Positions and lengths count UTF-8 characters
+            BYTE, ///< Positions and lengths count bytes of UTF8String::str()
+        };
+
+        /**
+         * @brief Settings passed to the builders by create()
+         */
+        struct Options {
+            size_t threads = 1; ///< Threads for multithreaded builders, 0 uses one per hardware thread
+            size_t memory_budget = 0; ///< Bytes of working memory for disk-backed builders, 0 = their default
+            std::string scratch_dir; ///< Directory for disk-backed builders, empty = system temporary directory
+            bool huge_pages = false; ///< Advise the naive builder's scratch arrays as transparent huge pages
+        };
+
         /**
          * @brief Virtual destructor for proper cleanup
          */
@@ -32,19 +56,42 @@ namespace text_processing {
         /**
          * @brief Build suffix array from UTF8String
          *
+         * Builders may keep a reference to text rather than a copy, so it
+         * must outlive every later get_text() call.
+         *
          * @param text Input text to build suffix array from
          * @return true if building was successful
          * @throw std::runtime_error if building fails
          */
         virtual bool build(const UTF8String &text) = 0;
 
+        /**
+         * @brief Build a suffix array sorted only by the first depth characters
+         *
+         * Suffixes sharing their first depth characters stay adjacent but are
+         * left in an unspecified (deterministic) order, and every LCP value is
+         * capped at depth. Builders without a cheaper partial mode sort fully,
+         * which satisfies any depth; depth_limit() tells which one happened.
+         *
+         * @param text Input text to build suffix array from
+         * @param depth Number of characters to sort by, 0 sorts fully
+         * @return true if building was successful
+         * @throw std::runtime_error if building fails
+         */
+        virtual bool build_to_depth(const UTF8String &text, size_t depth) {
+            (void) depth;
+            return build(text);
+        }
+
         /**
          * @brief Get the constructed suffix array
          *
+         * Entries are 32-bit for texts shorter than 4G characters, 64-bit otherwise.
+         *
          * @return const reference to the suffix array vector
          * @throw std::runtime_error if array hasn't been built
          */
-        [[nodiscard]] virtual const std::vector<size_t> &get_array() const = 0;
+        [[nodiscard]] virtual const IndexVector &get_array() const = 0;
 
         /**
          * @brief Get the Longest Common Prefix (LCP) array
@@ -55,12 +102,12 @@ namespace text_processing {
          * @return const reference to the LCP array
          * @throw std::runtime_error if array hasn't been built
          */
-        [[nodiscard]] virtual const std::vector<size_t> &get_lcp_array() const = 0;
+        [[nodiscard]] virtual const IndexVector &get_lcp_array() const = 0;
 
         /**
          * @brief Get original text the suffix array was built from
          *
-         * @return const reference to the original text
+         * @return const reference to the text of the last build, possibly the caller's object passed to build()
          */
         [[nodiscard]] virtual const UTF8String &get_text() const = 0;
 
@@ -71,6 +118,57 @@ namespace text_processing {
          */
         virtual bool is_built() const = 0;
 
+        /**
+         * @brief Unit of the suffix array entries and LCP values
+         *
+         * Byte-unit builders only keep suffixes starting on character boundaries
+         * and their LCP values always end on a character boundary, so both can be
+         * mapped back with UTF8String::char_index().
+         *
+         * @return Unit::CHARACTER unless overridden
+         */
+        [[nodiscard]] virtual Unit unit() const { return Unit::CHARACTER; }
+
+        /**
+         * @brief Depth the arrays are sorted to, 0 if fully sorted with exact LCP values
+         *
+         * An LCP value equal to a non-zero depth_limit() means "at least that long".
+         */
+        [[nodiscard]] virtual size_t depth_limit() const { return 0; }
+
+        /**
+         * @brief Whether get_array() and get_lcp_array() are kept in memory
+         *
+         * Disk-backed builders return false. Their arrays are best read in
+         * order with read_arrays(), as get_array() loads them completely.
+         */
+        [[nodiscard]] virtual bool in_memory() const { return true; }
+
+        /**
+         * @brief Number of suffix array entries
+         */
+        [[nodiscard]] virtual size_t suffix_count() const { return get_array().size(); }
+
+        /**
+         * @brief Copy a range of the suffix and LCP arrays
+         *
+         * @param begin First LCP index
+         * @param end One past the last LCP index
+         * @param sa Receives suffix array entries [begin, end], so every LCP value has both suffixes
+         * @param lcp Receives LCP entries [begin, end)
+         */
+        virtual void read_arrays(size_t begin, size_t end, std::vector<size_t> &sa, std::vector<size_t> &lcp) const {
+            const auto &suffix_array = get_array();
+            const auto &lcp_array = get_lcp_array();
+            sa.resize(end - begin + 1);
+            lcp.resize(end - begin);
+            for (size_t i = begin; i < end; ++i) {
+                sa[i - begin] = suffix_array[i];
+                lcp[i - begin] = lcp_array[i];
+            }
+            sa[end - begin] = suffix_array[end];
+        }
+
         /**
          * @brief Create a builder of specific type
          *
@@ -79,10 +177,30 @@ namespace text_processing {
          * provide creation logic in this method.
          *
          * @param type Type of suffix array builder to create
+         * @param threads Threads for multithreaded builders, 0 uses one per hardware thread
+         * @return std::unique_ptr<SuffixArrayBuilder> Pointer to created builder
+         * @throw std::invalid_argument if type is invalid
+         */
+        static std::unique_ptr<SuffixArrayBuilder> create(BuilderType type, size_t threads = 1);
+
+        /**
+         * @brief Create a builder of specific type with full settings
+         *
+         * @param type Type of suffix array builder to create
+         * @param options Threads, memory budget and scratch directory
          * @return std::unique_ptr<SuffixArrayBuilder> Pointer to created builder
          * @throw std::invalid_argument if type is invalid
          */
-        static std::unique_ptr<SuffixArrayBuilder> create(BuilderType type);
+        static std::unique_ptr<SuffixArrayBuilder> create(BuilderType type, const Options &options);
+
+        /**
+         * @brief Parse a builder type from its command line name
+         *
+         * @param name Lower-case builder name ("naive", "sais", "byte", "parallel", "external")
+         * @return BuilderType Matching builder type
+         * @throw std::invalid_argument if name is unknown
+         */
+        static BuilderType type_from_string(const std::string &name);
     };
 } // namespace text_processing
 
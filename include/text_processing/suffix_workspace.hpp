@@ -0,0 +1,139 @@
+#ifndef TEXT_PROCESSING_SUFFIX_WORKSPACE_HPP
+#define TEXT_PROCESSING_SUFFIX_WORKSPACE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace text_processing {
+    /**
+     * @brief Scratch arrays of a suffix array builder, kept between rounds and builds
+     *
+     * Prefix doubling needs several n-sized arrays in every round. Allocating
+     * them anew costs a page fault per page on first touch, in every round
+     * and for every domain of a batch. A workspace keeps one array per
+     * Buffer and only grows it, so a builder reusing its workspace touches
+     * fresh memory only when the text is larger than any before.
+     *
+     * With huge pages, grown arrays of at least HUGE_PAGE_BYTES are advised
+     * as transparent huge pages (madvise(MADV_HUGEPAGE)) before their first
+     * touch, so one fault maps 2 MiB instead of 4 KiB. This is a hint: it is
+     * ignored where the kernel or platform does not support it.
+     *
+     * Example:
+     * @code
+     *     SuffixWorkspace workspace(true);
+     *     auto &classes = workspace.get<uint32_t>(SuffixWorkspace::Buffer::CLASSES, n);
+     * @endcode
+     */
+    class SuffixWorkspace {
+    public:
+        /**
+         * @brief Arrays held by the workspace
+         */
+        enum class Buffer {
+            CLASSES, ///< Equivalence classes of the current round
+            NEXT_CLASSES, ///< Equivalence classes of the next round
+            ORDER, ///< Suffixes sorted by their second half, then the rank array of Kasai's algorithm
+            COUNTS, ///< Counting sort buckets, one per class
+        };
+
+        /**
+         * @brief Smallest array advised as huge pages
+         */
+        static constexpr size_t HUGE_PAGE_BYTES = size_t{2} << 20;
+
+        /**
+         * @brief Constructor
+         * @param huge_pages Advise large arrays as transparent huge pages
+         */
+        explicit SuffixWorkspace(bool huge_pages = false) : huge_pages_(huge_pages) {
+        }
+
+        /**
+         * @brief Array of a buffer resized to size entries
+         *
+         * While size fits the capacity the entries are left as they were and
+         * entries beyond the previous size are zero. Past it the array is
+         * reallocated without copying, so every entry is zero. The array of
+         * the same buffer with the other index type is released, so texts
+         * switching between 32- and 64-bit indices do not keep both.
+         *
+         * @tparam Index uint32_t or uint64_t
+         */
+        template<typename Index>
+        std::vector<Index> &get(Buffer buffer, size_t size) {
+            static_assert(std::is_same_v<Index, uint32_t> || std::is_same_v<Index, uint64_t>);
+            const auto slot = static_cast<size_t>(buffer);
+            if constexpr (std::is_same_v<Index, uint32_t>) {
+                std::vector<uint64_t>().swap(u64_[slot]);
+            } else {
+                std::vector<uint32_t>().swap(u32_[slot]);
+            }
+            auto &values = buffers<Index>()[slot];
+            if (size > values.capacity()) {
+                // Advised before resize() touches the new memory
+                std::vector<Index> grown;
+                grown.reserve(size);
+                advise(grown.data(), size * sizeof(Index));
+                values.swap(grown);
+            }
+            values.resize(size);
+            return values;
+        }
+
+        /**
+         * @brief Swap the arrays of two buffers without copying
+         */
+        void swap(Buffer first, Buffer second) {
+            u32_[static_cast<size_t>(first)].swap(u32_[static_cast<size_t>(second)]);
+            u64_[static_cast<size_t>(first)].swap(u64_[static_cast<size_t>(second)]);
+        }
+
+        /**
+         * @brief Free every array
+         */
+        void release() {
+            u32_ = {};
+            u64_ = {};
+        }
+
+        /**
+         * @brief Bytes reserved by all arrays
+         */
+        [[nodiscard]] size_t memory_bytes() const {
+            size_t bytes = 0;
+            for (size_t i = 0; i < BUFFERS; ++i) {
+                bytes += u32_[i].capacity() * sizeof(uint32_t) + u64_[i].capacity() * sizeof(uint64_t);
+            }
+            return bytes;
+        }
+
+        [[nodiscard]] bool huge_pages() const { return huge_pages_; }
+
+    private:
+        static constexpr size_t BUFFERS = 4;
+
+        std::array<std::vector<uint32_t>, BUFFERS> u32_; ///< Arrays of 32-bit builds
+        std::array<std::vector<uint64_t>, BUFFERS> u64_; ///< Arrays of 64-bit builds
+        bool huge_pages_; ///< Advise grown arrays as huge pages
+
+        template<typename Index>
+        std::array<std::vector<Index>, BUFFERS> &buffers() {
+            if constexpr (std::is_same_v<Index, uint32_t>) {
+                return u32_;
+            } else {
+                return u64_;
+            }
+        }
+
+        /**
+         * @brief Advise the whole pages of a new allocation as huge pages, if enabled
+         */
+        void advise(void *data, size_t bytes) const;
+    };
+} // namespace text_processing
+
+#endif // TEXT_PROCESSING_SUFFIX_WORKSPACE_HPP
@@ -1,9 +1,12 @@
 #ifndef TEXT_PROCESSING_UTF8_HANDLER_HPP
 #define TEXT_PROCESSING_UTF8_HANDLER_HPP
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <stdexcept>
+#include "text_processing/index_vector.hpp"
 
 namespace text_processing {
     /**
@@ -40,7 +43,7 @@ namespace text_processing {
         /**
         * @brief Default constructor creates an empty string
         */
-        UTF8String() : data_(), char_count_(0) {
+        UTF8String() : data_(), char_count_(0), ascii_(true) {
         }
 
         /**
@@ -49,6 +52,12 @@ namespace text_processing {
          */
         explicit UTF8String(const std::string &str);
 
+        /**
+         * @brief Construct UTF8String taking over the bytes of str without copying
+         * @throws UTF8Error if input is not valid UTF-8
+         */
+        explicit UTF8String(std::string &&str);
+
         /**
          * @brief Get character at specified index
          * @throws std::out_of_range if index is invalid
@@ -65,6 +74,31 @@ namespace text_processing {
          */
         [[nodiscard]] const std::string &str() const { return data_; }
 
+        /**
+         * @brief Byte offset of the character at index, index == length() gives str().length()
+         * @throws std::out_of_range if index is invalid
+         */
+        [[nodiscard]] size_t byte_offset(size_t index) const;
+
+        /**
+         * @brief Index of the character containing byte_pos, byte_pos == str().length() gives length()
+         * @throws std::out_of_range if byte_pos is invalid
+         */
+        [[nodiscard]] size_t char_index(size_t byte_pos) const;
+
+        /**
+         * @brief True if every character is a single byte (no index is kept)
+         */
+        [[nodiscard]] bool is_ascii() const { return ascii_; }
+
+        /**
+         * @brief Bytes used by the character index
+         */
+        [[nodiscard]] size_t index_memory_bytes() const {
+            return block_pos_.memory_bytes() + block_group_.capacity() * sizeof(uint32_t) +
+                   char_offset_.capacity();
+        }
+
         /**
          * @brief Iterator support
          */
@@ -88,6 +122,48 @@ namespace text_processing {
 
         UTF8String &operator+=(const std::string &other);
 
+        /**
+         * @brief Append raw bytes, e.g. straight out of a column buffer, without a temporary string
+         *
+         * The bytes are validated before anything is appended, so the string
+         * is unchanged if they are not valid UTF-8.
+         *
+         * @throws UTF8Error if bytes is not valid UTF-8
+         */
+        UTF8String &append(std::string_view bytes);
+
+        /**
+         * @brief Instruction sets of the kernels that validate, count and index UTF-8 bytes
+         */
+        enum class Kernel {
+            SCALAR, ///< Portable code, eight bytes per step where it can
+            SSSE3,  ///< 16 bytes per step, lookup-table validation with PSHUFB
+            AVX2,   ///< 32 bytes per step
+            NEON,   ///< 16 bytes per step on aarch64
+        };
+
+        /**
+         * @brief True if the constructors accept bytes as UTF-8
+         */
+        [[nodiscard]] static bool is_valid(std::string_view bytes);
+
+        /**
+         * @brief Number of characters of valid UTF-8 bytes, the bytes not of the form 10xxxxxx
+         */
+        [[nodiscard]] static size_t count_characters(std::string_view bytes);
+
+        /**
+         * @brief Kernel in use: the widest the CPU supports, unless set_kernel() picked another
+         */
+        [[nodiscard]] static Kernel kernel();
+
+        /**
+         * @brief Use another kernel from now on, e.g. to compare them in tests and benchmarks
+         *
+         * @return bool False, and nothing changes, if the CPU or the build lacks the kernel
+         */
+        static bool set_kernel(Kernel kernel);
+
         /**
          * @brief Equality comparison
          */
@@ -100,18 +176,56 @@ namespace text_processing {
          */
         bool operator<(const UTF8String &other) const;
 
+        /**
+         * @brief Remove all characters, keeping the allocated memory for reuse
+         */
+        void clear() {
+            data_.clear();
+            char_count_ = 0;
+            ascii_ = true;
+            block_pos_.clear();
+            block_group_.clear();
+            char_offset_.clear();
+        }
+
         // Add this method to allow pre-allocation
         void reserve(size_t size) {
             data_.reserve(size);
-            char_pos_.reserve(size);
+            if (!ascii_) {
+                block_pos_.reserve(size / BLOCK_SIZE + 1);
+                block_group_.reserve(size / BLOCK_SIZE + 1);
+            }
         }
 
     private:
+        /**
+         * The character index samples the byte position of every BLOCK_SIZE-th
+         * character. Blocks made only of single-byte characters need nothing else;
+         * the other blocks get a group of BLOCK_SIZE one-byte offsets relative to
+         * the block start (at most 63 * 4 bytes, so they fit in uint8_t).
+         * Pure ASCII strings keep no index at all.
+         */
+        static constexpr size_t BLOCK_SIZE = 64;
+        static constexpr uint32_t NO_GROUP = UINT32_MAX;
+
         std::string data_; // Raw UTF-8 encoded string
-        std::vector<size_t> char_pos_; // Start positions of each character
         size_t char_count_; // Number of characters
+        bool ascii_; // All characters are single bytes, byte offset == index
+        IndexVector block_pos_; // Byte position of every BLOCK_SIZE-th character
+        std::vector<uint32_t> block_group_; // Offset group of each block or NO_GROUP
+        std::vector<uint8_t> char_offset_; // Per-character offsets inside a block, by group
+
+        struct Trusted {
+        };
+
+        UTF8String(std::string str, Trusted); // Build from already validated UTF-8
 
         void indexString(); // Build character position index
+        void extendIndex(size_t from_byte, bool validate); // Index data_ from from_byte onwards
+        void materializeIndex(); // Build explicit blocks for an ASCII prefix
+        void addCharacter(size_t pos); // Register character starting at byte pos
+        void addAsciiRun(size_t pos, size_t count); // Register count single-byte characters from byte pos
+        void startGroup(size_t slot); // Give the current block explicit offsets for its first slot characters
     };
 
     /**
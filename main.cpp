@@ -1,83 +1,652 @@
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "data/document_store.hpp"
+#include "data/parquet_source.hpp"
+#include "text_processing/batch_runner.hpp"
 #include "text_processing/duplicate_finder.hpp"
+#include "text_processing/duplicate_remover.hpp"
+#include "text_processing/index_file.hpp"
+#include "text_processing/metrics.hpp"
+#include "text_processing/query_server.hpp"
 #include "sql/sql_handler.hpp"
 
 void print_usage() {
-    std::cerr << "Usage: duplicate_finder [-v|--verbose] <database_path> <output_json_path> <domain> <threshold>" << std::endl;
-    std::cerr << "Usage: duplicate_finder <database_path> <output_json_path> <domain> <threshold>" << std::endl;
-    std::cerr << "  <database_path>: Path to SQLite database" << std::endl;
-    std::cerr << "  <output_json_path>: Path to save JSON output" << std::endl;
+    std::cerr << "Usage: duplicate_finder [-v|--verbose] [--builder <type>] [--engine <engine>] [--threads <n>] [--depth-limited] [--prefilter] [--huge-pages] [--top <k> | --any] [--memory-budget <MiB>] [--scratch-dir <path>] [--format <format>] [--clusters | --remove-duplicates] [--index <path> [--incremental | --rebuild-index]] [--shards <n> | --shard <i>/<n>] [--stats <path>] <database_path> <output_json_path> <domain> <threshold>" << std::endl;
+    std::cerr << "       duplicate_finder --merge-shards --index <path> [--format <format>] [--stats <path>] <output_json_path> <shard_file>..." << std::endl;
+    std::cerr << "       duplicate_finder --serve [--threads <n>] [--batch <n>] [--stats <path>] <threshold> <index_path>..." << std::endl;
+    std::cerr << "       duplicate_finder [options] [--jobs <n>] (--all-domains | --domains <list> | --domains-file <path>) <database_path> <output_dir> <threshold>" << std::endl;
+    std::cerr << "  -v, --verbose: Print progress information" << std::endl;
+    std::cerr << "  --builder <type>: Suffix array builder, one of: naive (default), sais, byte, parallel, external" << std::endl;
+    std::cerr << "  --engine <engine>: Match engine, suffix-array (default) or hash (rolling hashes of <threshold>-long windows, no suffix array)" << std::endl;
+    std::cerr << "  --threads <n>: Threads for loading and the parallel builder, 0 uses all cores (default, 1 per domain in batch mode)" << std::endl;
+    std::cerr << "  --depth-limited: Sort suffixes only to <threshold> characters (faster, may pick other matches)" << std::endl;
+    std::cerr << "  --prefilter: Leave out documents that share no fingerprint with another one before building (same matches, except for documents ending alike)" << std::endl;
+    std::cerr << "  --huge-pages: Back the naive builder's scratch arrays with transparent huge pages where available" << std::endl;
+    std::cerr << "  --top <k>: Save only the <k> longest matches, keeping no more than <k> document pairs per thread while scanning" << std::endl;
+    std::cerr << "  --any: Stop at the first match and save only it, to tell whether there is any duplicate at all" << std::endl;
+    std::cerr << "  --memory-budget <MiB>: Memory for suffix buckets of the external builder (default 1024)" << std::endl;
+    std::cerr << "  --scratch-dir <path>: Directory for the external builder's array files (default: system temporary directory)" << std::endl;
+    std::cerr << "  --format <format>: Output format, one of: json (default), ndjson, binary" << std::endl;
+    std::cerr << "  --clusters: Save each maximal repeat once with all of its occurrences instead of matches per document pair" << std::endl;
+    std::cerr << "  --remove-duplicates: Cut the second copy of every match out of doc_content in the database" << std::endl;
+    std::cerr << "  --index <path>: Reuse the index file built for <domain>, or build and save it first" << std::endl;
+    std::cerr << "  --incremental: Match only rows added after the index was built against it and each other" << std::endl;
+    std::cerr << "  --rebuild-index: Rebuild the index from the database even if it is up to date" << std::endl;
+    std::cerr << "  --shards <n>: Split the suffixes into <n> shards by prefix, up to --threads of them sorted and scanned at once" << std::endl;
+    std::cerr << "  --shard <i>/<n>: Worker, save shard <i> of <n> of the --index file (written without arrays if missing) to <output_json_path>" << std::endl;
+    std::cerr << "  --merge-shards: Merge the files of all worker shards of the --index file into its matches" << std::endl;
+    std::cerr << "  --all-domains: Batch mode, process every domain in the table" << std::endl;
+    std::cerr << "  --domains <list>: Batch mode, process a comma-separated list of domains" << std::endl;
+    std::cerr << "  --domains-file <path>: Batch mode, process the domains listed one per line" << std::endl;
+    std::cerr << "  --jobs <n>: Domains processed at once in batch mode, 0 uses all cores (default)" << std::endl;
+    std::cerr << "  --serve: Keep the index files mapped and answer JSON lookup requests from stdin, one per line, on stdout" << std::endl;
+    std::cerr << "  --batch <n>: Most waiting requests answered together by --serve (default 64)" << std::endl;
+    std::cerr << "  --stats <path>: Save phase timings, counts and peak structure sizes as JSON (per domain in batch mode)" << std::endl;
+    std::cerr << "  <database_path>: Path to SQLite database, or a .parquet file if built with Arrow" << std::endl;
+    std::cerr << "  <output_json_path>: Path to save the matches" << std::endl;
+    std::cerr << "  <output_dir>: Directory receiving one <domain>.json (.ndjson, .bin) per domain" << std::endl;
     std::cerr << "  <domain>: Domain to filter documents" << std::endl;
     std::cerr << "  <threshold>: Minimum duplicate substring length" << std::endl;
 }
 
-int main(int argc, char* argv[]) {
-    // Check for correct number of arguments
-    if (argc < 5 || argc > 6) {
+// Split a comma-separated list, dropping empty entries
+std::vector<std::string> split_domains(const std::string& list) {
+    std::vector<std::string> domains;
+    std::stringstream stream(list);
+    std::string domain;
+    while (std::getline(stream, domain, ',')) {
+        if (!domain.empty()) domains.push_back(domain);
+    }
+    return domains;
+}
+
+// Read one domain per line, dropping empty lines
+std::vector<std::string> read_domains(const std::string& path) {
+    std::ifstream in(path);
+    if (!in.is_open()) {
+        throw std::runtime_error("Unable to open file: " + path);
+    }
+    std::vector<std::string> domains;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (!line.empty()) domains.push_back(line);
+    }
+    return domains;
+}
+
+// Parse "<i>/<n>" of --shard
+std::pair<size_t, size_t> parse_shard(const std::string& value) {
+    const auto slash = value.find('/');
+    if (slash == std::string::npos) {
+        throw std::invalid_argument("Shard must be given as <i>/<n>: " + value);
+    }
+    return {std::stoull(value.substr(0, slash)), std::stoull(value.substr(slash + 1))};
+}
+
+// Metrics of a run, saved to the --stats file when it finishes
+struct RunStats {
+    std::string path;
+    text_processing::Metrics metrics;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // Where components record, nullptr without --stats
+    text_processing::Metrics* target() { return path.empty() ? nullptr : &metrics; }
+
+    // Save the stats if asked for, passing the exit code through
+    int finish(int code) {
+        if (!path.empty()) {
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            metrics.add_time("total", elapsed.count());
+            metrics.save(path);
+        }
+        return code;
+    }
+};
+
+int run_batch(const std::vector<std::string>& positional, const std::vector<std::string>& domains,
+              const text_processing::FinderOptions& options, size_t jobs,
+              text_processing::MatchWriter::Format format, bool verbose, RunStats& stats) {
+    if (positional.size() != 3) {
+        print_usage();
+        return 1;
+    }
+
+    text_processing::BatchSource source;
+    source.db_path = positional[0];
+    std::string output_dir = positional[1];
+    size_t threshold = std::stoull(positional[2]);
+
+    text_processing::BatchRunner runner(source, options, jobs, format);
+    auto results = runner.run(domains, output_dir, threshold, verbose);
+
+    size_t failed = 0;
+    size_t matches = 0;
+    for (const auto& result : results) {
+        if (!result.error.empty()) {
+            std::cerr << "Error in domain " << result.domain << ": " << result.error << std::endl;
+            failed++;
+        }
+        matches += result.matches;
+    }
+    std::cout << "Processed " << results.size() - failed << "/" << results.size() << " domains, found "
+              << matches << " duplicate matches. Saved to " << output_dir << std::endl;
+
+    if (!stats.path.empty()) {
+        // The totals of the run, then one entry per domain
+        stats.metrics.add_count("domains", results.size());
+        stats.metrics.add_count("failed_domains", failed);
+        stats.metrics.add_count("matches", matches);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - stats.start;
+        stats.metrics.add_time("total", elapsed.count());
+        text_processing::Metrics::write_json(stats.path, text_processing::BatchRunner::stats_json(stats.metrics, results));
+    }
+    return failed == 0 ? 0 : 1;
+}
+
+int run_serve(const std::vector<std::string>& positional, size_t threads, size_t batch_size, bool verbose,
+              RunStats& stats) {
+    if (positional.size() < 2) {
         print_usage();
         return 1;
     }
+    // Recorded without --stats too, for the "stats" command
+    text_processing::QueryServer server(
+        text_processing::QueryServerOptions{threads, batch_size, std::stoull(positional[0]), &stats.metrics});
+    for (size_t i = 1; i < positional.size(); ++i) {
+        server.add_index(positional[i]);
+    }
+    stats.metrics.set_info("mode", "serve");
+    if (verbose) {
+        // stdout carries the responses
+        std::cerr << "Serving";
+        for (const auto& domain : server.domains()) std::cerr << " " << domain;
+        std::cerr << std::endl;
+    }
+    // Unsynchronized, so requests that have already arrived are buffered and answered as one batch
+    std::ios::sync_with_stdio(false);
+    const size_t answered = server.serve(std::cin, std::cout);
+    if (verbose) std::cerr << "Answered " << answered << " requests" << std::endl;
+    return stats.finish(0);
+}
 
+int main(int argc, char* argv[]) {
     try {
         // Parse arguments
         bool verbose = false;
+        text_processing::FinderOptions options;
+        options.threads = 0;
+        bool threads_set = false;
+        bool batch = false;
+        size_t jobs = 0;
+        auto format = text_processing::MatchWriter::Format::JSON;
+        std::string index_path;
+        bool incremental = false;
+        bool rebuild_index = false;
+        bool clusters = false;
+        bool remove_duplicates = false;
+        size_t shards = 0;
+        std::optional<std::pair<size_t, size_t>> worker_shard;
+        bool merge = false;
+        bool serve = false;
+        size_t batch_size = 64;
+        std::string builder_name = "naive";
+        std::string engine_name = "suffix-array";
+        RunStats stats;
+        std::vector<std::string> domains;
+        std::vector<std::string> positional;
         for (int i = 1; i < argc; ++i) {
-            if (std::string(argv[i]) == "-v" || std::string(argv[i]) == "--verbose") {
+            std::string arg = argv[i];
+            bool has_value = i + 1 < argc;
+            if (arg == "-v" || arg == "--verbose") {
                 verbose = true;
-                break;
+            } else if (arg == "--builder") {
+                if (!has_value) {
+                    print_usage();
+                    return 1;
+                }
+                builder_name = argv[++i];
+                options.builder_type = text_processing::SuffixArrayBuilder::type_from_string(builder_name);
+            } else if (arg == "--engine") {
+                if (!has_value) {
+                    print_usage();
+                    return 1;
+                }
+                engine_name = argv[++i];
+                options.engine = text_processing::DuplicateFinder::engine_from_string(engine_name);
+            } else if (arg == "--threads") {
+                if (!has_value) {
+                    print_usage();
+                    return 1;
+                }
+                options.threads = std::stoull(argv[++i]);
+                threads_set = true;
+            } else if (arg == "--depth-limited") {
+                options.depth_limited = true;
+            } else if (arg == "--prefilter") {
+                options.prefilter = true;
+            } else if (arg == "--huge-pages") {
+                options.huge_pages = true;
+            } else if (arg == "--top") {
+                if (!has_value) {
+                    print_usage();
+                    return 1;
+                }
+                options.top_k = std::stoull(argv[++i]);
+            } else if (arg == "--any") {
+                options.any_match = true;
+            } else if (arg == "--memory-budget") {
+                if (!has_value) {
+                    print_usage();
+                    return 1;
+                }
+                const auto mib = std::stoull(argv[++i]);
+                // Larger budgets would wrap when converted to bytes
+                if (mib > SIZE_MAX >> 20) {
+                    std::cerr << "--memory-budget must be at most " << (SIZE_MAX >> 20) << " MiB" << std::endl;
+                    return 1;
+                }
+                options.memory_budget = static_cast<size_t>(mib) << 20;
+            } else if (arg == "--scratch-dir") {
+                if (!has_value) {
+                    print_usage();
+                    return 1;
+                }
+                options.scratch_dir = argv[++i];
+            } else if (arg == "--format") {
+                if (!has_value) {
+                    print_usage();
+                    return 1;
+                }
+                format = text_processing::MatchWriter::format_from_string(argv[++i]);
+            } else if (arg == "--index") {
+                if (!has_value) {
+                    print_usage();
+                    return 1;
+                }
+                index_path = argv[++i];
+            } else if (arg == "--stats") {
+                if (!has_value) {
+                    print_usage();
+                    return 1;
+                }
+                stats.path = argv[++i];
+            } else if (arg == "--clusters") {
+                clusters = true;
+            } else if (arg == "--remove-duplicates") {
+                remove_duplicates = true;
+            } else if (arg == "--incremental") {
+                incremental = true;
+            } else if (arg == "--rebuild-index") {
+                rebuild_index = true;
+            } else if (arg == "--shards") {
+                if (!has_value) {
+                    print_usage();
+                    return 1;
+                }
+                shards = std::stoull(argv[++i]);
+            } else if (arg == "--shard") {
+                if (!has_value) {
+                    print_usage();
+                    return 1;
+                }
+                worker_shard = parse_shard(argv[++i]);
+            } else if (arg == "--merge-shards") {
+                merge = true;
+            } else if (arg == "--serve") {
+                serve = true;
+            } else if (arg == "--batch") {
+                if (!has_value) {
+                    print_usage();
+                    return 1;
+                }
+                batch_size = std::stoull(argv[++i]);
+            } else if (arg == "--all-domains") {
+                batch = true;
+            } else if (arg == "--domains" || arg == "--domains-file") {
+                if (!has_value) {
+                    print_usage();
+                    return 1;
+                }
+                auto listed = arg == "--domains" ? split_domains(argv[++i]) : read_domains(argv[++i]);
+                domains.insert(domains.end(), listed.begin(), listed.end());
+                batch = true;
+            } else if (arg == "--jobs") {
+                if (!has_value) {
+                    print_usage();
+                    return 1;
+                }
+                jobs = std::stoull(argv[++i]);
+            } else {
+                positional.push_back(arg);
+            }
+        }
+
+        if (serve) {
+            if (batch || merge || !index_path.empty() || clusters || remove_duplicates || shards > 0 || worker_shard
+                || options.engine != text_processing::MatchEngine::SUFFIX_ARRAY) {
+                std::cerr << "--serve takes only --threads, --batch, --stats and -v" << std::endl;
+                return 1;
             }
+            return run_serve(positional, options.threads, batch_size, verbose, stats);
         }
-        std::string db_path = argv[argc-4];
-        std::string output_path = argv[argc-3];
-        std::string domain = argv[argc-2];
-        size_t threshold = std::stoull(argv[argc-1]);
 
+        if ((options.top_k > 0 || options.any_match)
+            && (clusters || remove_duplicates || incremental || shards > 0 || worker_shard || merge)) {
+            std::cerr << "--top and --any cannot be combined with --clusters, --remove-duplicates, --incremental, "
+                         "--shards, --shard or --merge-shards" << std::endl;
+            return 1;
+        }
+        if (options.engine == text_processing::MatchEngine::ROLLING_HASH
+            && (clusters || !index_path.empty() || incremental || shards > 0 || worker_shard || merge)) {
+            std::cerr << "--engine hash cannot be combined with --clusters, --index, --incremental, "
+                         "--shards, --shard or --merge-shards" << std::endl;
+            return 1;
+        }
 
-        if (verbose) std::cout << "Creating SQLite Handler..." << std::endl;
-        // Create SQLite Handler
-        text_processing::SQLiteHandler sql_handler(db_path, verbose);
+        if (batch) {
+            if (!index_path.empty()) {
+                std::cerr << "--index cannot be combined with batch mode" << std::endl;
+                return 1;
+            }
+            if (clusters || remove_duplicates) {
+                std::cerr << "--clusters and --remove-duplicates cannot be combined with batch mode" << std::endl;
+                return 1;
+            }
+            if (shards > 0 || worker_shard || merge) {
+                std::cerr << "--shards, --shard and --merge-shards cannot be combined with batch mode" << std::endl;
+                return 1;
+            }
+            if (!positional.empty() && text_processing::is_parquet_path(positional[0])) {
+                std::cerr << "Batch mode reads SQLite databases only" << std::endl;
+                return 1;
+            }
+            // Domains already run side by side, so each finder gets one thread unless asked otherwise
+            if (!threads_set) options.threads = 1;
+            stats.metrics.set_info("mode", "batch");
+            stats.metrics.set_info("builder", builder_name);
+            stats.metrics.set_info("engine", engine_name);
+            return run_batch(positional, domains, options, jobs, format, verbose, stats);
+        }
 
-        if (verbose) std::cout << "Validating..." << std::endl;
-        // Validate table and columns exist
-        auto [valid, error] = sql_handler.validateTableAndColumns(
-            "data_table",
-            {"domains", "doc_content"}
-        );
+        if (merge) {
+            // Shard files of workers, each found in the same index
+            if (positional.size() < 2 || index_path.empty()) {
+                print_usage();
+                return 1;
+            }
+            options.metrics = stats.target();
+            stats.metrics.set_info("mode", "merge_shards");
+            text_processing::IndexFile index(index_path);
+            std::vector<text_processing::ShardResult> results;
+            for (size_t i = 1; i < positional.size(); ++i) {
+                results.push_back(text_processing::ShardResult::load(positional[i]));
+            }
+            if (verbose) std::cout << "Merging " << results.size() << " shards..." << std::endl;
+            auto matches = text_processing::DuplicateFinder(options).merge_shards(index, std::move(results));
+            {
+                text_processing::ScopedTimer timer(stats.target(), "save_matches");
+                text_processing::save_matches(matches, positional[0], format);
+            }
+            std::cout << "Found " << matches.size() << " duplicate matches. Saved to " << positional[0] << std::endl;
+            return stats.finish(0);
+        }
 
-        if (!valid) {
-            std::cerr << "Database validation failed: " << error << std::endl;
+        // Check for correct number of arguments
+        if (positional.size() != 4) {
+            print_usage();
             return 1;
         }
+        if ((incremental || rebuild_index) && index_path.empty()) {
+            std::cerr << "--incremental and --rebuild-index need --index" << std::endl;
+            return 1;
+        }
+        if (incremental && rebuild_index) {
+            std::cerr << "--incremental cannot be combined with --rebuild-index" << std::endl;
+            return 1;
+        }
+        if (incremental && clusters) {
+            std::cerr << "--incremental cannot be combined with --clusters" << std::endl;
+            return 1;
+        }
+        if (remove_duplicates && (clusters || !index_path.empty())) {
+            std::cerr << "--remove-duplicates cannot be combined with --clusters or --index" << std::endl;
+            return 1;
+        }
+        if (shards > 0 && (clusters || !index_path.empty() || worker_shard)) {
+            std::cerr << "--shards cannot be combined with --clusters, --index or --shard" << std::endl;
+            return 1;
+        }
+        if (options.prefilter && (clusters || !index_path.empty() || shards > 0 || worker_shard)) {
+            std::cerr << "--prefilter cannot be combined with --clusters, --index, --shards or --shard" << std::endl;
+            return 1;
+        }
+        if (worker_shard && (index_path.empty() || clusters || incremental || remove_duplicates)) {
+            std::cerr << "--shard needs --index and cannot be combined with --clusters, --incremental or --remove-duplicates" << std::endl;
+            return 1;
+        }
+
+        std::string db_path = positional[0];
+        std::string output_path = positional[1];
+        std::string domain = positional[2];
+        size_t threshold = std::stoull(positional[3]);
+        const bool parquet = text_processing::is_parquet_path(db_path);
+        if (parquet && remove_duplicates) {
+            std::cerr << "--remove-duplicates needs a SQLite database to write to" << std::endl;
+            return 1;
+        }
+        options.metrics = stats.target();
+        stats.metrics.set_info("domain", domain);
+        stats.metrics.set_info("builder", builder_name);
+        stats.metrics.set_info("engine", engine_name);
+        stats.metrics.set_info("threshold", std::to_string(threshold));
+        text_processing::DuplicateFinder finder(options);
+
+        // Save the worker's shard of the index to the output path
+        auto run_worker_shard = [&](const text_processing::IndexFile& index) {
+            const auto [shard, count] = *worker_shard;
+            if (verbose) std::cout << "Finding duplicates in shard " << shard << " of " << count << "..." << std::endl;
+            auto result = finder.find_shard(index, threshold, shard, count);
+            result.save(output_path);
+            std::cout << "Found " << result.matches.size() << " matches in shard " << shard << " of " << count
+                      << ". Saved to " << output_path << std::endl;
+            return stats.finish(0);
+        };
+
+        if (!index_path.empty() && !incremental && !rebuild_index && std::filesystem::exists(index_path)) {
+            // An index of the same domain answers any threshold without touching the database
+            try {
+                text_processing::IndexFile index(index_path);
+                if (index.label() == domain && worker_shard) {
+                    return run_worker_shard(index);
+                }
+                // A file of shard workers has no arrays to answer from
+                if (index.label() == domain && !index.has_arrays()) {
+                    if (verbose) std::cout << "Index has no suffix arrays, rebuilding..." << std::endl;
+                } else if (index.label() == domain && clusters) {
+                    if (verbose) std::cout << "Finding duplicate clusters in index..." << std::endl;
+                    auto found = finder.find_clusters(index, threshold);
+                    {
+                        text_processing::ScopedTimer timer(stats.target(), "save_clusters");
+                        text_processing::save_clusters(found, output_path, format);
+                    }
+                    std::cout << "Found " << found.size() << " duplicate clusters. Saved to " << output_path << std::endl;
+                    return stats.finish(0);
+                } else if (index.label() == domain) {
+                    if (verbose) std::cout << "Finding duplicates in index..." << std::endl;
+                    auto matches = finder.find_duplicates(index, threshold);
+                    {
+                        text_processing::ScopedTimer timer(stats.target(), "save_matches");
+                        text_processing::save_matches(matches, output_path, format);
+                    }
+                    std::cout << "Found " << matches.size() << " duplicate matches. Saved to " << output_path << std::endl;
+                    return stats.finish(0);
+                } else if (verbose) {
+                    std::cout << "Index was built for another domain, rebuilding..." << std::endl;
+                }
+            } catch (const std::runtime_error& e) {
+                if (verbose) std::cout << e.what() << ", rebuilding..." << std::endl;
+            }
+        }
+
+        std::optional<text_processing::SQLiteHandler> sql_handler;
+#ifdef TEXT_PROCESSING_WITH_PARQUET
+        std::optional<text_processing::ParquetSource> parquet_source;
+#endif
+        if (parquet) {
+#ifdef TEXT_PROCESSING_WITH_PARQUET
+            if (verbose) std::cout << "Opening Parquet file..." << std::endl;
+            parquet_source.emplace(db_path, verbose);
+            parquet_source->set_metrics(stats.target());
+            auto [valid, error] = parquet_source->validate_columns({"domains", "doc_content"});
+            if (!valid) {
+                std::cerr << "Parquet validation failed: " << error << std::endl;
+                return 1;
+            }
+#else
+            std::cerr << "Built without Parquet support, convert " << db_path
+                      << " with parquet_to_sqlite.py first" << std::endl;
+            return 1;
+#endif
+        } else {
+            if (verbose) std::cout << "Creating SQLite Handler..." << std::endl;
+            // Create SQLite Handler
+            // Reading only, unless the write-back needs the connection
+            sql_handler.emplace(db_path, verbose, remove_duplicates
+                ? text_processing::ConnectionProfile::DEFAULT
+                : text_processing::ConnectionProfile::BULK_READ);
+            sql_handler->setMetrics(stats.target());
+
+            if (verbose) std::cout << "Validating..." << std::endl;
+            // Validate table and columns exist
+            auto [valid, error] = sql_handler->validateTableAndColumns(
+                "data_table",
+                {"domains", "doc_content"}
+            );
+
+            if (!valid) {
+                std::cerr << "Database validation failed: " << error << std::endl;
+                return 1;
+            }
+        }
+
+        // Fill a store with the domain's rows after a row ID, from whichever source was opened
+        auto load_documents = [&](text_processing::DocumentStore& target, int64_t after_rowid) {
+#ifdef TEXT_PROCESSING_WITH_PARQUET
+            if (parquet_source) {
+                parquet_source->load_document_store(target, "domains", "doc_content", domain,
+                                                    options.threads, after_rowid);
+                return;
+            }
+#endif
+            sql_handler->loadDocumentStore(target, "data_table", "domains", "doc_content", domain,
+                                           options.threads, after_rowid);
+        };
+
+        if (incremental) {
+            // Only rows added since the index was built are loaded; the index itself stays as it is
+            text_processing::IndexFile index(index_path);
+            if (index.label() != domain) {
+                std::cerr << "Index " << index_path << " was not built for domain " << domain << std::endl;
+                return 1;
+            }
+            if (verbose) std::cout << "Loading new documents..." << std::endl;
+            text_processing::DocumentStore delta{text_processing::UTF8String("\x01")};
+            load_documents(delta, index.max_sql_id());
+            if (verbose) std::cout << "Finding duplicates of new documents..." << std::endl;
+            auto matches = finder.find_new_duplicates(index, delta, threshold);
+            {
+                text_processing::ScopedTimer timer(stats.target(), "save_matches");
+                text_processing::save_matches(matches, output_path, format);
+            }
+            std::cout << "Found " << matches.size() << " duplicate matches in " << delta.document_count()
+                      << " new documents. Saved to " << output_path << std::endl;
+            return stats.finish(0);
+        }
 
         if (verbose) std::cout << "Creating DocumentStore..." << std::endl;
         // Create document store filtered by domain
-        auto store = sql_handler.createDocumentStore(
-            "data_table",   // table name
-            "domains",      // filter column
-            "doc_content",     // content column
-            domain,         // filter value
-            "\x01"
-        );
-
-        if (verbose) std::cout << "Finding duplicates..." << std::endl;
-        // Find duplicates
-        text_processing::DuplicateFinder finder;
-        auto matches = finder.find_duplicates(store, threshold, verbose);
+        text_processing::DocumentStore store{text_processing::UTF8String("\x01")};
+        load_documents(store, text_processing::SQLiteHandler::ALL_ROWS);
+
+        if (worker_shard) {
+            // Workers only need the text, so the shared file skips the suffix array build
+            if (verbose) std::cout << "Writing index without arrays..." << std::endl;
+            text_processing::IndexFile::write_documents(index_path, store, domain);
+            return run_worker_shard(text_processing::IndexFile(index_path));
+        }
+
+        if (clusters) {
+            std::vector<text_processing::Cluster> found;
+            if (!index_path.empty()) {
+                if (verbose) std::cout << "Building index..." << std::endl;
+                finder.build_index(store, index_path, domain);
+                if (verbose) std::cout << "Finding duplicate clusters in index..." << std::endl;
+                found = finder.find_clusters(text_processing::IndexFile(index_path), threshold);
+            } else {
+                if (verbose) std::cout << "Finding duplicate clusters..." << std::endl;
+                found = finder.find_clusters(store, threshold);
+            }
+            if (verbose) std::cout << "Saving Results..." << std::endl;
+            {
+                text_processing::ScopedTimer timer(stats.target(), "save_clusters");
+                text_processing::save_clusters(found, output_path, format);
+            }
+            std::cout << "Found " << found.size() << " duplicate clusters. Saved to " << output_path << std::endl;
+            return stats.finish(0);
+        }
+
+        std::vector<text_processing::Match> matches;
+        if (!index_path.empty()) {
+            if (verbose) std::cout << "Building index..." << std::endl;
+            finder.build_index(store, index_path, domain);
+            if (verbose) std::cout << "Finding duplicates in index..." << std::endl;
+            matches = finder.find_duplicates(text_processing::IndexFile(index_path), threshold);
+        } else if (shards > 0) {
+            if (verbose) std::cout << "Finding duplicates in " << shards << " shards..." << std::endl;
+            matches = finder.find_duplicates_sharded(store, threshold, shards);
+        } else {
+            if (verbose) std::cout << "Finding duplicates..." << std::endl;
+            // Find duplicates
+            matches = finder.find_duplicates(store, threshold, verbose);
+        }
 
         if (verbose) std::cout << "Saving Results..." << std::endl;
-        // Save matches to JSON
-        text_processing::DuplicateFinder::save_matches_to_json(matches, output_path);
+        // Save matches
+        {
+            text_processing::ScopedTimer timer(stats.target(), "save_matches");
+            text_processing::save_matches(matches, output_path, format);
+        }
 
         std::cout << "Found " << matches.size() << " duplicate matches. Saved to " << output_path << std::endl;
 
-        return 0;
+        if (remove_duplicates) {
+            if (verbose) std::cout << "Removing duplicate spans..." << std::endl;
+            text_processing::ScopedTimer timer(stats.target(), "remove_duplicates");
+            auto edits = text_processing::remove_duplicate_spans(store, matches);
+            if (!sql_handler->enableWriteAheadLog() && verbose) {
+                std::cout << "Write-ahead logging not available, using the rollback journal" << std::endl;
+            }
+            size_t updated = sql_handler->updateRows("data_table", "doc_content", edits.sql_ids, edits.contents);
+            timer.stop();
+            stats.metrics.add_count("removed_characters", edits.removed);
+            std::cout << "Removed " << edits.removed << " duplicate characters from " << updated
+                      << " documents" << std::endl;
+        }
+
+        return stats.finish(0);
 
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
         return 1;
     }
-}
\ No newline at end of file
+}
@@ -9,76 +9,127 @@ namespace text_processing {
           , concatenated_text_(UTF8String("")) {
     }
 
-    std::set<DocumentPosition>::const_iterator DocumentStore::find_by_sql_id(int64_t sql_id) const {
-        // Binary search in documents_ (sorted by sql_id)
-        auto it = std::lower_bound(documents_.begin(), documents_.end(),
-                                   DocumentPosition{sql_id, 0, 0},
-                                   [](const DocumentPosition &a, const DocumentPosition &b) {
-                                       return a.sql_id < b.sql_id;
-                                   });
-
-        if (it != documents_.end() && it->sql_id == sql_id) {
-            return it;
+    bool DocumentStore::add_document(const UTF8String &content, int64_t sql_id) {
+        // Check if document exists - O(1)
+        if (!sql_ids_.insert(sql_id).second) {
+            return false;
         }
-        return documents_.end();
+        append(content, sql_id);
+        return true;
     }
 
-    bool DocumentStore::add_document(const UTF8String &content, int64_t sql_id) {
-        // Check if document exists using binary search - O(log n)
-        if (find_by_sql_id(sql_id) != documents_.end()) {
+    size_t DocumentStore::add_documents(const std::vector<UTF8String> &contents,
+                                        const std::vector<int64_t> &sql_ids) {
+        if (contents.size() != sql_ids.size()) {
+            throw std::invalid_argument("Every document needs exactly one SQL ID");
+        }
+
+        // Exact sizes for a single batch; repeated batches still grow geometrically
+        auto grow = [](size_t used, size_t extra, size_t capacity) {
+            return used + extra > capacity ? std::max(used + extra, 2 * capacity) : capacity;
+        };
+
+        // Keep the new IDs first, so the sizes below are exact
+        std::vector<bool> accepted(contents.size());
+        size_t count = 0;
+        size_t chars = 0;
+        size_t bytes = 0;
+        sql_ids_.reserve(grow(sql_ids_.size(), contents.size(),
+                              static_cast<size_t>(sql_ids_.bucket_count() * sql_ids_.max_load_factor())));
+        for (size_t i = 0; i < contents.size(); ++i) {
+            if (sql_ids_.insert(sql_ids[i]).second) {
+                accepted[i] = true;
+                count++;
+                chars += contents[i].length() + separator_.length();
+                bytes += contents[i].str().length() + separator_.str().length();
+            }
+        }
+
+        concatenated_text_.reserve(grow(concatenated_text_.str().length(), bytes,
+                                        concatenated_text_.str().capacity()));
+        pos_index_.reserve(grow(pos_index_.size(), count, pos_index_.capacity()));
+        start_document_.reserve(grow(start_document_.size(), count, start_document_.capacity()));
+        char_starts_.reserve(grow(char_starts_.size(), chars, char_starts_.capacity()));
+        byte_starts_.reserve(grow(byte_starts_.size(), bytes, byte_starts_.capacity()));
+
+        for (size_t i = 0; i < contents.size(); ++i) {
+            if (accepted[i]) {
+                append(contents[i], sql_ids[i]);
+            }
+        }
+        return count;
+    }
+
+    bool DocumentStore::add_document(std::string_view content, int64_t sql_id) {
+        if (sql_ids_.count(sql_id)) {
             return false;
         }
+        const size_t start_pos = concatenated_text_.length();
+        const size_t byte_start = concatenated_text_.str().length();
+        // Validated in place; the text is unchanged if this throws
+        concatenated_text_.append(content);
+        sql_ids_.insert(sql_id);
+        index_document(sql_id, start_pos, byte_start);
+        return true;
+    }
 
-        // Calculate start position for new document
-        size_t start_pos = concatenated_text_.length();
+    void DocumentStore::append(const UTF8String &content, int64_t sql_id) {
+        const size_t start_pos = concatenated_text_.length();
+        const size_t byte_start = concatenated_text_.str().length();
+        concatenated_text_ += content;
+        index_document(sql_id, start_pos, byte_start);
+    }
 
+    void DocumentStore::index_document(int64_t sql_id, size_t start_pos, size_t byte_start) {
         // Create new document position
         DocumentPosition doc_pos{
             sql_id,
             start_pos,
-            content.length()
+            concatenated_text_.length() - start_pos,
+            byte_start,
+            concatenated_text_.str().length() - byte_start
         };
 
-        // Insert into documents_ maintaining sorted order by sql_id - O(log(n))
-        auto insert_pos = std::lower_bound(documents_.begin(), documents_.end(), doc_pos);
-        documents_.insert(insert_pos, doc_pos);
-
         // Insert into pos_index_ maintaining sorted order by start_pos - O(1)
         pos_index_.push_back(doc_pos); // For positions, we can just append as it's always at the end
 
-        // Update concatenated text
-        concatenated_text_ += content + separator_;
-        return true;
-    }
-
-    DocumentPosition DocumentStore::find_document_id(size_t pos) const {
-        if (pos_index_.empty()) {
-            throw std::out_of_range("No documents in store");
+        // Mark the start in the rank bitvectors; the document owns its separator.
+        // An empty span leaves the start to the next document, like upper_bound would.
+        size_t span = doc_pos.length + separator_.length();
+        size_t byte_span = doc_pos.byte_length + separator_.str().length();
+        if (span > 0) {
+            start_document_.push_back(pos_index_.size() - 1);
+            char_starts_.push_back(true);
+            char_starts_.append_zeros(span - 1);
+            byte_starts_.push_back(true);
+            byte_starts_.append_zeros(byte_span - 1);
         }
 
-        // Binary search based on document start positions in pos_index_
-        auto it = std::upper_bound(pos_index_.begin(), pos_index_.end(), pos,
-                                   [](size_t pos, const DocumentPosition &doc) {
-                                       return pos < doc.start_pos;
-                                   });
+        concatenated_text_ += separator_;
+    }
 
-        if (it != pos_index_.begin()) {
-            --it;
-        } else {
-            throw std::out_of_range("Position before first document");
-        }
+    void DocumentStore::clear() {
+        concatenated_text_.clear();
+        sql_ids_.clear();
+        pos_index_.clear();
+        char_starts_.clear();
+        byte_starts_.clear();
+        start_document_.clear();
+    }
 
-        // Check if position is within document bounds (including separator)
-        size_t doc_end = it->start_pos + it->length;
-        if (it != --pos_index_.end()) {
-            // If not last document, include separator
-            doc_end += separator_.length();
+    DocumentPosition DocumentStore::find_document_id(size_t pos) const {
+        size_t index = document_index(pos);
+        if (index == NO_DOCUMENT) {
+            throw std::out_of_range("Position not found in any document");
         }
+        return pos_index_[index];
+    }
 
-        if (pos >= it->start_pos && pos < doc_end) {
-            return *it;
+    DocumentPosition DocumentStore::find_document_by_byte(size_t byte_pos) const {
+        size_t index = document_index_by_byte(byte_pos);
+        if (index == NO_DOCUMENT) {
+            throw std::out_of_range("Position not found in any document");
         }
-
-        throw std::out_of_range("Position not found in any document");
+        return pos_index_[index];
     }
 } // namespace text_processing
@@ -0,0 +1,293 @@
+#include "data/match_writer.hpp"
+#include <cstring>
+#include <stdexcept>
+
+namespace text_processing {
+    namespace {
+        // "00" to "99", so two digits are written per division
+        constexpr char DIGIT_PAIRS[] =
+            "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+            "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
+
+        constexpr char MATCH_MAGIC[8] = {'D', 'U', 'P', 'M', 'A', 'T', 'C', 'H'};
+        constexpr char CLUSTER_MAGIC[8] = {'D', 'U', 'P', 'C', 'L', 'U', 'S', 'T'};
+        constexpr size_t BINARY_COUNT_OFFSET = 16;
+
+        /**
+         * @brief Header shared by both binary formats; the count is patched in on close
+         */
+        void put_binary_header(BufferedFile &out, const char (&magic)[8], uint32_t version, size_t record_size) {
+            out.put(magic, sizeof(magic));
+            out.put_le64(version | static_cast<uint64_t>(record_size) << 32);
+            out.put_le64(0);
+        }
+    } // namespace
+
+    BufferedFile::BufferedFile(const std::string &filename)
+        : filename_(filename)
+          , buffer_(BUFFER_SIZE) {
+        file_ = std::fopen(filename.c_str(), "wb");
+        if (!file_) {
+            throw std::runtime_error("Unable to open file: " + filename);
+        }
+    }
+
+    BufferedFile::~BufferedFile() {
+        try {
+            close();
+        } catch (const std::exception &) {
+            // Nothing to report to from a destructor
+        }
+    }
+
+    void BufferedFile::put(const char *data, size_t length) {
+        if (used_ + length > buffer_.size()) {
+            flush();
+            if (length > buffer_.size()) {
+                // Too long to buffer: written as is, after what was buffered before it
+                if (!failed_ && std::fwrite(data, 1, length, file_) != length) {
+                    failed_ = true;
+                }
+                return;
+            }
+        }
+        std::memcpy(buffer_.data() + used_, data, length);
+        used_ += length;
+    }
+
+    void BufferedFile::put_integer(uint64_t value) {
+        char digits[20];
+        char *end = digits + sizeof(digits);
+        char *begin = end;
+        while (value >= 100) {
+            const size_t pair = 2 * (value % 100);
+            value /= 100;
+            *--begin = DIGIT_PAIRS[pair + 1];
+            *--begin = DIGIT_PAIRS[pair];
+        }
+        if (value >= 10) {
+            *--begin = DIGIT_PAIRS[2 * value + 1];
+            *--begin = DIGIT_PAIRS[2 * value];
+        } else {
+            *--begin = static_cast<char>('0' + value);
+        }
+        put(begin, static_cast<size_t>(end - begin));
+    }
+
+    void BufferedFile::put_integer(int64_t value) {
+        if (value < 0) {
+            put('-');
+            // Negate in unsigned arithmetic, INT64_MIN has no positive counterpart
+            put_integer(0 - static_cast<uint64_t>(value));
+        } else {
+            put_integer(static_cast<uint64_t>(value));
+        }
+    }
+
+    void BufferedFile::put_le64(uint64_t value) {
+        char bytes[8];
+        for (size_t i = 0; i < sizeof(bytes); ++i) {
+            bytes[i] = static_cast<char>(value >> (8 * i));
+        }
+        put(bytes, sizeof(bytes));
+    }
+
+    void BufferedFile::patch_le64(size_t offset, uint64_t value) {
+        flush();
+        char bytes[8];
+        for (size_t i = 0; i < sizeof(bytes); ++i) {
+            bytes[i] = static_cast<char>(value >> (8 * i));
+        }
+        const long end = std::ftell(file_);
+        if (failed_ || end < 0 ||
+            std::fseek(file_, static_cast<long>(offset), SEEK_SET) != 0 ||
+            std::fwrite(bytes, 1, sizeof(bytes), file_) != sizeof(bytes) ||
+            std::fseek(file_, end, SEEK_SET) != 0) {
+            failed_ = true;
+        }
+    }
+
+    void BufferedFile::check() const {
+        if (failed_) {
+            throw std::runtime_error("Unable to write file: " + filename_);
+        }
+    }
+
+    void BufferedFile::close() {
+        if (!file_) return;
+
+        flush();
+        if (std::fclose(file_) != 0) {
+            failed_ = true;
+        }
+        file_ = nullptr;
+        check();
+    }
+
+    void BufferedFile::flush() {
+        if (!failed_ && used_ > 0 && std::fwrite(buffer_.data(), 1, used_, file_) != used_) {
+            failed_ = true;
+        }
+        used_ = 0;
+    }
+
+    MatchWriter::Format MatchWriter::format_from_string(const std::string &name) {
+        if (name == "json") return Format::JSON;
+        if (name == "ndjson") return Format::NDJSON;
+        if (name == "binary") return Format::BINARY;
+        throw std::invalid_argument("Unknown match format: " + name);
+    }
+
+    std::string MatchWriter::extension(Format format) {
+        switch (format) {
+            case Format::NDJSON:
+                return ".ndjson";
+            case Format::BINARY:
+                return ".bin";
+            default:
+                return ".json";
+        }
+    }
+
+    MatchWriter::MatchWriter(const std::string &filename, Format format)
+        : out_(filename)
+          , format_(format) {
+        if (format_ == Format::JSON) {
+            out_.put('[');
+        } else if (format_ == Format::BINARY) {
+            put_binary_header(out_, MATCH_MAGIC, BINARY_VERSION, BINARY_RECORD_SIZE);
+        }
+    }
+
+    MatchWriter::~MatchWriter() {
+        try {
+            close();
+        } catch (const std::exception &) {
+            // Nothing to report to from a destructor
+        }
+    }
+
+    void MatchWriter::write(const Match &match) {
+        if (!out_.is_open()) {
+            throw std::runtime_error("Writer of " + out_.filename() + " is closed");
+        }
+
+        if (format_ == Format::BINARY) {
+            out_.put_le64(static_cast<uint64_t>(match.doc1_id));
+            out_.put_le64(static_cast<uint64_t>(match.doc2_id));
+            out_.put_le64(match.start_pos1);
+            out_.put_le64(match.start_pos2);
+            out_.put_le64(match.length);
+        } else {
+            if (format_ == Format::JSON && count_ > 0) out_.put(", ");
+            out_.put("{\"doc1_id\": ");
+            out_.put_integer(match.doc1_id);
+            out_.put(", \"doc2_id\": ");
+            out_.put_integer(match.doc2_id);
+            out_.put(", \"start_pos1\": ");
+            out_.put_integer(static_cast<uint64_t>(match.start_pos1));
+            out_.put(", \"start_pos2\": ");
+            out_.put_integer(static_cast<uint64_t>(match.start_pos2));
+            out_.put(", \"length\": ");
+            out_.put_integer(static_cast<uint64_t>(match.length));
+            out_.put('}');
+            if (format_ == Format::NDJSON) out_.put('\n');
+        }
+        count_++;
+        out_.check();
+    }
+
+    void MatchWriter::write(const std::vector<Match> &matches) {
+        for (const auto &match: matches) {
+            write(match);
+        }
+    }
+
+    void MatchWriter::close() {
+        if (!out_.is_open()) return;
+
+        if (format_ == Format::JSON) {
+            out_.put(']');
+        } else if (format_ == Format::BINARY) {
+            out_.patch_le64(BINARY_COUNT_OFFSET, count_);
+        }
+        out_.close();
+    }
+
+    ClusterWriter::ClusterWriter(const std::string &filename, MatchWriter::Format format)
+        : out_(filename)
+          , format_(format) {
+        if (format_ == MatchWriter::Format::JSON) {
+            out_.put('[');
+        } else if (format_ == MatchWriter::Format::BINARY) {
+            put_binary_header(out_, CLUSTER_MAGIC, BINARY_VERSION, BINARY_OCCURRENCE_SIZE);
+        }
+    }
+
+    ClusterWriter::~ClusterWriter() {
+        try {
+            close();
+        } catch (const std::exception &) {
+            // Nothing to report to from a destructor
+        }
+    }
+
+    void ClusterWriter::write(const Cluster &cluster) {
+        if (!out_.is_open()) {
+            throw std::runtime_error("Writer of " + out_.filename() + " is closed");
+        }
+
+        if (format_ == MatchWriter::Format::BINARY) {
+            out_.put_le64(cluster.length);
+            out_.put_le64(cluster.occurrences.size());
+            for (const auto &occurrence: cluster.occurrences) {
+                out_.put_le64(static_cast<uint64_t>(occurrence.doc_id));
+                out_.put_le64(occurrence.start_pos);
+            }
+        } else {
+            if (format_ == MatchWriter::Format::JSON && count_ > 0) out_.put(", ");
+            out_.put("{\"length\": ");
+            out_.put_integer(static_cast<uint64_t>(cluster.length));
+            out_.put(", \"occurrences\": [");
+            for (size_t i = 0; i < cluster.occurrences.size(); ++i) {
+                if (i > 0) out_.put(", ");
+                out_.put("{\"doc_id\": ");
+                out_.put_integer(cluster.occurrences[i].doc_id);
+                out_.put(", \"start_pos\": ");
+                out_.put_integer(static_cast<uint64_t>(cluster.occurrences[i].start_pos));
+                out_.put('}');
+            }
+            out_.put("]}");
+            if (format_ == MatchWriter::Format::NDJSON) out_.put('\n');
+        }
+        count_++;
+        out_.check();
+    }
+
+    void ClusterWriter::close() {
+        if (!out_.is_open()) return;
+
+        if (format_ == MatchWriter::Format::JSON) {
+            out_.put(']');
+        } else if (format_ == MatchWriter::Format::BINARY) {
+            out_.patch_le64(BINARY_COUNT_OFFSET, count_);
+        }
+        out_.close();
+    }
+
+    void save_matches(const std::vector<Match> &matches, const std::string &filename, MatchWriter::Format format) {
+        MatchWriter writer(filename, format);
+        writer.write(matches);
+        writer.close();
+    }
+
+    void save_clusters(const std::vector<Cluster> &clusters, const std::string &filename,
+                       MatchWriter::Format format) {
+        ClusterWriter writer(filename, format);
+        for (const auto &cluster: clusters) {
+            writer.write(cluster);
+        }
+        writer.close();
+    }
+} // namespace text_processing
@@ -0,0 +1,225 @@
+#include "data/parquet_source.hpp"
+
+#include <iostream>
+#include <string_view>
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <arrow/util/config.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/exception.h>
+#include <parquet/metadata.h>
+#include <parquet/statistics.h>
+
+namespace text_processing {
+
+namespace {
+    /**
+     * @brief Throw a ParquetError naming the file for a failed Arrow status
+     */
+    void check(const arrow::Status& status, const std::string& path) {
+        if (!status.ok()) {
+            throw ParquetError("Unable to read Parquet file " + path + ": " + status.ToString());
+        }
+    }
+
+    /**
+     * @brief Views of the values of a string or binary array, pointing into Arrow's buffers
+     */
+    class StringColumn {
+    public:
+        StringColumn(const std::shared_ptr<arrow::Array>& array, const std::string& name) {
+            if (!array) {
+                throw ParquetError("Column " + name + " is not a top-level column");
+            }
+            switch (array->type_id()) {
+                case arrow::Type::STRING:
+                case arrow::Type::BINARY:
+                    binary_ = static_cast<const arrow::BinaryArray*>(array.get());
+                    break;
+                case arrow::Type::LARGE_STRING:
+                case arrow::Type::LARGE_BINARY:
+                    large_ = static_cast<const arrow::LargeBinaryArray*>(array.get());
+                    break;
+                default:
+                    throw ParquetError("Column " + name + " is not a string column but " + array->type()->ToString());
+            }
+        }
+
+        [[nodiscard]] bool is_null(int64_t row) const {
+            return binary_ ? binary_->IsNull(row) : large_->IsNull(row);
+        }
+
+        [[nodiscard]] std::string_view value(int64_t row) const {
+            const auto view = binary_ ? binary_->GetView(row) : large_->GetView(row);
+            return {view.data(), view.size()};
+        }
+
+    private:
+        const arrow::BinaryArray* binary_ = nullptr;
+        const arrow::LargeBinaryArray* large_ = nullptr;
+    };
+} // namespace
+
+ParquetSource::ParquetSource(const std::string& path, bool verbose)
+    : path_(path), verbose_(verbose) {
+    try {
+        // Mapped, so uncompressed pages are read in place
+        std::shared_ptr<arrow::io::MemoryMappedFile> file;
+        PARQUET_ASSIGN_OR_THROW(file, arrow::io::MemoryMappedFile::Open(path, arrow::io::FileMode::READ));
+#if ARROW_VERSION_MAJOR >= 19
+        PARQUET_ASSIGN_OR_THROW(reader_, parquet::arrow::OpenFile(file, arrow::default_memory_pool()));
+#else
+        PARQUET_THROW_NOT_OK(parquet::arrow::OpenFile(file, arrow::default_memory_pool(), &reader_));
+#endif
+    } catch (const parquet::ParquetException& e) {
+        throw ParquetError("Unable to open Parquet file " + path + ": " + e.what());
+    }
+}
+
+ParquetSource::~ParquetSource() = default;
+
+ParquetSource::ParquetSource(ParquetSource&&) noexcept = default;
+
+ParquetSource& ParquetSource::operator=(ParquetSource&&) noexcept = default;
+
+int64_t ParquetSource::row_count() const {
+    return reader_->parquet_reader()->metadata()->num_rows();
+}
+
+int ParquetSource::row_group_count() const {
+    return reader_->parquet_reader()->metadata()->num_row_groups();
+}
+
+int ParquetSource::column_index(const std::string& name) const {
+    const parquet::SchemaDescriptor* schema = reader_->parquet_reader()->metadata()->schema();
+    const int index = schema->ColumnIndex(name);
+    if (index < 0) {
+        throw ParquetError("No column " + name + " in " + path_);
+    }
+    if (schema->Column(index)->physical_type() != parquet::Type::BYTE_ARRAY) {
+        throw ParquetError("Column " + name + " of " + path_ + " is not a string column");
+    }
+    return index;
+}
+
+bool ParquetSource::may_contain(int row_group, int column, const std::string& filter_value) const {
+    const auto chunk = reader_->parquet_reader()->metadata()->RowGroup(row_group)->ColumnChunk(column);
+    // Statistics of writers with another string order are not exposed, so these bounds are byte-wise
+    if (!chunk->is_stats_set()) {
+        return true;
+    }
+    const auto stats = std::dynamic_pointer_cast<parquet::ByteArrayStatistics>(chunk->statistics());
+    if (!stats) {
+        return true;
+    }
+    if (stats->HasNullCount() && stats->null_count() == chunk->num_values()) {
+        // Only nulls, which never match
+        return false;
+    }
+    if (!stats->HasMinMax()) {
+        return true;
+    }
+    // char_traits<char> compares as unsigned char, the order of the statistics
+    const std::string_view min(reinterpret_cast<const char*>(stats->min().ptr), stats->min().len);
+    const std::string_view max(reinterpret_cast<const char*>(stats->max().ptr), stats->max().len);
+    const std::string_view value(filter_value);
+    return min <= value && value <= max;
+}
+
+std::pair<bool, std::string> ParquetSource::validate_columns(const std::vector<std::string>& columns) const {
+    for (const auto& column : columns) {
+        try {
+            (void) column_index(column);
+        } catch (const ParquetError&) {
+            return {false, "Column " + column + " is missing or not a string column"};
+        }
+    }
+    return {true, ""};
+}
+
+DocumentStore ParquetSource::create_document_store(
+    const std::string& filter_column,
+    const std::string& content_column,
+    const std::string& filter_value,
+    const std::string& separator,
+    size_t threads
+) {
+    DocumentStore store{UTF8String(separator)};
+    load_document_store(store, filter_column, content_column, filter_value, threads);
+    return store;
+}
+
+void ParquetSource::load_document_store(
+    DocumentStore& store,
+    const std::string& filter_column,
+    const std::string& content_column,
+    const std::string& filter_value,
+    size_t threads,
+    int64_t after_row
+) {
+    ScopedTimer timer(metrics_, "load_documents");
+    const int filter = column_index(filter_column);
+    const int content = column_index(content_column);
+    std::vector<int> columns = {filter};
+    if (content != filter) columns.push_back(content);
+
+    store.clear();
+    // Arrow decodes the columns of a row group on its own CPU pool
+    reader_->set_use_threads(threads != 1);
+
+    const int groups = row_group_count();
+    size_t groups_read = 0;
+    size_t groups_skipped = 0;
+    int64_t group_start = 0; // Rows before the current row group
+    try {
+        for (int group = 0; group < groups; ++group) {
+            const int64_t rows = reader_->parquet_reader()->metadata()->RowGroup(group)->num_rows();
+            const int64_t first_id = group_start + 1;
+            group_start += rows;
+            if (rows == 0 || group_start <= after_row || !may_contain(group, filter, filter_value)) {
+                groups_skipped++;
+                continue;
+            }
+            if (verbose_) {
+                std::cout << "Reading row group " << group + 1 << "/" << groups << std::endl;
+            }
+
+            std::shared_ptr<arrow::Table> table;
+            check(reader_->ReadRowGroup(group, columns, &table), path_);
+            groups_read++;
+
+            // Batches over the chunks of both columns at once, without copying them
+            arrow::TableBatchReader batches(table);
+            int64_t id = first_id;
+            for (;;) {
+                std::shared_ptr<arrow::RecordBatch> batch;
+                check(batches.ReadNext(&batch), path_);
+                if (!batch) break;
+
+                const StringColumn filters(batch->GetColumnByName(filter_column), filter_column);
+                const StringColumn contents(batch->GetColumnByName(content_column), content_column);
+                for (int64_t row = 0; row < batch->num_rows(); ++row, ++id) {
+                    if (id <= after_row || filters.is_null(row) || filters.value(row) != filter_value) {
+                        continue;
+                    }
+                    store.add_document(contents.is_null(row) ? std::string_view() : contents.value(row), id);
+                }
+            }
+        }
+    } catch (const parquet::ParquetException& e) {
+        throw ParquetError("Unable to read Parquet file " + path_ + ": " + e.what());
+    }
+
+    if (metrics_) {
+        const auto& text = store.get_concatenated_text();
+        metrics_->add_count("documents", store.document_count());
+        metrics_->add_count("bytes_loaded", text.str().size());
+        metrics_->add_count("characters_loaded", text.length());
+        metrics_->add_count("row_groups", groups_read);
+        metrics_->add_count("row_groups_skipped", groups_skipped);
+        metrics_->record_peak("text", text.str().capacity());
+        metrics_->record_peak("text_index", text.index_memory_bytes());
+    }
+}
+
+} // namespace text_processing
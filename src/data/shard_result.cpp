@@ -0,0 +1,101 @@
+#include "data/shard_result.hpp"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include "data/match_writer.hpp"
+
+namespace text_processing {
+    namespace {
+        constexpr char SHARD_MAGIC[8] = {'D', 'U', 'P', 'S', 'H', 'A', 'R', 'D'};
+
+        /**
+         * @brief Little-endian fields of a shard file in order
+         */
+        class FieldReader {
+        public:
+            FieldReader(std::ifstream &in, const std::string &filename) : in_(in), filename_(filename) {
+            }
+
+            uint64_t next() {
+                unsigned char bytes[8];
+                if (!in_.read(reinterpret_cast<char *>(bytes), sizeof(bytes))) {
+                    throw std::runtime_error("Invalid shard file " + filename_ + ": truncated");
+                }
+                uint64_t value = 0;
+                for (size_t i = 0; i < sizeof(bytes); ++i) {
+                    value |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+                }
+                return value;
+            }
+
+        private:
+            std::ifstream &in_;
+            const std::string &filename_;
+        };
+    } // namespace
+
+    void ShardResult::save(const std::string &filename) const {
+        BufferedFile out(filename);
+        out.put(SHARD_MAGIC, sizeof(SHARD_MAGIC));
+        out.put_le64(VERSION | static_cast<uint64_t>(RECORD_SIZE) << 32);
+        out.put_le64(matches.size());
+        for (uint64_t field: {shard, shards, min_length, text_size, suffix_begin, suffix_count, first_suffix,
+                              last_suffix}) {
+            out.put_le64(field);
+        }
+        for (const auto &entry: matches) {
+            out.put_le64(entry.key1);
+            out.put_le64(entry.key2);
+            out.put_le64(static_cast<uint64_t>(entry.match.doc1_id));
+            out.put_le64(static_cast<uint64_t>(entry.match.doc2_id));
+            out.put_le64(entry.match.start_pos1);
+            out.put_le64(entry.match.start_pos2);
+            out.put_le64(entry.match.length);
+        }
+        out.close();
+    }
+
+    ShardResult ShardResult::load(const std::string &filename) {
+        std::ifstream in(filename, std::ios::binary);
+        if (!in.is_open()) {
+            throw std::runtime_error("Unable to open file: " + filename);
+        }
+        char magic[sizeof(SHARD_MAGIC)];
+        if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, SHARD_MAGIC, sizeof(magic)) != 0) {
+            throw std::runtime_error("Invalid shard file " + filename + ": not a shard file");
+        }
+        FieldReader fields(in, filename);
+        if (fields.next() != (VERSION | static_cast<uint64_t>(RECORD_SIZE) << 32)) {
+            throw std::runtime_error("Invalid shard file " + filename + ": unknown version");
+        }
+        const uint64_t count = fields.next();
+
+        ShardResult result;
+        for (uint64_t *field: {&result.shard, &result.shards, &result.min_length, &result.text_size,
+                               &result.suffix_begin, &result.suffix_count, &result.first_suffix,
+                               &result.last_suffix}) {
+            *field = fields.next();
+        }
+        if (result.shard >= result.shards) {
+            throw std::runtime_error("Invalid shard file " + filename + ": shard out of range");
+        }
+        // Check the size before allocating, a corrupt count must not allocate
+        in.seekg(0, std::ios::end);
+        const auto size = static_cast<uint64_t>(in.tellg());
+        if (count > size / RECORD_SIZE || size != HEADER_SIZE + count * RECORD_SIZE) {
+            throw std::runtime_error("Invalid shard file " + filename + ": size does not match the match count");
+        }
+        in.seekg(static_cast<std::streamoff>(HEADER_SIZE));
+        result.matches.resize(count);
+        for (auto &entry: result.matches) {
+            entry.key1 = fields.next();
+            entry.key2 = fields.next();
+            entry.match.doc1_id = static_cast<int64_t>(fields.next());
+            entry.match.doc2_id = static_cast<int64_t>(fields.next());
+            entry.match.start_pos1 = fields.next();
+            entry.match.start_pos2 = fields.next();
+            entry.match.length = fields.next();
+        }
+        return result;
+    }
+} // namespace text_processing
@@ -1,10 +1,19 @@
 #include "sql/sql_handler.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <sstream>
 #include <regex>
+#include <string_view>
+#include <thread>
+#include "text_processing/parallel.hpp"
 
 bool isValidName(const std::string& name) {
     // Regex to match valid table/column names: alphanumeric and underscores only
@@ -16,11 +25,74 @@ bool isValidName(const std::string& name) {
 
 namespace text_processing {
 
-SQLiteHandler::SQLiteHandler(const std::string& db_path, bool verbose) {
-    verbose_ = verbose;
+namespace {
+    /**
+     * @brief Rows read together and handed to one worker
+     */
+    struct RowBatch {
+        size_t sequence = 0;              ///< Position of the batch in row order
+        std::vector<int64_t> ids;         ///< Row IDs
+        std::vector<std::string> raw;     ///< Content bytes as read from SQLite
+        std::vector<UTF8String> contents; ///< Validated content, filled by the worker
+    };
+
+    // A batch ends at whichever limit is reached first
+    constexpr size_t BATCH_ROWS = 256;
+    constexpr size_t BATCH_BYTES = 1 << 20;
+
+    /**
+     * @brief A text column's bytes in SQLite's buffer, valid until the next step; NULL gives an empty view
+     */
+    std::string_view columnView(sqlite3_stmt* stmt, int column) {
+        const auto* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, column));
+        if (!text) return {};
+        return {text, static_cast<size_t>(sqlite3_column_bytes(stmt, column))};
+    }
+
+    /**
+     * @brief Copy a text column's bytes; NULL gives an empty string
+     */
+    std::string columnBytes(sqlite3_stmt* stmt, int column) {
+        return std::string(columnView(stmt, column));
+    }
+
+    // Parameters are bound without copies, the values outlive the statement's use.
+    // Parameters the query does not have are ignored.
+    void bindParameter(sqlite3_stmt* stmt, int index, const std::string& value) {
+        sqlite3_bind_text64(stmt, index, value.data(), value.size(), SQLITE_STATIC, SQLITE_UTF8);
+    }
+
+    void bindParameter(sqlite3_stmt* stmt, int index, int64_t value) {
+        sqlite3_bind_int64(stmt, index, value);
+    }
+
+    // Settings of ConnectionProfile::BULK_READ
+    constexpr const char* BULK_READ_PRAGMAS[] = {
+        "PRAGMA mmap_size=1073741824",
+        "PRAGMA cache_size=-65536",
+        "PRAGMA temp_store=MEMORY",
+        "PRAGMA query_only=ON",
+    };
+} // namespace
+
+SQLiteHandler::SQLiteHandler(const std::string& db_path, bool verbose, ConnectionProfile profile)
+    : verbose_(verbose)
+      , profile_(profile) {
     if (sqlite3_open(db_path.c_str(), &db_connection_) != SQLITE_OK) {
+        sqlite3_close(db_connection_);
+        db_connection_ = nullptr;
         throw SQLiteError("Failed to open database: " + db_path);
     }
+    if (profile_ == ConnectionProfile::BULK_READ) {
+        try {
+            for (const char* pragma : BULK_READ_PRAGMAS) {
+                execute(pragma);
+            }
+        } catch (...) {
+            close();
+            throw;
+        }
+    }
 }
 
 SQLiteHandler::~SQLiteHandler() {
@@ -28,9 +100,14 @@ SQLiteHandler::~SQLiteHandler() {
 }
 
 SQLiteHandler::SQLiteHandler(SQLiteHandler&& other) noexcept
-    : db_connection_(other.db_connection_) {
+    : db_connection_(other.db_connection_)
+      , verbose_(other.verbose_)
+      , profile_(other.profile_)
+      , metrics_(other.metrics_)
+      , statements_(std::move(other.statements_))
+      , indexed_(std::move(other.indexed_)) {
     other.db_connection_ = nullptr;
-    verbose_ = other.verbose_;
+    other.statements_.clear();
 }
 
 SQLiteHandler& SQLiteHandler::operator=(SQLiteHandler&& other) noexcept {
@@ -39,11 +116,21 @@ SQLiteHandler& SQLiteHandler::operator=(SQLiteHandler&& other) noexcept {
         db_connection_ = other.db_connection_;
         other.db_connection_ = nullptr;
         verbose_ = other.verbose_;
+        profile_ = other.profile_;
+        metrics_ = other.metrics_;
+        statements_ = std::move(other.statements_);
+        other.statements_.clear();
+        indexed_ = std::move(other.indexed_);
     }
     return *this;
 }
 
 void SQLiteHandler::close() {
+    for (auto& [query, stmt] : statements_) {
+        sqlite3_finalize(stmt);
+    }
+    statements_.clear();
+    indexed_.clear();
     if (db_connection_) {
         sqlite3_close(db_connection_);
         db_connection_ = nullptr;
@@ -51,68 +138,285 @@ void SQLiteHandler::close() {
     }
 }
 
+SQLiteHandler::StatementLease::~StatementLease() {
+    if (owned_) {
+        sqlite3_finalize(stmt_);
+    } else {
+        sqlite3_reset(stmt_);
+        sqlite3_clear_bindings(stmt_);
+    }
+}
+
+SQLiteHandler::StatementLease SQLiteHandler::prepare(const std::string& query) {
+    auto it = statements_.find(query);
+    if (it != statements_.end() && !sqlite3_stmt_busy(it->second)) {
+        return {it->second, false};
+    }
+    const bool cache = it == statements_.end();
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v3(db_connection_, query.c_str(), -1, cache ? SQLITE_PREPARE_PERSISTENT : 0,
+                           &stmt, nullptr) != SQLITE_OK) {
+        sqlite3_finalize(stmt);
+        throw SQLiteError("Failed to prepare SQL statement: " + query);
+    }
+    if (cache) {
+        statements_.emplace(query, stmt);
+    }
+    return {stmt, !cache};
+}
+
 DocumentStore SQLiteHandler::createDocumentStore(
     const std::string& table_name,
     const std::string& filter_column,
     const std::string& content_column,
     const std::string& filter_value,
-    const std::string& separator
+    const std::string& separator,
+    size_t threads
 ) {
-    // Get approximate total size first
-    std::string size_query = "SELECT COUNT(*), SUM(LENGTH(" + content_column + ")) "
-                            "FROM " + table_name +
-                            " WHERE " + filter_column + " = '" + filter_value + "'";
-
-    size_t doc_count = 0;
-    size_t total_size = 0;
+    DocumentStore store{UTF8String(separator)};
+    loadDocumentStore(store, table_name, filter_column, content_column, filter_value, threads);
+    return store;
+}
 
-    executeQuery(size_query, [&](sqlite3_stmt* stmt) {
-        doc_count = sqlite3_column_int64(stmt, 0);
-        total_size = sqlite3_column_int64(stmt, 1);
-    });
-    UTF8String sep = UTF8String(separator);
-    DocumentStore store(sep);
-    store.reserve(total_size);
+void SQLiteHandler::loadDocumentStore(
+    DocumentStore& store,
+    const std::string& table_name,
+    const std::string& filter_column,
+    const std::string& content_column,
+    const std::string& filter_value,
+    size_t threads,
+    int64_t after_rowid
+) {
+    ScopedTimer timer(metrics_, "load_documents");
     if (verbose_) std::cout << "Building Query" << std::endl;
-    std::string query = buildQuery(
-        table_name, filter_column, content_column, filter_value
-    );
-    int current = 0;
+    const std::string query = buildQuery(table_name, filter_column, content_column, after_rowid);
+    if (profile_ == ConnectionProfile::BULK_READ && !indexed_.count(table_name + "." + filter_column)) {
+        ensureIndex(table_name, filter_column);
+    }
+
+    // Counting for the progress output reads the filter column only, the contents are read once below
+    size_t doc_count = 0;
+    if (verbose_) {
+        std::string count_query = "SELECT COUNT(*) FROM " + table_name + " WHERE " + filter_column + " = ?1";
+        if (after_rowid != ALL_ROWS) count_query += " AND rowid > ?2";
+        executeQuery(count_query, [&doc_count](sqlite3_stmt* stmt) {
+            doc_count = sqlite3_column_int64(stmt, 0);
+        }, filter_value, after_rowid);
+    }
+    store.clear();
     if (verbose_) std::cout << "Adding Documents" << std::endl;
-    executeQuery(query, [&store, &current, this, &doc_count](sqlite3_stmt* stmt) {
-        const unsigned char* content = sqlite3_column_text(stmt, 0);
-        const int64_t id = sqlite3_column_int64(stmt, 1);
-        if (verbose_) {
-            if (current % std::max((int)doc_count / 100, 100) == 0 || current == doc_count) {
-                        float percentage = (float)current / doc_count * 100;
-                        std::cout << "\rProcessing documents... " << current << "/" << doc_count
-                                 << " (" << std::fixed << std::setprecision(1) << percentage << "%)"
-                                 << std::flush;
+
+    threads = resolve_threads(threads);
+    if (threads > 1) {
+        loadPipelined(store, query, filter_value, after_rowid, threads - 1, doc_count);
+    } else {
+        size_t current = 0;
+        executeQuery(query, [&store, &current, this, doc_count](sqlite3_stmt* stmt) {
+            reportProgress(current, doc_count);
+            const int64_t id = sqlite3_column_int64(stmt, 1);
+            // Validated and appended straight from SQLite's buffer, the only copy
+            store.add_document(columnView(stmt, 0), id);
+            current++;
+        }, filter_value, after_rowid);
+    }
+
+    if (metrics_) {
+        const auto& text = store.get_concatenated_text();
+        metrics_->add_count("documents", store.document_count());
+        metrics_->add_count("bytes_loaded", text.str().size());
+        metrics_->add_count("characters_loaded", text.length());
+        metrics_->record_peak("text", text.str().capacity());
+        metrics_->record_peak("text_index", text.index_memory_bytes());
+    }
+}
+
+void SQLiteHandler::loadPipelined(
+    DocumentStore& store,
+    const std::string& query,
+    const std::string& filter_value,
+    int64_t after_rowid,
+    size_t workers,
+    size_t doc_count
+) {
+    std::mutex mutex;
+    std::condition_variable work_ready;     // a batch was read, or reading ended
+    std::condition_variable space_ready;    // a batch was appended, or loading failed
+    std::deque<RowBatch> pending;           // read, waiting for a worker
+    std::map<size_t, RowBatch> validated;   // validated, waiting for their turn
+    size_t next_append = 0;
+    size_t in_flight = 0;                   // read but not yet appended
+    size_t appended = 0;
+    bool reading_done = false;
+    bool appending = false;
+    std::exception_ptr error;
+    const size_t max_in_flight = 4 * workers;
+
+    auto fail = [&](std::exception_ptr e) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!error) error = std::move(e);
+        work_ready.notify_all();
+        space_ready.notify_all();
+    };
+
+    auto work = [&]() {
+        for (;;) {
+            RowBatch batch;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                work_ready.wait(lock, [&] { return !pending.empty() || reading_done || error; });
+                if (error || pending.empty()) return;
+                batch = std::move(pending.front());
+                pending.pop_front();
+            }
+
+            try {
+                batch.contents.reserve(batch.raw.size());
+                for (auto& raw : batch.raw) {
+                    batch.contents.emplace_back(std::move(raw));
+                }
+                batch.raw.clear();
+            } catch (...) {
+                fail(std::current_exception());
+                return;
+            }
+
+            // Whichever worker holds the next batch in row order appends every ready batch
+            std::unique_lock<std::mutex> lock(mutex);
+            validated.emplace(batch.sequence, std::move(batch));
+            if (appending) continue;
+            appending = true;
+            while (!error) {
+                auto it = validated.find(next_append);
+                if (it == validated.end()) break;
+                RowBatch ready = std::move(it->second);
+                validated.erase(it);
+                lock.unlock();
+                try {
+                    for (size_t i = 0; i < ready.ids.size(); ++i) {
+                        reportProgress(appended++, doc_count);
                     }
+                    store.add_documents(ready.contents, ready.ids);
+                } catch (...) {
+                    lock.lock();
+                    appending = false;
+                    lock.unlock();
+                    fail(std::current_exception());
+                    return;
+                }
+                lock.lock();
+                next_append++;
+                in_flight--;
+                space_ready.notify_one();
+            }
+            appending = false;
         }
-        std::string content_str(reinterpret_cast<const char*>(content));
-        store.add_document(UTF8String(content_str), id);
-        current++;
-    });
+    };
 
-    return store;
+    std::vector<std::thread> pool;
+    pool.reserve(workers);
+    for (size_t i = 0; i < workers; ++i) {
+        pool.emplace_back(work);
+    }
+
+    // Step the statement here, copying every row once into the current batch
+    try {
+        RowBatch current;
+        size_t current_bytes = 0;
+        size_t sequence = 0;
+        auto submit = [&]() {
+            std::unique_lock<std::mutex> lock(mutex);
+            space_ready.wait(lock, [&] { return in_flight < max_in_flight || error; });
+            if (error) throw SQLiteError("Loading aborted");
+            current.sequence = sequence++;
+            pending.push_back(std::move(current));
+            in_flight++;
+            work_ready.notify_one();
+            current = RowBatch();
+            current_bytes = 0;
+        };
+        executeQuery(query, [&](sqlite3_stmt* stmt) {
+            current.ids.push_back(sqlite3_column_int64(stmt, 1));
+            current.raw.push_back(columnBytes(stmt, 0));
+            current_bytes += current.raw.back().size();
+            if (current.ids.size() >= BATCH_ROWS || current_bytes >= BATCH_BYTES) {
+                submit();
+            }
+        }, filter_value, after_rowid);
+        if (!current.ids.empty()) {
+            submit();
+        }
+    } catch (...) {
+        fail(std::current_exception());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        reading_done = true;
+    }
+    work_ready.notify_all();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
 }
 
-std::pair<bool, std::string> SQLiteHandler::validateTableAndColumns(
+void SQLiteHandler::reportProgress(size_t current, size_t doc_count) const {
+    if (!verbose_) return;
+    if (current % std::max(doc_count / 100, size_t{100}) == 0 || current == doc_count) {
+        float percentage = (float)current / doc_count * 100;
+        std::cout << "\rProcessing documents... " << current << "/" << doc_count
+                  << " (" << std::fixed << std::setprecision(1) << percentage << "%)"
+                  << std::flush;
+    }
+}
+
+std::vector<FilterGroup> SQLiteHandler::listFilterGroups(
     const std::string& table_name,
-    const std::vector<std::string>& columns
+    const std::string& filter_column,
+    const std::string& content_column
 ) {
+    if (!isValidName(table_name)) {
+        throw SQLiteError("Invalid table name: " + table_name);
+    }
+    if (!isValidName(filter_column)) {
+        throw SQLiteError("Invalid column name: " + filter_column);
+    }
+    if (!isValidName(content_column)) {
+        throw SQLiteError("Invalid column name: " + content_column);
+    }
+
     std::stringstream query;
-    query << "PRAGMA table_info(" << sanitizeInput(table_name) << ")";
+    query << "SELECT " << filter_column << ", COUNT(*), SUM(LENGTH(" << content_column << "))"
+          << " FROM " << table_name
+          << " WHERE " << filter_column << " IS NOT NULL"
+          << " GROUP BY " << filter_column
+          << " ORDER BY 3 DESC, 1";
+
+    std::vector<FilterGroup> groups;
+    executeQuery(query.str(), [&groups](sqlite3_stmt* stmt) {
+        const unsigned char* value = sqlite3_column_text(stmt, 0);
+        groups.push_back({
+            std::string(reinterpret_cast<const char*>(value)),
+            static_cast<size_t>(sqlite3_column_int64(stmt, 1)),
+            static_cast<size_t>(sqlite3_column_int64(stmt, 2))
+        });
+    });
+    return groups;
+}
 
+std::pair<bool, std::string> SQLiteHandler::validateTableAndColumns(
+    const std::string& table_name,
+    const std::vector<std::string>& columns
+) {
     bool table_exists = false;
     std::vector<std::string> existing_columns;
 
-    executeQuery(query.str(), [&](sqlite3_stmt* stmt) {
+    executeQuery("SELECT name FROM pragma_table_info(?1)", [&](sqlite3_stmt* stmt) {
         table_exists = true;
-        const unsigned char* column = sqlite3_column_text(stmt, 1);
-        existing_columns.emplace_back(reinterpret_cast<const char*>(column));
-    });
+        existing_columns.push_back(columnBytes(stmt, 0));
+    }, table_name);
 
     if (!table_exists) {
         return {false, table_name};
@@ -134,49 +438,128 @@ void SQLiteHandler::updateRow(
     const std::string& column_name,
     const std::string& new_value
 ) {
-    std::stringstream query;
-    query << "UPDATE " << sanitizeInput(table_name)
-          << " SET " << sanitizeInput(column_name) << " = '"
-          << sanitizeInput(new_value) << "' WHERE rowid = " << row_id;
+    updateRows(table_name, column_name, {row_id}, {new_value});
+}
+
+size_t SQLiteHandler::updateRows(
+    const std::string& table_name,
+    const std::string& column_name,
+    const std::vector<int64_t>& row_ids,
+    const std::vector<std::string>& values,
+    size_t batch_rows
+) {
+    if (!isValidName(table_name)) {
+        throw SQLiteError("Invalid table name: " + table_name);
+    }
+    if (!isValidName(column_name)) {
+        throw SQLiteError("Invalid column name: " + column_name);
+    }
+    if (row_ids.size() != values.size()) {
+        throw SQLiteError("Row IDs and values differ in size");
+    }
+    if (row_ids.empty()) return 0;
+    if (batch_rows == 0) batch_rows = row_ids.size();
+
+    const StatementLease stmt = prepare("UPDATE " + table_name + " SET " + column_name + " = ?1 WHERE rowid = ?2");
+
+    size_t changed = 0;
+    size_t row = 0;
+    while (row < row_ids.size()) {
+        const size_t end = std::min(row + batch_rows, row_ids.size());
+        execute("BEGIN IMMEDIATE");
+        try {
+            for (; row < end; ++row) {
+                // The value is only read during the step, so SQLite need not copy it
+                bindParameter(stmt.get(), 1, values[row]);
+                bindParameter(stmt.get(), 2, row_ids[row]);
+                if (sqlite3_step(stmt.get()) != SQLITE_DONE) {
+                    throw SQLiteError("Failed to update row " + std::to_string(row_ids[row]) + ": " +
+                                      sqlite3_errmsg(db_connection_));
+                }
+                changed += sqlite3_changes(db_connection_);
+                sqlite3_reset(stmt.get());
+            }
+            execute("COMMIT");
+        } catch (...) {
+            sqlite3_reset(stmt.get());
+            sqlite3_exec(db_connection_, "ROLLBACK", nullptr, nullptr, nullptr);
+            throw;
+        }
+        if (verbose_) {
+            std::cout << "\rUpdating rows... " << row << "/" << row_ids.size() << std::flush;
+        }
+    }
+    if (verbose_) std::cout << std::endl;
+    return changed;
+}
 
-    executeQuery(query.str(), [](sqlite3_stmt*){});
+bool SQLiteHandler::enableWriteAheadLog() {
+    std::string mode;
+    executeQuery("PRAGMA journal_mode=WAL", [&mode](sqlite3_stmt* stmt) {
+        mode = columnBytes(stmt, 0);
+    });
+    execute("PRAGMA synchronous=NORMAL");
+    return mode == "wal";
 }
 
-template <typename Callback>
-void SQLiteHandler::executeQuery(const std::string& query, Callback callback) {
-    sqlite3_stmt* stmt;
-    if (sqlite3_prepare_v2(db_connection_, query.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
-        throw SQLiteError("Failed to prepare SQL statement: " + query);
+bool SQLiteHandler::ensureIndex(const std::string& table_name, const std::string& column_name) {
+    if (!isValidName(table_name)) {
+        throw SQLiteError("Invalid table name: " + table_name);
     }
+    if (!isValidName(column_name)) {
+        throw SQLiteError("Invalid column name: " + column_name);
+    }
+    indexed_.insert(table_name + "." + column_name);
+
+    // Any index leading with the column serves the filter
+    bool exists = false;
+    executeQuery("SELECT 1 FROM pragma_index_list(?1) AS list, pragma_index_info(list.name) AS info "
+                 "WHERE info.seqno = 0 AND info.name = ?2", [&exists](sqlite3_stmt*) {
+        exists = true;
+    }, table_name, column_name);
+    if (exists) return true;
+
+    const bool query_only = profile_ == ConnectionProfile::BULK_READ;
+    if (query_only) execute("PRAGMA query_only=OFF");
+    const std::string create = "CREATE INDEX IF NOT EXISTS idx_" + table_name + "_" + column_name +
+                               " ON " + table_name + "(" + column_name + ")";
+    const bool created = sqlite3_exec(db_connection_, create.c_str(), nullptr, nullptr, nullptr) == SQLITE_OK;
+    if (query_only) execute("PRAGMA query_only=ON");
+    if (verbose_ && created) std::cout << "Created index on " << table_name << "." << column_name << std::endl;
+    return created;
+}
+
+template <typename Callback, typename... Params>
+void SQLiteHandler::executeQuery(const std::string& query, Callback callback, const Params&... params) {
+    // Reset and unbound on every exit, including exceptions thrown by the callback
+    const StatementLease stmt = prepare(query);
+    int index = 0;
+    (bindParameter(stmt.get(), ++index, params), ...);
 
     int rc = 0;
-    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
-        callback(stmt);
+    while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+        callback(stmt.get());
     }
 
     if (rc != SQLITE_DONE) {
-        throw SQLiteError("Failed to execute SQL statement: " + query);
+        throw SQLiteError("Failed to execute SQL statement: " + query + ": " + sqlite3_errmsg(db_connection_));
     }
-
-    sqlite3_finalize(stmt);
 }
 
-std::string SQLiteHandler::sanitizeInput(const std::string& input) {
-    std::string sanitized = input;
-    for (size_t pos = sanitized.find('\'');
-         pos != std::string::npos;
-         pos = sanitized.find('\'', pos)) {
-        sanitized.replace(pos, 1, "''");
-        pos += 2;
+void SQLiteHandler::execute(const std::string& statement) {
+    char* message = nullptr;
+    if (sqlite3_exec(db_connection_, statement.c_str(), nullptr, nullptr, &message) != SQLITE_OK) {
+        std::string error = message ? message : "unknown error";
+        sqlite3_free(message);
+        throw SQLiteError("Failed to execute SQL statement: " + statement + ": " + error);
     }
-    return sanitized;
 }
 
 std::string SQLiteHandler::buildQuery(
     const std::string& table_name,
     const std::string& filter_column,
     const std::string& content_column,
-    const std::string& filter_value
+    int64_t after_rowid
 ) {
     // Validate table and column names
     if (!isValidName(table_name)) {
@@ -190,10 +573,12 @@ std::string SQLiteHandler::buildQuery(
     }
 
     std::stringstream query;
-    query << "SELECT " << sanitizeInput(content_column)
-          << ", rowid FROM " << sanitizeInput(table_name)
-          << " WHERE " << sanitizeInput(filter_column)
-          << " = '" << sanitizeInput(filter_value) << "'";
+    query << "SELECT " << content_column
+          << ", rowid FROM " << table_name
+          << " WHERE " << filter_column << " = ?1";
+    if (after_rowid != ALL_ROWS) {
+        query << " AND rowid > ?2";
+    }
     return query.str();
 }
 
@@ -0,0 +1,174 @@
+#include "text_processing/batch_runner.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include "sql/sql_handler.hpp"
+#include "text_processing/parallel.hpp"
+
+namespace text_processing {
+    namespace {
+        /**
+         * @brief Connection, finder and store kept by one worker for all of its domains
+         */
+        struct BatchWorker {
+            std::unique_ptr<SQLiteHandler> sql;
+            std::unique_ptr<DuplicateFinder> finder;
+            std::unique_ptr<DocumentStore> store;
+        };
+    } // namespace
+
+    BatchRunner::BatchRunner(BatchSource source, FinderOptions options, size_t workers, MatchWriter::Format format)
+        : source_(std::move(source))
+          , options_(options)
+          , workers_(resolve_threads(workers))
+          , format_(format) {
+    }
+
+    std::vector<BatchResult> BatchRunner::run(
+        const std::vector<std::string> &domains,
+        const std::string &output_dir,
+        size_t min_length,
+        bool verbose
+    ) const {
+        // Schedule by the content size of every domain
+        std::vector<FilterGroup> groups;
+        {
+            SQLiteHandler sql(source_.db_path, false, source_.profile);
+            auto [valid, missing] = sql.validateTableAndColumns(
+                source_.table_name, {source_.filter_column, source_.content_column});
+            if (!valid) {
+                throw SQLiteError("Database validation failed: " + missing);
+            }
+            // Created once here, before the workers' connections look for it
+            if (source_.profile == ConnectionProfile::BULK_READ) {
+                sql.ensureIndex(source_.table_name, source_.filter_column);
+            }
+            groups = sql.listFilterGroups(source_.table_name, source_.filter_column, source_.content_column);
+        }
+
+        std::vector<BatchResult> results;
+        if (domains.empty()) {
+            for (const auto &group: groups) {
+                BatchResult result;
+                result.domain = group.value;
+                result.documents = group.documents;
+                result.bytes = group.bytes;
+                results.push_back(std::move(result));
+            }
+        } else {
+            std::unordered_map<std::string, const FilterGroup *> by_value;
+            for (const auto &group: groups) {
+                by_value.emplace(group.value, &group);
+            }
+            std::unordered_set<std::string> seen;
+            for (const auto &domain: domains) {
+                if (!seen.insert(domain).second) {
+                    continue;
+                }
+                auto it = by_value.find(domain);
+                // Unknown domains still get an (empty) output file
+                BatchResult result;
+                result.domain = domain;
+                result.bytes = it == by_value.end() ? 0 : it->second->bytes;
+                results.push_back(std::move(result));
+            }
+        }
+
+        std::filesystem::create_directories(output_dir);
+        std::vector<size_t> sizes(results.size());
+        for (size_t i = 0; i < results.size(); ++i) {
+            results[i].output_path = (std::filesystem::path(output_dir) / output_file_name(results[i].domain, format_)).string();
+            sizes[i] = results[i].bytes;
+        }
+
+        std::vector<BatchWorker> workers(std::min(workers_, results.size()));
+        std::mutex print_mutex;
+        parallel_for_each_largest_first(sizes, workers.size(), [&](size_t item, size_t index) {
+            BatchResult &result = results[item];
+            BatchWorker &worker = workers[index];
+            try {
+                if (!worker.sql) {
+                    worker.sql = std::make_unique<SQLiteHandler>(source_.db_path, false, source_.profile);
+                    worker.finder = std::make_unique<DuplicateFinder>(options_);
+                    worker.store = std::make_unique<DocumentStore>(UTF8String(source_.separator));
+                }
+                worker.sql->setMetrics(&result.metrics);
+                worker.finder->set_metrics(&result.metrics);
+                worker.sql->loadDocumentStore(*worker.store, source_.table_name, source_.filter_column,
+                                              source_.content_column, result.domain, options_.threads);
+                result.documents = worker.store->document_count();
+                auto matches = worker.finder->find_duplicates(*worker.store, min_length);
+                {
+                    ScopedTimer timer(&result.metrics, "save_matches");
+                    save_matches(matches, result.output_path, format_);
+                }
+                result.matches = matches.size();
+            } catch (const std::exception &e) {
+                result.error = e.what();
+            }
+            if (worker.sql) {
+                worker.sql->setMetrics(nullptr);
+                worker.finder->set_metrics(nullptr);
+            }
+
+            if (verbose) {
+                std::lock_guard<std::mutex> lock(print_mutex);
+                if (result.error.empty()) {
+                    std::cout << result.domain << ": " << result.matches << " matches in "
+                              << result.documents << " documents" << std::endl;
+                } else {
+                    std::cout << result.domain << ": failed: " << result.error << std::endl;
+                }
+            }
+        });
+
+        return results;
+    }
+
+    std::string BatchRunner::output_file_name(const std::string &domain, MatchWriter::Format format) {
+        std::string name;
+        bool replaced = domain.empty();
+        for (size_t i = 0; i < domain.size(); ++i) {
+            const unsigned char c = domain[i];
+            const bool keep = std::isalnum(c) || c == '-' || c == '_' || (c == '.' && i > 0);
+            name += keep ? static_cast<char>(c) : '_';
+            replaced |= !keep;
+        }
+        if (replaced) {
+            // FNV-1a, stable across platforms and runs
+            uint64_t hash = 14695981039346656037ULL;
+            for (const unsigned char c: domain) {
+                hash = (hash ^ c) * 1099511628211ULL;
+            }
+            std::ostringstream suffix;
+            suffix << std::hex << std::setw(16) << std::setfill('0') << hash;
+            name += "-" + suffix.str();
+        }
+        return name + MatchWriter::extension(format);
+    }
+
+    std::string BatchResult::to_json() const {
+        std::ostringstream json;
+        json << "{\"domain\": " << Metrics::json_string(domain) << ", \"documents\": " << documents
+             << ", \"matches\": " << matches << ", \"error\": " << Metrics::json_string(error)
+             << ", \"metrics\": " << metrics.to_json() << "}";
+        return json.str();
+    }
+
+    std::string BatchRunner::stats_json(const Metrics &run, const std::vector<BatchResult> &results) {
+        std::string json = "{\"run\": " + run.to_json() + ", \"domains\": [";
+        for (size_t i = 0; i < results.size(); ++i) {
+            if (i > 0) json += ", ";
+            json += results[i].to_json();
+        }
+        return json + "]}";
+    }
+} // namespace text_processing
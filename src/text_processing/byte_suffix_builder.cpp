@@ -0,0 +1,164 @@
+#include "text_processing/byte_suffix_builder.hpp"
+#include "text_processing/sais.hpp"
+#include <cstring>
+#include <stdexcept>
+
+namespace text_processing {
+
+namespace {
+    /**
+     * @brief True if the byte starts a UTF-8 character (is not a continuation byte)
+     */
+    inline bool is_char_start(unsigned char byte) {
+        return (byte & 0xC0) != 0x80;
+    }
+
+    /**
+     * @brief Number of bytes of the character with this lead byte
+     */
+    inline size_t char_bytes(unsigned char lead) {
+        if (lead < 0x80) return 1;
+        if ((lead & 0xE0) == 0xC0) return 2;
+        if ((lead & 0xF0) == 0xE0) return 3;
+        return 4;
+    }
+
+    /**
+     * @brief Kasai's algorithm restricted to the character-boundary suffixes
+     *
+     * Moving from one boundary to the next drops a whole character from the
+     * front of the suffix, so the running match loses that character's bytes
+     * instead of one. Stored values are cut back to the last complete common
+     * character; the running match is not, as it stays a valid lower bound.
+     *
+     * @param s Symbols of the text, s[n] is a unique sentinel
+     * @param bytes Raw UTF-8 bytes of the text, bytes[n] == 0
+     * @param n Number of bytes
+     * @param sa Sparse suffix array of the character-boundary suffixes
+     * @param lcp Output LCP array in bytes, resized to sa.size() - 1
+     */
+    template<typename Symbol, typename Index>
+    void sparse_kasai_lcp(const Symbol* s, const unsigned char* bytes, size_t n,
+                          const std::vector<Index>& sa, std::vector<Index>& lcp) {
+        const size_t m = sa.size();
+        std::vector<Index> rank(n);
+        for (size_t i = 0; i < m; i++) {
+            rank[sa[i]] = static_cast<Index>(i);
+        }
+        lcp.assign(m - 1, 0);
+
+        size_t k = 0;
+        for (size_t i = 0; i < n; i += char_bytes(bytes[i])) {
+            const size_t step = char_bytes(bytes[i]);
+            if (rank[i] == m - 1) {
+                k = 0;
+                continue;
+            }
+
+            size_t j = sa[rank[i] + 1];
+            while (s[i + k] == s[j + k]) {
+                k++;
+            }
+
+            size_t whole = k;
+            while (whole > 0 && !is_char_start(bytes[i + whole])) {
+                whole--;
+            }
+            lcp[rank[i]] = static_cast<Index>(whole);
+            k = k > step ? k - step : 0;
+        }
+    }
+} // namespace
+
+bool ByteSuffixBuilder::build(const UTF8String& text) {
+    try {
+        validate_input(text);
+        text_ = text;
+        is_built_ = false;
+
+        if (IndexVector::width_for(text_.str().length() + 1) == IndexVector::Width::UINT32) {
+            build_arrays<uint32_t>();
+        } else {
+            build_arrays<uint64_t>();
+        }
+        is_built_ = true;
+        return true;
+    } catch (const std::exception& e) {
+        is_built_ = false;
+        throw std::runtime_error(std::string("Failed to build suffix array: ") + e.what());
+    }
+}
+
+template<typename Index>
+void ByteSuffixBuilder::build_arrays() {
+    const std::string& data = text_.str();
+    const size_t n = data.length();
+    const auto* bytes = reinterpret_cast<const unsigned char*>(data.c_str());
+
+    // The string's own terminating NUL serves as the sentinel unless the text
+    // contains NUL characters; then the bytes are shifted up by one instead
+    std::vector<uint16_t> shifted;
+    if (std::memchr(bytes, 0, n) != nullptr) {
+        shifted.resize(n + 1, 0);
+        for (size_t i = 0; i < n; i++) {
+            shifted[i] = static_cast<uint16_t>(bytes[i] + 1);
+        }
+    }
+
+    // Sort all byte suffixes, then keep those starting on a character
+    // boundary (this drops the sentinel, which is always first)
+    std::vector<Index> sa(n + 1);
+    if (shifted.empty()) {
+        sais(bytes, sa.data(), n + 1, 256);
+    } else {
+        sais(shifted.data(), sa.data(), n + 1, 257);
+    }
+
+    size_t kept = 0;
+    for (size_t i = 1; i <= n; i++) {
+        if (is_char_start(bytes[sa[i]])) {
+            sa[kept++] = sa[i];
+        }
+    }
+    sa.resize(kept);
+    sa.shrink_to_fit();
+
+    std::vector<Index> lcp;
+    if (shifted.empty()) {
+        sparse_kasai_lcp(bytes, bytes, n, sa, lcp);
+    } else {
+        sparse_kasai_lcp(shifted.data(), bytes, n, sa, lcp);
+    }
+    suffix_array_ = IndexVector(std::move(sa));
+    lcp_array_ = IndexVector(std::move(lcp));
+}
+
+void ByteSuffixBuilder::validate_input(const UTF8String& text) {
+    if (text.length() == 0) {
+        throw std::runtime_error("Empty string provided");
+    }
+}
+
+const IndexVector& ByteSuffixBuilder::get_array() const {
+    if (!is_built_) {
+        throw std::runtime_error("Suffix array not built");
+    }
+    return suffix_array_;
+}
+
+const IndexVector& ByteSuffixBuilder::get_lcp_array() const {
+    if (!is_built_) {
+        throw std::runtime_error("LCP array not built");
+    }
+    return lcp_array_;
+}
+
+const UTF8String& ByteSuffixBuilder::get_text() const {
+    return text_;
+}
+
+bool ByteSuffixBuilder::is_built() const {
+    return is_built_;
+}
+
+} // namespace text_processing
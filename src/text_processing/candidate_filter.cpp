@@ -0,0 +1,141 @@
+#include "text_processing/candidate_filter.hpp"
+#include <algorithm>
+#include "text_processing/parallel.hpp"
+
+namespace text_processing {
+    namespace {
+        constexpr uint64_t HASH_BASE = 0x100000001b3ULL;
+
+        /**
+         * @brief Spread a polynomial hash over all bits, so window minima are evenly spaced
+         */
+        inline uint64_t mix(uint64_t x) {
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ULL;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebULL;
+            return x ^ (x >> 31);
+        }
+
+        struct Posting {
+            uint64_t hash;
+            size_t document;
+        };
+    } // namespace
+
+    std::vector<uint64_t> winnow_fingerprints(std::string_view bytes, size_t min_length) {
+        min_length = std::max<size_t>(min_length, 1);
+        if (bytes.size() < min_length) {
+            // Too short for any match
+            return {};
+        }
+        const size_t shingle = std::min(min_length, CANDIDATE_SHINGLE_BYTES);
+        const size_t window = min_length - shingle + 1;
+        const size_t shingles = bytes.size() - shingle + 1;
+        const auto *data = reinterpret_cast<const unsigned char *>(bytes.data());
+
+        // Rolling hash of every shingle
+        std::vector<uint64_t> hashes(shingles);
+        uint64_t power = 1;
+        uint64_t hash = 0;
+        for (size_t i = 0; i < shingle; ++i) {
+            if (i > 0) power *= HASH_BASE;
+            hash = hash * HASH_BASE + data[i];
+        }
+        hashes[0] = mix(hash);
+        for (size_t i = 1; i < shingles; ++i) {
+            hash = (hash - data[i - 1] * power) * HASH_BASE + data[i + shingle - 1];
+            hashes[i] = mix(hash);
+        }
+
+        // Minimum of every window from a queue of increasing hashes
+        std::vector<uint64_t> fingerprints;
+        std::vector<size_t> minima(shingles);
+        size_t head = 0;
+        size_t tail = 0;
+        size_t last = shingles;
+        for (size_t i = 0; i < shingles; ++i) {
+            while (tail > head && hashes[minima[tail - 1]] >= hashes[i]) tail--;
+            minima[tail++] = i;
+            if (minima[head] + window <= i) head++;
+            if (i + 1 >= window && minima[head] != last) {
+                last = minima[head];
+                fingerprints.push_back(hashes[last]);
+            }
+        }
+        std::sort(fingerprints.begin(), fingerprints.end());
+        fingerprints.erase(std::unique(fingerprints.begin(), fingerprints.end()), fingerprints.end());
+        return fingerprints;
+    }
+
+    std::vector<size_t> find_candidate_documents(const DocumentStore &store, size_t min_length, size_t threads,
+                                                 size_t *fingerprints) {
+        const size_t count = store.document_count();
+        if (fingerprints) *fingerprints = 0;
+        if (count == 0) {
+            return {};
+        }
+        threads = resolve_threads(threads);
+        const std::string_view text = store.get_concatenated_text().str();
+
+        // Fingerprints of the documents in contiguous parts, handed out to threads
+        const size_t parts = std::min(count, 16 * threads);
+        std::vector<std::vector<Posting>> part_postings(parts);
+        parallel_for_each_dynamic(parts, threads, [&](size_t part) {
+            for (size_t d = count * part / parts; d < count * (part + 1) / parts; ++d) {
+                const auto &doc = store.document(d);
+                for (uint64_t hash: winnow_fingerprints(text.substr(doc.byte_start, doc.byte_length), min_length)) {
+                    part_postings[part].push_back({hash, d});
+                }
+            }
+        });
+        size_t total = 0;
+        for (const auto &postings: part_postings) {
+            total += postings.size();
+        }
+        std::vector<Posting> postings;
+        postings.reserve(total);
+        for (auto &part: part_postings) {
+            postings.insert(postings.end(), part.begin(), part.end());
+            std::vector<Posting>().swap(part);
+        }
+        if (fingerprints) *fingerprints = total;
+
+        // A document has each fingerprint once, so a run of equal hashes longer than one spans documents
+        parallel_sort(postings.begin(), postings.end(), threads, [](const Posting &a, const Posting &b) {
+            return a.hash < b.hash || (a.hash == b.hash && a.document < b.document);
+        });
+        std::vector<bool> candidate(count);
+        for (size_t i = 0; i < postings.size();) {
+            size_t j = i + 1;
+            while (j < postings.size() && postings[j].hash == postings[i].hash) ++j;
+            if (j - i > 1) {
+                for (size_t k = i; k < j; ++k) {
+                    candidate[postings[k].document] = true;
+                }
+            }
+            i = j;
+        }
+
+        std::vector<size_t> documents;
+        for (size_t d = 0; d < count; ++d) {
+            if (candidate[d]) documents.push_back(d);
+        }
+        return documents;
+    }
+
+    DocumentStore select_documents(const DocumentStore &store, const std::vector<size_t> &documents) {
+        DocumentStore selected(store.separator());
+        const std::string_view text = store.get_concatenated_text().str();
+        size_t bytes = 0;
+        for (size_t d: documents) {
+            bytes += store.document(d).byte_length + store.separator().str().size();
+        }
+        selected.reserve(bytes);
+        for (size_t d: documents) {
+            const auto &doc = store.document(d);
+            selected.add_document(text.substr(doc.byte_start, doc.byte_length), doc.sql_id);
+        }
+        return selected;
+    }
+} // namespace text_processing
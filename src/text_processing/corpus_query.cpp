@@ -0,0 +1,137 @@
+#include "text_processing/corpus_query.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include "text_processing/utf8_handler.hpp"
+
+namespace text_processing {
+    namespace {
+        bool is_continuation(char byte) {
+            return (static_cast<unsigned char>(byte) & 0xC0) == 0x80;
+        }
+
+        /**
+         * @brief Common prefix of two byte ranges known to share their first skip bytes
+         */
+        size_t common_prefix(std::string_view a, std::string_view b, size_t skip) {
+            const size_t max = std::min(a.size(), b.size());
+            return skip + static_cast<size_t>(std::mismatch(a.begin() + static_cast<std::ptrdiff_t>(skip),
+                                                            a.begin() + static_cast<std::ptrdiff_t>(max),
+                                                            b.begin() + static_cast<std::ptrdiff_t>(skip)).first -
+                                              a.begin() - static_cast<std::ptrdiff_t>(skip));
+        }
+    } // namespace
+
+    std::string QueryHit::to_json() const {
+        std::ostringstream json;
+        json << "{"
+                << "\"query_pos\": " << query_pos << ", "
+                << "\"length\": " << length << ", "
+                << "\"doc_id\": " << doc_id << ", "
+                << "\"doc_pos\": " << doc_pos
+                << "}";
+        return json.str();
+    }
+
+    CorpusQuery::CorpusQuery(const IndexFile &index) : index_(index) {
+        if (!index.has_arrays()) {
+            throw std::invalid_argument("Index " + std::string(index.label()) + " has no suffix arrays to query");
+        }
+    }
+
+    std::vector<QueryHit> CorpusQuery::find(std::string_view text, size_t min_length) const {
+        const UTF8String query{std::string(text)};
+        const std::string_view bytes = query.str();
+        min_length = std::max<size_t>(min_length, 1);
+        std::vector<QueryHit> hits;
+        if (index_.suffix_count() == 0) {
+            return hits;
+        }
+
+        index_.visit_arrays([&](const auto &sa, const auto &) {
+            // The substring found at a character contains the one of the next
+            // character but its first, so the ends never decrease; a substring
+            // ending where the previous one did is contained in it
+            size_t previous_end = 0;
+            size_t char_pos = 0;
+            for (size_t byte = 0; byte < bytes.size(); ++char_pos) {
+                if (query.length() - char_pos < min_length) {
+                    break;
+                }
+                size_t doc_byte = 0;
+                const size_t length = longest_prefix(sa, bytes.substr(byte), doc_byte);
+                const size_t end = byte + length;
+                if (end > previous_end) {
+                    previous_end = end;
+                    const size_t chars = query.char_index(end) - char_pos;
+                    if (chars >= min_length) {
+                        const auto doc = index_.document(index_.document_index_by_byte(doc_byte));
+                        hits.push_back({char_pos, chars, doc.sql_id, index_.char_index(doc_byte) - doc.start_pos});
+                    }
+                }
+                do {
+                    ++byte;
+                } while (byte < bytes.size() && is_continuation(bytes[byte]));
+            }
+        });
+        return hits;
+    }
+
+    template<typename SuffixArray>
+    size_t CorpusQuery::longest_prefix(const SuffixArray &sa, std::string_view suffix, size_t &byte_pos) const {
+        const std::string_view text = index_.text();
+        const bool byte_unit = index_.unit() == SuffixArrayBuilder::Unit::BYTE;
+        auto start = [&](size_t rank) {
+            return byte_unit ? sa[rank] : index_.byte_offset(sa[rank]);
+        };
+
+        // The longest common prefix with any suffix is the one with a
+        // neighbour of the query's place in the suffix array. lcp_lo and
+        // lcp_hi are the prefixes shared with the entries at lo - 1 and hi,
+        // and every entry between them shares the shorter one.
+        const size_t n = sa.size();
+        size_t lo = 0;
+        size_t hi = n;
+        size_t lcp_lo = 0;
+        size_t lcp_hi = 0;
+        while (lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+            const std::string_view other = text.substr(start(mid));
+            const size_t l = common_prefix(other, suffix, std::min(lcp_lo, lcp_hi));
+            const bool other_first = l == std::min(other.size(), suffix.size())
+                                         ? other.size() <= suffix.size()
+                                         : static_cast<unsigned char>(other[l]) < static_cast<unsigned char>(suffix[l]);
+            if (other_first) {
+                lo = mid + 1;
+                lcp_lo = l;
+            } else {
+                hi = mid;
+                lcp_hi = l;
+            }
+        }
+
+        size_t best = 0;
+        auto consider = [&](size_t rank, size_t length) {
+            const size_t pos = start(rank);
+            // Cut back to a character boundary and to the end of the document
+            while (length > 0 && length < suffix.size() && is_continuation(suffix[length])) {
+                length--;
+            }
+            const size_t document = index_.document_index_by_byte(pos);
+            if (document == DocumentStore::NO_DOCUMENT) {
+                return;
+            }
+            const auto doc = index_.document(document);
+            const size_t doc_end = doc.byte_start + doc.byte_length;
+            length = pos < doc_end ? std::min(length, doc_end - pos) : 0;
+            if (length > best) {
+                best = length;
+                byte_pos = pos;
+            }
+        };
+        if (lo > 0) consider(lo - 1, lcp_lo);
+        if (lo < n) consider(lo, lcp_hi);
+        return best;
+    }
+} // namespace text_processing
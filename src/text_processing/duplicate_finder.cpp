@@ -1,20 +1,628 @@
 #include "text_processing/duplicate_finder.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
 #include <fstream>
 #include <iostream>
+#include <optional>
 #include <stdexcept>
-#include <map>
+#include <string_view>
+#include <unordered_map>
+#include "text_processing/byte_suffix_builder.hpp"
+#include "text_processing/candidate_filter.hpp"
+#include "text_processing/external_suffix_builder.hpp"
+#include "text_processing/hash_matcher.hpp"
+#include "text_processing/index_file.hpp"
+#include "text_processing/parallel.hpp"
+#include "text_processing/prefix_buckets.hpp"
 
 
 namespace text_processing {
-    DuplicateFinder::DuplicateFinder(SuffixArrayBuilder::BuilderType builder_type)
-        : suffix_builder_(SuffixArrayBuilder::create(builder_type)) {
+    namespace {
+        /**
+         * @brief Fewest adjacent pairs worth a matching shard of their own
+         */
+        constexpr size_t MIN_SHARD_PAIRS = 1 << 16;
+
+        /**
+         * @brief Adjacent pairs read from disk at once for builders that keep their arrays there
+         */
+        constexpr size_t STREAM_BLOCK_PAIRS = 1 << 20;
+
+        /**
+         * @brief Fewest prefix buckets planned per shard, so the shards come out about equally large
+         */
+        constexpr size_t BUCKETS_PER_SHARD = 4;
+
+        /**
+         * @brief Receives the first match of a shard, and stops the shards after the first one with a match
+         *
+         * Shards before it keep scanning, as one of them may still find an
+         * earlier match, so the lowest shard with a match ends up with the
+         * first match in suffix order, whatever the threads' timing.
+         */
+        class FirstMatch {
+        public:
+            FirstMatch(std::atomic<size_t> &first_shard, size_t shard) : first_shard_(first_shard), shard_(shard) {
+            }
+
+            void update(size_t, size_t, const Match &match) {
+                if (match_) return;
+                match_ = match;
+                size_t first = first_shard_.load(std::memory_order_relaxed);
+                while (shard_ < first && !first_shard_.compare_exchange_weak(first, shard_, std::memory_order_relaxed)) {
+                }
+            }
+
+            [[nodiscard]] bool stopped() const {
+                return match_ || first_shard_.load(std::memory_order_relaxed) < shard_;
+            }
+
+            [[nodiscard]] const std::optional<Match> &match() const { return match_; }
+
+        private:
+            std::atomic<size_t> &first_shard_; ///< Lowest shard with a match so far, shared
+            size_t shard_;
+            std::optional<Match> match_;
+        };
+
+        /**
+         * @brief Tables keeping best matches never stop a scan
+         */
+        template<typename Table>
+        bool scan_stopped(const Table &) { return false; }
+
+        bool scan_stopped(const FirstMatch &sink) { return sink.stopped(); }
+
+        /**
+         * @brief Prefix buckets of a text in suffix order, and the buckets of every shard
+         */
+        struct ShardPlan {
+            std::vector<PrefixBucket> buckets;
+            std::vector<size_t> starts;       ///< Suffixes before each bucket, and the total at the end
+            std::vector<size_t> first_bucket; ///< Shard s has the buckets [first_bucket[s], first_bucket[s + 1])
+
+            ShardPlan(const PrefixScanner &scanner, size_t shards, size_t memory_budget) {
+                const size_t total = scanner.suffix_count();
+                // One suffix and one LCP value per bucket entry
+                const size_t budget = memory_budget == 0 ? ExternalSuffixBuilder::DEFAULT_MEMORY_BUDGET : memory_budget;
+                size_t capacity = std::max<size_t>(budget / (2 * sizeof(size_t)), 1);
+                const size_t per_shard = total / (BUCKETS_PER_SHARD * shards);
+                capacity = std::max<size_t>(std::min(capacity, per_shard), 1);
+                if (total > 0) {
+                    scanner.plan("", total, capacity, buckets);
+                }
+
+                starts.reserve(buckets.size() + 1);
+                size_t before = 0;
+                for (const auto &bucket: buckets) {
+                    starts.push_back(before);
+                    before += bucket.count;
+                }
+                starts.push_back(before);
+
+                // A bucket belongs to the shard its first suffix falls in when split evenly
+                first_bucket.assign(shards + 1, buckets.size());
+                size_t next = 0;
+                for (size_t b = 0; b < buckets.size(); ++b) {
+                    const size_t shard = starts[b] * shards / total;
+                    while (next <= shard) {
+                        first_bucket[next++] = b;
+                    }
+                }
+            }
+        };
+
+        /**
+         * @brief Block of an array read from disk, indexed like the whole array
+         */
+        struct ArrayBlock {
+            const std::vector<size_t> &values;
+            size_t base; ///< Array index of values[0]
+
+            size_t operator[](size_t i) const { return values[i - base]; }
+        };
+
+        /**
+         * @brief Best match of a pair of document indices, on its way to a merge partition
+         */
+        struct PairMatch {
+            size_t key1;
+            size_t key2;
+            Match match;
+        };
+
+        /**
+         * @brief Extends matches whose LCP was capped by a depth-limited build
+         *
+         * Two suffixes lo < hi that match for L units lie on the diagonal hi - lo,
+         * and every later pair (lo + t, hi + t) with t < L matches for exactly
+         * L - t units. The last run found on each diagonal is remembered, so the
+         * many capped pairs inside one long duplicate are extended only once.
+         */
+        class MatchExtender {
+        public:
+            MatchExtender(const UTF8String &text, bool byte_unit) : text_(text), byte_unit_(byte_unit) {
+            }
+
+            /**
+             * @brief Full LCP of the suffixes at a and b, known to share at least depth units
+             */
+            size_t extend(size_t a, size_t b, size_t depth) {
+                const size_t lo = std::min(a, b);
+                const size_t hi = std::max(a, b);
+                auto &run = runs_[hi - lo];
+                if (lo >= run.first && lo < run.second) {
+                    return run.second - lo;
+                }
+                if (run.first > lo && run.first <= lo + depth && run.first < run.second) {
+                    // The known prefix reaches the remembered run
+                    run.first = lo;
+                    return run.second - lo;
+                }
+
+                // Compare bytes after the known prefix; stop early at a known run on this diagonal
+                const std::string &data = text_.str();
+                const size_t lo_byte = to_byte(lo + depth);
+                const size_t hi_byte = to_byte(hi + depth);
+                const bool joins_run = run.first > lo && run.first < run.second;
+                const size_t stop_byte = joins_run ? to_byte(run.first) : data.length();
+
+                size_t k = 0;
+                while (lo_byte + k < stop_byte && hi_byte + k < data.length() &&
+                       data[lo_byte + k] == data[hi_byte + k]) {
+                    k++;
+                }
+
+                size_t end;
+                if (joins_run && lo_byte + k == stop_byte) {
+                    end = run.second;
+                } else {
+                    // Cut a partially matching character
+                    size_t end_byte = lo_byte + k;
+                    while (end_byte > lo_byte && (static_cast<unsigned char>(data[end_byte]) & 0xC0) == 0x80) {
+                        end_byte--;
+                    }
+                    end = byte_unit_ ? end_byte : text_.char_index(end_byte);
+                }
+                run = {lo, end};
+                return end - lo;
+            }
+
+        private:
+            const UTF8String &text_;
+            bool byte_unit_;
+            std::unordered_map<size_t, std::pair<size_t, size_t>> runs_; ///< Diagonal -> matching run [lo, end)
+
+            [[nodiscard]] size_t to_byte(size_t pos) const {
+                return byte_unit_ ? pos : text_.byte_offset(pos);
+            }
+        };
+
+        /**
+         * @brief Documents of a DocumentStore, matched with the arrays of a builder built on its text
+         */
+        class StoreCorpus {
+        public:
+            StoreCorpus(const DocumentStore &store, const SuffixArrayBuilder &builder)
+                : StoreCorpus(store, builder.unit() == SuffixArrayBuilder::Unit::BYTE, builder.depth_limit()) {
+            }
+
+            StoreCorpus(const DocumentStore &store, bool byte_unit, size_t depth)
+                : store_(store)
+                  , byte_unit_(byte_unit)
+                  , depth_(depth)
+                  , extender_(store.get_concatenated_text(), byte_unit_) {
+            }
+
+            [[nodiscard]] bool byte_unit() const { return byte_unit_; }
+
+            /**
+             * @brief LCP values equal to this non-zero depth only say "at least that long"
+             */
+            [[nodiscard]] size_t depth() const { return depth_; }
+
+            [[nodiscard]] size_t find_document(size_t pos) const {
+                return byte_unit_ ? store_.document_index_by_byte(pos) : store_.document_index(pos);
+            }
+
+            [[nodiscard]] const DocumentPosition &document(size_t index) const { return store_.document(index); }
+
+            [[nodiscard]] size_t char_index(size_t byte_pos) const {
+                return store_.get_concatenated_text().char_index(byte_pos);
+            }
+
+            [[nodiscard]] size_t byte_offset(size_t char_pos) const {
+                return store_.get_concatenated_text().byte_offset(char_pos);
+            }
+
+            [[nodiscard]] std::string_view text() const { return store_.get_concatenated_text().str(); }
+
+            size_t extend(size_t a, size_t b, size_t depth) { return extender_.extend(a, b, depth); }
+
+        private:
+            const DocumentStore &store_;
+            bool byte_unit_;
+            size_t depth_;
+            MatchExtender extender_;
+        };
+
+        /**
+         * @brief Documents of a mapped index file
+         */
+        class IndexCorpus {
+        public:
+            explicit IndexCorpus(const IndexFile &index)
+                : IndexCorpus(index, index.unit() == SuffixArrayBuilder::Unit::BYTE) {
+            }
+
+            /**
+             * @brief Corpus for positions in bytes (byte_unit) or characters, whatever the index's unit
+             */
+            IndexCorpus(const IndexFile &index, bool byte_unit) : index_(index), byte_unit_(byte_unit) {
+            }
+
+            [[nodiscard]] bool byte_unit() const { return byte_unit_; }
+
+            /**
+             * @brief Indexes are written from complete builds
+             */
+            [[nodiscard]] size_t depth() const { return 0; }
+
+            [[nodiscard]] size_t find_document(size_t pos) const {
+                return byte_unit_ ? index_.document_index_by_byte(pos) : index_.document_index(pos);
+            }
+
+            [[nodiscard]] DocumentPosition document(size_t index) const { return index_.document(index); }
+
+            [[nodiscard]] size_t char_index(size_t byte_pos) const { return index_.char_index(byte_pos); }
+
+            [[nodiscard]] size_t byte_offset(size_t char_pos) const { return index_.byte_offset(char_pos); }
+
+            [[nodiscard]] std::string_view text() const { return index_.text(); }
+
+            size_t extend(size_t, size_t, size_t depth) { return depth; }
+
+        private:
+            const IndexFile &index_;
+            bool byte_unit_;
+        };
+
+        /**
+         * @brief An index file followed by a store of new documents, addressed in bytes
+         *
+         * Byte positions from text_bytes() on, and document indices from the
+         * index's document count on, belong to the new documents.
+         */
+        class DeltaCorpus {
+        public:
+            DeltaCorpus(const IndexFile &index, const DocumentStore &delta)
+                : index_(index)
+                  , delta_(delta)
+                  , old_bytes_(index.text().size())
+                  , old_chars_(index.char_count())
+                  , old_documents_(index.document_count()) {
+            }
+
+            [[nodiscard]] bool byte_unit() const { return true; }
+
+            [[nodiscard]] size_t depth() const { return 0; }
+
+            [[nodiscard]] size_t find_document(size_t pos) const {
+                if (pos < old_bytes_) {
+                    return index_.document_index_by_byte(pos);
+                }
+                size_t index = delta_.document_index_by_byte(pos - old_bytes_);
+                return index == DocumentStore::NO_DOCUMENT ? index : old_documents_ + index;
+            }
+
+            [[nodiscard]] DocumentPosition document(size_t index) const {
+                if (index < old_documents_) {
+                    return index_.document(index);
+                }
+                DocumentPosition doc = delta_.document(index - old_documents_);
+                doc.start_pos += old_chars_;
+                doc.byte_start += old_bytes_;
+                return doc;
+            }
+
+            [[nodiscard]] size_t char_index(size_t byte_pos) const {
+                return byte_pos < old_bytes_
+                           ? index_.char_index(byte_pos)
+                           : old_chars_ + delta_.get_concatenated_text().char_index(byte_pos - old_bytes_);
+            }
+
+            size_t extend(size_t, size_t, size_t depth) { return depth; }
+
+        private:
+            const IndexFile &index_;
+            const DocumentStore &delta_;
+            size_t old_bytes_;
+            size_t old_chars_;
+            size_t old_documents_;
+        };
+
+        /**
+         * @brief Suffix and LCP arrays read by index, as walked by collect_clusters()
+         */
+        template<typename SuffixArray, typename LcpArray>
+        class ArrayPair {
+        public:
+            ArrayPair(const SuffixArray &sa, const LcpArray &lcp) : sa_(sa), lcp_(lcp) {
+            }
+
+            [[nodiscard]] size_t size() const { return sa_.size(); }
+            size_t sa(size_t i) { return sa_[i]; }
+            size_t lcp(size_t i) { return lcp_[i]; }
+
+        private:
+            const SuffixArray &sa_;
+            const LcpArray &lcp_;
+        };
+
+        /**
+         * @brief Arrays of a builder that keeps them on disk, read a block at a time from the accessed index on
+         */
+        class StreamedArrays {
+        public:
+            explicit StreamedArrays(const SuffixArrayBuilder &builder)
+                : builder_(builder)
+                  , size_(builder.suffix_count()) {
+            }
+
+            [[nodiscard]] size_t size() const { return size_; }
+
+            size_t sa(size_t i) {
+                if (i < base_ || i >= base_ + sa_.size()) load(i);
+                return sa_[i - base_];
+            }
+
+            size_t lcp(size_t i) {
+                if (i < base_ || i >= base_ + lcp_.size()) load(i);
+                return lcp_[i - base_];
+            }
+
+        private:
+            const SuffixArrayBuilder &builder_;
+            size_t size_;
+            size_t base_ = 0; ///< Array index of sa_[0] and lcp_[0]
+            std::vector<size_t> sa_;
+            std::vector<size_t> lcp_;
+
+            void load(size_t i) {
+                base_ = i;
+                builder_.read_arrays(i, std::min(i + STREAM_BLOCK_PAIRS, size_ - 1), sa_, lcp_);
+            }
+        };
+
+        /**
+         * @brief A suffix on the way through collect_clusters()
+         */
+        struct Leaf {
+            size_t pos;       ///< Suffix array entry
+            size_t document;  ///< Document index, or DocumentStore::NO_DOCUMENT
+            size_t remaining; ///< Units left in the document from pos, 0 in separators
+        };
+
+        /**
+         * @brief Left key of a suffix at the start of its document, which can never be extended to the left
+         */
+        constexpr uint32_t DOCUMENT_START = UINT32_MAX;
+
+        /**
+         * @brief Reports the maximal repeats among the suffixes of one run
+         *
+         * A run is a stretch of suffix array entries whose neighbours share at
+         * least the threshold within their documents. Its LCP intervals are
+         * found bottom-up with a stack: an interval [lb, rb] with LCP l is a
+         * substring of l units occurring at every suffix in it, and no longer
+         * one occurs at all of them. It is kept if the suffixes are not all
+         * preceded by the same character (else the repeat one character to the
+         * left has the same occurrences) and span two documents. Both tests
+         * are prefix counts over the run, so skipped intervals cost O(1).
+         */
+        template<typename Corpus>
+        class IntervalWalker {
+        public:
+            IntervalWalker(Corpus &corpus, size_t min_length, std::vector<Cluster> &clusters)
+                : corpus_(corpus)
+                  , byte_unit_(corpus.byte_unit())
+                  , min_length_(min_length)
+                  , clusters_(clusters) {
+            }
+
+            /**
+             * @brief Walk the intervals of leaves whose neighbours share lcps[j] units
+             */
+            void walk(const std::vector<Leaf> &leaves, const std::vector<size_t> &lcps) {
+                const size_t count = leaves.size();
+                left_changes_.assign(count, 0);
+                document_changes_.assign(count, 0);
+                uint32_t previous = left_key(leaves[0]);
+                for (size_t j = 1; j < count; ++j) {
+                    const uint32_t key = left_key(leaves[j]);
+                    const bool changed = key != previous || key == DOCUMENT_START;
+                    left_changes_[j] = left_changes_[j - 1] + changed;
+                    document_changes_[j] = document_changes_[j - 1] + (leaves[j].document != leaves[j - 1].document);
+                    previous = key;
+                }
+
+                // (lcp, left bound) of the open intervals; the base of LCP 0 is never reported
+                stack_.assign(1, {0, 0});
+                for (size_t j = 0; j < count; ++j) {
+                    const size_t h = j + 1 < count ? lcps[j] : 0;
+                    size_t lb = j;
+                    while (h < stack_.back().first) {
+                        const auto [lcp, left] = stack_.back();
+                        stack_.pop_back();
+                        report(leaves, lcp, left, j);
+                        lb = left;
+                    }
+                    if (h > stack_.back().first) {
+                        stack_.emplace_back(h, lb);
+                    }
+                }
+            }
+
+        private:
+            Corpus &corpus_;
+            bool byte_unit_;
+            size_t min_length_;
+            std::vector<Cluster> &clusters_;
+            std::vector<size_t> left_changes_;     ///< Neighbours with different left keys up to each leaf
+            std::vector<size_t> document_changes_; ///< Neighbours in different documents up to each leaf
+            std::vector<std::pair<size_t, size_t>> stack_;
+
+            /**
+             * @brief The character before a suffix, as its UTF-8 bytes, or DOCUMENT_START
+             */
+            uint32_t left_key(const Leaf &leaf) const {
+                const auto doc = corpus_.document(leaf.document);
+                if (leaf.pos == (byte_unit_ ? doc.byte_start : doc.start_pos)) {
+                    return DOCUMENT_START;
+                }
+                const std::string_view text = corpus_.text();
+                size_t byte = byte_unit_ ? leaf.pos : corpus_.byte_offset(leaf.pos);
+                uint32_t key = 0;
+                do {
+                    key = key << 8 | static_cast<unsigned char>(text[--byte]);
+                } while (byte > 0 && (static_cast<unsigned char>(text[byte]) & 0xC0) == 0x80);
+                return key;
+            }
+
+            void report(const std::vector<Leaf> &leaves, size_t lcp, size_t lb, size_t rb) {
+                if (left_changes_[rb] == left_changes_[lb] || document_changes_[rb] == document_changes_[lb]) {
+                    return;
+                }
+                size_t length = lcp;
+                if (byte_unit_) {
+                    const size_t first = leaves[lb].pos;
+                    length = corpus_.char_index(first + lcp) - corpus_.char_index(first);
+                }
+                if (length < min_length_) {
+                    return;
+                }
+
+                Cluster cluster{length, {}};
+                cluster.occurrences.reserve(rb - lb + 1);
+                for (size_t j = lb; j <= rb; ++j) {
+                    const auto doc = corpus_.document(leaves[j].document);
+                    const size_t pos = byte_unit_ ? corpus_.char_index(leaves[j].pos) : leaves[j].pos;
+                    cluster.occurrences.push_back({doc.sql_id, pos - doc.start_pos});
+                }
+                std::sort(cluster.occurrences.begin(), cluster.occurrences.end());
+                clusters_.push_back(std::move(cluster));
+            }
+        };
+
+        /**
+         * @brief Where a new suffix falls among the suffixes of an index
+         */
+        struct Insertion {
+            size_t rank;     ///< Number of indexed suffixes smaller than the new one
+            size_t lcp_prev; ///< Byte LCP with the indexed suffix at rank - 1
+            size_t lcp_next; ///< Byte LCP with the indexed suffix at rank
+        };
+
+        /**
+         * @brief Common prefix of two byte ranges, cut back to a character boundary
+         *
+         * @param a First range, followed by a readable byte (the terminating NUL at the end)
+         */
+        size_t char_common_prefix(std::string_view a, std::string_view b) {
+            const size_t max = std::min(a.size(), b.size());
+            size_t k = std::mismatch(a.begin(), a.begin() + static_cast<std::ptrdiff_t>(max), b.begin()).first - a.begin();
+            while (k > 0 && k < a.size() && (static_cast<unsigned char>(a[k]) & 0xC0) == 0x80) {
+                k--;
+            }
+            return k;
+        }
+    } // namespace
+
+    DuplicateFinder::DuplicateFinder(SuffixArrayBuilder::BuilderType builder_type, size_t threads)
+        : suffix_builder_(SuffixArrayBuilder::create(builder_type, threads))
+          , threads_(resolve_threads(threads)) {
+    }
+
+    DuplicateFinder::DuplicateFinder(const FinderOptions &options)
+        : suffix_builder_(SuffixArrayBuilder::create(
+              options.builder_type,
+              SuffixArrayBuilder::Options{options.threads, options.memory_budget, options.scratch_dir,
+                                          options.huge_pages}))
+          , depth_limited_(options.depth_limited)
+          , threads_(resolve_threads(options.threads))
+          , memory_budget_(options.memory_budget)
+          , prefilter_(options.prefilter)
+          , top_k_(options.top_k)
+          , any_match_(options.any_match)
+          , engine_(options.engine)
+          , metrics_(options.metrics) {
+    }
+
+    MatchEngine DuplicateFinder::engine_from_string(const std::string &name) {
+        if (name == "suffix-array") {
+            return MatchEngine::SUFFIX_ARRAY;
+        }
+        if (name == "hash") {
+            return MatchEngine::ROLLING_HASH;
+        }
+        throw std::invalid_argument("Unknown match engine: " + name);
+    }
+
+    void DuplicateFinder::build_arrays(const UTF8String &text, size_t min_length, bool depth_limited) {
+        {
+            ScopedTimer timer(metrics_, "build_suffix_array");
+            const bool built = depth_limited
+                                   ? suffix_builder_->build_to_depth(text, min_length)
+                                   : suffix_builder_->build(text);
+            if (!built) {
+                throw std::runtime_error("Failed to build suffix array");
+            }
+        }
+        if (metrics_) {
+            metrics_->add_count("suffixes", suffix_builder_->suffix_count());
+            if (suffix_builder_->in_memory()) {
+                metrics_->record_peak("suffix_array", suffix_builder_->get_array().memory_bytes());
+                metrics_->record_peak("lcp_array", suffix_builder_->get_lcp_array().memory_bytes());
+            }
+        }
     }
 
     std::vector<Match> DuplicateFinder::find_duplicates(
         const DocumentStore &store,
         size_t min_length,
         bool verbose
+    ) {
+        if (!prefilter_ || min_length < CANDIDATE_MIN_LENGTH) {
+            return find_all_duplicates(store, min_length, verbose);
+        }
+        if (verbose) std::cout << "Prefiltering candidate documents" << std::endl;
+        ScopedTimer timer(metrics_, "prefilter");
+        size_t fingerprints = 0;
+        const auto candidates = find_candidate_documents(store, min_length, threads_, &fingerprints);
+        if (metrics_) {
+            metrics_->add_count("fingerprints", fingerprints);
+            metrics_->add_count("candidate_documents", candidates.size());
+            metrics_->add_count("dropped_documents", store.document_count() - candidates.size());
+        }
+        if (candidates.size() == store.document_count()) {
+            timer.stop();
+            return find_all_duplicates(store, min_length, verbose);
+        }
+        // Without the dropped documents the adjacent suffixes sharing min_length characters stay the same,
+        // except among suffixes running into a separator, which are ordered by the documents after it
+        // Kept as a member: the builder refers to its text until the next build
+        selected_ = select_documents(store, candidates);
+        timer.stop();
+        return find_all_duplicates(selected_, min_length, verbose);
+    }
+
+    std::vector<Match> DuplicateFinder::find_all_duplicates(
+        const DocumentStore &store,
+        size_t min_length,
+        bool verbose
     ) {
         if (verbose) std::cout << "Returns concatenated text" << std::endl;
         // Get concatenated text from store
@@ -22,91 +630,764 @@ namespace text_processing {
         if (text.length() == 0) {
             return {};
         }
+        if (engine_ == MatchEngine::ROLLING_HASH) {
+            if (verbose) std::cout << "Starts Hashing Windows" << std::endl;
+            return find_hashed_duplicates(store, min_length);
+        }
         if (verbose) std::cout << "Starts Building Suffix Array" << std::endl;
         // Build suffix array and LCP array
-        if (!suffix_builder_->build(text)) {
-            throw std::runtime_error("Failed to build suffix array");
-        }
+        build_arrays(text, min_length, depth_limited_);
         if (verbose) std::cout << "Starts Finding Matches" << std::endl;
         return process_matches(store, min_length);
     }
 
-    std::vector<Match> DuplicateFinder::process_matches(
-        const DocumentStore &store,
+    std::vector<Match> DuplicateFinder::find_hashed_duplicates(const DocumentStore &store, size_t min_length) const {
+        HashMatchStats stats;
+        std::vector<Match> result;
+        {
+            ScopedTimer timer(metrics_, "hash_matches");
+            result = find_hashed_matches(store, min_length, threads_, any_match_, &stats);
+        }
+        if (metrics_) {
+            metrics_->add_count("anchors", stats.anchors);
+            metrics_->add_count("anchor_hits", stats.anchor_hits);
+            metrics_->record_peak("anchor_table", stats.anchor_bytes);
+        }
+        {
+            // Every pair occurs once, so the order is the one of the suffix array engine
+            ScopedTimer timer(metrics_, "sort_matches");
+            if (top_k_ > 0 && top_k_ < result.size()) {
+                std::partial_sort(result.begin(), result.begin() + static_cast<std::ptrdiff_t>(top_k_), result.end());
+                result.resize(top_k_);
+            } else {
+                parallel_sort(result.begin(), result.end(), threads_, std::less<>());
+            }
+        }
+        if (metrics_) metrics_->add_count("pairs_kept", result.size());
+        return result;
+    }
+
+    std::vector<Match> DuplicateFinder::find_duplicates(const IndexFile &index, size_t min_length) const {
+        if (index.suffix_count() < 2) {
+            return {};
+        }
+        return reduce_in_mode(index.suffix_count() - 1, min_length, [&](size_t begin, size_t end, auto &table) {
+            IndexCorpus corpus(index);
+            size_t scanned = 0;
+            index.visit_arrays([&](const auto &sa, const auto &lcp) {
+                scanned = collect_matches(corpus, sa, lcp, begin, end, min_length, table);
+            });
+            return scanned;
+        });
+    }
+
+    std::vector<Match> DuplicateFinder::find_new_duplicates(
+        const IndexFile &index,
+        const DocumentStore &delta,
         size_t min_length
     ) const {
-        const auto &suffix_array = suffix_builder_->get_array();
-        const auto &lcp_array = suffix_builder_->get_lcp_array();
+        const std::string &new_text = delta.get_concatenated_text().str();
+        if (new_text.empty()) {
+            return {};
+        }
+        ByteSuffixBuilder delta_builder;
+        delta_builder.build(delta.get_concatenated_text());
+        const auto &new_sa = delta_builder.get_array();
+        const auto &new_lcp = delta_builder.get_lcp_array();
 
-        // Map to store longest match for each document pair
-        // Key: a pair of doc IDs (smaller ID first), Value: best match found
-        std::map<std::pair<int64_t, int64_t>, Match> best_matches;
+        const std::string_view old_text = index.text();
+        const bool old_bytes = index.unit() == SuffixArrayBuilder::Unit::BYTE;
+        auto old_suffix = [&](const auto &sa, size_t rank) {
+            return old_bytes ? sa[rank] : index.byte_offset(sa[rank]);
+        };
 
-        // Process all adjacent positions in suffix array
-        for (size_t i = 0; i < lcp_array.size(); ++i) {
-            try {
-                // Get documents for adjacent positions in suffix array
-                auto doc1 = store.find_document_id(suffix_array[i]);
-                auto doc2 = store.find_document_id(suffix_array[i + 1]);
-
-                // Skip if same document
-                if (doc1.sql_id == doc2.sql_id) {
-                    continue;
+        // Binary search every new suffix in the indexed suffix array. Skipping
+        // the bytes shared with both bounds keeps repeated prefixes cheap, and
+        // the ranks grow with the new suffixes' order, so each search starts
+        // at the previous rank.
+        std::vector<Insertion> insertions(new_sa.size());
+        index.visit_arrays([&](const auto &sa, const auto &) {
+            const size_t n = sa.size();
+            parallel_for(0, new_sa.size(), threads_, [&](size_t begin, size_t end, size_t) {
+                size_t lower = 0;
+                for (size_t k = begin; k < end; ++k) {
+                    const std::string_view suffix = std::string_view(new_text).substr(new_sa[k]);
+                    size_t lo = lower;
+                    size_t hi = n;
+                    size_t lcp_lo = 0;
+                    size_t lcp_hi = 0;
+                    while (lo < hi) {
+                        const size_t mid = lo + (hi - lo) / 2;
+                        const std::string_view other = old_text.substr(old_suffix(sa, mid));
+                        const size_t skip = std::min(lcp_lo, lcp_hi);
+                        const size_t max = std::min(other.size(), suffix.size());
+                        const size_t l = skip + (std::mismatch(other.begin() + static_cast<std::ptrdiff_t>(skip),
+                                                               other.begin() + static_cast<std::ptrdiff_t>(max),
+                                                               suffix.begin() + static_cast<std::ptrdiff_t>(skip)).first -
+                                                 other.begin() - static_cast<std::ptrdiff_t>(skip));
+                        // Equal suffixes put the indexed one first, as if the new text followed the index
+                        const bool other_first = l == max
+                                                     ? other.size() <= suffix.size()
+                                                     : static_cast<unsigned char>(other[l]) <
+                                                       static_cast<unsigned char>(suffix[l]);
+                        if (other_first) {
+                            lo = mid + 1;
+                            lcp_lo = l;
+                        } else {
+                            hi = mid;
+                            lcp_hi = l;
+                        }
+                    }
+                    Insertion &insertion = insertions[k];
+                    insertion.rank = lo;
+                    insertion.lcp_prev = lo > 0 ? char_common_prefix(suffix, old_text.substr(old_suffix(sa, lo - 1))) : 0;
+                    insertion.lcp_next = lo < n ? char_common_prefix(suffix, old_text.substr(old_suffix(sa, lo))) : 0;
+                    lower = lo;
                 }
+            });
+        });
 
-                // Calculate relative positions within documents
-                size_t pos1 = suffix_array[i] - doc1.start_pos;
-                size_t pos2 = suffix_array[i + 1] - doc2.start_pos;
-
-                // Adjust length if it crosses document boundaries
-                size_t max_len1 = doc1.length - pos1;
-                size_t max_len2 = doc2.length - pos2;
-                size_t max_possible_length = std::min(max_len1, max_len2);
-                size_t actual_length = std::min(lcp_array[i], max_possible_length);
+        // New suffixes inserted between the same two indexed suffixes form a
+        // run; each run with its two neighbours is the part of the merged
+        // suffix array that involves new documents
+        std::vector<size_t> runs;
+        for (size_t k = 0; k < insertions.size(); ++k) {
+            if (k == 0 || insertions[k].rank != insertions[k - 1].rank) {
+                runs.push_back(k);
+            }
+        }
+        runs.push_back(insertions.size());
 
-                // Skip if too short
-                if (actual_length < min_length) {
-                    continue;
+        return reduce_matches(runs.size() - 1, min_length, [&](size_t begin, size_t end, MatchTable &table) {
+            DeltaCorpus corpus(index, delta);
+            std::vector<size_t> sa;
+            std::vector<size_t> lcp;
+            index.visit_arrays([&](const auto &old_sa, const auto &) {
+                for (size_t run = begin; run < end; ++run) {
+                    const size_t first = runs[run];
+                    const size_t last = runs[run + 1] - 1;
+                    const size_t rank = insertions[first].rank;
+                    sa.clear();
+                    lcp.clear();
+                    if (rank > 0) {
+                        sa.push_back(old_suffix(old_sa, rank - 1));
+                        lcp.push_back(insertions[first].lcp_prev);
+                    }
+                    for (size_t k = first; k <= last; ++k) {
+                        sa.push_back(old_text.size() + new_sa[k]);
+                        if (k < last) lcp.push_back(new_lcp[k]);
+                    }
+                    if (rank < old_sa.size()) {
+                        lcp.push_back(insertions[last].lcp_next);
+                        sa.push_back(old_suffix(old_sa, rank));
+                    }
+                    collect_matches(corpus, sa, lcp, 0, lcp.size(), min_length, table);
                 }
+            });
+        });
+    }
+
+    void DuplicateFinder::build_index(const DocumentStore &store, const std::string &path, const std::string &label) {
+        const auto &text = store.get_concatenated_text();
+        if (text.length() > 0) {
+            build_arrays(text, 0, false);
+        }
+        ScopedTimer timer(metrics_, "write_index");
+        IndexFile::write(path, store, *suffix_builder_, label);
+    }
+
+    std::vector<Cluster> DuplicateFinder::find_clusters(const DocumentStore &store, size_t min_length) {
+        const auto &text = store.get_concatenated_text();
+        if (text.length() == 0) {
+            return {};
+        }
+        build_arrays(text, min_length, false);
+
+        const bool in_memory = suffix_builder_->in_memory();
+        return reduce_clusters(suffix_builder_->suffix_count(), [&](size_t begin, size_t end,
+                                                                    std::vector<Cluster> &clusters) {
+            StoreCorpus corpus(store, *suffix_builder_);
+            if (in_memory) {
+                ArrayPair arrays(suffix_builder_->get_array(), suffix_builder_->get_lcp_array());
+                collect_clusters(corpus, arrays, begin, end, min_length, clusters);
+            } else {
+                StreamedArrays arrays(*suffix_builder_);
+                collect_clusters(corpus, arrays, begin, end, min_length, clusters);
+            }
+        });
+    }
+
+    std::vector<Cluster> DuplicateFinder::find_clusters(const IndexFile &index, size_t min_length) const {
+        return reduce_clusters(index.suffix_count(), [&](size_t begin, size_t end, std::vector<Cluster> &clusters) {
+            IndexCorpus corpus(index);
+            index.visit_arrays([&](const auto &sa, const auto &lcp) {
+                ArrayPair arrays(sa, lcp);
+                collect_clusters(corpus, arrays, begin, end, min_length, clusters);
+            });
+        });
+    }
+
+    ShardResult DuplicateFinder::find_shard(const DocumentStore &store, size_t min_length, size_t shard,
+                                            size_t shards) const {
+        StoreCorpus corpus(store, true, 0);
+        return collect_shard(corpus, store.get_concatenated_text().str(), min_length, shard, shards, threads_);
+    }
+
+    ShardResult DuplicateFinder::find_shard(const IndexFile &index, size_t min_length, size_t shard,
+                                            size_t shards) const {
+        IndexCorpus corpus(index, true);
+        return collect_shard(corpus, index.text(), min_length, shard, shards, threads_);
+    }
+
+    std::vector<Match> DuplicateFinder::merge_shards(const DocumentStore &store,
+                                                     std::vector<ShardResult> results) const {
+        StoreCorpus corpus(store, true, 0);
+        return merge_shard_results(corpus, store.get_concatenated_text().str(), std::move(results));
+    }
+
+    std::vector<Match> DuplicateFinder::merge_shards(const IndexFile &index, std::vector<ShardResult> results) const {
+        IndexCorpus corpus(index, true);
+        return merge_shard_results(corpus, index.text(), std::move(results));
+    }
+
+    std::vector<Match> DuplicateFinder::find_duplicates_sharded(const DocumentStore &store, size_t min_length,
+                                                                size_t shards) const {
+        // Whole shards run side by side, each sorting its buckets on one thread
+        std::vector<ShardResult> results(shards);
+        parallel_for_each_dynamic(shards, threads_, [&](size_t shard) {
+            StoreCorpus corpus(store, true, 0);
+            results[shard] = collect_shard(corpus, store.get_concatenated_text().str(), min_length, shard, shards, 1);
+        });
+        return merge_shards(store, std::move(results));
+    }
+
+    template<typename Corpus>
+    ShardResult DuplicateFinder::collect_shard(Corpus &corpus, std::string_view text, size_t min_length,
+                                               size_t shard, size_t shards, size_t threads) const {
+        if (shard >= shards) {
+            throw std::invalid_argument("Shard " + std::to_string(shard) + " of " + std::to_string(shards) +
+                                        " does not exist");
+        }
+        ShardResult result;
+        result.shard = shard;
+        result.shards = shards;
+        result.min_length = min_length;
+        result.text_size = text.size();
 
-                // Create document pair key (smaller ID first)
-                auto doc_pair = std::make_pair(
-                    std::min(doc1.sql_id, doc2.sql_id),
-                    std::max(doc1.sql_id, doc2.sql_id)
-                );
+        const PrefixScanner scanner(reinterpret_cast<const unsigned char *>(text.data()), text.size());
+        const ShardPlan plan(scanner, shards, memory_budget_);
+        const size_t first = plan.first_bucket[shard];
+        const size_t last = plan.first_bucket[shard + 1];
+        result.suffix_begin = plan.starts[first];
+        result.suffix_count = plan.starts[last] - plan.starts[first];
 
-                // Create match (ensure doc1 is the one with smaller ID)
-                Match match;
-                if (doc1.sql_id < doc2.sql_id) {
-                    match = Match{doc1.sql_id, doc2.sql_id, pos1, pos2, actual_length};
+        // sa[0] is the last suffix of the previous bucket, so the pair across buckets is scanned too
+        MatchTable table;
+        std::vector<size_t> sa;
+        std::vector<size_t> lcp;
+        size_t peak = 0;
+        for (size_t b = first; b < last; ++b) {
+            const PrefixBucket &bucket = plan.buckets[b];
+            const size_t depth = bucket.prefix.size();
+            const size_t offset = b > first ? 1 : 0;
+            {
+                ScopedTimer timer(metrics_, "sort_buckets");
+                if (offset == 0) {
+                    sa.clear();
                 } else {
-                    match = Match{doc2.sql_id, doc1.sql_id, pos2, pos1, actual_length};
+                    const size_t previous = sa.back();
+                    sa.assign(1, previous);
                 }
+                scanner.collect(bucket, sa);
+                parallel_sort(sa.begin() + static_cast<std::ptrdiff_t>(offset), sa.end(), threads,
+                              [&scanner, depth](size_t a, size_t c) { return scanner.less(a, c, depth); });
+                lcp.resize(sa.size() - 1);
+                parallel_for(0, lcp.size(), threads, [&](size_t begin, size_t end, size_t) {
+                    for (size_t i = begin; i < end; ++i) {
+                        lcp[i] = scanner.lcp(sa[i], sa[i + 1], i < offset ? 0 : depth);
+                    }
+                });
+            }
+            {
+                ScopedTimer timer(metrics_, "scan_matches");
+                collect_matches(corpus, sa, lcp, 0, lcp.size(), min_length, table);
+            }
+            if (b == first) result.first_suffix = sa.front();
+            result.last_suffix = sa.back();
+            peak = std::max(peak, (sa.capacity() + lcp.capacity()) * sizeof(size_t));
+        }
 
-                // Update best match for this document pair if longer
-                auto it = best_matches.find(doc_pair);
-                if (it == best_matches.end() || match.length > it->second.length) {
-                    best_matches[doc_pair] = match;
-                }
-            } catch (const std::out_of_range &) {
-                // Skip positions that fall in document separators
+        result.matches.reserve(table.size());
+        table.for_each([&result](size_t key1, size_t key2, const Match &match) {
+            result.matches.push_back({key1, key2, match});
+        });
+        if (metrics_) {
+            metrics_->add_count("buckets", last - first);
+            metrics_->add_count("suffixes", result.suffix_count);
+            metrics_->add_count("pairs_scanned", result.suffix_count > 0 ? result.suffix_count - 1 : 0);
+            metrics_->record_peak("bucket", peak);
+            metrics_->record_peak("match_tables", table.memory_bytes());
+        }
+        return result;
+    }
+
+    template<typename Corpus>
+    std::vector<Match> DuplicateFinder::merge_shard_results(Corpus &corpus, std::string_view text,
+                                                          std::vector<ShardResult> results) const {
+        ScopedTimer merge_timer(metrics_, "merge_shards");
+        std::sort(results.begin(), results.end(), [](const ShardResult &a, const ShardResult &b) {
+            return a.shard < b.shard;
+        });
+        // Every shard once, all cut from this text with the same plan and threshold
+        const size_t shards = results.size();
+        uint64_t suffixes = 0;
+        for (size_t i = 0; i < shards; ++i) {
+            const ShardResult &result = results[i];
+            if (result.shards != shards || result.shard != i) {
+                throw std::invalid_argument("Expected one result for each of " + std::to_string(result.shards) +
+                                            " shards, got shard " + std::to_string(result.shard) + " among " +
+                                            std::to_string(shards) + " results");
+            }
+            if (result.min_length != results[0].min_length || result.text_size != text.size() ||
+                result.suffix_begin != suffixes) {
+                throw std::invalid_argument("Shard " + std::to_string(i) +
+                                            " was found with another threshold, text or memory budget");
+            }
+            suffixes += result.suffix_count;
+        }
+        const PrefixScanner scanner(reinterpret_cast<const unsigned char *>(text.data()), text.size());
+        if (shards > 0 && suffixes != scanner.suffix_count()) {
+            throw std::invalid_argument("Shard results do not cover the text");
+        }
+        const size_t min_length = shards > 0 ? results[0].min_length : 0;
+
+        // In shard order the pair across each border comes between its shards'
+        // pairs, and the earliest of equally long matches wins as in one pass
+        MatchTable merged;
+        bool has_previous = false;
+        size_t previous = 0;
+        for (auto &result: results) {
+            if (result.suffix_count == 0) {
                 continue;
             }
+            if (has_previous) {
+                const std::vector<size_t> sa = {previous, result.first_suffix};
+                const std::vector<size_t> lcp = {scanner.lcp(previous, result.first_suffix, 0)};
+                collect_matches(corpus, sa, lcp, 0, 1, min_length, merged);
+            }
+            for (const auto &entry: result.matches) {
+                merged.update(entry.key1, entry.key2, entry.match);
+            }
+            result.matches = {};
+            previous = result.last_suffix;
+            has_previous = true;
         }
 
-        // Convert map to vector of matches
+        std::vector<Match> matches;
+        matches.reserve(merged.size());
+        merged.for_each([&matches, min_length](size_t, size_t, const Match &match) {
+            if (match.length >= min_length) {
+                matches.push_back(match);
+            }
+        });
+        merge_timer.stop();
+        {
+            ScopedTimer timer(metrics_, "sort_matches");
+            parallel_sort(matches.begin(), matches.end(), threads_, std::less<>());
+        }
+        if (metrics_) metrics_->add_count("pairs_kept", matches.size());
+        return matches;
+    }
+
+    std::vector<Match> DuplicateFinder::process_matches(
+        const DocumentStore &store,
+        size_t min_length
+    ) const {
+        const bool in_memory = suffix_builder_->in_memory();
+        const size_t pairs = in_memory ? suffix_builder_->get_lcp_array().size() : suffix_builder_->suffix_count() - 1;
+        return reduce_in_mode(pairs, min_length, [&](size_t begin, size_t end, auto &table) {
+            StoreCorpus corpus(store, *suffix_builder_);
+            if (in_memory) {
+                return collect_matches(corpus, suffix_builder_->get_array(), suffix_builder_->get_lcp_array(),
+                                       begin, end, min_length, table);
+            }
+            // Stream the range block by block, so only a block of both arrays is in memory
+            std::vector<size_t> sa;
+            std::vector<size_t> lcp;
+            size_t scanned = 0;
+            for (size_t block = begin; block < end && !scan_stopped(table); block += STREAM_BLOCK_PAIRS) {
+                const size_t block_end = std::min(end, block + STREAM_BLOCK_PAIRS);
+                suffix_builder_->read_arrays(block, block_end, sa, lcp);
+                scanned += collect_matches(corpus, ArrayBlock{sa, block}, ArrayBlock{lcp, block},
+                                           block, block_end, min_length, table);
+            }
+            return scanned;
+        });
+    }
+
+    template<typename Collect>
+    std::vector<Match> DuplicateFinder::reduce_in_mode(size_t pairs, size_t min_length, Collect &&collect) const {
+        if (any_match_) {
+            return reduce_any_match(pairs, collect);
+        }
+        if (top_k_ > 0) {
+            return reduce_top_matches(pairs, min_length, top_k_, collect);
+        }
+        return reduce_matches(pairs, min_length, collect);
+    }
+
+    template<typename Collect>
+    std::vector<Match> DuplicateFinder::reduce_top_matches(size_t pairs, size_t min_length, size_t limit,
+                                                           Collect &&collect) const {
+        const size_t shards = std::max<size_t>(1, std::min(threads_, pairs / MIN_SHARD_PAIRS));
+        std::vector<TopMatches> tables(shards, TopMatches(limit));
+        {
+            ScopedTimer timer(metrics_, "scan_matches");
+            parallel_for(0, pairs, shards, [&](size_t begin, size_t end, size_t shard) {
+                collect(begin, end, tables[shard]);
+            });
+        }
+        if (metrics_) {
+            size_t table_bytes = 0;
+            for (const auto &table: tables) {
+                table_bytes += table.memory_bytes();
+            }
+            metrics_->add_count("pairs_scanned", pairs);
+            metrics_->record_peak("match_tables", table_bytes);
+        }
+
+        // A pair missing from a shard's table is outranked there by limit
+        // pairs, which stay at least as good when merged, so a pair among the
+        // best limit overall has its best match in the tables. Merging in
+        // shard order keeps the earliest of equally long matches.
+        ScopedTimer merge_timer(metrics_, "merge_matches");
+        MatchTable merged(shards * limit);
+        for (const auto &table: tables) {
+            table.for_each([&merged](size_t key1, size_t key2, const Match &match) {
+                merged.update(key1, key2, match);
+            });
+        }
         std::vector<Match> result;
-        result.reserve(best_matches.size());
-        for (const auto &pair: best_matches) {
-            if (pair.second.length >= min_length) {
-                // Double check min_length
-                result.push_back(pair.second);
+        result.reserve(merged.size());
+        merged.for_each([&result, min_length](size_t, size_t, const Match &match) {
+            if (match.length >= min_length) {
+                result.push_back(match);
             }
+        });
+        merge_timer.stop();
+        {
+            ScopedTimer timer(metrics_, "sort_matches");
+            const size_t kept = std::min(limit, result.size());
+            std::partial_sort(result.begin(), result.begin() + static_cast<std::ptrdiff_t>(kept), result.end());
+            result.resize(kept);
         }
+        if (metrics_) metrics_->add_count("pairs_kept", result.size());
+        return result;
+    }
 
-        // Sort by length descending, then by doc IDs
-        std::sort(result.begin(), result.end());
+    template<typename Collect>
+    std::vector<Match> DuplicateFinder::reduce_any_match(size_t pairs, Collect &&collect) const {
+        const size_t shards = std::max<size_t>(1, std::min(threads_, pairs / MIN_SHARD_PAIRS));
+        std::atomic<size_t> first_shard{shards};
+        std::vector<FirstMatch> sinks;
+        sinks.reserve(shards);
+        for (size_t shard = 0; shard < shards; ++shard) {
+            sinks.emplace_back(first_shard, shard);
+        }
+        std::vector<size_t> scanned(shards);
+        {
+            ScopedTimer timer(metrics_, "scan_matches");
+            parallel_for(0, pairs, shards, [&](size_t begin, size_t end, size_t shard) {
+                scanned[shard] = collect(begin, end, sinks[shard]);
+            });
+        }
+        std::vector<Match> result;
+        for (const auto &sink: sinks) {
+            if (sink.match()) {
+                // The lowest shard with a match scanned its range up to it, as a single thread would
+                result.push_back(*sink.match());
+                break;
+            }
+        }
+        if (metrics_) {
+            size_t total = 0;
+            for (size_t count: scanned) {
+                total += count;
+            }
+            metrics_->add_count("pairs_scanned", total);
+            metrics_->add_count("pairs_kept", result.size());
+        }
+        return result;
+    }
+
+    template<typename Collect>
+    std::vector<Match> DuplicateFinder::reduce_matches(size_t pairs, size_t min_length, Collect &&collect) const {
+        const size_t shards = std::max<size_t>(1, std::min(threads_, pairs / MIN_SHARD_PAIRS));
+
+        // Reduce every range of adjacent pairs on its own
+        std::vector<MatchTable> tables(shards);
+        {
+            ScopedTimer timer(metrics_, "scan_matches");
+            parallel_for(0, pairs, shards, [&](size_t begin, size_t end, size_t shard) {
+                collect(begin, end, tables[shard]);
+            });
+        }
+        if (metrics_) {
+            size_t table_bytes = 0;
+            for (const auto &table: tables) {
+                table_bytes += table.memory_bytes();
+            }
+            metrics_->add_count("pairs_scanned", pairs);
+            metrics_->record_peak("match_tables", table_bytes);
+        }
+        ScopedTimer merge_timer(metrics_, "merge_matches");
+
+        // Merge per hash partition, visiting the shards in range order so the
+        // earliest of equally long matches wins just as in a single pass
+        std::vector<MatchTable> merged;
+        if (shards == 1) {
+            merged = std::move(tables);
+        } else {
+            // parts[shard][partition] holds the shard's pairs hashing to the partition
+            std::vector<std::vector<std::vector<PairMatch>>> parts(
+                shards, std::vector<std::vector<PairMatch>>(shards));
+            parallel_for(0, shards, shards, [&](size_t begin, size_t end, size_t) {
+                for (size_t shard = begin; shard < end; ++shard) {
+                    tables[shard].for_each([&](size_t key1, size_t key2, const Match &match) {
+                        size_t part = (MatchTable::hash(key1, key2) >> 32) * shards >> 32;
+                        parts[shard][part].push_back({key1, key2, match});
+                    });
+                    tables[shard] = MatchTable();
+                }
+            });
+
+            merged.resize(shards);
+            parallel_for(0, shards, shards, [&](size_t begin, size_t end, size_t) {
+                for (size_t part = begin; part < end; ++part) {
+                    for (size_t shard = 0; shard < shards; ++shard) {
+                        for (const auto &entry: parts[shard][part]) {
+                            merged[part].update(entry.key1, entry.key2, entry.match);
+                        }
+                        parts[shard][part] = {};
+                    }
+                }
+            });
+        }
+
+        // Convert tables to vector of matches
+        std::vector<Match> result;
+        size_t total = 0;
+        for (const auto &table: merged) {
+            total += table.size();
+        }
+        result.reserve(total);
+        for (const auto &table: merged) {
+            table.for_each([&result, min_length](size_t, size_t, const Match &match) {
+                if (match.length >= min_length) {
+                    // Double check min_length
+                    result.push_back(match);
+                }
+            });
+        }
+
+        merge_timer.stop();
+
+        // Sort by length descending, then by doc IDs; every pair occurs once,
+        // so the order does not depend on the tables' slot order
+        {
+            ScopedTimer timer(metrics_, "sort_matches");
+            parallel_sort(result.begin(), result.end(), threads_, std::less<>());
+        }
+        if (metrics_) metrics_->add_count("pairs_kept", result.size());
 
         return result;
     }
+
+    template<typename Collect>
+    std::vector<Cluster> DuplicateFinder::reduce_clusters(size_t suffixes, Collect &&collect) const {
+        if (suffixes < 2) {
+            return {};
+        }
+        const size_t shards = std::max<size_t>(1, std::min(threads_, suffixes / MIN_SHARD_PAIRS));
+        std::vector<std::vector<Cluster>> parts(shards);
+        {
+            ScopedTimer timer(metrics_, "scan_clusters");
+            parallel_for(0, suffixes, shards, [&](size_t begin, size_t end, size_t shard) {
+                collect(begin, end, parts[shard]);
+            });
+        }
+
+        std::vector<Cluster> result;
+        size_t total = 0;
+        for (const auto &part: parts) {
+            total += part.size();
+        }
+        result.reserve(total);
+        for (auto &part: parts) {
+            std::move(part.begin(), part.end(), std::back_inserter(result));
+        }
+        // Clusters are distinct, so the order does not depend on the sharding
+        parallel_sort(result.begin(), result.end(), threads_, std::less<>());
+        if (metrics_) metrics_->add_count("clusters", result.size());
+        return result;
+    }
+
+    template<typename Corpus, typename Arrays>
+    void DuplicateFinder::collect_clusters(
+        Corpus &corpus,
+        Arrays &arrays,
+        size_t begin,
+        size_t end,
+        size_t min_length,
+        std::vector<Cluster> &clusters
+    ) {
+        const size_t n = arrays.size();
+        if (begin >= n) {
+            return;
+        }
+        const bool byte_unit = corpus.byte_unit();
+        // A byte length is never shorter than its character length, so runs are cut in either unit
+        const size_t threshold = std::max<size_t>(min_length, 1);
+
+        auto make_leaf = [&](size_t i) {
+            const size_t pos = arrays.sa(i);
+            const size_t index = corpus.find_document(pos);
+            size_t remaining = 0;
+            if (index != DocumentStore::NO_DOCUMENT) {
+                const auto doc = corpus.document(index);
+                const size_t offset = pos - (byte_unit ? doc.byte_start : doc.start_pos);
+                const size_t length = byte_unit ? doc.byte_length : doc.length;
+                remaining = offset < length ? length - offset : 0;
+            }
+            return Leaf{pos, index, remaining};
+        };
+        // LCP of neighbours cut at their document ends. As no document contains
+        // the separator, the cut values are still the minima over ranges.
+        auto shared = [](const Leaf &a, size_t lcp, const Leaf &b) {
+            return std::min({lcp, a.remaining, b.remaining});
+        };
+
+        size_t i = begin;
+        Leaf current = make_leaf(i);
+        bool more = true;
+        if (begin > 0 && shared(make_leaf(begin - 1), arrays.lcp(begin - 1), current) >= threshold) {
+            // The run containing begin started in the previous shard, which walks it
+            more = false;
+            while (i + 1 < n) {
+                const Leaf next = make_leaf(i + 1);
+                const size_t h = shared(current, arrays.lcp(i), next);
+                ++i;
+                current = next;
+                if (h < threshold) {
+                    more = true;
+                    break;
+                }
+            }
+        }
+
+        IntervalWalker<Corpus> walker(corpus, min_length, clusters);
+        std::vector<Leaf> leaves;
+        std::vector<size_t> lcps;
+        while (more && i < end) {
+            // Collect the run starting at i, ending before the first neighbours sharing less than threshold
+            leaves.assign(1, current);
+            lcps.clear();
+            more = false;
+            while (i + 1 < n) {
+                const Leaf next = make_leaf(i + 1);
+                const size_t h = shared(current, arrays.lcp(i), next);
+                ++i;
+                current = next;
+                if (h < threshold) {
+                    more = true;
+                    break;
+                }
+                leaves.push_back(next);
+                lcps.push_back(h);
+            }
+            if (leaves.size() > 1) {
+                walker.walk(leaves, lcps);
+            }
+        }
+    }
+
+    template<typename Corpus, typename SuffixArray, typename LcpArray, typename Table>
+    size_t DuplicateFinder::collect_matches(
+        Corpus &corpus,
+        const SuffixArray &suffix_array,
+        const LcpArray &lcp_array,
+        size_t begin,
+        size_t end,
+        size_t min_length,
+        Table &best
+    ) {
+        // Byte-unit builders are mapped back to characters only for candidate matches
+        const bool byte_unit = corpus.byte_unit();
+        const size_t depth = corpus.depth();
+
+        // Process all adjacent positions in suffix array
+        size_t next_index = begin < end ? corpus.find_document(suffix_array[begin]) : DocumentStore::NO_DOCUMENT;
+        for (size_t i = begin; i < end; ++i) {
+            if (scan_stopped(best)) {
+                return i - begin;
+            }
+            // Get documents for adjacent positions in suffix array; each lookup is reused once
+            size_t index1 = next_index;
+            size_t index2 = corpus.find_document(suffix_array[i + 1]);
+            next_index = index2;
+
+            // Skip positions that fall in document separators, and pairs in the same document
+            if (index1 == DocumentStore::NO_DOCUMENT || index2 == DocumentStore::NO_DOCUMENT || index1 == index2) {
+                continue;
+            }
+            const auto &doc1 = corpus.document(index1);
+            const auto &doc2 = corpus.document(index2);
+
+            // Calculate relative positions within documents
+            size_t start1 = byte_unit ? doc1.byte_start : doc1.start_pos;
+            size_t start2 = byte_unit ? doc2.byte_start : doc2.start_pos;
+            size_t pos1 = suffix_array[i] - start1;
+            size_t pos2 = suffix_array[i + 1] - start2;
+
+            // Adjust length if it crosses document boundaries (a suffix may start in the separator)
+            size_t len1 = byte_unit ? doc1.byte_length : doc1.length;
+            size_t len2 = byte_unit ? doc2.byte_length : doc2.length;
+            size_t max_len1 = pos1 < len1 ? len1 - pos1 : 0;
+            size_t max_len2 = pos2 < len2 ? len2 - pos2 : 0;
+            size_t max_possible_length = std::min(max_len1, max_len2);
+            size_t actual_length = std::min(lcp_array[i], max_possible_length);
+
+            // Skip if too short (a byte length is never shorter than its character length)
+            if (actual_length < min_length) {
+                continue;
+            }
+
+            if (depth > 0 && lcp_array[i] >= depth && max_possible_length > depth) {
+                size_t full = corpus.extend(suffix_array[i], suffix_array[i + 1], depth);
+                actual_length = std::min(full, max_possible_length);
+            }
+
+            if (byte_unit) {
+                size_t char1 = corpus.char_index(suffix_array[i]);
+                actual_length = corpus.char_index(suffix_array[i] + actual_length) - char1;
+                if (actual_length < min_length) {
+                    continue;
+                }
+                pos1 = char1 - doc1.start_pos;
+                pos2 = corpus.char_index(suffix_array[i + 1]) - doc2.start_pos;
+            }
+
+            // Create match (ensure doc1 is the one with smaller ID)
+            Match match;
+            if (doc1.sql_id < doc2.sql_id) {
+                match = Match{doc1.sql_id, doc2.sql_id, pos1, pos2, actual_length};
+            } else {
+                match = Match{doc2.sql_id, doc1.sql_id, pos2, pos1, actual_length};
+            }
+
+            // Update best match for this document pair if longer
+            best.update(std::min(index1, index2), std::max(index1, index2), match);
+        }
+        return end > begin ? end - begin : 0;
+    }
 } // namespace text_processing
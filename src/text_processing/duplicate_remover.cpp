@@ -0,0 +1,54 @@
+#include "text_processing/duplicate_remover.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+namespace text_processing {
+    DocumentEdits remove_duplicate_spans(const DocumentStore &store, const std::vector<Match> &matches) {
+        // Character ranges [begin, end) to cut, per document ID
+        std::unordered_map<int64_t, std::vector<std::pair<size_t, size_t>>> spans;
+        for (const auto &match: matches) {
+            if (match.length > 0) {
+                spans[match.doc2_id].emplace_back(match.start_pos2, match.start_pos2 + match.length);
+            }
+        }
+
+        DocumentEdits edits;
+        const auto &text = store.get_concatenated_text();
+        const std::string &bytes = text.str();
+        for (size_t index = 0; index < store.document_count() && !spans.empty(); ++index) {
+            const auto &doc = store.document(index);
+            auto it = spans.find(doc.sql_id);
+            if (it == spans.end()) continue;
+
+            auto &ranges = it->second;
+            const size_t removed = edits.removed;
+            std::sort(ranges.begin(), ranges.end());
+            std::string content;
+            content.reserve(doc.byte_length);
+            size_t kept = 0; // Character offset up to which the document is copied or cut
+            for (const auto &[begin, end]: ranges) {
+                const size_t from = std::min(begin, doc.length);
+                const size_t to = std::min(end, doc.length);
+                if (to <= kept) continue;
+                if (from > kept) {
+                    const size_t first = text.byte_offset(doc.start_pos + kept);
+                    content.append(bytes, first, text.byte_offset(doc.start_pos + from) - first);
+                    kept = from;
+                }
+                edits.removed += to - kept;
+                kept = to;
+            }
+            const size_t first = text.byte_offset(doc.start_pos + kept);
+            content.append(bytes, first, doc.byte_start + doc.byte_length - first);
+
+            if (edits.removed > removed) {
+                edits.sql_ids.push_back(doc.sql_id);
+                edits.contents.push_back(std::move(content));
+            }
+            spans.erase(it);
+        }
+        return edits;
+    }
+} // namespace text_processing
@@ -0,0 +1,229 @@
+#include "text_processing/external_suffix_builder.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include "text_processing/prefix_buckets.hpp"
+
+namespace text_processing {
+
+namespace {
+    /**
+     * @brief Name for a new scratch directory, unique across builders and processes
+     */
+    std::string unique_directory_name() {
+        static std::atomic<uint64_t> counter{0};
+        std::random_device random;
+        std::ostringstream name;
+        name << "suffix_array_" << std::hex << random() << "_" << counter++;
+        return name.str();
+    }
+} // namespace
+
+ExternalSuffixBuilder::ExternalSuffixBuilder(size_t memory_budget, std::string scratch_dir)
+    : memory_budget_(memory_budget == 0 ? DEFAULT_MEMORY_BUDGET : memory_budget)
+      , scratch_dir_(std::move(scratch_dir)) {
+}
+
+ExternalSuffixBuilder::~ExternalSuffixBuilder() {
+    remove_scratch();
+}
+
+bool ExternalSuffixBuilder::build(const UTF8String& text) {
+    try {
+        validate_input(text);
+        remove_scratch();
+        is_built_ = false;
+        arrays_loaded_ = false;
+        suffix_array_ = IndexVector();
+        lcp_array_ = IndexVector();
+        text_ = &text;
+
+        namespace fs = std::filesystem;
+        fs::path base = scratch_dir_.empty() ? fs::temp_directory_path() : fs::path(scratch_dir_);
+        fs::create_directories(base);
+        fs::path path;
+        do {
+            path = base / unique_directory_name();
+        } while (!fs::create_directory(path));
+        scratch_path_ = path.string();
+
+        width_ = IndexVector::width_for(text.str().length() + 1);
+        if (width_ == IndexVector::Width::UINT32) {
+            build_arrays<uint32_t>();
+        } else {
+            build_arrays<uint64_t>();
+        }
+        is_built_ = true;
+        return true;
+    } catch (const std::exception& e) {
+        remove_scratch();
+        is_built_ = false;
+        throw std::runtime_error(std::string("Failed to build suffix array: ") + e.what());
+    }
+}
+
+template<typename Index>
+void ExternalSuffixBuilder::build_arrays() {
+    const std::string& data = text_->str();
+    const size_t n = data.length();
+    PrefixScanner scanner(reinterpret_cast<const unsigned char*>(data.c_str()), n);
+
+    // One suffix and one LCP value per bucket entry
+    const size_t capacity = std::max<size_t>(memory_budget_ / (2 * sizeof(Index)), 1);
+    const size_t suffixes = scanner.suffix_count();
+    std::vector<PrefixBucket> buckets;
+    scanner.plan("", suffixes, capacity, buckets);
+
+    std::ofstream sa_out(scratch_path_ + "/sa.bin", std::ios::binary);
+    std::ofstream lcp_out(scratch_path_ + "/lcp.bin", std::ios::binary);
+    if (!sa_out.is_open() || !lcp_out.is_open()) {
+        throw std::runtime_error("Unable to create array files in " + scratch_path_);
+    }
+
+    std::vector<Index> positions;
+    std::vector<Index> lcp;
+    positions.reserve(std::min(capacity, suffixes));
+    lcp.reserve(std::min(capacity, suffixes));
+    bool has_previous = false;
+    size_t previous = 0;
+    size_t written = 0;
+    for (const auto& bucket : buckets) {
+        positions.clear();
+        scanner.collect(bucket, positions);
+        if (positions.empty()) {
+            continue;
+        }
+
+        const size_t depth = bucket.prefix.size();
+        std::sort(positions.begin(), positions.end(), [&scanner, depth](Index a, Index b) {
+            return scanner.less(a, b, depth);
+        });
+
+        // The first suffix is compared with the last one of the previous bucket
+        lcp.clear();
+        if (has_previous) {
+            lcp.push_back(static_cast<Index>(scanner.lcp(previous, positions[0], 0)));
+        }
+        for (size_t i = 1; i < positions.size(); i++) {
+            lcp.push_back(static_cast<Index>(scanner.lcp(positions[i - 1], positions[i], depth)));
+        }
+
+        sa_out.write(reinterpret_cast<const char*>(positions.data()),
+                     static_cast<std::streamsize>(positions.size() * sizeof(Index)));
+        lcp_out.write(reinterpret_cast<const char*>(lcp.data()),
+                      static_cast<std::streamsize>(lcp.size() * sizeof(Index)));
+        previous = positions.back();
+        has_previous = true;
+        written += positions.size();
+    }
+
+    sa_out.close();
+    lcp_out.close();
+    if (!sa_out || !lcp_out) {
+        throw std::runtime_error("Failed to write array files in " + scratch_path_);
+    }
+    suffix_count_ = written;
+    bucket_count_ = buckets.size();
+}
+
+template<typename Index>
+void ExternalSuffixBuilder::read_file(const std::string& name, size_t begin, size_t end,
+                                      std::vector<size_t>& out) const {
+    std::ifstream in(scratch_path_ + "/" + name, std::ios::binary);
+    std::vector<Index> values(end - begin);
+    in.seekg(static_cast<std::streamoff>(begin * sizeof(Index)));
+    in.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(Index)));
+    if (!in) {
+        throw std::runtime_error("Failed to read " + name + " in " + scratch_path_);
+    }
+    out.assign(values.begin(), values.end());
+}
+
+void ExternalSuffixBuilder::read_arrays(size_t begin, size_t end, std::vector<size_t>& sa,
+                                        std::vector<size_t>& lcp) const {
+    if (!is_built_) {
+        throw std::runtime_error("Suffix array not built");
+    }
+    if (width_ == IndexVector::Width::UINT32) {
+        read_file<uint32_t>("sa.bin", begin, end + 1, sa);
+        read_file<uint32_t>("lcp.bin", begin, end, lcp);
+    } else {
+        read_file<uint64_t>("sa.bin", begin, end + 1, sa);
+        read_file<uint64_t>("lcp.bin", begin, end, lcp);
+    }
+}
+
+void ExternalSuffixBuilder::load_arrays() const {
+    std::lock_guard<std::mutex> lock(load_mutex_);
+    if (arrays_loaded_) {
+        return;
+    }
+    auto load = [this](const std::string& name, size_t count, IndexVector& out) {
+        out = IndexVector(width_, count);
+        out.visit([&](auto& values) {
+            std::ifstream in(scratch_path_ + "/" + name, std::ios::binary);
+            in.read(reinterpret_cast<char*>(values.data()),
+                    static_cast<std::streamsize>(values.size() * sizeof(values[0])));
+            if (!in) {
+                throw std::runtime_error("Failed to read " + name + " in " + scratch_path_);
+            }
+        });
+    };
+    load("sa.bin", suffix_count_, suffix_array_);
+    load("lcp.bin", suffix_count_ - 1, lcp_array_);
+    arrays_loaded_ = true;
+}
+
+void ExternalSuffixBuilder::remove_scratch() {
+    if (!scratch_path_.empty()) {
+        std::error_code error;
+        std::filesystem::remove_all(scratch_path_, error);
+        scratch_path_.clear();
+    }
+}
+
+void ExternalSuffixBuilder::validate_input(const UTF8String& text) {
+    if (text.length() == 0) {
+        throw std::runtime_error("Empty string provided");
+    }
+}
+
+size_t ExternalSuffixBuilder::suffix_count() const {
+    if (!is_built_) {
+        throw std::runtime_error("Suffix array not built");
+    }
+    return suffix_count_;
+}
+
+const IndexVector& ExternalSuffixBuilder::get_array() const {
+    if (!is_built_) {
+        throw std::runtime_error("Suffix array not built");
+    }
+    load_arrays();
+    return suffix_array_;
+}
+
+const IndexVector& ExternalSuffixBuilder::get_lcp_array() const {
+    if (!is_built_) {
+        throw std::runtime_error("LCP array not built");
+    }
+    load_arrays();
+    return lcp_array_;
+}
+
+const UTF8String& ExternalSuffixBuilder::get_text() const {
+    static const UTF8String empty;
+    return text_ ? *text_ : empty;
+}
+
+bool ExternalSuffixBuilder::is_built() const {
+    return is_built_;
+}
+
+} // namespace text_processing
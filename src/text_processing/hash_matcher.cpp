@@ -0,0 +1,280 @@
+#include "text_processing/hash_matcher.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+#include "text_processing/integer_text.hpp"
+#include "text_processing/parallel.hpp"
+
+namespace text_processing {
+    namespace {
+        constexpr uint64_t HASH_BASE = 0x100000001b3ULL;
+
+        /**
+         * @brief Spread a polynomial hash over all bits, so the top bits pick evenly filled buckets
+         */
+        inline uint64_t mix(uint64_t x) {
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ULL;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebULL;
+            return x ^ (x >> 31);
+        }
+
+        /**
+         * @brief A sampled window of a document
+         */
+        struct Anchor {
+            uint64_t hash;
+            size_t document; ///< Index in the store
+            size_t pos;      ///< Character offset in the document
+        };
+
+        /**
+         * @brief Where a match runs between two documents: its document before and the offset between the starts
+         */
+        struct Diagonal {
+            size_t document;
+            size_t shift; ///< Position in the earlier document minus the one in the later, plus the later's length
+
+            bool operator==(const Diagonal &other) const {
+                return document == other.document && shift == other.shift;
+            }
+        };
+
+        struct DiagonalHash {
+            size_t operator()(const Diagonal &diagonal) const {
+                return mix(diagonal.document * HASH_BASE + diagonal.shift);
+            }
+        };
+
+        /**
+         * @brief Hash of the windows of width symbols starting at 0, step, 2 * step, ... of symbols[0, length)
+         *
+         * @param power HASH_BASE to the power width
+         * @param prefix Scratch, receives the polynomial hash of every prefix
+         * @param out Receives the mixed window hashes
+         */
+        template<typename Symbol>
+        void window_hashes(const Symbol *symbols, size_t length, size_t width, size_t step, uint64_t power,
+                           std::vector<uint64_t> &prefix, std::vector<uint64_t> &out) {
+            out.clear();
+            if (length < width) {
+                return;
+            }
+            prefix.resize(length + 1);
+            prefix[0] = 0;
+            for (size_t i = 0; i < length; ++i) {
+                prefix[i + 1] = prefix[i] * HASH_BASE + symbols[i];
+            }
+            // Every window is one multiply and subtract on its own, so the loop vectorizes
+            out.resize((length - width) / step + 1);
+            const uint64_t *hashes = prefix.data();
+            uint64_t *windows = out.data();
+            for (size_t j = 0; j < out.size(); ++j) {
+                windows[j] = mix(hashes[j * step + width] - hashes[j * step] * power);
+            }
+        }
+
+        /**
+         * @brief Anchors sorted by hash, indexed by the top bits of the hash
+         */
+        class AnchorTable {
+        public:
+            AnchorTable(std::vector<Anchor> anchors, size_t threads) : anchors_(std::move(anchors)) {
+                parallel_sort(anchors_.begin(), anchors_.end(), threads, [](const Anchor &a, const Anchor &b) {
+                    if (a.hash != b.hash) return a.hash < b.hash;
+                    if (a.document != b.document) return a.document < b.document;
+                    return a.pos < b.pos;
+                });
+                size_t bits = 1;
+                while ((size_t{1} << bits) < anchors_.size()) {
+                    bits++;
+                }
+                shift_ = 64 - bits;
+                starts_.assign((size_t{1} << bits) + 1, 0);
+                for (const auto &anchor: anchors_) {
+                    starts_[(anchor.hash >> shift_) + 1]++;
+                }
+                for (size_t b = 1; b < starts_.size(); ++b) {
+                    starts_[b] += starts_[b - 1];
+                }
+            }
+
+            /**
+             * @brief Call fn(anchor) for the anchors with this hash, by document and position
+             */
+            template<typename Fn>
+            void for_each(uint64_t hash, Fn &&fn) const {
+                const size_t bucket = hash >> shift_;
+                for (size_t i = starts_[bucket]; i < starts_[bucket + 1]; ++i) {
+                    if (anchors_[i].hash == hash) {
+                        fn(anchors_[i]);
+                    }
+                }
+            }
+
+            [[nodiscard]] size_t memory_bytes() const {
+                return anchors_.capacity() * sizeof(Anchor) + starts_.capacity() * sizeof(size_t);
+            }
+
+        private:
+            std::vector<Anchor> anchors_;
+            std::vector<size_t> starts_; ///< starts_[b] is the first anchor whose hash has top bits b
+            size_t shift_ = 63;
+        };
+
+        template<typename Symbol>
+        std::vector<Match> match_documents(const Symbol *symbols, const DocumentStore &store, size_t min_length,
+                                           size_t threads, bool first_only, HashMatchStats *stats) {
+            const size_t count = store.document_count();
+            const size_t step = std::max<size_t>(1, min_length / 2);
+            const size_t width = min_length - step + 1;
+            uint64_t power = 1;
+            for (size_t i = 0; i < width; ++i) {
+                power *= HASH_BASE;
+            }
+            const size_t parts = std::min(count, 16 * threads);
+
+            // Anchors of every document but the last, whose windows are only looked up
+            std::vector<std::vector<Anchor>> part_anchors(parts);
+            parallel_for_each_dynamic(parts, threads, [&](size_t part) {
+                std::vector<uint64_t> prefix;
+                std::vector<uint64_t> hashes;
+                for (size_t d = count * part / parts; d < count * (part + 1) / parts && d + 1 < count; ++d) {
+                    const auto &doc = store.document(d);
+                    if (doc.length < min_length) continue;
+                    window_hashes(symbols + doc.start_pos, doc.length, width, step, power, prefix, hashes);
+                    for (size_t j = 0; j < hashes.size(); ++j) {
+                        part_anchors[part].push_back({hashes[j], d, j * step});
+                    }
+                }
+            });
+            size_t total = 0;
+            for (const auto &anchors: part_anchors) {
+                total += anchors.size();
+            }
+            if (total == 0) {
+                return {};
+            }
+            std::vector<Anchor> anchors;
+            anchors.reserve(total);
+            for (auto &part: part_anchors) {
+                anchors.insert(anchors.end(), part.begin(), part.end());
+                std::vector<Anchor>().swap(part);
+            }
+            const AnchorTable table(std::move(anchors), threads);
+
+            // Every window of a document against the anchors of the documents before it
+            std::vector<std::vector<Match>> found(count);
+            std::vector<size_t> part_hits(parts);
+            std::atomic<size_t> first_found{count}; ///< Lowest later document with a match so far
+            parallel_for_each_dynamic(parts, threads, [&](size_t part) {
+                std::vector<uint64_t> prefix;
+                std::vector<uint64_t> hashes;
+                std::unordered_map<Diagonal, size_t, DiagonalHash> covered; ///< End in the later document
+                std::unordered_map<size_t, Match> best; ///< By the earlier document
+                size_t hits = 0;
+                for (size_t b = count * part / parts; b < count * (part + 1) / parts; ++b) {
+                    // Documents after one with a match stop, the ones before it may still have an earlier one
+                    if (first_only && b > first_found.load(std::memory_order_relaxed)) break;
+                    const auto &later = store.document(b);
+                    if (later.length < min_length) continue;
+                    const Symbol *text_b = symbols + later.start_pos;
+                    window_hashes(text_b, later.length, width, 1, power, prefix, hashes);
+                    covered.clear();
+                    best.clear();
+                    for (size_t q = 0; q < hashes.size(); ++q) {
+                        if (first_only && !best.empty()) break;
+                        table.for_each(hashes[q], [&](const Anchor &anchor) {
+                            if (anchor.document >= b) return;
+                            // Hits inside a match already extended on this diagonal add nothing
+                            auto [end, fresh] = covered.try_emplace(
+                                Diagonal{anchor.document, anchor.pos + later.length - q}, 0);
+                            if (!fresh && end->second > q) return;
+                            hits++;
+
+                            const auto &earlier = store.document(anchor.document);
+                            const Symbol *text_a = symbols + earlier.start_pos;
+                            size_t left = 0;
+                            while (left < anchor.pos && left < q &&
+                                   text_a[anchor.pos - left - 1] == text_b[q - left - 1]) {
+                                left++;
+                            }
+                            const size_t max_right = std::min(earlier.length - anchor.pos, later.length - q);
+                            size_t right = 0;
+                            while (right < max_right && text_a[anchor.pos + right] == text_b[q + right]) {
+                                right++;
+                            }
+                            end->second = q + right;
+                            const size_t length = left + right;
+                            if (length < min_length) return;
+
+                            // Longest first, then earliest in the later document, then in the earlier one
+                            const size_t pos_a = anchor.pos - left;
+                            const size_t pos_b = q - left;
+                            const Match match = earlier.sql_id < later.sql_id
+                                                    ? Match{earlier.sql_id, later.sql_id, pos_a, pos_b, length}
+                                                    : Match{later.sql_id, earlier.sql_id, pos_b, pos_a, length};
+                            auto [slot, first] = best.try_emplace(anchor.document, match);
+                            if (first) return;
+                            const Match &held = slot->second;
+                            const size_t held_b = earlier.sql_id < later.sql_id ? held.start_pos2 : held.start_pos1;
+                            const size_t held_a = earlier.sql_id < later.sql_id ? held.start_pos1 : held.start_pos2;
+                            if (length > held.length || (length == held.length &&
+                                                         (pos_b < held_b || (pos_b == held_b && pos_a < held_a)))) {
+                                slot->second = match;
+                            }
+                        });
+                    }
+                    for (const auto &[document, match]: best) {
+                        found[b].push_back(match);
+                    }
+                    if (first_only && !best.empty()) {
+                        // Of the matches at the first window with any, the one with the earliest document
+                        auto earliest = std::min_element(best.begin(), best.end(), [](const auto &x, const auto &y) {
+                            return x.first < y.first;
+                        });
+                        found[b].assign(1, earliest->second);
+                        size_t first = first_found.load(std::memory_order_relaxed);
+                        while (b < first &&
+                               !first_found.compare_exchange_weak(first, b, std::memory_order_relaxed)) {
+                        }
+                    }
+                }
+                part_hits[part] = hits;
+            });
+
+            if (stats) {
+                stats->anchors = total;
+                stats->anchor_bytes = table.memory_bytes();
+                for (size_t hits: part_hits) {
+                    stats->anchor_hits += hits;
+                }
+            }
+            std::vector<Match> result;
+            for (auto &matches: found) {
+                if (first_only && !matches.empty()) {
+                    // The first document with a match, scanned in full by its part as by a single thread
+                    return {matches.front()};
+                }
+                result.insert(result.end(), matches.begin(), matches.end());
+            }
+            return result;
+        }
+    } // namespace
+
+    std::vector<Match> find_hashed_matches(const DocumentStore &store, size_t min_length, size_t threads,
+                                           bool first_only, HashMatchStats *stats) {
+        if (stats) *stats = HashMatchStats{};
+        if (store.document_count() < 2) {
+            return {};
+        }
+        const IntegerText text(store.get_concatenated_text());
+        return text.visit([&](const auto *symbols) {
+            return match_documents(symbols, store, std::max<size_t>(min_length, 1), resolve_threads(threads),
+                                   first_only, stats);
+        });
+    }
+} // namespace text_processing
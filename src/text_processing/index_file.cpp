@@ -0,0 +1,415 @@
+#include "text_processing/index_file.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "text_processing/index_vector.hpp"
+#include "text_processing/utf8_handler.hpp"
+
+namespace text_processing {
+
+namespace {
+    constexpr char MAGIC[8] = {'D', 'U', 'P', 'I', 'D', 'X', '\0', '\0'};
+    constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+    constexpr size_t BLOCK_BYTES = 64;
+    constexpr size_t BLOCK_CHARS = 64;
+    constexpr size_t ALIGNMENT = 8;
+
+    /**
+     * @brief Suffix array entries converted and written at once
+     */
+    constexpr size_t WRITE_BLOCK = 1 << 20;
+
+    /**
+     * @brief Fixed file header, followed by the sections it points to
+     */
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t byte_order;
+        uint32_t unit;               ///< 0 = characters, 1 = bytes
+        uint32_t width;              ///< Bytes per suffix and LCP array entry
+        uint64_t file_size;
+        uint64_t label_offset;
+        uint64_t label_size;
+        uint64_t text_offset;
+        uint64_t text_size;          ///< Bytes
+        uint64_t char_count;
+        uint64_t sa_offset;
+        uint64_t suffix_count;
+        uint64_t lcp_offset;
+        uint64_t documents_offset;
+        uint64_t document_count;
+        uint64_t blocks_offset;
+        uint64_t block_count;
+        uint64_t samples_offset;
+        uint64_t sample_count;
+    };
+
+    inline bool is_char_start(unsigned char byte) {
+        return (byte & 0xC0) != 0x80;
+    }
+
+    /**
+     * @brief Sequential writer that keeps every section aligned
+     */
+    class SectionWriter {
+    public:
+        explicit SectionWriter(std::ofstream& out) : out_(out) {
+        }
+
+        /**
+         * @brief Pad to the next aligned offset and return it
+         */
+        uint64_t begin_section() {
+            static constexpr char zeros[ALIGNMENT] = {};
+            const size_t padding = (ALIGNMENT - offset_ % ALIGNMENT) % ALIGNMENT;
+            write(zeros, padding);
+            return offset_;
+        }
+
+        void write(const void* data, size_t size) {
+            out_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+            offset_ += size;
+        }
+
+        [[nodiscard]] uint64_t offset() const { return offset_; }
+
+    private:
+        std::ofstream& out_;
+        uint64_t offset_ = 0;
+    };
+
+    /**
+     * @brief Write the suffix array (lcp = false) or the LCP array of a builder with Index entries
+     */
+    template<typename Index>
+    void write_array(SectionWriter& writer, const SuffixArrayBuilder& builder, bool lcp) {
+        const size_t last = builder.suffix_count() - 1;
+        std::vector<size_t> sa;
+        std::vector<size_t> lcp_values;
+        std::vector<Index> buffer;
+        for (size_t begin = 0;; ) {
+            const size_t end = std::min(begin + WRITE_BLOCK, last);
+            builder.read_arrays(begin, end, sa, lcp_values);
+            // sa holds one entry more than lcp; it is kept for the last block only
+            const auto& values = lcp ? lcp_values : sa;
+            const size_t count = lcp || end < last ? end - begin : end - begin + 1;
+            buffer.assign(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(count));
+            writer.write(buffer.data(), buffer.size() * sizeof(Index));
+            if (end == last) {
+                break;
+            }
+            begin = end;
+        }
+    }
+
+    [[noreturn]] void corrupt(const std::string& path, const std::string& reason) {
+        throw std::runtime_error("Invalid index file " + path + ": " + reason);
+    }
+} // namespace
+
+/**
+ * @brief Document table record
+ */
+struct IndexFile::Document {
+    int64_t sql_id;
+    uint64_t start_pos;
+    uint64_t length;
+    uint64_t byte_start;
+    uint64_t byte_length;
+};
+
+void IndexFile::write(const std::string& path, const DocumentStore& store,
+                      const SuffixArrayBuilder& builder, const std::string& label) {
+    write_file(path, store, &builder, label);
+}
+
+void IndexFile::write_documents(const std::string& path, const DocumentStore& store, const std::string& label) {
+    write_file(path, store, nullptr, label);
+}
+
+void IndexFile::write_file(const std::string& path, const DocumentStore& store,
+                           const SuffixArrayBuilder* builder, const std::string& label) {
+    const UTF8String& text = store.get_concatenated_text();
+    const bool no_arrays = text.length() == 0 || !builder;
+    if (!no_arrays && !builder->is_built()) {
+        throw std::runtime_error("Suffix array not built");
+    }
+    if (!no_arrays && builder->suffix_count() != text.length()) {
+        throw std::runtime_error("Suffix array was not built on the store's text");
+    }
+
+    const std::string temporary = path + ".tmp";
+    std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        throw std::runtime_error("Unable to open file: " + temporary);
+    }
+
+    const std::string& data = text.str();
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.byte_order = BYTE_ORDER_MARK;
+    // Without arrays positions are bytes, as for the shards matched from the file
+    header.unit = !builder || builder->unit() == SuffixArrayBuilder::Unit::BYTE ? 1 : 0;
+    header.width = IndexVector::width_for(data.length() + 1) == IndexVector::Width::UINT32 ? 4 : 8;
+
+    SectionWriter writer(out);
+    writer.write(&header, sizeof(header));
+
+    header.label_offset = writer.begin_section();
+    header.label_size = label.size();
+    writer.write(label.data(), label.size());
+
+    header.text_offset = writer.begin_section();
+    header.text_size = data.length();
+    header.char_count = text.length();
+    writer.write(data.data(), data.length());
+
+    header.suffix_count = no_arrays ? 0 : builder->suffix_count();
+    header.sa_offset = writer.begin_section();
+    if (no_arrays) {
+        header.lcp_offset = header.sa_offset;
+    } else if (header.width == 4) {
+        write_array<uint32_t>(writer, *builder, false);
+        header.lcp_offset = writer.begin_section();
+        write_array<uint32_t>(writer, *builder, true);
+    } else {
+        write_array<uint64_t>(writer, *builder, false);
+        header.lcp_offset = writer.begin_section();
+        write_array<uint64_t>(writer, *builder, true);
+    }
+
+    header.documents_offset = writer.begin_section();
+    header.document_count = store.document_count();
+    for (size_t i = 0; i < store.document_count(); ++i) {
+        const DocumentPosition& doc = store.document(i);
+        Document record{doc.sql_id, doc.start_pos, doc.length, doc.byte_start, doc.byte_length};
+        writer.write(&record, sizeof(record));
+    }
+
+    // Characters before every byte block and bytes before every character block;
+    // the last entry of each covers a partial (or empty) block
+    header.block_count = data.length() / BLOCK_BYTES + 1;
+    header.sample_count = text.length() / BLOCK_CHARS + 1;
+    std::vector<uint64_t> blocks;
+    std::vector<uint64_t> samples;
+    blocks.reserve(header.block_count);
+    samples.reserve(header.sample_count);
+    uint64_t chars = 0;
+    for (size_t i = 0; i < data.length(); ++i) {
+        if (i % BLOCK_BYTES == 0) {
+            blocks.push_back(chars);
+        }
+        if (is_char_start(static_cast<unsigned char>(data[i]))) {
+            if (chars % BLOCK_CHARS == 0) {
+                samples.push_back(i);
+            }
+            chars++;
+        }
+    }
+    if (data.length() % BLOCK_BYTES == 0) {
+        blocks.push_back(chars);
+    }
+    if (chars % BLOCK_CHARS == 0) {
+        samples.push_back(data.length());
+    }
+    header.blocks_offset = writer.begin_section();
+    writer.write(blocks.data(), blocks.size() * sizeof(uint64_t));
+    header.samples_offset = writer.begin_section();
+    writer.write(samples.data(), samples.size() * sizeof(uint64_t));
+
+    header.file_size = writer.offset();
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.close();
+    if (!out) {
+        std::filesystem::remove(temporary);
+        throw std::runtime_error("Failed to write index file: " + temporary);
+    }
+    std::filesystem::rename(temporary, path);
+}
+
+IndexFile::IndexFile(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Unable to open file: " + path);
+    }
+    struct stat info{};
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Unable to stat file: " + path);
+    }
+    const auto size = static_cast<size_t>(info.st_size);
+    if (size < sizeof(Header)) {
+        ::close(fd);
+        corrupt(path, "too small for a header");
+    }
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("Unable to map file: " + path);
+    }
+    mapping_ = mapping;
+    mapping_size_ = size;
+
+    try {
+        Header header{};
+        std::memcpy(&header, mapping_, sizeof(header));
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+            corrupt(path, "not an index file");
+        }
+        if (header.version != VERSION) {
+            corrupt(path, "version " + std::to_string(header.version) + ", expected " + std::to_string(VERSION));
+        }
+        if (header.byte_order != BYTE_ORDER_MARK) {
+            corrupt(path, "written with another byte order");
+        }
+        if ((header.width != 4 && header.width != 8) || header.unit > 1) {
+            corrupt(path, "unknown array format");
+        }
+        if (header.file_size != size) {
+            corrupt(path, "truncated");
+        }
+
+        // Every section must be aligned and lie inside the file
+        auto section = [&](uint64_t offset, uint64_t count, uint64_t element) -> const char* {
+            if (offset % ALIGNMENT != 0 || offset > size || count > (size - offset) / element) {
+                corrupt(path, "section outside the file");
+            }
+            return static_cast<const char*>(mapping_) + offset;
+        };
+        const uint64_t lcp_entries = header.suffix_count == 0 ? 0 : header.suffix_count - 1;
+        label_ = {section(header.label_offset, header.label_size, 1), header.label_size};
+        text_ = {section(header.text_offset, header.text_size, 1), header.text_size};
+        sa_ = section(header.sa_offset, header.suffix_count, header.width);
+        lcp_ = section(header.lcp_offset, lcp_entries, header.width);
+        documents_ = reinterpret_cast<const Document*>(
+            section(header.documents_offset, header.document_count, sizeof(Document)));
+        block_chars_ = reinterpret_cast<const uint64_t*>(
+            section(header.blocks_offset, header.block_count, sizeof(uint64_t)));
+        char_samples_ = reinterpret_cast<const uint64_t*>(
+            section(header.samples_offset, header.sample_count, sizeof(uint64_t)));
+        if (header.block_count != header.text_size / BLOCK_BYTES + 1 ||
+            header.sample_count != header.char_count / BLOCK_CHARS + 1) {
+            corrupt(path, "character blocks do not match the text");
+        }
+
+        unit_ = header.unit == 1 ? SuffixArrayBuilder::Unit::BYTE : SuffixArrayBuilder::Unit::CHARACTER;
+        width_ = header.width;
+        char_count_ = header.char_count;
+        suffix_count_ = header.suffix_count;
+        document_count_ = header.document_count;
+    } catch (...) {
+        unmap();
+        throw;
+    }
+}
+
+IndexFile::~IndexFile() {
+    unmap();
+}
+
+IndexFile::IndexFile(IndexFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+IndexFile& IndexFile::operator=(IndexFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        mapping_ = std::exchange(other.mapping_, nullptr);
+        mapping_size_ = std::exchange(other.mapping_size_, 0);
+        label_ = other.label_;
+        text_ = other.text_;
+        unit_ = other.unit_;
+        width_ = other.width_;
+        char_count_ = other.char_count_;
+        suffix_count_ = std::exchange(other.suffix_count_, 0);
+        document_count_ = std::exchange(other.document_count_, 0);
+        sa_ = other.sa_;
+        lcp_ = other.lcp_;
+        documents_ = other.documents_;
+        block_chars_ = other.block_chars_;
+        char_samples_ = other.char_samples_;
+    }
+    return *this;
+}
+
+void IndexFile::unmap() {
+    if (mapping_ != nullptr) {
+        ::munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+        mapping_size_ = 0;
+    }
+}
+
+DocumentPosition IndexFile::document(size_t index) const {
+    const Document& doc = documents_[index];
+    return DocumentPosition{doc.sql_id, doc.start_pos, doc.length, doc.byte_start, doc.byte_length};
+}
+
+size_t IndexFile::document_index(size_t pos) const {
+    return unit_ == SuffixArrayBuilder::Unit::BYTE ? lookup(pos, text_.size(), &Document::byte_start, &Document::byte_length)
+                                                   : lookup(pos, char_count_, &Document::start_pos, &Document::length);
+}
+
+size_t IndexFile::document_index_by_byte(size_t byte_pos) const {
+    return lookup(byte_pos, text_.size(), &Document::byte_start, &Document::byte_length);
+}
+
+size_t IndexFile::lookup(size_t pos, size_t total, uint64_t Document::*start, uint64_t Document::*length) const {
+    if (pos >= total || document_count_ == 0) {
+        return DocumentStore::NO_DOCUMENT;
+    }
+
+    // Last document starting at or before pos
+    const Document* end = documents_ + document_count_;
+    const Document* it = std::upper_bound(documents_, end, pos, [start](size_t value, const Document& doc) {
+        return value < doc.*start;
+    });
+    if (it == documents_) {
+        return DocumentStore::NO_DOCUMENT;
+    }
+    const Document& doc = *--it;
+    if (it + 1 == end && pos >= doc.*start + doc.*length) {
+        // Separator after the last document
+        return DocumentStore::NO_DOCUMENT;
+    }
+    return static_cast<size_t>(it - documents_);
+}
+
+int64_t IndexFile::max_sql_id() const {
+    int64_t max = std::numeric_limits<int64_t>::min();
+    for (size_t i = 0; i < document_count_; ++i) {
+        max = std::max(max, documents_[i].sql_id);
+    }
+    return max;
+}
+
+size_t IndexFile::char_index(size_t byte_pos) const {
+    const size_t block = byte_pos / BLOCK_BYTES;
+    const size_t start = block * BLOCK_BYTES;
+    return block_chars_[block] + UTF8String::count_characters(text_.substr(start, byte_pos - start));
+}
+
+size_t IndexFile::byte_offset(size_t char_pos) const {
+    size_t pos = char_samples_[char_pos / BLOCK_CHARS];
+    for (size_t left = char_pos % BLOCK_CHARS; left > 0; --left) {
+        do {
+            pos++;
+        } while (pos < text_.size() && !is_char_start(static_cast<unsigned char>(text_[pos])));
+    }
+    return pos;
+}
+
+} // namespace text_processing
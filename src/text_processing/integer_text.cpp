@@ -0,0 +1,101 @@
+#include "text_processing/integer_text.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace text_processing {
+    namespace {
+        constexpr uint32_t MAX_CODE_POINT = 0x10FFFF;
+
+        /**
+         * @brief Decode the code point starting at pos and advance pos past it
+         *
+         * The input is already validated by UTF8String, so no checks are needed.
+         */
+        inline uint32_t decode(const unsigned char *bytes, size_t &pos) {
+            unsigned char first_byte = bytes[pos];
+            if (first_byte < 0x80) {
+                pos += 1;
+                return first_byte;
+            }
+            if ((first_byte & 0xE0) == 0xC0) {
+                uint32_t cp = ((first_byte & 0x1Fu) << 6) | (bytes[pos + 1] & 0x3Fu);
+                pos += 2;
+                return cp;
+            }
+            if ((first_byte & 0xF0) == 0xE0) {
+                uint32_t cp = ((first_byte & 0x0Fu) << 12) | ((bytes[pos + 1] & 0x3Fu) << 6) |
+                              (bytes[pos + 2] & 0x3Fu);
+                pos += 3;
+                return cp;
+            }
+            uint32_t cp = ((first_byte & 0x07u) << 18) | ((bytes[pos + 1] & 0x3Fu) << 12) |
+                          ((bytes[pos + 2] & 0x3Fu) << 6) | (bytes[pos + 3] & 0x3Fu);
+            pos += 4;
+            return cp;
+        }
+    } // namespace
+
+    IntegerText::IntegerText(const UTF8String &text) : length_(text.length()) {
+        const std::string &data = text.str();
+        const auto *bytes = reinterpret_cast<const unsigned char *>(data.data());
+
+        // First pass: collect the alphabet
+        std::vector<bool> seen(MAX_CODE_POINT + 1, false);
+        uint32_t max_cp = 0;
+        for (size_t pos = 0; pos < data.length();) {
+            uint32_t cp = decode(bytes, pos);
+            seen[cp] = true;
+            max_cp = std::max(max_cp, cp);
+        }
+
+        // Dense ranks in code point order, 0 is left for the sentinel
+        std::vector<uint32_t> rank_of(static_cast<size_t>(max_cp) + 1, 0);
+        for (uint32_t cp = 0; cp <= max_cp && !data.empty(); cp++) {
+            if (seen[cp]) {
+                alphabet_.push_back(cp);
+                rank_of[cp] = static_cast<uint32_t>(alphabet_.size());
+            }
+        }
+
+        // Second pass: write symbols in the narrowest type
+        if (alphabet_.size() < std::numeric_limits<uint8_t>::max() + 1u) {
+            width_ = Width::UINT8;
+            fill(u8_, data, rank_of);
+        } else if (alphabet_.size() < std::numeric_limits<uint16_t>::max() + 1u) {
+            width_ = Width::UINT16;
+            fill(u16_, data, rank_of);
+        } else {
+            width_ = Width::UINT32;
+            fill(u32_, data, rank_of);
+        }
+    }
+
+    template<typename Symbol>
+    void IntegerText::fill(std::vector<Symbol> &out, const std::string &data,
+                           const std::vector<uint32_t> &rank_of) {
+        const auto *bytes = reinterpret_cast<const unsigned char *>(data.data());
+        out.resize(length_ + 1);
+        size_t i = 0;
+        for (size_t pos = 0; pos < data.length();) {
+            out[i++] = static_cast<Symbol>(rank_of[decode(bytes, pos)]);
+        }
+        out[length_] = 0;
+    }
+
+    uint32_t IntegerText::operator[](size_t index) const {
+        if (index > length_) {
+            throw std::out_of_range("Symbol index out of range");
+        }
+        return visit([index](const auto *symbols) {
+            return static_cast<uint32_t>(symbols[index]);
+        });
+    }
+
+    uint32_t IntegerText::code_point(uint32_t symbol) const {
+        if (symbol == 0 || symbol > alphabet_.size()) {
+            throw std::out_of_range("Symbol not in alphabet");
+        }
+        return alphabet_[symbol - 1];
+    }
+} // namespace text_processing
@@ -0,0 +1,226 @@
+#include "text_processing/metrics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace text_processing {
+    namespace {
+        /**
+         * @brief Latency buckets per power of two
+         */
+        constexpr double BUCKETS_PER_DOUBLING = 16;
+
+        /**
+         * @brief Bucket of a duration: 0 below a microsecond, then 1/16 of a doubling each
+         */
+        size_t latency_bucket(double seconds) {
+            const double micros = seconds * 1e6;
+            if (!(micros >= 1)) {
+                return 0;
+            }
+            return 1 + static_cast<size_t>(std::log2(micros) * BUCKETS_PER_DOUBLING);
+        }
+
+        /**
+         * @brief Geometric middle of a bucket in seconds
+         */
+        double bucket_seconds(size_t bucket) {
+            if (bucket == 0) {
+                return 0.5e-6;
+            }
+            return std::exp2((static_cast<double>(bucket) - 0.5) / BUCKETS_PER_DOUBLING) * 1e-6;
+        }
+    } // namespace
+
+    double Metrics::Latency::percentile(double q) const {
+        if (count == 0) {
+            return 0;
+        }
+        const auto rank = static_cast<uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(count)));
+        uint64_t seen = 0;
+        for (size_t bucket = 0; bucket < buckets.size(); ++bucket) {
+            seen += buckets[bucket];
+            if (seen >= std::max<uint64_t>(rank, 1)) {
+                return std::min(bucket_seconds(bucket), max);
+            }
+        }
+        return max;
+    }
+
+    Metrics::Metrics(const Metrics &other) {
+        std::lock_guard<std::mutex> lock(other.mutex_);
+        info_ = other.info_;
+        phases_ = other.phases_;
+        counts_ = other.counts_;
+        peaks_ = other.peaks_;
+        latencies_ = other.latencies_;
+    }
+
+    Metrics &Metrics::operator=(const Metrics &other) {
+        if (this != &other) {
+            std::scoped_lock lock(mutex_, other.mutex_);
+            info_ = other.info_;
+            phases_ = other.phases_;
+            counts_ = other.counts_;
+            peaks_ = other.peaks_;
+            latencies_ = other.latencies_;
+        }
+        return *this;
+    }
+
+    void Metrics::add_time(const std::string &phase, double seconds) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Phase &entry = phases_[phase];
+        entry.seconds += seconds;
+        entry.calls++;
+    }
+
+    void Metrics::add_count(const std::string &name, uint64_t value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        counts_[name] += value;
+    }
+
+    void Metrics::record_peak(const std::string &structure, uint64_t bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        uint64_t &peak = peaks_[structure];
+        if (bytes > peak) peak = bytes;
+    }
+
+    void Metrics::record_latency(const std::string &operation, double seconds) {
+        const size_t bucket = latency_bucket(seconds);
+        std::lock_guard<std::mutex> lock(mutex_);
+        Latency &entry = latencies_[operation];
+        if (entry.buckets.size() <= bucket) {
+            entry.buckets.resize(bucket + 1);
+        }
+        entry.buckets[bucket]++;
+        entry.count++;
+        entry.seconds += seconds;
+        entry.max = std::max(entry.max, seconds);
+    }
+
+    void Metrics::set_info(const std::string &key, const std::string &value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        info_[key] = value;
+    }
+
+    Metrics::Phase Metrics::phase(const std::string &phase) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = phases_.find(phase);
+        return it == phases_.end() ? Phase{} : it->second;
+    }
+
+    uint64_t Metrics::count(const std::string &name) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = counts_.find(name);
+        return it == counts_.end() ? 0 : it->second;
+    }
+
+    uint64_t Metrics::peak(const std::string &structure) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = peaks_.find(structure);
+        return it == peaks_.end() ? 0 : it->second;
+    }
+
+    Metrics::Latency Metrics::latency(const std::string &operation) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = latencies_.find(operation);
+        return it == latencies_.end() ? Latency{} : it->second;
+    }
+
+    void Metrics::clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        info_.clear();
+        phases_.clear();
+        counts_.clear();
+        peaks_.clear();
+        latencies_.clear();
+    }
+
+    std::string Metrics::to_json() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::ostringstream json;
+        json << std::setprecision(6) << std::fixed;
+        auto entries = [&json](const char *name, const auto &map, auto &&write) {
+            json << json_string(name) << ": {";
+            bool first = true;
+            for (const auto &[key, value]: map) {
+                if (!first) json << ", ";
+                first = false;
+                json << json_string(key) << ": ";
+                write(value);
+            }
+            json << "}";
+        };
+        json << "{";
+        entries("info", info_, [&json](const std::string &value) { json << json_string(value); });
+        json << ", ";
+        entries("phases", phases_, [&json](const Phase &phase) {
+            json << "{\"seconds\": " << phase.seconds << ", \"calls\": " << phase.calls << "}";
+        });
+        json << ", ";
+        entries("counts", counts_, [&json](uint64_t value) { json << value; });
+        json << ", ";
+        entries("peak_bytes", peaks_, [&json](uint64_t value) { json << value; });
+        if (!latencies_.empty()) {
+            json << ", ";
+            entries("latencies", latencies_, [&json](const Latency &latency) {
+                json << "{\"count\": " << latency.count
+                     << ", \"p50_ms\": " << latency.percentile(0.5) * 1e3
+                     << ", \"p99_ms\": " << latency.percentile(0.99) * 1e3
+                     << ", \"max_ms\": " << latency.max * 1e3 << "}";
+            });
+        }
+        json << "}";
+        return json.str();
+    }
+
+    void Metrics::save(const std::string &filename) const {
+        write_json(filename, to_json());
+    }
+
+    void Metrics::write_json(const std::string &filename, const std::string &json) {
+        std::ofstream file(filename);
+        if (!file.is_open()) {
+            throw std::runtime_error("Unable to open file: " + filename);
+        }
+        file << json << "\n";
+        if (!file) {
+            throw std::runtime_error("Unable to write file: " + filename);
+        }
+    }
+
+    std::string Metrics::json_string(const std::string &value) {
+        std::string quoted = "\"";
+        for (char c: value) {
+            switch (c) {
+                case '"':
+                    quoted += "\\\"";
+                    break;
+                case '\\':
+                    quoted += "\\\\";
+                    break;
+                case '\n':
+                    quoted += "\\n";
+                    break;
+                case '\t':
+                    quoted += "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                        quoted += escaped;
+                    } else {
+                        quoted += c;
+                    }
+            }
+        }
+        return quoted + "\"";
+    }
+} // namespace text_processing
@@ -1,32 +1,48 @@
 #include "text_processing/naive_suffix_builder.hpp"
+#include "text_processing/kasai_lcp.hpp"
+#include <algorithm>
 #include <stdexcept>
-#include <map>
+#include <type_traits>
 
 namespace text_processing {
 
+namespace {
+    using Buffer = SuffixWorkspace::Buffer;
+
+    /**
+     * @brief Move the storage of an IndexVector out if it has this index type, leaving it empty
+     */
+    template<typename Index>
+    std::vector<Index> take_storage(IndexVector& values) {
+        std::vector<Index> storage;
+        values.visit([&storage](auto& typed) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(typed)>, std::vector<Index>>) {
+                storage.swap(typed);
+            }
+        });
+        values = IndexVector();
+        return storage;
+    }
+} // namespace
+
 bool NaiveSuffixBuilder::build(const UTF8String& text) {
+    return build_to_depth(text, 0);
+}
+
+bool NaiveSuffixBuilder::build_to_depth(const UTF8String& text, size_t depth) {
     try {
         validate_input(text);
-        text_ = text;
+        text_ = &text;
         is_built_ = false;
 
-        // Initialize vectors for sorting and equivalence classes
-        std::vector<size_t> p(text_.length());
-        std::vector<size_t> c(text_.length());
-
-        // Initial sorting of single characters
-        size_t classes = sort_characters(p, c);
-
-        // Main loop - sort by powers of 2
-        size_t len = 1;
-        while (len < text_.length()) {
-            classes = sort_doubled(len, p, c, classes);
-            len *= 2;
+        // One extra slot holds a virtual sentinel smaller than every character,
+        // so sorting cyclic shifts yields the order of the suffixes.
+        IntegerText symbols(text);
+        if (IndexVector::width_for(text.length() + 1) == IndexVector::Width::UINT32) {
+            build_arrays<uint32_t>(symbols, depth);
+        } else {
+            build_arrays<uint64_t>(symbols, depth);
         }
-
-        // Store final suffix array and build LCP array
-        suffix_array_ = std::move(p);
-        build_lcp_array();
         is_built_ = true;
         return true;
     } catch (const std::exception& e) {
@@ -35,122 +51,186 @@ bool NaiveSuffixBuilder::build(const UTF8String& text) {
     }
 }
 
-size_t NaiveSuffixBuilder::sort_characters(std::vector<size_t>& p, std::vector<size_t>& c) const {
-    const size_t n = text_.length();
+template<typename Index>
+void NaiveSuffixBuilder::build_arrays(const IntegerText& symbols, size_t depth) {
+    // The arrays of the previous build are overwritten, so their memory is reused
+    const size_t n = symbols.length() + 1;
+    std::vector<Index> p = take_storage<Index>(suffix_array_);
+    std::vector<Index> lcp = take_storage<Index>(lcp_array_);
+    p.resize(n);
+    auto& c = workspace_.get<Index>(Buffer::CLASSES, n);
 
-    // Map each unique character to an index
-    std::map<UTF8String::Character, size_t> char_index;
-    for (size_t i = 0; i < n; i++) {
-        char_index[text_[i]] = 0;  // Just insert to collect unique characters
-    }
+    // Initial sorting of the first characters, several at once for small alphabets
+    size_t len = packed_length(symbols.alphabet_size(), n, depth);
+    size_t classes = len > 1
+        ? symbols.visit([this, len, &symbols, &p](const auto* s) {
+              return sort_packed(s, symbols.alphabet_size(), len, p);
+          })
+        : sort_characters(symbols, p, c);
 
-    // Assign indices to characters
-    size_t idx = 0;
-    for (auto& pair : char_index) {
-        pair.second = idx++;
+    // Main loop - double the sorted length until the requested depth is reached
+    // or every suffix has its own class
+    while (len < n && classes < n && (depth == 0 || len < depth)) {
+        classes = sort_doubled(len, p, classes);
+        len *= 2;
     }
+    depth_limit_ = classes < n ? depth : 0;
+
+    // Drop the sentinel (always first), store suffix array and build LCP array
+    p.erase(p.begin());
+    auto& rank = workspace_.get<Index>(Buffer::ORDER, n - 1);
+    symbols.visit([this, &p, &c, &lcp, &rank](const auto* s) {
+        if (depth_limit_ == 0) {
+            kasai_lcp(s, p, lcp, rank);
+        } else {
+            capped_kasai_lcp(s, p, c, depth_limit_, lcp, rank);
+        }
+    });
+    suffix_array_ = IndexVector(std::move(p));
+    lcp_array_ = IndexVector(std::move(lcp));
+}
 
-    // Count characters using their indices
-    std::vector<size_t> cnt(char_index.size(), 0);
+template<typename Index>
+size_t NaiveSuffixBuilder::sort_characters(const IntegerText& symbols, std::vector<Index>& p,
+                                           std::vector<Index>& c) {
+    const size_t n = p.size();
+    const size_t classes = symbols.alphabet_size() + 1;
+
+    // Equivalence class of each position is its symbol, the sentinel is 0
+    symbols.visit([&c, n](const auto* s) {
+        for (size_t i = 0; i < n; i++) {
+            c[i] = s[i];
+        }
+    });
+
+    // Counting sort by symbol
+    auto& cnt = workspace_.get<Index>(Buffer::COUNTS, classes);
+    std::fill(cnt.begin(), cnt.end(), 0);
     for (size_t i = 0; i < n; i++) {
-        cnt[char_index[text_[i]]]++;
+        cnt[c[i]]++;
     }
 
-    for (size_t i = 1; i < char_index.size(); i++) {
+    for (size_t i = 1; i < classes; i++) {
         cnt[i] += cnt[i-1];
     }
 
+    for (size_t i = n; i > 0; i--) {
+        p[--cnt[c[i-1]]] = static_cast<Index>(i-1);
+    }
+
+    // Every symbol occurs in the text, so the classes are already dense
+    return classes;
+}
+
+size_t NaiveSuffixBuilder::packed_length(size_t alphabet_size, size_t n, size_t depth) {
+    // Codes index the counting sort buckets, which should stay cache-sized and below n
+    const size_t buckets = std::min(n, PACKED_BUCKETS);
+    const size_t radix = alphabet_size + 1;
+    size_t length = 1;
+    size_t codes = radix;
+    while (codes <= buckets / radix && (depth == 0 || length < depth)) {
+        codes *= radix;
+        length++;
+    }
+    return length;
+}
+
+template<typename Symbol, typename Index>
+size_t NaiveSuffixBuilder::sort_packed(const Symbol* s, size_t alphabet_size, size_t length,
+                                       std::vector<Index>& p) {
+    const size_t n = p.size();
+    const size_t radix = alphabet_size + 1;
+    size_t high = 1; // Weight of the first character of a code
+    for (size_t j = 1; j < length; j++) {
+        high *= radix;
+    }
+    auto& code = workspace_.get<Index>(Buffer::NEXT_CLASSES, n);
+    auto& cnt = workspace_.get<Index>(Buffer::COUNTS, high * radix);
+    std::fill(cnt.begin(), cnt.end(), 0);
+
+    // The code of a position packs its first length symbols in base radix.
+    // Symbols after the unique sentinel never decide a comparison, so they
+    // are taken as 0 instead of wrapping around like the cyclic shifts.
+    size_t current = 0;
+    for (size_t j = 0; j < length; j++) {
+        current = current * radix + (j < n ? s[j] : 0);
+    }
+    for (size_t i = 0; i < n; i++) {
+        code[i] = static_cast<Index>(current);
+        cnt[current]++;
+        const size_t next = i + length < n ? s[i + length] : 0;
+        current = (current - s[i] * high) * radix + next;
+    }
+
+    // Counting sort by code
+    size_t start = 0;
+    for (auto& count : cnt) {
+        const size_t bucket = count;
+        count = static_cast<Index>(start);
+        start += bucket;
+    }
     for (size_t i = 0; i < n; i++) {
-        p[--cnt[char_index[text_[i]]]] = i;
+        p[cnt[code[i]]++] = static_cast<Index>(i);
     }
 
-    // Assign equivalence classes
+    // Dense equivalence classes in sorted order
+    auto& c = workspace_.get<Index>(Buffer::CLASSES, n);
     c[p[0]] = 0;
     size_t classes = 1;
-
     for (size_t i = 1; i < n; i++) {
-        if (text_[p[i]] != text_[p[i-1]]) {
+        if (code[p[i]] != code[p[i-1]]) {
             classes++;
         }
-        c[p[i]] = classes - 1;
+        c[p[i]] = static_cast<Index>(classes - 1);
     }
-
     return classes;
 }
 
-size_t NaiveSuffixBuilder::sort_doubled(const size_t k, std::vector<size_t>& p,
-                                        std::vector<size_t>& c, size_t classes) const {
-    const size_t n = text_.length();
-    std::vector<size_t> cnt(classes, 0);
-    std::vector<size_t> pn(n);
-    std::vector<size_t> cn(n);
-    
-    // Sort by second element
+template<typename Index>
+size_t NaiveSuffixBuilder::sort_doubled(const size_t k, std::vector<Index>& p, size_t classes) {
+    const size_t n = p.size();
+    const auto& c = workspace_.get<Index>(Buffer::CLASSES, n);
+    auto& pn = workspace_.get<Index>(Buffer::ORDER, n);
+    auto& cn = workspace_.get<Index>(Buffer::NEXT_CLASSES, n);
+    auto& cnt = workspace_.get<Index>(Buffer::COUNTS, classes);
+    std::fill(cnt.begin(), cnt.end(), 0);
+
+    // Sort by second element, the shift wraps around without a division
     for (size_t i = 0; i < n; i++) {
-        pn[i] = (p[i] + n - k) % n;
+        pn[i] = static_cast<Index>(p[i] >= k ? p[i] - k : p[i] + n - k);
     }
-    
+
     // Count sort by first element
     for (size_t i = 0; i < n; i++) {
         cnt[c[pn[i]]]++;
     }
-    
+
     for (size_t i = 1; i < classes; i++) {
         cnt[i] += cnt[i-1];
     }
-    
+
     for (size_t i = n; i > 0; i--) {
         p[--cnt[c[pn[i-1]]]] = pn[i-1];
     }
-    
+
     // Update equivalence classes
     cn[p[0]] = 0;
     classes = 1;
-    
+
+    auto second = [k, n](size_t i) { return i + k < n ? i + k : i + k - n; };
+    std::pair<Index, Index> prev = {c[p[0]], c[second(p[0])]};
     for (size_t i = 1; i < n; i++) {
-        std::pair<size_t, size_t> cur = {c[p[i]], c[(p[i] + k) % n]};
-        std::pair<size_t, size_t> prev = {c[p[i-1]], c[(p[i-1] + k) % n]};
-        
+        std::pair<Index, Index> cur = {c[p[i]], c[second(p[i])]};
+
         if (cur != prev) {
             classes++;
         }
-        cn[p[i]] = classes - 1;
+        cn[p[i]] = static_cast<Index>(classes - 1);
+        prev = cur;
     }
-    
-    c = std::move(cn);
-    return classes;
-}
 
-void NaiveSuffixBuilder::build_lcp_array() {
-    const size_t n = text_.length();
-    std::vector<size_t> rank = create_rank_array();
-    lcp_array_.resize(n - 1);
-    
-    // Kasai's algorithm
-    size_t k = 0;
-    for (size_t i = 0; i < n; i++) {
-        if (rank[i] == n - 1) {
-            k = 0;
-            continue;
-        }
-        
-        size_t j = suffix_array_[rank[i] + 1];
-        while (i + k < n && j + k < n && 
-               text_[i + k] == text_[j + k]) {
-            k++;
-        }
-        
-        lcp_array_[rank[i]] = k;
-        if (k > 0) k--;
-    }
-}
-
-std::vector<size_t> NaiveSuffixBuilder::create_rank_array() const {
-    std::vector<size_t> rank(text_.length());
-    for (size_t i = 0; i < text_.length(); i++) {
-        rank[suffix_array_[i]] = i;
-    }
-    return rank;
+    workspace_.swap(Buffer::CLASSES, Buffer::NEXT_CLASSES);
+    return classes;
 }
 
 void NaiveSuffixBuilder::validate_input(const UTF8String& text) {
@@ -159,14 +239,14 @@ void NaiveSuffixBuilder::validate_input(const UTF8String& text) {
     }
 }
 
-const std::vector<size_t>& NaiveSuffixBuilder::get_array() const {
+const IndexVector& NaiveSuffixBuilder::get_array() const {
     if (!is_built_) {
         throw std::runtime_error("Suffix array not built");
     }
     return suffix_array_;
 }
 
-const std::vector<size_t>& NaiveSuffixBuilder::get_lcp_array() const {
+const IndexVector& NaiveSuffixBuilder::get_lcp_array() const {
     if (!is_built_) {
         throw std::runtime_error("LCP array not built");
     }
@@ -174,11 +254,12 @@ const std::vector<size_t>& NaiveSuffixBuilder::get_lcp_array() const {
 }
 
 const UTF8String& NaiveSuffixBuilder::get_text() const {
-    return text_;
+    static const UTF8String empty;
+    return text_ ? *text_ : empty;
 }
 
 bool NaiveSuffixBuilder::is_built() const {
     return is_built_;
 }
 
-} // namespace text_processing
\ No newline at end of file
+} // namespace text_processing
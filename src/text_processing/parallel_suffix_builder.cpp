@@ -0,0 +1,272 @@
+#include "text_processing/parallel_suffix_builder.hpp"
+#include "text_processing/kasai_lcp.hpp"
+#include "text_processing/parallel.hpp"
+#include <limits>
+#include <stdexcept>
+
+namespace text_processing {
+
+namespace {
+    /**
+     * @brief Groups at least this large are sorted and split with all threads
+     */
+    constexpr size_t LARGE_GROUP = 1 << 15;
+
+    /**
+     * @brief Small groups handed to a thread at a time
+     */
+    constexpr size_t GROUP_BATCH = 256;
+} // namespace
+
+ParallelSuffixBuilder::ParallelSuffixBuilder(size_t threads)
+    : threads_(resolve_threads(threads)) {
+}
+
+bool ParallelSuffixBuilder::build(const UTF8String& text) {
+    try {
+        validate_input(text);
+        text_ = text;
+        is_built_ = false;
+
+        IntegerText symbols(text_);
+        if (IndexVector::width_for(text_.length() + 1) == IndexVector::Width::UINT32) {
+            build_arrays<uint32_t>(symbols);
+        } else {
+            build_arrays<uint64_t>(symbols);
+        }
+        is_built_ = true;
+        return true;
+    } catch (const std::exception& e) {
+        is_built_ = false;
+        throw std::runtime_error(std::string("Failed to build suffix array: ") + e.what());
+    }
+}
+
+template<typename Index>
+void ParallelSuffixBuilder::build_arrays(const IntegerText& symbols) {
+    // One extra position holds the sentinel, which ends every comparison
+    const size_t n = text_.length() + 1;
+    std::vector<Index> p(n);
+    std::vector<Index> rank(n);
+
+    auto groups = sort_characters(symbols, p, rank);
+    for (size_t h = 1; !groups.empty(); h *= 2) {
+        sort_doubled(h, p, rank, groups);
+    }
+    rank = std::vector<Index>();
+
+    // Drop the sentinel (always first), store suffix array and build LCP array
+    p.erase(p.begin());
+    std::vector<Index> lcp;
+    symbols.visit([this, &p, &lcp](const auto* s) {
+        parallel_plcp_lcp(s, p, lcp, threads_);
+    });
+    suffix_array_ = IndexVector(std::move(p));
+    lcp_array_ = IndexVector(std::move(lcp));
+}
+
+template<typename Index>
+std::vector<std::pair<Index, Index>> ParallelSuffixBuilder::sort_characters(
+    const IntegerText& symbols, std::vector<Index>& p, std::vector<Index>& rank) const {
+    const size_t n = p.size();
+    const size_t k = symbols.alphabet_size() + 1;
+
+    // Per-thread histograms only pay off while they are small next to the text
+    const size_t chunks = std::min(threads_, std::max<size_t>(n / k, 1));
+    std::vector<std::vector<Index>> counts(chunks, std::vector<Index>(k, 0));
+    symbols.visit([&](const auto* s) {
+        parallel_for(0, n, chunks, [&](size_t begin, size_t end, size_t chunk) {
+            auto& count = counts[chunk];
+            for (size_t i = begin; i < end; i++) {
+                count[s[i]]++;
+            }
+        });
+    });
+
+    // Bucket starts, then each chunk's write offset inside every bucket
+    std::vector<Index> bucket(k);
+    std::vector<std::pair<Index, Index>> groups;
+    size_t sum = 0;
+    for (size_t symbol = 0; symbol < k; symbol++) {
+        bucket[symbol] = static_cast<Index>(sum);
+        size_t begin = sum;
+        for (auto& count : counts) {
+            size_t c = count[symbol];
+            count[symbol] = static_cast<Index>(sum);
+            sum += c;
+        }
+        if (sum - begin > 1) {
+            groups.emplace_back(static_cast<Index>(begin), static_cast<Index>(sum));
+        }
+    }
+
+    // Stable scatter: chunk order and position order inside a chunk are kept
+    symbols.visit([&](const auto* s) {
+        parallel_for(0, n, chunks, [&](size_t begin, size_t end, size_t chunk) {
+            auto& offset = counts[chunk];
+            for (size_t i = begin; i < end; i++) {
+                p[offset[s[i]]++] = static_cast<Index>(i);
+                rank[i] = bucket[s[i]];
+            }
+        });
+    });
+    return groups;
+}
+
+template<typename Index>
+void ParallelSuffixBuilder::sort_doubled(const size_t h, std::vector<Index>& p, std::vector<Index>& rank,
+                                         std::vector<std::pair<Index, Index>>& groups) const {
+    using Group = std::pair<Index, Index>;
+    using Entry = std::pair<Index, Index>; // (rank h positions ahead, position)
+    auto by_key = [](const Entry& a, const Entry& b) { return a.first < b.first; };
+
+    // Entries of group g live at keys[offset[g]..); only unsorted groups need them
+    std::vector<size_t> offset(groups.size() + 1, 0);
+    std::vector<size_t> large;
+    for (size_t g = 0; g < groups.size(); g++) {
+        size_t size = groups[g].second - groups[g].first;
+        offset[g + 1] = offset[g] + size;
+        if (size >= LARGE_GROUP) {
+            large.push_back(g);
+        }
+    }
+    std::vector<Entry> keys(offset.back());
+
+    // Every suffix in an unsorted group is longer than h (its first h symbols
+    // do not contain the sentinel), so p[j] + h is always a valid position
+    auto load = [&](size_t g, size_t begin, size_t end) {
+        const Index l = groups[g].first;
+        Entry* out = keys.data() + offset[g];
+        for (size_t j = begin; j < end; j++) {
+            out[j - l] = {rank[p[j] + h], p[j]};
+        }
+    };
+    auto store = [&](size_t g, size_t begin, size_t end) {
+        const Index l = groups[g].first;
+        const Entry* in = keys.data() + offset[g];
+        for (size_t j = begin; j < end; j++) {
+            p[j] = in[j - l].second;
+        }
+    };
+
+    // Sort: small groups spread over the threads, large ones sorted by all of them
+    const size_t batches = (groups.size() + GROUP_BATCH - 1) / GROUP_BATCH;
+    parallel_for_each_dynamic(batches, threads_, [&](size_t batch) {
+        size_t end = std::min(groups.size(), (batch + 1) * GROUP_BATCH);
+        for (size_t g = batch * GROUP_BATCH; g < end; g++) {
+            size_t l = groups[g].first;
+            size_t r = groups[g].second;
+            if (r - l >= LARGE_GROUP) continue;
+            load(g, l, r);
+            std::sort(keys.begin() + offset[g], keys.begin() + offset[g + 1], by_key);
+            store(g, l, r);
+        }
+    });
+    for (size_t g : large) {
+        size_t l = groups[g].first;
+        size_t r = groups[g].second;
+        parallel_for(l, r, threads_, [&](size_t begin, size_t end, size_t) { load(g, begin, end); });
+        parallel_sort(keys.begin() + offset[g], keys.begin() + offset[g + 1], threads_, by_key);
+        parallel_for(l, r, threads_, [&](size_t begin, size_t end, size_t) { store(g, begin, end); });
+    }
+
+    // Split every group into runs of equal keys. The new rank of a suffix is
+    // the start of its run; runs of more than one suffix stay unsorted. Ranks
+    // are only rewritten here, after every key of this round has been read.
+    auto split = [&](size_t g, size_t begin, size_t end, size_t start, std::vector<Group>& out) {
+        const size_t l = groups[g].first;
+        const size_t r = groups[g].second;
+        const Entry* in = keys.data() + offset[g];
+        for (size_t j = begin; j < end; j++) {
+            if (j > l && in[j - l].first != in[j - l - 1].first) {
+                start = j;
+            }
+            rank[p[j]] = static_cast<Index>(start);
+            bool run_ends = j + 1 == r || in[j + 1 - l].first != in[j - l].first;
+            if (run_ends && j > start) {
+                out.emplace_back(static_cast<Index>(start), static_cast<Index>(j + 1));
+            }
+        }
+    };
+
+    const size_t chunks = resolve_threads(threads_);
+    std::vector<std::vector<Group>> next(chunks);
+    parallel_for(0, groups.size(), chunks, [&](size_t begin, size_t end, size_t chunk) {
+        for (size_t g = begin; g < end; g++) {
+            if (groups[g].second - groups[g].first < LARGE_GROUP) {
+                split(g, groups[g].first, groups[g].second, groups[g].first, next[chunk]);
+            }
+        }
+    });
+
+    std::vector<Group> result;
+    for (const auto& part : next) {
+        result.insert(result.end(), part.begin(), part.end());
+    }
+
+    for (size_t g : large) {
+        // Find where the run containing each chunk's first entry starts,
+        // then split the chunks independently
+        const size_t l = groups[g].first;
+        const size_t r = groups[g].second;
+        const size_t parts = std::min(chunks, r - l);
+        const Entry* in = keys.data() + offset[g];
+        auto part_begin = [l, r, parts](size_t part) { return l + (r - l) * part / parts; };
+        std::vector<size_t> part_start(parts, l);
+        parallel_for(1, parts, parts, [&](size_t begin, size_t end, size_t) {
+            for (size_t part = begin; part < end; part++) {
+                size_t prev = part_begin(part - 1);
+                size_t j = part_begin(part);
+                while (j > prev && in[j - l].first == in[j - l - 1].first) {
+                    j--;
+                }
+                // Reaching the previous chunk start means the run began there or earlier
+                part_start[part] = j > prev ? j : std::numeric_limits<size_t>::max();
+            }
+        });
+        for (size_t part = 1; part < parts; part++) {
+            if (part_start[part] == std::numeric_limits<size_t>::max()) {
+                part_start[part] = part_start[part - 1];
+            }
+        }
+
+        std::vector<std::vector<Group>> runs(parts);
+        parallel_for(l, r, parts, [&](size_t begin, size_t end, size_t part) {
+            split(g, begin, end, part_start[part], runs[part]);
+        });
+        for (const auto& part : runs) {
+            result.insert(result.end(), part.begin(), part.end());
+        }
+    }
+    groups = std::move(result);
+}
+
+void ParallelSuffixBuilder::validate_input(const UTF8String& text) {
+    if (text.length() == 0) {
+        throw std::runtime_error("Empty string provided");
+    }
+}
+
+const IndexVector& ParallelSuffixBuilder::get_array() const {
+    if (!is_built_) {
+        throw std::runtime_error("Suffix array not built");
+    }
+    return suffix_array_;
+}
+
+const IndexVector& ParallelSuffixBuilder::get_lcp_array() const {
+    if (!is_built_) {
+        throw std::runtime_error("LCP array not built");
+    }
+    return lcp_array_;
+}
+
+const UTF8String& ParallelSuffixBuilder::get_text() const {
+    return text_;
+}
+
+bool ParallelSuffixBuilder::is_built() const {
+    return is_built_;
+}
+
+} // namespace text_processing
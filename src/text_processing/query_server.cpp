@@ -0,0 +1,374 @@
+#include "text_processing/query_server.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include "text_processing/parallel.hpp"
+
+namespace text_processing {
+    namespace {
+        /**
+         * @brief Reads the flat JSON object of a request line
+         */
+        class RequestParser {
+        public:
+            explicit RequestParser(const std::string &line) : line_(line) {
+            }
+
+            QueryRequest parse() {
+                QueryRequest request;
+                expect('{');
+                if (!consume('}')) {
+                    do {
+                        const std::string key = string();
+                        expect(':');
+                        skip_space();
+                        if (key == "threshold") {
+                            request.threshold = number();
+                        } else if (key == "id" && peek() != '"') {
+                            // Numeric IDs are echoed as strings
+                            request.id = std::to_string(number());
+                        } else if (key == "id" || key == "domain" || key == "text" || key == "command") {
+                            std::string value = string();
+                            if (key == "id") request.id = std::move(value);
+                            else if (key == "domain") request.domain = std::move(value);
+                            else if (key == "text") request.text = std::move(value);
+                            else request.command = std::move(value);
+                        } else {
+                            skip_value();
+                        }
+                    } while (consume(','));
+                    expect('}');
+                }
+                skip_space();
+                if (pos_ != line_.size()) {
+                    fail("trailing characters");
+                }
+                return request;
+            }
+
+        private:
+            const std::string &line_;
+            size_t pos_ = 0;
+
+            [[noreturn]] void fail(const std::string &what) const {
+                throw std::invalid_argument("Invalid request at character " + std::to_string(pos_) + ": " + what);
+            }
+
+            void skip_space() {
+                while (pos_ < line_.size() && (line_[pos_] == ' ' || line_[pos_] == '\t' || line_[pos_] == '\r')) {
+                    ++pos_;
+                }
+            }
+
+            char peek() {
+                skip_space();
+                return pos_ < line_.size() ? line_[pos_] : '\0';
+            }
+
+            bool consume(char c) {
+                if (peek() == c) {
+                    ++pos_;
+                    return true;
+                }
+                return false;
+            }
+
+            void expect(char c) {
+                if (!consume(c)) {
+                    fail(std::string("expected '") + c + "'");
+                }
+            }
+
+            size_t number() {
+                skip_space();
+                const size_t start = pos_;
+                size_t value = 0;
+                while (pos_ < line_.size() && line_[pos_] >= '0' && line_[pos_] <= '9') {
+                    const auto digit = static_cast<size_t>(line_[pos_++] - '0');
+                    if (value > (SIZE_MAX - digit) / 10) {
+                        fail("number too large");
+                    }
+                    value = value * 10 + digit;
+                }
+                if (pos_ == start) {
+                    fail("expected a non-negative integer");
+                }
+                return value;
+            }
+
+            unsigned hex4() {
+                if (pos_ + 4 > line_.size()) {
+                    fail("truncated \\u escape");
+                }
+                unsigned value = 0;
+                for (int i = 0; i < 4; ++i) {
+                    const char c = line_[pos_++];
+                    value <<= 4;
+                    if (c >= '0' && c <= '9') value |= static_cast<unsigned>(c - '0');
+                    else if (c >= 'a' && c <= 'f') value |= static_cast<unsigned>(c - 'a' + 10);
+                    else if (c >= 'A' && c <= 'F') value |= static_cast<unsigned>(c - 'A' + 10);
+                    else fail("invalid \\u escape");
+                }
+                return value;
+            }
+
+            static void append_utf8(std::string &out, unsigned code) {
+                if (code < 0x80) {
+                    out += static_cast<char>(code);
+                } else if (code < 0x800) {
+                    out += static_cast<char>(0xC0 | code >> 6);
+                    out += static_cast<char>(0x80 | (code & 0x3F));
+                } else if (code < 0x10000) {
+                    out += static_cast<char>(0xE0 | code >> 12);
+                    out += static_cast<char>(0x80 | (code >> 6 & 0x3F));
+                    out += static_cast<char>(0x80 | (code & 0x3F));
+                } else {
+                    out += static_cast<char>(0xF0 | code >> 18);
+                    out += static_cast<char>(0x80 | (code >> 12 & 0x3F));
+                    out += static_cast<char>(0x80 | (code >> 6 & 0x3F));
+                    out += static_cast<char>(0x80 | (code & 0x3F));
+                }
+            }
+
+            std::string string() {
+                expect('"');
+                std::string value;
+                while (true) {
+                    if (pos_ >= line_.size()) {
+                        fail("unterminated string");
+                    }
+                    const char c = line_[pos_++];
+                    if (c == '"') {
+                        return value;
+                    }
+                    if (c != '\\') {
+                        value += c;
+                        continue;
+                    }
+                    if (pos_ >= line_.size()) {
+                        fail("unterminated string");
+                    }
+                    switch (const char escaped = line_[pos_++]) {
+                        case '"':
+                        case '\\':
+                        case '/':
+                            value += escaped;
+                            break;
+                        case 'b':
+                            value += '\b';
+                            break;
+                        case 'f':
+                            value += '\f';
+                            break;
+                        case 'n':
+                            value += '\n';
+                            break;
+                        case 'r':
+                            value += '\r';
+                            break;
+                        case 't':
+                            value += '\t';
+                            break;
+                        case 'u': {
+                            unsigned code = hex4();
+                            if (code >= 0xD800 && code < 0xDC00) {
+                                // High surrogate, combined with the low one that must follow
+                                if (line_.compare(pos_, 2, "\\u") != 0) {
+                                    fail("unpaired surrogate");
+                                }
+                                pos_ += 2;
+                                const unsigned low = hex4();
+                                if (low < 0xDC00 || low >= 0xE000) {
+                                    fail("unpaired surrogate");
+                                }
+                                code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                            } else if (code >= 0xDC00 && code < 0xE000) {
+                                fail("unpaired surrogate");
+                            }
+                            append_utf8(value, code);
+                            break;
+                        }
+                        default:
+                            fail("invalid escape");
+                    }
+                }
+            }
+
+            void skip_value() {
+                const char c = peek();
+                if (c == '"') {
+                    (void) string();
+                } else if (c == '-' || (c >= '0' && c <= '9')) {
+                    pos_++;
+                    while (pos_ < line_.size() && std::string_view("0123456789.eE+-").find(line_[pos_]) != std::string_view::npos) {
+                        ++pos_;
+                    }
+                } else if (line_.compare(pos_, 4, "true") == 0 || line_.compare(pos_, 4, "null") == 0) {
+                    pos_ += 4;
+                } else if (line_.compare(pos_, 5, "false") == 0) {
+                    pos_ += 5;
+                } else {
+                    fail("only strings, numbers, true, false and null are accepted");
+                }
+            }
+        };
+    } // namespace
+
+    QueryRequest QueryRequest::parse(const std::string &line) {
+        return RequestParser(line).parse();
+    }
+
+    std::string QueryResponse::to_json() const {
+        std::ostringstream json;
+        json << "{\"id\": " << Metrics::json_string(id);
+        if (!error.empty()) {
+            json << ", \"error\": " << Metrics::json_string(error);
+        } else if (!body.empty()) {
+            json << ", \"stats\": " << body;
+        } else {
+            json << ", \"hits\": [";
+            for (size_t i = 0; i < hits.size(); ++i) {
+                if (i > 0) json << ", ";
+                json << hits[i].to_json();
+            }
+            json << "]";
+        }
+        json << "}";
+        return json.str();
+    }
+
+    QueryServer::QueryServer(const QueryServerOptions &options) : options_(options) {
+        options_.threads = resolve_threads(options.threads);
+        options_.batch_size = std::max<size_t>(options.batch_size, 1);
+    }
+
+    void QueryServer::add_index(const std::string &path) {
+        Corpus corpus;
+        corpus.index = std::make_unique<IndexFile>(path);
+        std::string label(corpus.index->label());
+        if (corpora_.count(label) > 0) {
+            throw std::runtime_error("Index " + path + " has the label " + label + " of an index already loaded");
+        }
+        try {
+            corpus.query = std::make_unique<CorpusQuery>(*corpus.index);
+        } catch (const std::invalid_argument &e) {
+            throw std::runtime_error(e.what());
+        }
+        corpora_.emplace(std::move(label), std::move(corpus));
+    }
+
+    std::vector<std::string> QueryServer::domains() const {
+        std::vector<std::string> labels;
+        for (const auto &[label, corpus]: corpora_) {
+            labels.push_back(label);
+        }
+        return labels;
+    }
+
+    QueryResponse QueryServer::answer_one(const QueryRequest &request) const {
+        QueryResponse response;
+        response.id = request.id;
+        if (request.command == "stats") {
+            response.body = options_.metrics ? options_.metrics->to_json() : "{}";
+            return response;
+        }
+        if (!request.command.empty()) {
+            response.error = "Unknown command " + request.command;
+            return response;
+        }
+        auto corpus = request.domain.empty() && corpora_.size() == 1
+                          ? corpora_.begin()
+                          : corpora_.find(request.domain);
+        if (corpus == corpora_.end()) {
+            response.error = "No index loaded for domain " + request.domain;
+            return response;
+        }
+        try {
+            response.hits = corpus->second.query->find(
+                request.text, request.threshold > 0 ? request.threshold : options_.threshold);
+        } catch (const std::exception &e) {
+            response.error = e.what();
+        }
+        return response;
+    }
+
+    std::vector<QueryResponse> QueryServer::answer(const std::vector<QueryRequest> &requests) const {
+        ScopedTimer timer(options_.metrics, "answer_batch");
+        std::vector<QueryResponse> responses(requests.size());
+        parallel_for_each_dynamic(requests.size(), options_.threads, [&](size_t i) {
+            responses[i] = answer_one(requests[i]);
+        });
+        timer.stop();
+        if (options_.metrics) {
+            size_t hits = 0;
+            size_t errors = 0;
+            for (const auto &response: responses) {
+                hits += response.hits.size();
+                errors += !response.error.empty();
+            }
+            options_.metrics->add_count("queries", requests.size());
+            options_.metrics->add_count("batches", 1);
+            options_.metrics->add_count("query_hits", hits);
+            options_.metrics->add_count("query_errors", errors);
+        }
+        return responses;
+    }
+
+    size_t QueryServer::serve(std::istream &in, std::ostream &out) const {
+        using Clock = std::chrono::steady_clock;
+        size_t answered = 0;
+        std::vector<QueryRequest> requests;
+        std::vector<std::string> errors; ///< Parse error of every line, empty for the lines in requests
+        std::vector<Clock::time_point> arrivals;
+        std::string line;
+        // Block for the first request of a batch, then take the ones already buffered
+        while (std::getline(in, line)) {
+            requests.clear();
+            errors.clear();
+            arrivals.clear();
+            do {
+                if (line.empty() || line == "\r") {
+                    continue;
+                }
+                arrivals.push_back(Clock::now());
+                try {
+                    requests.push_back(QueryRequest::parse(line));
+                    errors.emplace_back();
+                } catch (const std::invalid_argument &e) {
+                    errors.emplace_back(e.what());
+                }
+            } while (errors.size() < options_.batch_size && in.rdbuf()->in_avail() > 0 && std::getline(in, line));
+            if (errors.empty()) {
+                continue;
+            }
+
+            const auto responses = answer(requests);
+            size_t next = 0;
+            for (const auto &error: errors) {
+                if (error.empty()) {
+                    out << responses[next++].to_json() << '\n';
+                } else {
+                    QueryResponse invalid;
+                    invalid.error = error;
+                    out << invalid.to_json() << '\n';
+                }
+            }
+            out.flush();
+            if (options_.metrics) {
+                const auto written = Clock::now();
+                for (const auto &arrival: arrivals) {
+                    const std::chrono::duration<double> elapsed = written - arrival;
+                    options_.metrics->record_latency("query", elapsed.count());
+                }
+                options_.metrics->add_count("query_errors", errors.size() - requests.size());
+            }
+            answered += errors.size();
+        }
+        return answered;
+    }
+} // namespace text_processing
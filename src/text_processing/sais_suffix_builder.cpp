@@ -0,0 +1,76 @@
+#include "text_processing/sais_suffix_builder.hpp"
+#include "text_processing/integer_text.hpp"
+#include "text_processing/kasai_lcp.hpp"
+#include "text_processing/sais.hpp"
+#include <stdexcept>
+
+namespace text_processing {
+
+bool SAISSuffixBuilder::build(const UTF8String& text) {
+    try {
+        validate_input(text);
+        text_ = text;
+        is_built_ = false;
+
+        IntegerText symbols(text_);
+        if (IndexVector::width_for(text_.length() + 1) == IndexVector::Width::UINT32) {
+            build_arrays<uint32_t>(symbols);
+        } else {
+            build_arrays<uint64_t>(symbols);
+        }
+        is_built_ = true;
+        return true;
+    } catch (const std::exception& e) {
+        is_built_ = false;
+        throw std::runtime_error(std::string("Failed to build suffix array: ") + e.what());
+    }
+}
+
+template<typename Index>
+void SAISSuffixBuilder::build_arrays(const IntegerText& symbols) {
+    const size_t n = text_.length();
+
+    // The sentinel is always the smallest suffix and is dropped
+    std::vector<Index> sa(n + 1);
+    symbols.visit([&sa, n, &symbols](const auto* s) {
+        sais(s, sa.data(), n + 1, symbols.alphabet_size() + 1);
+    });
+    sa.erase(sa.begin());
+
+    std::vector<Index> lcp;
+    symbols.visit([&sa, &lcp](const auto* s) {
+        kasai_lcp(s, sa, lcp);
+    });
+    suffix_array_ = IndexVector(std::move(sa));
+    lcp_array_ = IndexVector(std::move(lcp));
+}
+
+void SAISSuffixBuilder::validate_input(const UTF8String& text) {
+    if (text.length() == 0) {
+        throw std::runtime_error("Empty string provided");
+    }
+}
+
+const IndexVector& SAISSuffixBuilder::get_array() const {
+    if (!is_built_) {
+        throw std::runtime_error("Suffix array not built");
+    }
+    return suffix_array_;
+}
+
+const IndexVector& SAISSuffixBuilder::get_lcp_array() const {
+    if (!is_built_) {
+        throw std::runtime_error("LCP array not built");
+    }
+    return lcp_array_;
+}
+
+const UTF8String& SAISSuffixBuilder::get_text() const {
+    return text_;
+}
+
+bool SAISSuffixBuilder::is_built() const {
+    return is_built_;
+}
+
+} // namespace text_processing
@@ -1,13 +1,50 @@
 #include "text_processing/suffix_array_builder.hpp"
 #include "text_processing/naive_suffix_builder.hpp"
+#include "text_processing/sais_suffix_builder.hpp"
+#include "text_processing/byte_suffix_builder.hpp"
+#include "text_processing/parallel_suffix_builder.hpp"
+#include "text_processing/external_suffix_builder.hpp"
 
 namespace text_processing {
-    std::unique_ptr<SuffixArrayBuilder> SuffixArrayBuilder::create(BuilderType type) {
+    std::unique_ptr<SuffixArrayBuilder> SuffixArrayBuilder::create(BuilderType type, size_t threads) {
+        Options options;
+        options.threads = threads;
+        return create(type, options);
+    }
+
+    std::unique_ptr<SuffixArrayBuilder> SuffixArrayBuilder::create(BuilderType type, const Options &options) {
         switch (type) {
             case BuilderType::NAIVE:
-                return std::make_unique<NaiveSuffixBuilder>();
+                return std::make_unique<NaiveSuffixBuilder>(options.huge_pages);
+            case BuilderType::SAIS:
+                return std::make_unique<SAISSuffixBuilder>();
+            case BuilderType::BYTE:
+                return std::make_unique<ByteSuffixBuilder>();
+            case BuilderType::PARALLEL:
+                return std::make_unique<ParallelSuffixBuilder>(options.threads);
+            case BuilderType::EXTERNAL:
+                return std::make_unique<ExternalSuffixBuilder>(options.memory_budget, options.scratch_dir);
             default:
                 throw std::invalid_argument("Unknown builder type");
         }
     }
+
+    SuffixArrayBuilder::BuilderType SuffixArrayBuilder::type_from_string(const std::string &name) {
+        if (name == "naive") {
+            return BuilderType::NAIVE;
+        }
+        if (name == "sais") {
+            return BuilderType::SAIS;
+        }
+        if (name == "byte") {
+            return BuilderType::BYTE;
+        }
+        if (name == "parallel") {
+            return BuilderType::PARALLEL;
+        }
+        if (name == "external") {
+            return BuilderType::EXTERNAL;
+        }
+        throw std::invalid_argument("Unknown builder type: " + name);
+    }
 } // namespace text_processing
\ No newline at end of file
@@ -0,0 +1,23 @@
+#include "text_processing/suffix_workspace.hpp"
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace text_processing {
+    void SuffixWorkspace::advise(void *data, size_t bytes) const {
+        if (!huge_pages_ || bytes < HUGE_PAGE_BYTES) {
+            return;
+        }
+#ifdef MADV_HUGEPAGE
+        // madvise() takes whole pages, the allocation may start inside one
+        const auto page = static_cast<uintptr_t>(::sysconf(_SC_PAGESIZE));
+        const auto begin = (reinterpret_cast<uintptr_t>(data) + page - 1) / page * page;
+        const auto end = (reinterpret_cast<uintptr_t>(data) + bytes) / page * page;
+        if (begin < end) {
+            // A refused hint leaves ordinary pages
+            (void) ::madvise(reinterpret_cast<void *>(begin), end - begin, MADV_HUGEPAGE);
+        }
+#else
+        (void) data;
+#endif
+    }
+} // namespace text_processing
@@ -1,4 +1,15 @@
 #include "text_processing/utf8_handler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define UTF8_SIMD_X86 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define UTF8_SIMD_NEON 1
+#endif
 
 namespace text_processing {
     // Character class implementations
@@ -50,33 +61,29 @@ namespace text_processing {
         return current_;
     }
 
-    // UTF8String class implementations
-    UTF8String::UTF8String(const std::string &str) : data_(str), char_count_(0) {
-        indexString();
-    }
-
-    void UTF8String::indexString() {
-        char_pos_.clear();
-        char_count_ = 0;
-
-        if (data_.empty()) {
-            return;
+    namespace {
+        /**
+         * @brief Number of bytes of the character with this lead byte (input already valid)
+         */
+        inline size_t sequence_length(unsigned char first_byte) {
+            if (first_byte < 0x80) return 1;
+            if ((first_byte & 0xE0) == 0xC0) return 2;
+            if ((first_byte & 0xF0) == 0xE0) return 3;
+            return 4;
         }
 
-        const auto *bytes = reinterpret_cast<const unsigned char *>(data_.c_str());
-        size_t len = data_.length();
-        size_t pos = 0;
-
-        while (pos < len) {
-            char_pos_.push_back(pos);
-
+        /**
+         * @brief Validate the character starting at pos and return its byte length
+         * @throws UTF8Error if the sequence is invalid
+         */
+        size_t validate_sequence(const unsigned char *bytes, size_t len, size_t pos) {
             // Get number of bytes in current character
             unsigned char first_byte = bytes[pos];
-            int char_bytes;
+            size_t char_bytes;
 
             if ((first_byte & 0x80) == 0) {
                 // Single byte character (0xxxxxxx)
-                char_bytes = 1;
+                return 1;
             } else if ((first_byte & 0xE0) == 0xC0) {
                 // Two byte character (110xxxxx)
                 char_bytes = 2;
@@ -97,7 +104,7 @@ namespace text_processing {
             }
 
             // Validate continuation bytes
-            for (int i = 1; i < char_bytes; i++) {
+            for (size_t i = 1; i < char_bytes; i++) {
                 if ((bytes[pos + i] & 0xC0) != 0x80) {
                     throw UTF8Error("Invalid UTF-8 continuation byte at position " +
                                     std::to_string(pos + i));
@@ -127,25 +134,778 @@ namespace text_processing {
                 default: break;
             }
 
-            pos += char_bytes;
-            char_count_++;
+            return char_bytes;
+        }
+
+        inline bool is_char_start(unsigned char byte) {
+            return (byte & 0xC0) != 0x80;
+        }
+
+        /**
+         * @brief Number of leading ASCII bytes in [bytes, bytes + len), eight bytes per step
+         */
+        size_t ascii_prefix_scalar(const unsigned char *bytes, size_t len) {
+            size_t i = 0;
+            for (; i + 8 <= len; i += 8) {
+                uint64_t word;
+                std::memcpy(&word, bytes + i, sizeof(word));
+                if (word & 0x8080808080808080ULL) {
+                    break;
+                }
+            }
+            while (i < len && bytes[i] < 0x80) {
+                i++;
+            }
+            return i;
+        }
+
+        /**
+         * @brief Scalar kernel: validates sequence by sequence, so it never returns false
+         * @throws UTF8Error at the first invalid sequence
+         */
+        bool valid_scalar(const unsigned char *bytes, size_t len) {
+            for (size_t pos = ascii_prefix_scalar(bytes, len); pos < len;) {
+                if (bytes[pos] < 0x80) {
+                    pos += ascii_prefix_scalar(bytes + pos, len - pos);
+                } else {
+                    pos += validate_sequence(bytes, len, pos);
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Character starts among eight bytes: all but the continuation bytes 10xxxxxx
+         */
+        size_t count_scalar(const unsigned char *bytes, size_t len) {
+            size_t count = len;
+            size_t i = 0;
+            for (; i + 8 <= len; i += 8) {
+                uint64_t word;
+                std::memcpy(&word, bytes + i, sizeof(word));
+                // Top bit set and the next one clear, then the eight flags summed by one multiply
+                const uint64_t continuations = (word & ~(word << 1) & 0x8080808080808080ULL) >> 7;
+                count -= (continuations * 0x0101010101010101ULL) >> 56;
+            }
+            for (; i < len; ++i) {
+                count -= !is_char_start(bytes[i]);
+            }
+            return count;
+        }
+
+        /**
+         * @brief Bit i set if bytes[i] starts a character, for len <= 64
+         */
+        uint64_t starts_scalar(const unsigned char *bytes, size_t len) {
+            uint64_t mask = 0;
+            size_t i = 0;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            for (; i + 8 <= len; i += 8) {
+                uint64_t word;
+                std::memcpy(&word, bytes + i, sizeof(word));
+                // One flag per byte, gathered into the top byte in order by the multiply
+                const uint64_t starts = (~(word & ~(word << 1)) & 0x8080808080808080ULL) >> 7;
+                mask |= ((starts * 0x0102040810204080ULL) >> 56) << i;
+            }
+#endif
+            for (; i < len; ++i) {
+                mask |= static_cast<uint64_t>(is_char_start(bytes[i])) << i;
+            }
+            return mask;
+        }
+
+        /*
+         * Vector validation after Keiser and Lemire, "Validating UTF-8 in less
+         * than one instruction per byte" (2021). Three 16-entry tables, indexed
+         * by the high and low nibble of the previous byte and the high nibble of
+         * the current one, give a bit per kind of error; the AND of the three is
+         * non-zero exactly where two bytes cannot follow each other. Third and
+         * fourth bytes of a sequence, which look like a stray continuation to
+         * that test, are told apart by the bytes two and three back.
+         *
+         * The tables also reject surrogates and code points above U+10FFFF, which
+         * validate_sequence() accepts, so a rejected input is validated again by
+         * the scalar code, which decides and reports the error position.
+         */
+        constexpr uint8_t TOO_SHORT = 1 << 0;  // Lead byte followed by a lead or ASCII byte
+        constexpr uint8_t TOO_LONG = 1 << 1;   // ASCII byte followed by a continuation
+        constexpr uint8_t OVERLONG_3 = 1 << 2; // 11100000 100xxxxx
+        constexpr uint8_t TOO_LARGE = 1 << 3;  // 11110100 1001xxxx and above
+        constexpr uint8_t SURROGATE = 1 << 4;  // 11101101 101xxxxx
+        constexpr uint8_t OVERLONG_2 = 1 << 5; // 1100000x 10xxxxxx
+        constexpr uint8_t TOO_LARGE_1000 = 1 << 6; // 11110101 1000xxxx and above
+        constexpr uint8_t OVERLONG_4 = 1 << 6; // 11110000 1000xxxx
+        constexpr uint8_t TWO_CONTS = 1 << 7;  // Two continuations, valid only as third or fourth byte
+        constexpr uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+        alignas(16) constexpr uint8_t BYTE_1_HIGH[16] = {
+            TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+            TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+            TOO_SHORT | OVERLONG_2,
+            TOO_SHORT,
+            TOO_SHORT | OVERLONG_3 | SURROGATE,
+            TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4,
+        };
+
+        alignas(16) constexpr uint8_t BYTE_1_LOW[16] = {
+            CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+            CARRY | OVERLONG_2,
+            CARRY,
+            CARRY,
+            CARRY | TOO_LARGE,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+        };
+
+        alignas(16) constexpr uint8_t BYTE_2_HIGH[16] = {
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+        };
+
+        /**
+         * @brief Largest byte allowed at each of the last 32 positions of a block before its sequence runs past it
+         */
+        alignas(32) constexpr uint8_t INCOMPLETE_MAX[32] = {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF,
+        };
+
+#if defined(UTF8_SIMD_X86)
+        /**
+         * @brief ascii_prefix_scalar() with 16 bytes per step; SSE2 is part of every x86-64 CPU
+         */
+        __attribute__((target("sse2")))
+        size_t ascii_prefix_sse2(const unsigned char *bytes, size_t len) {
+            size_t i = 0;
+            for (; i + 16 <= len; i += 16) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + i));
+                int mask = _mm_movemask_epi8(chunk); // Top bit of every byte
+                if (mask != 0) {
+                    return i + __builtin_ctz(static_cast<unsigned>(mask));
+                }
+            }
+            return i + ascii_prefix_scalar(bytes + i, len - i);
+        }
+
+        /**
+         * @brief ascii_prefix_scalar() with 32 bytes per step
+         */
+        __attribute__((target("avx2")))
+        size_t ascii_prefix_avx2(const unsigned char *bytes, size_t len) {
+            size_t i = 0;
+            for (; i + 32 <= len; i += 32) {
+                __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes + i));
+                unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(chunk));
+                if (mask != 0) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + ascii_prefix_sse2(bytes + i, len - i);
+        }
+
+        /**
+         * @brief Validation state carried from one 16-byte block to the next
+         */
+        struct Ssse3Checker {
+            __m128i error;
+            __m128i prev_input;
+            __m128i prev_incomplete;
+        };
+
+        __attribute__((target("ssse3"), always_inline))
+        inline void check_block_ssse3(Ssse3Checker &state, __m128i input) {
+            if (_mm_movemask_epi8(input) == 0) {
+                // ASCII: only a sequence left open by the previous block is an error
+                state.error = _mm_or_si128(state.error, state.prev_incomplete);
+                state.prev_incomplete = _mm_setzero_si128();
+                state.prev_input = input;
+                return;
+            }
+            const __m128i nibble = _mm_set1_epi8(0x0F);
+            const __m128i prev1 = _mm_alignr_epi8(input, state.prev_input, 15);
+            const __m128i byte_1_high = _mm_shuffle_epi8(
+                _mm_load_si128(reinterpret_cast<const __m128i *>(BYTE_1_HIGH)),
+                _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+            const __m128i byte_1_low = _mm_shuffle_epi8(
+                _mm_load_si128(reinterpret_cast<const __m128i *>(BYTE_1_LOW)), _mm_and_si128(prev1, nibble));
+            const __m128i byte_2_high = _mm_shuffle_epi8(
+                _mm_load_si128(reinterpret_cast<const __m128i *>(BYTE_2_HIGH)),
+                _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+            const __m128i special = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+            // Continuations two after a 3- or 4-byte lead, or three after a 4-byte one, are expected
+            const __m128i prev2 = _mm_alignr_epi8(input, state.prev_input, 14);
+            const __m128i prev3 = _mm_alignr_epi8(input, state.prev_input, 13);
+            const __m128i third = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+            const __m128i fourth = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+            const __m128i must_continue = _mm_and_si128(_mm_or_si128(third, fourth),
+                                                        _mm_set1_epi8(static_cast<char>(0x80)));
+            state.error = _mm_or_si128(state.error, _mm_xor_si128(must_continue, special));
+
+            state.prev_incomplete = _mm_subs_epu8(
+                input, _mm_load_si128(reinterpret_cast<const __m128i *>(INCOMPLETE_MAX + 16)));
+            state.prev_input = input;
         }
+
+        __attribute__((target("ssse3")))
+        bool valid_ssse3(const unsigned char *bytes, size_t len) {
+            Ssse3Checker state{_mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128()};
+            size_t i = 0;
+            for (; i + 16 <= len; i += 16) {
+                check_block_ssse3(state, _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + i)));
+            }
+            if (i < len) {
+                // Zero padding is ASCII, so a sequence cut off by the end shows up as too short
+                alignas(16) unsigned char tail[16] = {};
+                std::memcpy(tail, bytes + i, len - i);
+                check_block_ssse3(state, _mm_load_si128(reinterpret_cast<const __m128i *>(tail)));
+            }
+            const __m128i error = _mm_or_si128(state.error, state.prev_incomplete);
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+        }
+
+        /**
+         * @brief Validation state carried from one 32-byte block to the next
+         */
+        struct Avx2Checker {
+            __m256i error;
+            __m256i prev_input;
+            __m256i prev_incomplete;
+        };
+
+        /**
+         * @brief The bytes of input shifted back by N, with the last N of prev in front
+         */
+        template<int N>
+        __attribute__((target("avx2"), always_inline))
+        inline __m256i previous_avx2(__m256i input, __m256i prev) {
+            return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 16 - N);
+        }
+
+        __attribute__((target("avx2"), always_inline))
+        inline __m256i lookup_avx2(const uint8_t *table, __m256i index) {
+            const __m256i entries = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(table)));
+            return _mm256_shuffle_epi8(entries, index);
+        }
+
+        __attribute__((target("avx2"), always_inline))
+        inline void check_block_avx2(Avx2Checker &state, __m256i input) {
+            if (_mm256_movemask_epi8(input) == 0) {
+                state.error = _mm256_or_si256(state.error, state.prev_incomplete);
+                state.prev_incomplete = _mm256_setzero_si256();
+                state.prev_input = input;
+                return;
+            }
+            const __m256i nibble = _mm256_set1_epi8(0x0F);
+            const __m256i prev1 = previous_avx2<1>(input, state.prev_input);
+            const __m256i byte_1_high = lookup_avx2(BYTE_1_HIGH, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+            const __m256i byte_1_low = lookup_avx2(BYTE_1_LOW, _mm256_and_si256(prev1, nibble));
+            const __m256i byte_2_high = lookup_avx2(BYTE_2_HIGH, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+            const __m256i special = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+            const __m256i prev2 = previous_avx2<2>(input, state.prev_input);
+            const __m256i prev3 = previous_avx2<3>(input, state.prev_input);
+            const __m256i third = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+            const __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+            const __m256i must_continue = _mm256_and_si256(_mm256_or_si256(third, fourth),
+                                                           _mm256_set1_epi8(static_cast<char>(0x80)));
+            state.error = _mm256_or_si256(state.error, _mm256_xor_si256(must_continue, special));
+
+            state.prev_incomplete = _mm256_subs_epu8(
+                input, _mm256_load_si256(reinterpret_cast<const __m256i *>(INCOMPLETE_MAX)));
+            state.prev_input = input;
+        }
+
+        __attribute__((target("avx2")))
+        bool valid_avx2(const unsigned char *bytes, size_t len) {
+            Avx2Checker state{_mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256()};
+            size_t i = 0;
+            for (; i + 32 <= len; i += 32) {
+                check_block_avx2(state, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes + i)));
+            }
+            if (i < len) {
+                alignas(32) unsigned char tail[32] = {};
+                std::memcpy(tail, bytes + i, len - i);
+                check_block_avx2(state, _mm256_load_si256(reinterpret_cast<const __m256i *>(tail)));
+            }
+            const __m256i error = _mm256_or_si256(state.error, state.prev_incomplete);
+            return _mm256_testz_si256(error, error) != 0;
+        }
+
+        /**
+         * @brief count_scalar() with 16 bytes per step: a continuation byte is below -64 as a signed byte
+         *
+         * The compare gives -1 per character start, subtracted into byte
+         * counters that are summed before any can pass 255.
+         */
+        __attribute__((target("sse2")))
+        size_t count_sse2(const unsigned char *bytes, size_t len) {
+            const __m128i limit = _mm_set1_epi8(-65);
+            size_t count = 0;
+            size_t i = 0;
+            while (i + 16 <= len) {
+                __m128i counters = _mm_setzero_si128();
+                for (size_t end = std::min(len - 15, i + 255 * 16); i < end; i += 16) {
+                    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + i));
+                    counters = _mm_sub_epi8(counters, _mm_cmpgt_epi8(chunk, limit));
+                }
+                const __m128i sums = _mm_sad_epu8(counters, _mm_setzero_si128());
+                count += static_cast<size_t>(_mm_cvtsi128_si32(sums) + _mm_extract_epi16(sums, 4));
+            }
+            return count + count_scalar(bytes + i, len - i);
+        }
+
+        __attribute__((target("avx2")))
+        size_t count_avx2(const unsigned char *bytes, size_t len) {
+            const __m256i limit = _mm256_set1_epi8(-65);
+            size_t count = 0;
+            size_t i = 0;
+            while (i + 32 <= len) {
+                __m256i counters = _mm256_setzero_si256();
+                for (size_t end = std::min(len - 31, i + 255 * 32); i < end; i += 32) {
+                    const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes + i));
+                    counters = _mm256_sub_epi8(counters, _mm256_cmpgt_epi8(chunk, limit));
+                }
+                const __m256i sums = _mm256_sad_epu8(counters, _mm256_setzero_si256());
+                const __m128i halves = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+                count += static_cast<size_t>(_mm_cvtsi128_si32(halves) + _mm_extract_epi16(halves, 4));
+            }
+            return count + count_sse2(bytes + i, len - i);
+        }
+
+        __attribute__((target("sse2")))
+        uint64_t starts_sse2(const unsigned char *bytes, size_t len) {
+            alignas(16) unsigned char padded[64];
+            if (len < 64) {
+                // Continuation bytes start nothing
+                std::memset(padded, 0x80, sizeof(padded));
+                std::memcpy(padded, bytes, len);
+                bytes = padded;
+            }
+            const __m128i limit = _mm_set1_epi8(-65);
+            uint64_t mask = 0;
+            for (int k = 0; k < 4; ++k) {
+                const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + 16 * k));
+                mask |= static_cast<uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpgt_epi8(chunk, limit))))
+                        << (16 * k);
+            }
+            return mask;
+        }
+
+        __attribute__((target("avx2")))
+        uint64_t starts_avx2(const unsigned char *bytes, size_t len) {
+            alignas(32) unsigned char padded[64];
+            if (len < 64) {
+                std::memset(padded, 0x80, sizeof(padded));
+                std::memcpy(padded, bytes, len);
+                bytes = padded;
+            }
+            const __m256i limit = _mm256_set1_epi8(-65);
+            const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes));
+            const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes + 32));
+            return static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(low, limit)))) |
+                   static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(high, limit))))
+                   << 32;
+        }
+#elif defined(UTF8_SIMD_NEON)
+        /**
+         * @brief ascii_prefix_scalar() with 16 bytes per step
+         */
+        size_t ascii_prefix_neon(const unsigned char *bytes, size_t len) {
+            size_t i = 0;
+            for (; i + 16 <= len; i += 16) {
+                if (vmaxvq_u8(vld1q_u8(bytes + i)) >= 0x80) {
+                    break;
+                }
+            }
+            return i + ascii_prefix_scalar(bytes + i, len - i);
+        }
+
+        struct NeonChecker {
+            uint8x16_t error;
+            uint8x16_t prev_input;
+            uint8x16_t prev_incomplete;
+        };
+
+        inline void check_block_neon(NeonChecker &state, uint8x16_t input) {
+            if (vmaxvq_u8(input) < 0x80) {
+                state.error = vorrq_u8(state.error, state.prev_incomplete);
+                state.prev_incomplete = vdupq_n_u8(0);
+                state.prev_input = input;
+                return;
+            }
+            const uint8x16_t prev1 = vextq_u8(state.prev_input, input, 15);
+            const uint8x16_t byte_1_high = vqtbl1q_u8(vld1q_u8(BYTE_1_HIGH), vshrq_n_u8(prev1, 4));
+            const uint8x16_t byte_1_low = vqtbl1q_u8(vld1q_u8(BYTE_1_LOW), vandq_u8(prev1, vdupq_n_u8(0x0F)));
+            const uint8x16_t byte_2_high = vqtbl1q_u8(vld1q_u8(BYTE_2_HIGH), vshrq_n_u8(input, 4));
+            const uint8x16_t special = vandq_u8(vandq_u8(byte_1_high, byte_1_low), byte_2_high);
+
+            const uint8x16_t prev2 = vextq_u8(state.prev_input, input, 14);
+            const uint8x16_t prev3 = vextq_u8(state.prev_input, input, 13);
+            const uint8x16_t third = vqsubq_u8(prev2, vdupq_n_u8(0xE0 - 0x80));
+            const uint8x16_t fourth = vqsubq_u8(prev3, vdupq_n_u8(0xF0 - 0x80));
+            const uint8x16_t must_continue = vandq_u8(vorrq_u8(third, fourth), vdupq_n_u8(0x80));
+            state.error = vorrq_u8(state.error, veorq_u8(must_continue, special));
+
+            state.prev_incomplete = vqsubq_u8(input, vld1q_u8(INCOMPLETE_MAX + 16));
+            state.prev_input = input;
+        }
+
+        bool valid_neon(const unsigned char *bytes, size_t len) {
+            NeonChecker state{vdupq_n_u8(0), vdupq_n_u8(0), vdupq_n_u8(0)};
+            size_t i = 0;
+            for (; i + 16 <= len; i += 16) {
+                check_block_neon(state, vld1q_u8(bytes + i));
+            }
+            if (i < len) {
+                alignas(16) unsigned char tail[16] = {};
+                std::memcpy(tail, bytes + i, len - i);
+                check_block_neon(state, vld1q_u8(tail));
+            }
+            return vmaxvq_u8(vorrq_u8(state.error, state.prev_incomplete)) == 0;
+        }
+
+        size_t count_neon(const unsigned char *bytes, size_t len) {
+            const int8x16_t limit = vdupq_n_s8(-65);
+            size_t count = 0;
+            size_t i = 0;
+            for (; i + 16 <= len; i += 16) {
+                const uint8x16_t starts = vcgtq_s8(vreinterpretq_s8_u8(vld1q_u8(bytes + i)), limit);
+                count += vaddvq_u8(vshrq_n_u8(starts, 7));
+            }
+            return count + count_scalar(bytes + i, len - i);
+        }
+
+        uint64_t starts_neon(const unsigned char *bytes, size_t len) {
+            alignas(16) unsigned char padded[64];
+            if (len < 64) {
+                std::memset(padded, 0x80, sizeof(padded));
+                std::memcpy(padded, bytes, len);
+                bytes = padded;
+            }
+            // One bit per byte, then pairwise sums pack each run of eight bytes into one
+            const int8x16_t limit = vdupq_n_s8(-65);
+            const uint8x16_t bits = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+            uint8x16_t parts[4];
+            for (int k = 0; k < 4; ++k) {
+                parts[k] = vandq_u8(vcgtq_s8(vreinterpretq_s8_u8(vld1q_u8(bytes + 16 * k)), limit), bits);
+            }
+            uint8x16_t sum = vpaddq_u8(vpaddq_u8(parts[0], parts[1]), vpaddq_u8(parts[2], parts[3]));
+            sum = vpaddq_u8(sum, sum);
+            return vgetq_lane_u64(vreinterpretq_u64_u8(sum), 0);
+        }
+#endif
+
+        /**
+         * @brief The functions of one UTF8String::Kernel
+         */
+        struct Kernels {
+            UTF8String::Kernel kind;
+            size_t (*ascii_prefix)(const unsigned char *, size_t); ///< Number of leading ASCII bytes
+            bool (*valid)(const unsigned char *, size_t); ///< False if the bytes may be invalid
+            size_t (*count)(const unsigned char *, size_t); ///< Character starts
+            uint64_t (*starts)(const unsigned char *, size_t); ///< Character starts among up to 64 bytes, as bits
+        };
+
+        constexpr Kernels SCALAR_KERNELS{UTF8String::Kernel::SCALAR, ascii_prefix_scalar, valid_scalar,
+                                         count_scalar, starts_scalar};
+#if defined(UTF8_SIMD_X86)
+        constexpr Kernels SSSE3_KERNELS{UTF8String::Kernel::SSSE3, ascii_prefix_sse2, valid_ssse3,
+                                        count_sse2, starts_sse2};
+        constexpr Kernels AVX2_KERNELS{UTF8String::Kernel::AVX2, ascii_prefix_avx2, valid_avx2,
+                                       count_avx2, starts_avx2};
+#elif defined(UTF8_SIMD_NEON)
+        constexpr Kernels NEON_KERNELS{UTF8String::Kernel::NEON, ascii_prefix_neon, valid_neon,
+                                       count_neon, starts_neon};
+#endif
+
+        /**
+         * @brief The kernels of kind, or nullptr if the CPU or the build lacks them
+         */
+        const Kernels *supported_kernels(UTF8String::Kernel kind) {
+            switch (kind) {
+                case UTF8String::Kernel::SCALAR:
+                    return &SCALAR_KERNELS;
+#if defined(UTF8_SIMD_X86)
+                case UTF8String::Kernel::SSSE3:
+                    __builtin_cpu_init();
+                    return __builtin_cpu_supports("ssse3") ? &SSSE3_KERNELS : nullptr;
+                case UTF8String::Kernel::AVX2:
+                    __builtin_cpu_init();
+                    return __builtin_cpu_supports("avx2") ? &AVX2_KERNELS : nullptr;
+#elif defined(UTF8_SIMD_NEON)
+                case UTF8String::Kernel::NEON:
+                    return &NEON_KERNELS;
+#endif
+                default:
+                    return nullptr;
+            }
+        }
+
+        /**
+         * @brief Widest kernels the running CPU supports
+         */
+        const Kernels *select_kernels() {
+            for (auto kind: {UTF8String::Kernel::AVX2, UTF8String::Kernel::NEON, UTF8String::Kernel::SSSE3}) {
+                if (const Kernels *kernels = supported_kernels(kind)) {
+                    return kernels;
+                }
+            }
+            return &SCALAR_KERNELS;
+        }
+
+        std::atomic<const Kernels *> &current_kernels() {
+            static std::atomic<const Kernels *> kernels{select_kernels()};
+            return kernels;
+        }
+
+        inline const Kernels &kernels() {
+            return *current_kernels().load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Number of leading ASCII bytes, using the current kernel
+         */
+        size_t ascii_prefix_length(const unsigned char *bytes, size_t len) {
+            return kernels().ascii_prefix(bytes, len);
+        }
+
+        /**
+         * @brief Check whether every byte in [begin, end) is ASCII
+         */
+        bool all_ascii(const unsigned char *bytes, size_t begin, size_t end) {
+            return ascii_prefix_length(bytes + begin, end - begin) == end - begin;
+        }
+
+        /**
+         * @brief Validate [bytes, bytes + len) with the current kernel
+         * @throws UTF8Error at the first invalid sequence
+         */
+        void validate_bytes(const unsigned char *bytes, size_t len) {
+            if (!kernels().valid(bytes, len)) {
+                // The vector kernels only say whether; the scalar code decides and says where
+                valid_scalar(bytes, len);
+            }
+        }
+    } // namespace
+
+    // UTF8String class implementations
+    UTF8String::UTF8String(const std::string &str) : data_(str), char_count_(0), ascii_(true) {
+        indexString();
     }
 
-    UTF8String::Character UTF8String::operator[](size_t index) const {
-        if (index >= char_count_) {
+    UTF8String::UTF8String(std::string &&str) : data_(std::move(str)), char_count_(0), ascii_(true) {
+        indexString();
+    }
+
+    UTF8String::UTF8String(std::string str, Trusted) : data_(std::move(str)), char_count_(0), ascii_(true) {
+        extendIndex(0, false);
+    }
+
+    void UTF8String::indexString() {
+        char_count_ = 0;
+        ascii_ = true;
+        block_pos_ = IndexVector(IndexVector::width_for(data_.length()));
+        block_group_.clear();
+        char_offset_.clear();
+        extendIndex(0, true);
+    }
+
+    void UTF8String::extendIndex(size_t from_byte, bool validate) {
+        const auto *bytes = reinterpret_cast<const unsigned char *>(data_.c_str());
+        size_t len = data_.length();
+
+        // ASCII fast path: no index is needed while every character is one byte
+        if (ascii_ && all_ascii(bytes, from_byte, len)) {
+            char_count_ += len - from_byte;
+            return;
+        }
+        if (ascii_) {
+            materializeIndex();
+        }
+
+        const Kernels &kernel = kernels();
+        size_t pos = from_byte;
+        if (kernel.kind == Kernel::SCALAR) {
+            // One pass, validating each character as it is indexed
+            while (pos < len) {
+                if (bytes[pos] < 0x80) {
+                    // ASCII runs need no validation and are indexed in bulk
+                    size_t run = kernel.ascii_prefix(bytes + pos, len - pos);
+                    addAsciiRun(pos, run);
+                    pos += run;
+                    continue;
+                }
+                size_t char_bytes = validate ? validate_sequence(bytes, len, pos) : sequence_length(bytes[pos]);
+                addCharacter(pos);
+                pos += char_bytes;
+            }
+            return;
+        }
+
+        // Validated up front, then long ASCII runs are indexed in bulk and
+        // everything else 64 bytes at a time from a mask of character starts
+        if (validate) {
+            validate_bytes(bytes + from_byte, len - from_byte);
+        }
+        while (pos < len) {
+            if (bytes[pos] < 0x80) {
+                size_t run = kernel.ascii_prefix(bytes + pos, len - pos);
+                if (run >= BLOCK_SIZE || pos + run == len) {
+                    addAsciiRun(pos, run);
+                    pos += run;
+                    continue;
+                }
+            }
+            const size_t chunk = std::min(len - pos, size_t{64});
+            for (uint64_t starts = kernel.starts(bytes + pos, chunk); starts != 0; starts &= starts - 1) {
+                addCharacter(pos + __builtin_ctzll(starts));
+            }
+            pos += chunk;
+        }
+    }
+
+    void UTF8String::materializeIndex() {
+        // Every character so far is one byte: one sample per block, no offset groups
+        ascii_ = false;
+        block_pos_ = IndexVector(IndexVector::width_for(data_.length()));
+        block_pos_.reserve(data_.length() / BLOCK_SIZE + 1);
+        block_group_.reserve(data_.length() / BLOCK_SIZE + 1);
+        for (size_t i = 0; i < char_count_; i += BLOCK_SIZE) {
+            block_pos_.push_back(i);
+            block_group_.push_back(NO_GROUP);
+        }
+    }
+
+    void UTF8String::addCharacter(size_t pos) {
+        size_t slot = char_count_ % BLOCK_SIZE;
+        if (slot == 0) {
+            block_pos_.push_back(pos);
+            block_group_.push_back(NO_GROUP);
+        }
+
+        size_t offset = pos - block_pos_[block_pos_.size() - 1];
+        if (block_group_.back() == NO_GROUP && offset != slot) {
+            // First character not at its single-byte offset: give the block explicit offsets
+            startGroup(slot);
+        }
+        uint32_t group = block_group_.back();
+        if (group != NO_GROUP) {
+            char_offset_[group * BLOCK_SIZE + slot] = static_cast<uint8_t>(offset);
+        }
+        char_count_++;
+    }
+
+    void UTF8String::addAsciiRun(size_t pos, size_t count) {
+        // Fill one block at a time; a block without an offset group stays without one
+        while (count > 0) {
+            size_t slot = char_count_ % BLOCK_SIZE;
+            if (slot == 0) {
+                block_pos_.push_back(pos);
+                block_group_.push_back(NO_GROUP);
+            }
+            size_t take = std::min(count, BLOCK_SIZE - slot);
+            size_t offset = pos - block_pos_[block_pos_.size() - 1];
+            if (block_group_.back() == NO_GROUP && offset != slot) {
+                startGroup(slot);
+            }
+            uint32_t group = block_group_.back();
+            if (group != NO_GROUP) {
+                uint8_t *offsets = char_offset_.data() + static_cast<size_t>(group) * BLOCK_SIZE + slot;
+                for (size_t i = 0; i < take; i++) {
+                    offsets[i] = static_cast<uint8_t>(offset + i);
+                }
+            }
+            char_count_ += take;
+            pos += take;
+            count -= take;
+        }
+    }
+
+    void UTF8String::startGroup(size_t slot) {
+        uint32_t group = static_cast<uint32_t>(char_offset_.size() / BLOCK_SIZE);
+        block_group_.back() = group;
+        char_offset_.resize(char_offset_.size() + BLOCK_SIZE);
+        for (size_t i = 0; i < slot; i++) {
+            char_offset_[group * BLOCK_SIZE + i] = static_cast<uint8_t>(i);
+        }
+    }
+
+    size_t UTF8String::byte_offset(size_t index) const {
+        if (index > char_count_) {
             throw std::out_of_range("Character index out of range");
         }
+        if (ascii_) {
+            return index;
+        }
+        if (index == char_count_) {
+            return data_.length();
+        }
+
+        size_t block = index / BLOCK_SIZE;
+        size_t slot = index % BLOCK_SIZE;
+        uint32_t group = block_group_[block];
+        size_t offset = group == NO_GROUP ? slot : char_offset_[group * BLOCK_SIZE + slot];
+        return block_pos_[block] + offset;
+    }
+
+    size_t UTF8String::char_index(size_t byte_pos) const {
+        if (byte_pos > data_.length()) {
+            throw std::out_of_range("Byte position out of range");
+        }
+        if (ascii_) {
+            return byte_pos;
+        }
+        if (byte_pos == data_.length()) {
+            return char_count_;
+        }
 
-        size_t start = char_pos_[index];
-        size_t length;
+        // Last block starting at or before byte_pos
+        size_t lo = 0;
+        size_t hi = block_pos_.size();
+        while (hi - lo > 1) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (block_pos_[mid] <= byte_pos) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
 
-        if (index + 1 < char_count_) {
-            length = char_pos_[index + 1] - start;
-        } else {
-            length = data_.length() - start;
+        size_t block_start = lo * BLOCK_SIZE;
+        size_t offset = byte_pos - block_pos_[lo];
+        uint32_t group = block_group_[lo];
+        if (group == NO_GROUP) {
+            return block_start + offset;
         }
 
+        // Last character in the block starting at or before offset
+        size_t slots = std::min(BLOCK_SIZE, char_count_ - block_start);
+        const uint8_t *offsets = char_offset_.data() + static_cast<size_t>(group) * BLOCK_SIZE;
+        size_t slot = std::upper_bound(offsets, offsets + slots, offset) - offsets;
+        return block_start + slot - 1;
+    }
+
+    UTF8String::Character UTF8String::operator[](size_t index) const {
+        if (index >= char_count_) {
+            throw std::out_of_range("Character index out of range");
+        }
+
+        size_t start = byte_offset(index);
+        size_t length = sequence_length(static_cast<unsigned char>(data_[start]));
         return Character(data_.substr(start, length));
     }
 
@@ -168,16 +928,9 @@ namespace text_processing {
             return UTF8String("");
         }
 
-        size_t begin_pos = char_pos_[start];
-        size_t end_pos;
-
-        if (start + length < char_count_) {
-            end_pos = char_pos_[start + length];
-        } else {
-            end_pos = data_.length();
-        }
-
-        return UTF8String(data_.substr(begin_pos, end_pos - begin_pos));
+        size_t begin_pos = byte_offset(start);
+        size_t end_pos = byte_offset(start + length);
+        return {data_.substr(begin_pos, end_pos - begin_pos), Trusted{}};
     }
 
     bool UTF8String::operator==(const UTF8String &other) const {
@@ -193,7 +946,9 @@ namespace text_processing {
     }
 
     UTF8String UTF8String::operator+(const UTF8String &other) const {
-        return UTF8String(data_ + other.data_);
+        UTF8String result(*this);
+        result += other;
+        return result;
     }
 
     UTF8String &UTF8String::operator+=(const UTF8String &other) {
@@ -202,18 +957,14 @@ namespace text_processing {
         }
 
         size_t original_size = data_.length();
-        size_t original_char_count = char_count_;
 
-        // Add the new data
+        // Add the new data and index it; it is already valid UTF-8
         data_ += other.data_;
-
-        // Add positions, offsetting by original size
-        char_pos_.reserve(char_pos_.size() + other.char_pos_.size());
-        for (size_t pos: other.char_pos_) {
-            char_pos_.push_back(pos + original_size);
+        if (ascii_ && other.ascii_) {
+            char_count_ += other.char_count_;
+            return *this;
         }
-
-        char_count_ = original_char_count + other.char_count_;
+        extendIndex(original_size, false);
         return *this;
     }
 
@@ -226,4 +977,48 @@ namespace text_processing {
         UTF8String temp(other);
         return operator+=(temp);
     }
+
+    UTF8String &UTF8String::append(std::string_view bytes) {
+        const auto *data = reinterpret_cast<const unsigned char *>(bytes.data());
+        const size_t len = bytes.size();
+        const bool ascii = ascii_prefix_length(data, len) == len;
+        if (!ascii) {
+            validate_bytes(data, len);
+        }
+
+        const size_t original_size = data_.length();
+        data_.append(bytes);
+        if (ascii_ && ascii) {
+            char_count_ += len;
+            return *this;
+        }
+        extendIndex(original_size, false);
+        return *this;
+    }
+
+    bool UTF8String::is_valid(std::string_view bytes) {
+        try {
+            validate_bytes(reinterpret_cast<const unsigned char *>(bytes.data()), bytes.size());
+            return true;
+        } catch (const UTF8Error &) {
+            return false;
+        }
+    }
+
+    size_t UTF8String::count_characters(std::string_view bytes) {
+        return kernels().count(reinterpret_cast<const unsigned char *>(bytes.data()), bytes.size());
+    }
+
+    UTF8String::Kernel UTF8String::kernel() {
+        return kernels().kind;
+    }
+
+    bool UTF8String::set_kernel(Kernel kernel) {
+        const Kernels *chosen = supported_kernels(kernel);
+        if (chosen == nullptr) {
+            return false;
+        }
+        current_kernels().store(chosen, std::memory_order_relaxed);
+        return true;
+    }
 } // namespace text_processing
@@ -80,4 +80,148 @@ TEST_F(DocumentStoreTest, CustomSeparator) {
 
     UTF8String expected = UTF8String("Doc1") + UTF8String("###") + UTF8String("Doc2") + UTF8String("###");
     EXPECT_EQ(custom_store->get_concatenated_text(), expected);
-}
\ No newline at end of file
+}
+// Test finding document by byte offset
+TEST_F(DocumentStoreTest, FindDocumentByByte) {
+    add_sample_documents();
+
+    // "Hello World" is 11 bytes, "გამარჯობა" is 27 bytes
+    auto doc1 = store->find_document_by_byte(11);
+    EXPECT_EQ(doc1.sql_id, 1);
+    EXPECT_EQ(doc1.byte_start, 0);
+    EXPECT_EQ(doc1.byte_length, 11);
+
+    auto doc2 = store->find_document_by_byte(12);
+    EXPECT_EQ(doc2.sql_id, 2);
+    EXPECT_EQ(doc2.start_pos, 12);
+    EXPECT_EQ(doc2.byte_start, 12);
+    EXPECT_EQ(doc2.byte_length, 27);
+
+    auto doc3 = store->find_document_by_byte(40);
+    EXPECT_EQ(doc3.sql_id, 3);
+    EXPECT_EQ(doc3.start_pos, 22);
+    EXPECT_EQ(doc3.byte_start, 40);
+
+    EXPECT_THROW((void) store->find_document_by_byte(51), std::out_of_range);
+}
+
+// Test constant time lookup by index
+TEST_F(DocumentStoreTest, DocumentIndex) {
+    EXPECT_EQ(store->document_index(0), DocumentStore::NO_DOCUMENT);
+    add_sample_documents();
+    EXPECT_EQ(store->document_count(), 3);
+
+    EXPECT_EQ(store->document_index(0), 0);
+    EXPECT_EQ(store->document_index(11), 0); // separator belongs to the document before it
+    EXPECT_EQ(store->document_index(12), 1);
+    EXPECT_EQ(store->document_index(32), 2);
+    EXPECT_EQ(store->document_index(33), DocumentStore::NO_DOCUMENT); // separator after the last document
+    EXPECT_EQ(store->document_index(999), DocumentStore::NO_DOCUMENT);
+    EXPECT_EQ(store->document(1).sql_id, 2);
+
+    EXPECT_EQ(store->document_index_by_byte(38), 1);
+    EXPECT_EQ(store->document_index_by_byte(40), 2);
+    EXPECT_EQ(store->document_index_by_byte(51), DocumentStore::NO_DOCUMENT);
+}
+
+// Test that empty documents own no positions
+TEST_F(DocumentStoreTest, EmptyDocumentsWithoutSeparator) {
+    DocumentStore plain{UTF8String("")};
+    plain.add_document(UTF8String("ab"), 1);
+    plain.add_document(UTF8String(""), 2);
+    plain.add_document(UTF8String("cd"), 3);
+    EXPECT_EQ(plain.document_index(1), 0);
+    EXPECT_EQ(plain.document_index(2), 2);
+    EXPECT_EQ(plain.find_document_id(2).sql_id, 3);
+}
+
+// Test that a cleared store can be refilled from scratch
+TEST_F(DocumentStoreTest, ClearForReuse) {
+    add_sample_documents();
+    store->clear();
+    EXPECT_EQ(store->document_count(), 0);
+    EXPECT_EQ(store->get_concatenated_text().length(), 0);
+    EXPECT_EQ(store->document_index(0), DocumentStore::NO_DOCUMENT);
+
+    // Previously used IDs can be added again
+    EXPECT_TRUE(store->add_document(UTF8String("გამარჯობა"), 1));
+    EXPECT_TRUE(store->add_document(UTF8String("abc"), 2));
+    EXPECT_EQ(store->get_concatenated_text().str(), "გამარჯობა$abc$");
+    EXPECT_EQ(store->document_index(10), 1);
+    EXPECT_EQ(store->document_index_by_byte(28), 1);
+    EXPECT_EQ(store->find_document_id(3).sql_id, 1);
+}
+
+// Test that bulk loading gives the same store as adding one by one
+TEST_F(DocumentStoreTest, AddDocumentsMatchesAddDocument) {
+    std::vector<UTF8String> contents;
+    std::vector<int64_t> ids;
+    for (int64_t i = 0; i < 500; ++i) {
+        contents.emplace_back(std::string(i % 7, 'a') + (i % 3 == 0 ? "ჯო" : "xy"));
+        ids.push_back(1000 - i);
+    }
+
+    DocumentStore single;
+    for (size_t i = 0; i < contents.size(); ++i) {
+        single.add_document(contents[i], ids[i]);
+    }
+
+    // Split into uneven batches
+    EXPECT_EQ(store->add_documents({contents.begin(), contents.begin() + 3}, {ids.begin(), ids.begin() + 3}), 3);
+    EXPECT_EQ(store->add_documents({contents.begin() + 3, contents.end()}, {ids.begin() + 3, ids.end()}), 497);
+
+    EXPECT_EQ(store->get_concatenated_text(), single.get_concatenated_text());
+    ASSERT_EQ(store->document_count(), single.document_count());
+    for (size_t pos = 0; pos < single.get_concatenated_text().length(); pos += 17) {
+        EXPECT_EQ(store->document_index(pos), single.document_index(pos)) << "at " << pos;
+    }
+    EXPECT_EQ(store->find_document_id(40).sql_id, single.find_document_id(40).sql_id);
+}
+
+// Test that documents added from raw bytes equal those added as UTF8String
+TEST_F(DocumentStoreTest, AddDocumentFromBytes) {
+    DocumentStore strings;
+    for (int64_t i = 0; i < 200; ++i) {
+        const std::string content = std::string(i % 5, 'a') + (i % 2 == 0 ? "ჯო" : "") + std::to_string(i);
+        EXPECT_TRUE(store->add_document(std::string_view(content), i));
+        strings.add_document(UTF8String(content), i);
+    }
+    EXPECT_FALSE(store->add_document(std::string_view("again"), 7));
+    EXPECT_TRUE(store->add_document(std::string_view(), 500));
+    strings.add_document(UTF8String(""), 500);
+
+    // Invalid bytes leave the store unchanged and the ID free
+    EXPECT_THROW(store->add_document(std::string_view("bad\xFF"), 501), UTF8Error);
+    EXPECT_TRUE(store->add_document(std::string_view("good"), 501));
+    strings.add_document(UTF8String("good"), 501);
+
+    EXPECT_EQ(store->get_concatenated_text(), strings.get_concatenated_text());
+    ASSERT_EQ(store->document_count(), strings.document_count());
+    for (size_t i = 0; i < strings.document_count(); ++i) {
+        const auto &a = store->document(i);
+        const auto &b = strings.document(i);
+        EXPECT_EQ(a.sql_id, b.sql_id);
+        EXPECT_EQ(a.start_pos, b.start_pos);
+        EXPECT_EQ(a.length, b.length);
+        EXPECT_EQ(a.byte_start, b.byte_start);
+        EXPECT_EQ(a.byte_length, b.byte_length);
+    }
+    for (size_t pos = 0; pos < strings.get_concatenated_text().length(); pos += 11) {
+        EXPECT_EQ(store->document_index(pos), strings.document_index(pos)) << "at " << pos;
+    }
+}
+
+// Test duplicate IDs in and across batches
+TEST_F(DocumentStoreTest, AddDocumentsSkipsDuplicates) {
+    store->add_document(UTF8String("first"), 1);
+    size_t added = store->add_documents(
+        {UTF8String("again"), UTF8String("second"), UTF8String("twice"), UTF8String("third")},
+        {1, 2, 2, 3});
+    EXPECT_EQ(added, 2);
+    EXPECT_EQ(store->document_count(), 3);
+    EXPECT_EQ(store->get_concatenated_text().str(), "first$second$third$");
+    EXPECT_FALSE(store->add_document(UTF8String("late"), 3));
+
+    EXPECT_THROW(store->add_documents({UTF8String("a")}, {}), std::invalid_argument);
+    EXPECT_EQ(store->add_documents({}, {}), 0);
+}
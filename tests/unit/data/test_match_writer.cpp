@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include "data/match_writer.hpp"
+
+using namespace text_processing;
+
+class MatchWriterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        path = (std::filesystem::temp_directory_path() / ("match_writer_test_" + name)).string();
+        matches = {
+            {1, 2, 0, 5, 120},
+            {-7, 9, 1234567890123, 10, 99},
+            {std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(), 0, 0, 0},
+            {3, 4, 18446744073709551615ULL, 100, 10},
+        };
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    std::string read_file() const {
+        std::ifstream in(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(in), {}};
+    }
+
+    static uint64_t read_le64(const std::string &bytes, size_t offset) {
+        uint64_t value = 0;
+        for (size_t i = 0; i < 8; ++i) {
+            value |= static_cast<uint64_t>(static_cast<unsigned char>(bytes[offset + i])) << (8 * i);
+        }
+        return value;
+    }
+
+    std::string path;
+    std::vector<Match> matches;
+};
+
+// Test that the JSON format is exactly Match::to_json_array()
+TEST_F(MatchWriterTest, JsonMatchesToJsonArray) {
+    for (size_t count = 0; count <= matches.size(); ++count) {
+        std::vector<Match> prefix(matches.begin(), matches.begin() + count);
+        save_matches(prefix, path);
+        EXPECT_EQ(read_file(), Match::to_json_array(prefix)) << count;
+    }
+}
+
+// Test one object per line
+TEST_F(MatchWriterTest, Ndjson) {
+    save_matches(matches, path, MatchWriter::Format::NDJSON);
+    std::string expected;
+    for (const auto &match: matches) {
+        expected += match.to_json() + "\n";
+    }
+    EXPECT_EQ(read_file(), expected);
+
+    save_matches({}, path, MatchWriter::Format::NDJSON);
+    EXPECT_EQ(read_file(), "");
+}
+
+// Test the header and fixed-width little-endian records
+TEST_F(MatchWriterTest, Binary) {
+    save_matches(matches, path, MatchWriter::Format::BINARY);
+    const std::string bytes = read_file();
+    ASSERT_EQ(bytes.size(), MatchWriter::BINARY_HEADER_SIZE + matches.size() * MatchWriter::BINARY_RECORD_SIZE);
+    EXPECT_EQ(bytes.substr(0, 8), "DUPMATCH");
+    EXPECT_EQ(read_le64(bytes, 8), MatchWriter::BINARY_VERSION | MatchWriter::BINARY_RECORD_SIZE << 32);
+    EXPECT_EQ(read_le64(bytes, 16), matches.size());
+
+    for (size_t i = 0; i < matches.size(); ++i) {
+        const size_t record = MatchWriter::BINARY_HEADER_SIZE + i * MatchWriter::BINARY_RECORD_SIZE;
+        Match read{
+            static_cast<int64_t>(read_le64(bytes, record)),
+            static_cast<int64_t>(read_le64(bytes, record + 8)),
+            read_le64(bytes, record + 16),
+            read_le64(bytes, record + 24),
+            read_le64(bytes, record + 32)
+        };
+        EXPECT_EQ(read, matches[i]) << i;
+    }
+}
+
+// Test output larger than the buffer
+TEST_F(MatchWriterTest, ManyMatches) {
+    std::vector<Match> many;
+    for (size_t i = 0; i < 20000; ++i) {
+        many.push_back({static_cast<int64_t>(i), static_cast<int64_t>(i * 7), i % 13, i * 1000, 1000000 - i});
+    }
+    {
+        MatchWriter writer(path);
+        for (const auto &match: many) {
+            writer.write(match);
+        }
+        EXPECT_EQ(writer.count(), many.size());
+        // The destructor finishes the file
+    }
+    EXPECT_EQ(read_file(), Match::to_json_array(many));
+}
+
+// Test spans longer than the buffer, written past it in order with what was buffered around them
+TEST_F(MatchWriterTest, SpanLongerThanBuffer) {
+    std::string record(3 * BufferedFile::BUFFER_SIZE + 5, 'x');
+    for (size_t i = 0; i < record.size(); i += 997) {
+        record[i] = static_cast<char>('a' + i % 26);
+    }
+    {
+        BufferedFile out(path);
+        out.put("head ");
+        out.put(record.data(), record.size());
+        out.put_integer(uint64_t{42});
+        out.put(record.data(), BufferedFile::BUFFER_SIZE);
+        out.put('\n');
+        out.close();
+    }
+    EXPECT_EQ(read_file(), "head " + record + "42" + record.substr(0, BufferedFile::BUFFER_SIZE) + "\n");
+}
+
+TEST_F(MatchWriterTest, Errors) {
+    EXPECT_THROW(MatchWriter("/nonexistent/matches.json"), std::runtime_error);
+    EXPECT_THROW(MatchWriter::format_from_string("xml"), std::invalid_argument);
+    EXPECT_EQ(MatchWriter::format_from_string("ndjson"), MatchWriter::Format::NDJSON);
+    EXPECT_EQ(MatchWriter::extension(MatchWriter::Format::BINARY), ".bin");
+
+    MatchWriter writer(path);
+    writer.close();
+    writer.close();
+    EXPECT_THROW(writer.write(matches[0]), std::runtime_error);
+    EXPECT_EQ(read_file(), "[]");
+}
+
+class ClusterWriterTest : public MatchWriterTest {
+protected:
+    std::vector<Cluster> clusters = {
+        {27, {{1, 10}, {2, 0}, {5, 3}}},
+        {4, {{-3, 0}, {std::numeric_limits<int64_t>::max(), 18446744073709551615ULL}}},
+        {1, {}},
+    };
+};
+
+// Test that the JSON format is an array of Cluster::to_json()
+TEST_F(ClusterWriterTest, Json) {
+    save_clusters(clusters, path);
+    std::string expected = "[";
+    for (size_t i = 0; i < clusters.size(); ++i) {
+        if (i > 0) expected += ", ";
+        expected += clusters[i].to_json();
+    }
+    EXPECT_EQ(read_file(), expected + "]");
+
+    save_clusters({}, path);
+    EXPECT_EQ(read_file(), "[]");
+}
+
+TEST_F(ClusterWriterTest, Ndjson) {
+    save_clusters(clusters, path, MatchWriter::Format::NDJSON);
+    std::string expected;
+    for (const auto &cluster: clusters) {
+        expected += cluster.to_json() + "\n";
+    }
+    EXPECT_EQ(read_file(), expected);
+}
+
+TEST_F(ClusterWriterTest, Binary) {
+    save_clusters(clusters, path, MatchWriter::Format::BINARY);
+    const std::string bytes = read_file();
+    EXPECT_EQ(bytes.substr(0, 8), "DUPCLUST");
+    EXPECT_EQ(read_le64(bytes, 8), ClusterWriter::BINARY_VERSION | ClusterWriter::BINARY_OCCURRENCE_SIZE << 32);
+    EXPECT_EQ(read_le64(bytes, 16), clusters.size());
+
+    size_t offset = ClusterWriter::BINARY_HEADER_SIZE;
+    for (const auto &cluster: clusters) {
+        Cluster read{read_le64(bytes, offset), {}};
+        const size_t count = read_le64(bytes, offset + 8);
+        offset += 16;
+        for (size_t i = 0; i < count; ++i, offset += ClusterWriter::BINARY_OCCURRENCE_SIZE) {
+            read.occurrences.push_back({static_cast<int64_t>(read_le64(bytes, offset)), read_le64(bytes, offset + 8)});
+        }
+        EXPECT_EQ(read, cluster);
+    }
+    EXPECT_EQ(offset, bytes.size());
+}
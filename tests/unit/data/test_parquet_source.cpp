@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "data/parquet_source.hpp"
+
+using namespace text_processing;
+
+// test_documents.parquet holds six rows of domain, content and category in one row group
+class ParquetSourceTest : public ::testing::Test {
+protected:
+    const std::string PARQUET_PATH = "test_documents.parquet";
+
+    ParquetSource source{PARQUET_PATH};
+};
+
+TEST_F(ParquetSourceTest, ReadsFooter) {
+    EXPECT_EQ(source.row_count(), 6);
+    EXPECT_EQ(source.row_group_count(), 1);
+    EXPECT_TRUE(source.validate_columns({"domain", "content", "category"}).first);
+    auto [valid, error] = source.validate_columns({"domain", "missing"});
+    EXPECT_FALSE(valid);
+    EXPECT_NE(error.find("missing"), std::string::npos);
+}
+
+// Test that the rows of a domain get their 1-based row numbers as IDs
+TEST_F(ParquetSourceTest, LoadsFilteredRows) {
+    auto store = source.create_document_store("domain", "content", "domain1.com");
+    ASSERT_EQ(store.document_count(), 3);
+    EXPECT_EQ(store.get_concatenated_text().str(),
+              "First document content$Second document from domain1$Third document from domain1$");
+    EXPECT_EQ(store.document(0).sql_id, 1);
+    EXPECT_EQ(store.document(1).sql_id, 2);
+    EXPECT_EQ(store.document(2).sql_id, 5);
+
+    auto georgian = source.create_document_store("domain", "content", "domain3.com", "\x01", 2);
+    ASSERT_EQ(georgian.document_count(), 1);
+    EXPECT_EQ(georgian.document(0).sql_id, 4);
+    EXPECT_EQ(georgian.document(0).length, 22);
+}
+
+// Test that a reused store is cleared, and that only rows after a bound are loaded
+TEST_F(ParquetSourceTest, ReusesStoreAndLoadsAfterRow) {
+    DocumentStore store;
+    source.load_document_store(store, "category", "content", "news");
+    EXPECT_EQ(store.document_count(), 4);
+    source.load_document_store(store, "domain", "content", "domain1.com", 1, 2);
+    ASSERT_EQ(store.document_count(), 1);
+    EXPECT_EQ(store.document(0).sql_id, 5);
+    source.load_document_store(store, "domain", "content", "domain1.com", 1, 6);
+    EXPECT_EQ(store.document_count(), 0);
+}
+
+// Test that row groups whose statistics exclude the value are not read
+TEST_F(ParquetSourceTest, SkipsRowGroupsByStatistics) {
+    Metrics metrics;
+    source.set_metrics(&metrics);
+    DocumentStore store;
+    source.load_document_store(store, "domain", "content", "zzz.com");
+    EXPECT_EQ(store.document_count(), 0);
+    EXPECT_EQ(metrics.count("row_groups_skipped"), 1);
+    EXPECT_EQ(metrics.count("row_groups"), 0);
+
+    source.load_document_store(store, "domain", "content", "domain2.com");
+    EXPECT_EQ(metrics.count("row_groups"), 1);
+    EXPECT_EQ(metrics.count("documents"), 2);
+    EXPECT_EQ(metrics.phase("load_documents").calls, 2);
+}
+
+TEST_F(ParquetSourceTest, Errors) {
+    EXPECT_THROW(ParquetSource("/nonexistent/file.parquet"), ParquetError);
+    EXPECT_THROW(ParquetSource("test_documents.db"), ParquetError);
+    EXPECT_THROW(source.create_document_store("domain", "missing", "domain1.com"), ParquetError);
+    EXPECT_TRUE(is_parquet_path("dump.parquet"));
+    EXPECT_TRUE(is_parquet_path("/data/part-0.parq"));
+    EXPECT_FALSE(is_parquet_path("data.db"));
+    EXPECT_FALSE(is_parquet_path("parquet"));
+}
@@ -195,4 +195,247 @@ TEST_F(SQLiteHandlerTest, UpdateRow) {
     );
     std::string str = store.get_concatenated_text().str(), target = "Updated content";
     EXPECT_TRUE(str.find(target) != std::string::npos);
-}
\ No newline at end of file
+}
+// Test batched updates, including a batch size that does not divide the rows
+TEST_F(SQLiteHandlerTest, UpdateRows) {
+    auto before = handler->createDocumentStore("data_table", "domain", "content", "domain1.com");
+    ASSERT_EQ(before.document_count(), 3);
+    std::vector<int64_t> ids;
+    std::vector<std::string> values;
+    for (size_t i = 0; i < before.document_count(); ++i) {
+        ids.push_back(before.document(i).sql_id);
+        values.push_back("row's value " + std::to_string(i) + " ჩემო");
+    }
+    ids.push_back(1000000);
+    values.emplace_back("missing row");
+
+    EXPECT_EQ(handler->updateRows("data_table", "content", ids, values, 2), 3);
+    auto after = handler->createDocumentStore("data_table", "domain", "content", "domain1.com");
+    EXPECT_EQ(after.get_concatenated_text().str(), values[0] + "$" + values[1] + "$" + values[2] + "$");
+
+    EXPECT_EQ(handler->updateRows("data_table", "content", {}, {}), 0);
+    EXPECT_THROW(handler->updateRows("data_table", "content", {1}, {}), SQLiteError);
+    EXPECT_THROW(handler->updateRows("data_table; DROP TABLE data_table", "content", {1}, {"x"}), SQLiteError);
+    EXPECT_THROW(handler->updateRows("data_table", "no_such_column", {1}, {"x"}), SQLiteError);
+}
+
+// Test that a failing row rolls back its batch only
+TEST_F(SQLiteHandlerTest, UpdateRowsRollsBackFailedBatch) {
+    auto before = handler->createDocumentStore("data_table", "domain", "content", "domain1.com");
+    ASSERT_EQ(before.document_count(), 3);
+    const int64_t first = before.document(0).sql_id;
+    const int64_t second = before.document(1).sql_id;
+
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open(TEST_DB_PATH.c_str(), &db), SQLITE_OK);
+    ASSERT_EQ(sqlite3_exec(db, "CREATE TRIGGER reject BEFORE UPDATE ON data_table WHEN NEW.content = 'bad' "
+                               "BEGIN SELECT RAISE(ABORT, 'rejected'); END", nullptr, nullptr, nullptr), SQLITE_OK);
+    sqlite3_close(db);
+
+    EXPECT_THROW(handler->updateRows("data_table", "content", {first, second, first}, {"first", "second", "bad"}, 2),
+                 SQLiteError);
+    auto after = handler->createDocumentStore("data_table", "domain", "content", "domain1.com");
+    const std::string text = after.get_concatenated_text().str();
+    EXPECT_EQ(text.find("first$second$"), 0);
+
+    // The handler can still write afterwards
+    EXPECT_EQ(handler->updateRows("data_table", "content", {first}, {"again"}), 1);
+}
+
+TEST_F(SQLiteHandlerTest, EnableWriteAheadLog) {
+    EXPECT_TRUE(handler->enableWriteAheadLog());
+    handler->updateRow("data_table", 1, "content", "Logged content");
+    auto store = handler->createDocumentStore("data_table", "domain", "content", "domain1.com");
+    EXPECT_NE(store.get_concatenated_text().str().find("Logged content"), std::string::npos);
+
+    SQLiteHandler memory(":memory:");
+    EXPECT_FALSE(memory.enableWriteAheadLog());
+}
+
+// Test listing filter values with their sizes, largest first
+TEST_F(SQLiteHandlerTest, ListFilterGroups) {
+    auto groups = handler->listFilterGroups("data_table", "domain", "content");
+    ASSERT_EQ(groups.size(), 3);
+    EXPECT_EQ(groups[0].value, "domain1.com");
+    EXPECT_EQ(groups[0].documents, 3);
+    EXPECT_EQ(groups[0].bytes, 77);
+    EXPECT_EQ(groups[1].value, "domain2.com");
+    EXPECT_EQ(groups[2].value, "domain3.com");
+    EXPECT_EQ(groups[2].documents, 1);
+
+    EXPECT_THROW(handler->listFilterGroups("data_table; DROP TABLE data_table", "domain", "content"), SQLiteError);
+    EXPECT_THROW(handler->listFilterGroups("data_table", "domain--", "content"), SQLiteError);
+}
+
+// Test refilling one store for several filter values
+TEST_F(SQLiteHandlerTest, LoadDocumentStoreReusesStore) {
+    DocumentStore store{UTF8String("$")};
+    handler->loadDocumentStore(store, "data_table", "domain", "content", "domain1.com");
+    EXPECT_EQ(store.document_count(), 3);
+
+    handler->loadDocumentStore(store, "data_table", "domain", "content", "domain3.com");
+    EXPECT_EQ(store.document_count(), 1);
+    EXPECT_EQ(store.get_concatenated_text().str(), "გამარჯობა from domain3$");
+
+    handler->loadDocumentStore(store, "data_table", "domain", "content", "nonexistent.com");
+    EXPECT_EQ(store.document_count(), 0);
+    EXPECT_EQ(store.get_concatenated_text().length(), 0);
+}
+
+TEST_F(SQLiteHandlerTest, LoadDocumentStoreMetrics) {
+    Metrics metrics;
+    handler->setMetrics(&metrics);
+    DocumentStore store{UTF8String("$")};
+    handler->loadDocumentStore(store, "data_table", "domain", "content", "domain1.com");
+    handler->loadDocumentStore(store, "data_table", "domain", "content", "domain3.com");
+
+    EXPECT_EQ(metrics.phase("load_documents").calls, 2);
+    EXPECT_EQ(metrics.count("documents"), 4);
+    EXPECT_EQ(metrics.count("bytes_loaded"),
+              std::string("First document content$Second document from domain1$Third document from domain1$").size() +
+              std::string("გამარჯობა from domain3$").size());
+    EXPECT_EQ(metrics.count("characters_loaded"), 80 + 23);
+    EXPECT_GE(metrics.peak("text"), 80);
+    EXPECT_GT(metrics.peak("text_index"), 0);
+
+    handler->setMetrics(nullptr);
+    handler->loadDocumentStore(store, "data_table", "domain", "content", "domain1.com");
+    EXPECT_EQ(metrics.count("documents"), 4);
+}
+
+// Test loading only the rows after a given rowid
+TEST_F(SQLiteHandlerTest, LoadDocumentStoreAfterRowid) {
+    DocumentStore all{UTF8String("$")};
+    handler->loadDocumentStore(all, "data_table", "domain", "content", "domain1.com");
+    ASSERT_EQ(all.document_count(), 3);
+
+    DocumentStore store{UTF8String("$")};
+    handler->loadDocumentStore(store, "data_table", "domain", "content", "domain1.com", 1, all.document(0).sql_id);
+    ASSERT_EQ(store.document_count(), 2);
+    EXPECT_EQ(store.document(0).sql_id, all.document(1).sql_id);
+    EXPECT_EQ(store.document(1).sql_id, all.document(2).sql_id);
+
+    handler->loadDocumentStore(store, "data_table", "domain", "content", "domain1.com", 2, all.document(2).sql_id);
+    EXPECT_EQ(store.document_count(), 0);
+}
+
+// Test that loading other filter values reuses the prepared statements
+TEST_F(SQLiteHandlerTest, StatementsAreCached) {
+    DocumentStore store{UTF8String("$")};
+    handler->loadDocumentStore(store, "data_table", "domain", "content", "domain1.com");
+    const size_t cached = handler->cachedStatements();
+    EXPECT_GT(cached, 0);
+    for (const char* domain : {"domain2.com", "domain3.com", "it's quoted", "domain1.com"}) {
+        handler->loadDocumentStore(store, "data_table", "domain", "content", domain);
+    }
+    EXPECT_EQ(handler->cachedStatements(), cached);
+    EXPECT_EQ(store.document_count(), 3);
+
+    handler->close();
+    EXPECT_EQ(handler->cachedStatements(), 0);
+}
+
+// Test the bulk-scan profile: same rows, an index on the filter column, no writes
+TEST_F(SQLiteHandlerTest, BulkReadProfile) {
+    auto expected = handler->createDocumentStore("data_table", "domain", "content", "domain1.com");
+    handler.reset();
+
+    SQLiteHandler reader(TEST_DB_PATH, false, ConnectionProfile::BULK_READ);
+    EXPECT_EQ(reader.profile(), ConnectionProfile::BULK_READ);
+    for (size_t threads : {1, 2}) {
+        auto store = reader.createDocumentStore("data_table", "domain", "content", "domain1.com", "$", threads);
+        EXPECT_EQ(store.get_concatenated_text(), expected.get_concatenated_text());
+    }
+    EXPECT_THROW(reader.updateRow("data_table", 1, "content", "changed"), SQLiteError);
+
+    // The test database has an index on domain, category gets one on first use
+    auto count_indexes = [this]() {
+        sqlite3* db = nullptr;
+        int indexes = 0;
+        EXPECT_EQ(sqlite3_open(TEST_DB_PATH.c_str(), &db), SQLITE_OK);
+        sqlite3_exec(db, "SELECT name FROM sqlite_master WHERE type = 'index'",
+                     [](void* count, int, char**, char**) { ++*static_cast<int*>(count); return 0; },
+                     &indexes, nullptr);
+        sqlite3_close(db);
+        return indexes;
+    };
+    EXPECT_EQ(count_indexes(), 1);
+    auto news = reader.createDocumentStore("data_table", "category", "content", "news");
+    EXPECT_EQ(news.document_count(), 4);
+    EXPECT_EQ(count_indexes(), 2);
+    EXPECT_TRUE(reader.ensureIndex("data_table", "category"));
+    EXPECT_EQ(count_indexes(), 2);
+    EXPECT_THROW(reader.ensureIndex("data_table", "domain; --"), SQLiteError);
+
+    // Still query-only after creating the index
+    EXPECT_THROW(reader.updateRow("data_table", 1, "content", "changed"), SQLiteError);
+}
+
+// Fills a fresh database with many rows, enough for several loading batches
+class PipelinedLoadTest : public ::testing::Test {
+protected:
+    const std::string DB_PATH = "pipelined_load_test.db";
+
+    void SetUp() override {
+        fs::remove(DB_PATH);
+        sqlite3* db = nullptr;
+        ASSERT_EQ(sqlite3_open(DB_PATH.c_str(), &db), SQLITE_OK);
+        exec(db, "CREATE TABLE docs (domain TEXT, content TEXT)");
+        exec(db, "BEGIN");
+        sqlite3_stmt* stmt = nullptr;
+        ASSERT_EQ(sqlite3_prepare_v2(db, "INSERT INTO docs VALUES (?, ?)", -1, &stmt, nullptr), SQLITE_OK);
+        const std::vector<std::string> words = {"alpha ", "გამარჯობა ", "👋 ", "beta ", ""};
+        for (size_t row = 0; row < 3000; ++row) {
+            std::string content;
+            for (size_t w = 0; w < row % 13; ++w) {
+                content += words[(row + w) % words.size()];
+            }
+            sqlite3_bind_text(stmt, 1, row % 3 == 0 ? "b.com" : "a.com", -1, SQLITE_STATIC);
+            sqlite3_bind_text(stmt, 2, content.c_str(), static_cast<int>(content.size()), SQLITE_TRANSIENT);
+            sqlite3_step(stmt);
+            sqlite3_reset(stmt);
+        }
+        sqlite3_finalize(stmt);
+        exec(db, "INSERT INTO docs VALUES ('a.com', NULL)");
+        exec(db, "INSERT INTO docs VALUES ('bad.com', 'ok'), ('bad.com', CAST(X'41FF42' AS TEXT)), ('bad.com', 'ok')");
+        exec(db, "COMMIT");
+        sqlite3_close(db);
+    }
+
+    void TearDown() override {
+        fs::remove(DB_PATH);
+    }
+
+    static void exec(sqlite3* db, const std::string& sql) {
+        ASSERT_EQ(sqlite3_exec(db, sql.c_str(), nullptr, nullptr, nullptr), SQLITE_OK) << sql;
+    }
+};
+
+// Test that loading on several threads gives the same store as one thread
+TEST_F(PipelinedLoadTest, MatchesSequentialLoad) {
+    SQLiteHandler handler(DB_PATH);
+    auto expected = handler.createDocumentStore("docs", "domain", "content", "a.com", "$", 1);
+    EXPECT_EQ(expected.document_count(), 2001);
+
+    for (size_t threads : {2, 4, 0}) {
+        auto store = handler.createDocumentStore("docs", "domain", "content", "a.com", "$", threads);
+        EXPECT_EQ(store.get_concatenated_text(), expected.get_concatenated_text()) << threads;
+        ASSERT_EQ(store.document_count(), expected.document_count());
+        for (size_t i = 0; i < store.document_count(); ++i) {
+            EXPECT_EQ(store.document(i).sql_id, expected.document(i).sql_id);
+            EXPECT_EQ(store.document(i).start_pos, expected.document(i).start_pos);
+            EXPECT_EQ(store.document(i).byte_length, expected.document(i).byte_length);
+        }
+    }
+}
+
+// Test that invalid UTF-8 fails the load in either mode
+TEST_F(PipelinedLoadTest, InvalidContentThrows) {
+    SQLiteHandler handler(DB_PATH);
+    EXPECT_THROW(handler.createDocumentStore("docs", "domain", "content", "bad.com", "$", 1), UTF8Error);
+    EXPECT_THROW(handler.createDocumentStore("docs", "domain", "content", "bad.com", "$", 4), UTF8Error);
+
+    // The handler stays usable afterwards
+    auto store = handler.createDocumentStore("docs", "domain", "content", "b.com", "$", 4);
+    EXPECT_EQ(store.document_count(), 1000);
+}
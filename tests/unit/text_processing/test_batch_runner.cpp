@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include "text_processing/batch_runner.hpp"
+#include "sql/sql_handler.hpp"
+#include "text_processing/parallel.hpp"
+
+using namespace text_processing;
+namespace fs = std::filesystem;
+
+class BatchRunnerTest : public ::testing::Test {
+protected:
+    const std::string DB_PATH = "test_documents.db";
+    const std::string OUTPUT_DIR = "batch_runner_output";
+
+    void SetUp() override {
+        fs::remove_all(OUTPUT_DIR);
+        source.db_path = DB_PATH;
+        source.filter_column = "domain";
+        source.content_column = "content";
+        source.separator = "$";
+    }
+
+    void TearDown() override {
+        fs::remove_all(OUTPUT_DIR);
+    }
+
+    static std::string read_file(const std::string &path) {
+        std::ifstream in(path);
+        std::stringstream content;
+        content << in.rdbuf();
+        return content.str();
+    }
+
+    // JSON the single-domain path writes for a domain
+    std::string expected_json(const std::string &domain, size_t min_length) const {
+        SQLiteHandler sql(DB_PATH);
+        auto store = sql.createDocumentStore(source.table_name, source.filter_column, source.content_column,
+                                             domain, source.separator);
+        DuplicateFinder finder;
+        return Match::to_json_array(finder.find_duplicates(store, min_length));
+    }
+
+    BatchSource source;
+};
+
+// Test that every domain is processed and matches the single-domain output
+TEST_F(BatchRunnerTest, AllDomains) {
+    BatchRunner runner(source, FinderOptions{}, 2);
+    auto results = runner.run({}, OUTPUT_DIR, 5);
+
+    ASSERT_EQ(results.size(), 3);
+    // Largest domain first
+    EXPECT_EQ(results[0].domain, "domain1.com");
+    EXPECT_EQ(results[0].documents, 3);
+    EXPECT_EQ(results[2].domain, "domain3.com");
+    for (const auto &result: results) {
+        EXPECT_TRUE(result.error.empty()) << result.error;
+        EXPECT_EQ(result.output_path, (fs::path(OUTPUT_DIR) / (result.domain + ".json")).string());
+        EXPECT_EQ(read_file(result.output_path), expected_json(result.domain, 5)) << result.domain;
+    }
+}
+
+// Test an explicit domain list with duplicates and unknown domains
+TEST_F(BatchRunnerTest, SelectedDomains) {
+    FinderOptions options;
+    options.builder_type = SuffixArrayBuilder::BuilderType::SAIS;
+    BatchRunner runner(source, options, 1);
+    auto results = runner.run({"domain2.com", "missing.com", "domain2.com"}, OUTPUT_DIR, 5);
+
+    ASSERT_EQ(results.size(), 2);
+    EXPECT_EQ(results[0].domain, "domain2.com");
+    EXPECT_EQ(results[0].documents, 2);
+    EXPECT_EQ(read_file(results[0].output_path), expected_json("domain2.com", 5));
+
+    EXPECT_EQ(results[1].domain, "missing.com");
+    EXPECT_TRUE(results[1].error.empty());
+    EXPECT_EQ(results[1].documents, 0);
+    EXPECT_EQ(read_file(results[1].output_path), "[]");
+    EXPECT_FALSE(fs::exists(fs::path(OUTPUT_DIR) / "domain1.com.json"));
+}
+
+// Test writing NDJSON files
+TEST_F(BatchRunnerTest, NdjsonFormat) {
+    BatchRunner runner(source, FinderOptions{}, 2, MatchWriter::Format::NDJSON);
+    auto results = runner.run({"domain1.com"}, OUTPUT_DIR, 5);
+
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0].output_path, (fs::path(OUTPUT_DIR) / "domain1.com.ndjson").string());
+    SQLiteHandler sql(DB_PATH);
+    auto store = sql.createDocumentStore(source.table_name, source.filter_column, source.content_column,
+                                         "domain1.com", source.separator);
+    std::string expected;
+    for (const auto &match: DuplicateFinder().find_duplicates(store, 5)) {
+        expected += match.to_json() + "\n";
+    }
+    EXPECT_EQ(read_file(results[0].output_path), expected);
+}
+
+// Test that every domain records into its own metrics
+TEST_F(BatchRunnerTest, PerDomainMetrics) {
+    BatchRunner runner(source, FinderOptions{}, 2);
+    auto results = runner.run({}, OUTPUT_DIR, 5);
+
+    ASSERT_EQ(results.size(), 3);
+    for (const auto &result: results) {
+        EXPECT_EQ(result.metrics.count("documents"), result.documents) << result.domain;
+        EXPECT_EQ(result.metrics.count("pairs_kept"), result.matches) << result.domain;
+        EXPECT_EQ(result.metrics.phase("load_documents").calls, 1) << result.domain;
+        EXPECT_EQ(result.metrics.phase("save_matches").calls, 1) << result.domain;
+    }
+}
+
+// Test the --stats document: the run's metrics, then every domain in result order
+TEST_F(BatchRunnerTest, StatsJson) {
+    BatchResult failed;
+    failed.domain = "bad \"domain\"";
+    failed.documents = 3;
+    failed.error = "no such table";
+    failed.metrics.add_count("documents", 3);
+    EXPECT_EQ(failed.to_json(), R"({"domain": "bad \"domain\"", "documents": 3, "matches": 0, "error": "no such table", )"
+                                R"("metrics": {"info": {}, "phases": {}, "counts": {"documents": 3}, "peak_bytes": {}}})");
+
+    BatchRunner runner(source, FinderOptions{}, 2);
+    auto results = runner.run({}, OUTPUT_DIR, 5);
+    ASSERT_EQ(results.size(), 3);
+    results.push_back(failed);
+    Metrics run;
+    run.add_count("domains", results.size());
+    EXPECT_EQ(BatchRunner::stats_json(run, results),
+              "{\"run\": " + run.to_json() + ", \"domains\": [" + results[0].to_json() + ", " + results[1].to_json() +
+              ", " + results[2].to_json() + ", " + failed.to_json() + "]}");
+    EXPECT_EQ(BatchRunner::stats_json(run, {}), "{\"run\": " + run.to_json() + ", \"domains\": []}");
+}
+
+// Test that bad columns fail the whole batch before any work starts
+TEST_F(BatchRunnerTest, InvalidSource) {
+    source.content_column = "nonexistent_column";
+    BatchRunner runner(source, FinderOptions{});
+    EXPECT_THROW(runner.run({}, OUTPUT_DIR, 5), SQLiteError);
+}
+
+// Test file names of unusual domains
+TEST_F(BatchRunnerTest, OutputFileName) {
+    EXPECT_EQ(BatchRunner::output_file_name("example.com"), "example.com.json");
+    EXPECT_EQ(BatchRunner::output_file_name("sub-domain_1.org"), "sub-domain_1.org.json");
+
+    std::string path_like = BatchRunner::output_file_name("../etc/passwd");
+    EXPECT_EQ(path_like.find('/'), std::string::npos);
+    EXPECT_NE(path_like.front(), '.');
+
+    // Replaced characters never make two domains share a file
+    EXPECT_NE(BatchRunner::output_file_name("a/b"), BatchRunner::output_file_name("a_b"));
+    EXPECT_NE(BatchRunner::output_file_name("a/b"), BatchRunner::output_file_name("a:b"));
+    EXPECT_NE(BatchRunner::output_file_name(""), ".json");
+    EXPECT_EQ(BatchRunner::output_file_name("example.com", MatchWriter::Format::BINARY), "example.com.bin");
+}
+
+// Test that items are handed out largest first
+TEST(LargestFirstTest, SingleWorkerOrder) {
+    std::vector<size_t> sizes = {5, 100, 5, 40, 0};
+    std::vector<size_t> order;
+    parallel_for_each_largest_first(sizes, 1, [&order](size_t item, size_t worker) {
+        EXPECT_EQ(worker, 0);
+        order.push_back(item);
+    });
+    EXPECT_EQ(order, (std::vector<size_t>{1, 3, 0, 2, 4}));
+}
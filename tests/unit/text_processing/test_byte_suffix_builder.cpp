@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <random>
+#include "text_processing/byte_suffix_builder.hpp"
+#include "text_processing/naive_suffix_builder.hpp"
+#include "text_processing/suffix_array_builder.hpp"
+
+using namespace text_processing;
+
+class ByteSuffixBuilderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        builder = std::make_unique<ByteSuffixBuilder>();
+    }
+
+    void TearDown() override {
+        builder.reset();
+    }
+
+    // Helper to compare against the naive builder after mapping bytes to characters
+    void expectSameAsNaive(const std::string& input) {
+        UTF8String text(input);
+        NaiveSuffixBuilder naive;
+        ASSERT_TRUE(naive.build(text));
+        ASSERT_TRUE(builder->build(text));
+
+        const auto& sa = builder->get_array();
+        const auto& lcp = builder->get_lcp_array();
+        ASSERT_EQ(sa.size(), text.length()) << "Input: " << input;
+        ASSERT_EQ(lcp.size(), text.length() - 1) << "Input: " << input;
+
+        std::vector<size_t> char_sa;
+        std::vector<size_t> char_lcp;
+        for (size_t i = 0; i < sa.size(); ++i) {
+            char_sa.push_back(text.char_index(sa[i]));
+            if (i < lcp.size()) {
+                char_lcp.push_back(text.char_index(sa[i] + lcp[i]) - char_sa.back());
+            }
+        }
+        EXPECT_EQ(char_sa, naive.get_array()) << "Input: " << input;
+        EXPECT_EQ(char_lcp, naive.get_lcp_array()) << "Input: " << input;
+    }
+
+    std::unique_ptr<ByteSuffixBuilder> builder;
+};
+
+TEST_F(ByteSuffixBuilderTest, EmptyString) {
+    EXPECT_THROW(builder->build(UTF8String("")), std::runtime_error);
+    EXPECT_FALSE(builder->is_built());
+}
+
+TEST_F(ByteSuffixBuilderTest, AsciiMatchesCharacterOrder) {
+    ASSERT_TRUE(builder->build(UTF8String("banana$")));
+    EXPECT_EQ(builder->get_array(), std::vector<size_t>({6, 5, 3, 1, 0, 4, 2}));
+    EXPECT_EQ(builder->get_lcp_array(), std::vector<size_t>({0, 1, 3, 0, 0, 2}));
+    EXPECT_EQ(builder->unit(), SuffixArrayBuilder::Unit::BYTE);
+}
+
+TEST_F(ByteSuffixBuilderTest, PositionsAreByteOffsets) {
+    // "ა" U+10D0, "ბ" U+10D1 and "გ" U+10D2 are three bytes each
+    ASSERT_TRUE(builder->build(UTF8String("აბგ$")));
+    EXPECT_EQ(builder->get_array(), std::vector<size_t>({9, 0, 3, 6}));
+    EXPECT_EQ(builder->get_lcp_array(), std::vector<size_t>({0, 0, 0}));
+}
+
+TEST_F(ByteSuffixBuilderTest, LcpStopsAtCharacterBoundary) {
+    // "é" (C3 A9) and "è" (C3 A8) share their lead byte
+    ASSERT_TRUE(builder->build(UTF8String("xé$xè")));
+    const auto& sa = builder->get_array();
+    const auto& lcp = builder->get_lcp_array();
+    for (size_t i = 0; i + 1 < sa.size(); ++i) {
+        if ((sa[i] == 0 && sa[i + 1] == 4) || (sa[i] == 4 && sa[i + 1] == 0)) {
+            EXPECT_EQ(lcp[i], 1);
+        }
+    }
+    expectSameAsNaive("xé$xè");
+}
+
+TEST_F(ByteSuffixBuilderTest, TextWithNulCharacters) {
+    expectSameAsNaive(std::string("a\0b\0a\0b", 7));
+    expectSameAsNaive(std::string("\0\0\0", 3));
+}
+
+TEST_F(ByteSuffixBuilderTest, FactoryCreation) {
+    auto factory_builder = SuffixArrayBuilder::create(SuffixArrayBuilder::BuilderType::BYTE);
+    ASSERT_NE(factory_builder, nullptr);
+    EXPECT_TRUE(factory_builder->build(UTF8String("test$")));
+    EXPECT_EQ(factory_builder->unit(), SuffixArrayBuilder::Unit::BYTE);
+    EXPECT_EQ(SuffixArrayBuilder::type_from_string("byte"), SuffixArrayBuilder::BuilderType::BYTE);
+    EXPECT_EQ(SuffixArrayBuilder::create(SuffixArrayBuilder::BuilderType::SAIS)->unit(),
+              SuffixArrayBuilder::Unit::CHARACTER);
+}
+
+TEST_F(ByteSuffixBuilderTest, MatchesNaiveOnDocumentLikeText) {
+    expectSameAsNaive("hello world$Say hello world$");
+    expectSameAsNaive("გამარჯობა მსოფლიო$გამარჯობა კარგო$ჩემო კარგო$");
+    expectSameAsNaive("👋🌍👋🌍$");
+}
+
+TEST_F(ByteSuffixBuilderTest, MatchesNaiveOnRandomText) {
+    std::mt19937 rng(7);
+    const std::vector<std::string> alphabet = {"a", "b", "$", "é", "è", "ა", "👋", "🌍"};
+    for (size_t round = 0; round < 200; ++round) {
+        std::uniform_int_distribution<size_t> len_dist(1, 100);
+        std::uniform_int_distribution<size_t> sigma_dist(1, alphabet.size());
+        size_t sigma = sigma_dist(rng);
+        std::uniform_int_distribution<size_t> char_dist(0, sigma - 1);
+
+        std::string input;
+        size_t len = len_dist(rng);
+        for (size_t i = 0; i < len; ++i) {
+            input += alphabet[char_dist(rng)];
+        }
+        expectSameAsNaive(input);
+    }
+}
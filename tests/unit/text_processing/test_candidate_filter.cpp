@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <random>
+#include "text_processing/candidate_filter.hpp"
+
+using namespace text_processing;
+using ::testing::ElementsAre;
+using ::testing::IsSupersetOf;
+
+class CandidateFilterTest : public ::testing::Test {
+protected:
+    std::mt19937 rng{7};
+
+    // Random text over a small alphabet, whose shorter shingles are shared by chance
+    std::string random_text(size_t characters, const std::vector<std::string>& alphabet) {
+        std::string text;
+        for (size_t i = 0; i < characters; ++i) {
+            text += alphabet[rng() % alphabet.size()];
+        }
+        return text;
+    }
+
+    const std::vector<std::string> latin = {"a", "b", "c", "d", "e", "f", "g", "h", " "};
+    const std::vector<std::string> georgian = {"ა", "ბ", "გ", "დ", "ე", "ვ", "ზ", "თ", " "};
+};
+
+TEST_F(CandidateFilterTest, WinnowingOfShortTexts) {
+    EXPECT_TRUE(winnow_fingerprints("", 8).empty());
+    EXPECT_TRUE(winnow_fingerprints("shorter", 8).empty());
+    EXPECT_EQ(winnow_fingerprints("exactly8", 8).size(), 1);
+    EXPECT_EQ(winnow_fingerprints("aaaaaaaaaaaa", 8).size(), 1);
+
+    const auto fingerprints = winnow_fingerprints(random_text(2000, latin), 40);
+    EXPECT_TRUE(std::is_sorted(fingerprints.begin(), fingerprints.end()));
+    EXPECT_EQ(std::adjacent_find(fingerprints.begin(), fingerprints.end()), fingerprints.end());
+    // About two fingerprints per window of shingles
+    EXPECT_LT(fingerprints.size(), 2000 / 5);
+}
+
+// Test that a substring of exactly the threshold keeps both documents, wherever it is planted
+TEST_F(CandidateFilterTest, SharedSubstringIsAlwaysFound) {
+    for (const auto* alphabet : {&latin, &georgian}) {
+        for (size_t min_length : {8, 16, 17, 50}) {
+            for (int trial = 0; trial < 20; ++trial) {
+                const std::string shared = random_text(min_length, *alphabet);
+                DocumentStore store;
+                store.add_document(UTF8String(random_text(rng() % 300, *alphabet) + shared + random_text(rng() % 300, *alphabet)), 1);
+                store.add_document(UTF8String(random_text(500, *alphabet)), 2);
+                store.add_document(UTF8String(random_text(rng() % 300, *alphabet) + shared), 3);
+                EXPECT_THAT(find_candidate_documents(store, min_length, 2), IsSupersetOf({0, 2}))
+                    << "Threshold: " << min_length << ", trial: " << trial;
+            }
+        }
+    }
+}
+
+TEST_F(CandidateFilterTest, DropsDocumentsWithoutSharedFingerprints) {
+    DocumentStore store;
+    EXPECT_TRUE(find_candidate_documents(store, 10).empty());
+
+    const std::string boilerplate = "Copyright example.com, all rights reserved";
+    store.add_document(UTF8String(random_text(400, latin)), 10);
+    store.add_document(UTF8String(random_text(400, latin) + boilerplate), 20);
+    store.add_document(UTF8String("short"), 30);
+    store.add_document(UTF8String(boilerplate + random_text(400, latin)), 40);
+    // A repeat inside one document is no match
+    const std::string repeated = random_text(100, latin);
+    store.add_document(UTF8String(repeated + repeated), 50);
+
+    size_t fingerprints = 0;
+    EXPECT_THAT(find_candidate_documents(store, 20, 0, &fingerprints), ElementsAre(1, 3));
+    EXPECT_GT(fingerprints, 0);
+}
+
+TEST_F(CandidateFilterTest, SelectDocumentsKeepsIdsAndSeparator) {
+    DocumentStore store(UTF8String("\x01"));
+    store.add_document(UTF8String("გამარჯობა"), 5);
+    store.add_document(UTF8String("hello"), 6);
+    store.add_document(UTF8String("ჩემო კარგო"), 7);
+
+    const auto selected = select_documents(store, {0, 2});
+    ASSERT_EQ(selected.document_count(), 2);
+    EXPECT_EQ(selected.separator().str(), "\x01");
+    EXPECT_EQ(selected.get_concatenated_text().str(), "გამარჯობა\x01ჩემო კარგო\x01");
+    EXPECT_EQ(selected.document(0).sql_id, 5);
+    EXPECT_EQ(selected.document(1).sql_id, 7);
+    EXPECT_EQ(selected.document(1).start_pos, 10);
+    EXPECT_EQ(selected.document(1).length, 10);
+
+    EXPECT_EQ(select_documents(store, {}).document_count(), 0);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <map>
+#include <random>
+#include "text_processing/corpus_query.hpp"
+#include "text_processing/duplicate_finder.hpp"
+
+using namespace text_processing;
+
+class CorpusQueryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        path = (std::filesystem::temp_directory_path() / ("corpus_query_test_" + name + ".idx")).string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    void add(const std::string &text, int64_t id) {
+        store.add_document(UTF8String(text), id);
+        texts[id] = UTF8String(text);
+    }
+
+    // Maximal substrings found by trying every length at every character
+    std::vector<std::pair<size_t, size_t>> brute_force(const UTF8String &query, size_t min_length) const {
+        std::vector<std::pair<size_t, size_t>> hits;
+        size_t previous_end = 0;
+        for (size_t i = 0; i < query.length(); ++i) {
+            size_t length = 0;
+            while (i + length < query.length()) {
+                const std::string candidate = query.substr(i, length + 1).str();
+                bool found = false;
+                for (const auto &[id, text]: texts) {
+                    found = found || text.str().find(candidate) != std::string::npos;
+                }
+                if (!found) break;
+                length++;
+            }
+            if (i + length > previous_end) {
+                previous_end = i + length;
+                if (length >= min_length) hits.emplace_back(i, length);
+            }
+        }
+        return hits;
+    }
+
+    void expect_hits(const CorpusQuery &query, const std::string &text, size_t min_length) const {
+        const UTF8String utf8(text);
+        const auto hits = query.find(text, min_length);
+        std::vector<std::pair<size_t, size_t>> found;
+        for (const auto &hit: hits) {
+            found.emplace_back(hit.query_pos, hit.length);
+            // The named document really holds the substring there
+            ASSERT_EQ(texts.count(hit.doc_id), 1);
+            EXPECT_EQ(texts.at(hit.doc_id).substr(hit.doc_pos, hit.length), utf8.substr(hit.query_pos, hit.length))
+                << "Query: " << text;
+        }
+        EXPECT_EQ(found, brute_force(utf8, min_length)) << "Query: " << text;
+    }
+
+    std::string path;
+    DocumentStore store{UTF8String("\x01")};
+    std::map<int64_t, UTF8String> texts;
+};
+
+TEST_F(CorpusQueryTest, FindsMaximalSubstrings) {
+    add("the quick brown fox jumps over the lazy dog", 1);
+    add("გამარჯობა მსოფლიო, hello world", 4);
+    add("lorem ipsum dolor sit amet", 9);
+    for (auto type : {SuffixArrayBuilder::BuilderType::NAIVE, SuffixArrayBuilder::BuilderType::BYTE}) {
+        DuplicateFinder(type).build_index(store, path, "example.com");
+        IndexFile index(path);
+        CorpusQuery query(index);
+        expect_hits(query, "a quick brown dog jumps over the lazy fox", 5);
+        expect_hits(query, "say გამარჯობა world and hello world, ipsum dolor", 3);
+        expect_hits(query, "nothing here matches anything xyz", 12);
+        expect_hits(query, "", 3);
+
+        // Never across two documents
+        auto hits = query.find("the lazy doggამარჯობა", 4);
+        ASSERT_EQ(hits.size(), 2);
+        EXPECT_EQ(hits[0], (QueryHit{0, 12, 1, 31}));
+        EXPECT_EQ(hits[1], (QueryHit{13, 8, 4, 1}));
+    }
+}
+
+TEST_F(CorpusQueryTest, MatchesBruteForceOnRandomTexts) {
+    std::mt19937 rng(41);
+    const std::vector<std::string> alphabet = {"a", "b", "c", "ა", "ბ"};
+    auto random_text = [&](size_t length) {
+        std::string text;
+        for (size_t i = 0; i < length; ++i) {
+            text += alphabet[rng() % alphabet.size()];
+        }
+        return text;
+    };
+    for (int64_t id = 1; id <= 20; ++id) {
+        add(random_text(60), id);
+    }
+    DuplicateFinder(SuffixArrayBuilder::BuilderType::NAIVE).build_index(store, path, "random");
+    IndexFile index(path);
+    CorpusQuery query(index);
+    for (int q = 0; q < 20; ++q) {
+        expect_hits(query, random_text(80), 1 + q % 6);
+    }
+}
+
+TEST_F(CorpusQueryTest, Errors) {
+    add("hello world", 1);
+    DuplicateFinder finder(SuffixArrayBuilder::BuilderType::BYTE);
+    finder.build_index(store, path, "example.com");
+    IndexFile index(path);
+    EXPECT_THROW((void) CorpusQuery(index).find("\xff\xfe", 3), UTF8Error);
+
+    IndexFile::write_documents(path, store, "example.com");
+    IndexFile without_arrays(path);
+    EXPECT_THROW(CorpusQuery{without_arrays}, std::invalid_argument);
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <map>
+#include <random>
+#include <set>
 #include "text_processing/duplicate_finder.hpp"
 
 using namespace text_processing;
@@ -165,4 +168,724 @@ TEST_F(DuplicateFinderTest, SaveMatchesToJson) {
 
     // Clean up
     std::remove(temp_file.c_str());
-}
\ No newline at end of file
+}
+TEST_F(DuplicateFinderTest, SAISBuilderMatchesNaive) {
+    store->add_document(UTF8String("გამარჯობა მსოფლიო"), 1);
+    store->add_document(UTF8String("გამარჯობა კარგო"), 2);
+    store->add_document(UTF8String("ჩემო კარგო"), 3);
+    store->add_document(UTF8String("მსოფლიო ულამაზესია!"), 4);
+
+    DuplicateFinder sais_finder(SuffixArrayBuilder::BuilderType::SAIS);
+    EXPECT_EQ(sais_finder.find_duplicates(*store, 5), finder->find_duplicates(*store, 5));
+}
+
+TEST_F(DuplicateFinderTest, ByteBuilderMatchesNaive) {
+    store->add_document(UTF8String("გამარჯობა მსოფლიო"), 1);
+    store->add_document(UTF8String("გამარჯობა კარგო"), 2);
+    store->add_document(UTF8String("ჩემო კარგო"), 3);
+    store->add_document(UTF8String("მსოფლიო ულამაზესია!"), 4);
+    store->add_document(UTF8String("hello world"), 5);
+    store->add_document(UTF8String("Say hello world"), 6);
+
+    DuplicateFinder byte_finder(SuffixArrayBuilder::BuilderType::BYTE);
+    EXPECT_EQ(byte_finder.find_duplicates(*store, 5), finder->find_duplicates(*store, 5));
+    EXPECT_EQ(byte_finder.find_duplicates(*store, 0), finder->find_duplicates(*store, 0));
+}
+
+TEST_F(DuplicateFinderTest, DepthLimitedExtendsMatches) {
+    store->add_document(UTF8String("hello world"), 1);
+    store->add_document(UTF8String("Say hello world"), 2);
+    store->add_document(UTF8String("გამარჯობა მსოფლიო"), 3);
+    store->add_document(UTF8String("ჩემო გამარჯობა მსოფ"), 4);
+
+    FinderOptions options;
+    options.depth_limited = true;
+    DuplicateFinder limited(options);
+    EXPECT_THAT(limited.find_duplicates(*store, 3), UnorderedElementsAre(
+        create_match(1, 2, 0, 4, 11),  // "hello world"
+        create_match(3, 4, 0, 5, 14)   // "გამარჯობა მსოფ"
+    ));
+}
+
+TEST_F(DuplicateFinderTest, DepthLimitedReportsGenuineMatches) {
+    std::mt19937 rng(21);
+    const std::vector<std::string> alphabet = {"a", "b", "c", "d", "ე"};
+    for (int round = 0; round < 30; ++round) {
+        // Two documents built from shared random blocks
+        std::vector<std::string> blocks;
+        for (int b = 0; b < 4; ++b) {
+            std::string block;
+            size_t length = 20 + rng() % 30;
+            for (size_t i = 0; i < length; ++i) {
+                block += alphabet[rng() % alphabet.size()];
+            }
+            blocks.push_back(block);
+        }
+        UTF8String doc1(blocks[0] + blocks[1] + blocks[2]);
+        UTF8String doc2(blocks[3] + blocks[1] + blocks[0]);
+
+        DocumentStore pair_store;
+        pair_store.add_document(doc1, 1);
+        pair_store.add_document(doc2, 2);
+
+        FinderOptions options;
+        options.depth_limited = true;
+        DuplicateFinder limited(options);
+        DuplicateFinder full;
+        for (size_t threshold : {2, 5, 10}) {
+            auto expected = full.find_duplicates(pair_store, threshold);
+            auto matches = limited.find_duplicates(pair_store, threshold);
+            ASSERT_EQ(matches.size(), expected.size());
+            for (size_t m = 0; m < matches.size(); ++m) {
+                // Same pair, a real common substring, never longer than the full search finds
+                const auto& match = matches[m];
+                EXPECT_EQ(match.doc1_id, expected[m].doc1_id);
+                EXPECT_GE(match.length, threshold);
+                EXPECT_LE(match.length, expected[m].length);
+                EXPECT_EQ(doc1.substr(match.start_pos1, match.length), doc2.substr(match.start_pos2, match.length));
+            }
+        }
+    }
+}
+
+TEST_F(DuplicateFinderTest, DepthLimitedExtendsLongDuplicates) {
+    std::mt19937 rng(8);
+    std::string text;
+    for (int i = 0; i < 3000; ++i) {
+        text += (i % 7 == 0) ? std::string("ფ") : std::string(1, static_cast<char>('a' + rng() % 26));
+    }
+    UTF8String doc1(text);
+    store->add_document(doc1, 1);
+    store->add_document(UTF8String("##") + doc1.substr(500, 2000) + UTF8String("##"), 2);
+
+    FinderOptions options;
+    options.depth_limited = true;
+    DuplicateFinder limited(options);
+    EXPECT_THAT(limited.find_duplicates(*store, 50), ElementsAre(create_match(1, 2, 500, 2, 2000)));
+    EXPECT_EQ(limited.find_duplicates(*store, 50), finder->find_duplicates(*store, 50));
+}
+
+TEST_F(DuplicateFinderTest, ShardedMatchingIsDeterministic) {
+    // Many documents stitched from shared boilerplate blocks produce many pairs
+    std::mt19937 rng(13);
+    std::vector<std::string> blocks;
+    for (int b = 0; b < 40; ++b) {
+        std::string block;
+        for (int i = 0; i < 60; ++i) {
+            block += static_cast<char>('a' + rng() % 8);
+        }
+        blocks.push_back(block);
+    }
+    for (int64_t id = 1; id <= 600; ++id) {
+        std::string doc;
+        for (int part = 0; part < 4; ++part) {
+            doc += blocks[rng() % blocks.size()] + static_cast<char>('A' + rng() % 26);
+        }
+        store->add_document(UTF8String(doc), id);
+    }
+
+    auto expected = finder->find_duplicates(*store, 20);
+    ASSERT_GT(expected.size(), 1000);
+    for (size_t threads : {2, 3, 8}) {
+        FinderOptions options;
+        options.threads = threads;
+        DuplicateFinder sharded(options);
+        EXPECT_EQ(sharded.find_duplicates(*store, 20), expected) << "Threads: " << threads;
+    }
+}
+
+// Test that top-K returns the first K of all matches, ties included, for any thread count and builder
+TEST_F(DuplicateFinderTest, TopMatchesArePrefixOfAllMatches) {
+    std::mt19937 rng(23);
+    std::vector<std::string> blocks;
+    for (int b = 0; b < 40; ++b) {
+        std::string block;
+        for (int i = 0; i < 60; ++i) {
+            block += static_cast<char>('a' + rng() % 8);
+        }
+        blocks.push_back(block);
+    }
+    for (int64_t id = 1; id <= 600; ++id) {
+        std::string doc;
+        for (int part = 0; part < 4; ++part) {
+            doc += blocks[rng() % blocks.size()] + static_cast<char>('A' + rng() % 26);
+        }
+        store->add_document(UTF8String(doc), id);
+    }
+
+    auto all = finder->find_duplicates(*store, 20);
+    ASSERT_GT(all.size(), 1000);
+    for (auto type : {SuffixArrayBuilder::BuilderType::NAIVE, SuffixArrayBuilder::BuilderType::BYTE}) {
+        for (size_t threads : {1, 3}) {
+            for (size_t k : {1, 10, 500, 100000}) {
+                Metrics metrics;
+                FinderOptions options;
+                options.builder_type = type;
+                options.threads = threads;
+                options.top_k = k;
+                options.metrics = &metrics;
+                auto top = DuplicateFinder(options).find_duplicates(*store, 20);
+                const std::vector<Match> expected(all.begin(), all.begin() + std::min(k, all.size()));
+                EXPECT_EQ(top, expected) << "Threads: " << threads << ", k: " << k;
+                EXPECT_EQ(metrics.count("pairs_kept"), expected.size());
+            }
+        }
+    }
+}
+
+// Test that the any-match mode finds a real match, stops early and finds nothing where there is none
+TEST_F(DuplicateFinderTest, AnyMatchStopsAtFirstMatch) {
+    std::mt19937 rng(29);
+    std::string shared;
+    for (int i = 0; i < 40; ++i) {
+        shared += static_cast<char>('a' + rng() % 26);
+    }
+    for (int64_t id = 1; id <= 300; ++id) {
+        std::string doc;
+        for (int i = 0; i < 500; ++i) {
+            doc += static_cast<char>('a' + rng() % 26);
+        }
+        if (id % 50 == 0) doc.insert(100, shared);
+        store->add_document(UTF8String(doc), id);
+    }
+    auto all = finder->find_duplicates(*store, 30);
+    ASSERT_FALSE(all.empty());
+
+    for (size_t threads : {1, 2}) {
+        Metrics metrics;
+        FinderOptions options;
+        options.threads = threads;
+        options.any_match = true;
+        options.metrics = &metrics;
+        DuplicateFinder any(options);
+        auto found = any.find_duplicates(*store, 30);
+        ASSERT_EQ(found.size(), 1) << "Threads: " << threads;
+        EXPECT_GE(found[0].length, 30);
+        EXPECT_NE(found[0].doc1_id, found[0].doc2_id);
+        const auto &text = store->get_concatenated_text();
+        const auto &doc1 = store->document(static_cast<size_t>(found[0].doc1_id - 1));
+        const auto &doc2 = store->document(static_cast<size_t>(found[0].doc2_id - 1));
+        EXPECT_EQ(text.substr(doc1.start_pos + found[0].start_pos1, found[0].length).str(),
+                  text.substr(doc2.start_pos + found[0].start_pos2, found[0].length).str());
+        EXPECT_LT(metrics.count("pairs_scanned"), store->get_concatenated_text().length() - 1);
+
+        // Nothing is long enough
+        EXPECT_TRUE(any.find_duplicates(*store, 100).empty());
+    }
+}
+
+// Test that the any-match mode returns the single-threaded scan's match for any thread count
+TEST_F(DuplicateFinderTest, AnyMatchIsTheSameForEveryThreadCount) {
+    std::mt19937 rng(37);
+    auto random_text = [&](size_t length) {
+        std::string text;
+        for (size_t i = 0; i < length; ++i) {
+            text += static_cast<char>('a' + rng() % 26);
+        }
+        return text;
+    };
+    // Enough text for four shards, with pairs sharing a block all over the suffix array
+    std::vector<std::string> blocks;
+    for (int b = 0; b < 12; ++b) {
+        blocks.push_back(random_text(40));
+    }
+    for (int64_t id = 1; id <= 600; ++id) {
+        std::string doc = random_text(500);
+        if (id % 25 == 0) doc.insert(rng() % 400, blocks[rng() % blocks.size()]);
+        store->add_document(UTF8String(doc), id);
+    }
+
+    FinderOptions options;
+    options.any_match = true;
+    options.threads = 1;
+    const auto expected = DuplicateFinder(options).find_duplicates(*store, 30);
+    ASSERT_EQ(expected.size(), 1);
+    for (size_t threads : {2, 3, 4}) {
+        options.threads = threads;
+        for (int run = 0; run < 2; ++run) {
+            EXPECT_EQ(DuplicateFinder(options).find_duplicates(*store, 30), expected) << "Threads: " << threads;
+        }
+    }
+}
+
+// Test that the rolling hash engine reports the suffix arrays' matches where every repeat is shared by two documents
+TEST_F(DuplicateFinderTest, HashEngineMatchesSuffixArrays) {
+    std::mt19937 rng(31);
+    auto random_text = [&](size_t length) {
+        std::string text;
+        for (size_t i = 0; i < length; ++i) {
+            text += static_cast<char>('a' + rng() % 26);
+        }
+        return text;
+    };
+    // Documents 3k + 1 and 3k + 2 share a block, 3k + 3 shares nothing
+    for (int64_t id = 1; id <= 240; id += 3) {
+        const std::string block = random_text(30 + rng() % 40);
+        store->add_document(UTF8String(random_text(rng() % 200) + block + random_text(rng() % 100)), id);
+        store->add_document(UTF8String(random_text(rng() % 200) + block + random_text(rng() % 100)), id + 1);
+        store->add_document(UTF8String(random_text(rng() % 200)), id + 2);
+    }
+    auto sorted = finder->find_duplicates(*store, 25);
+    ASSERT_EQ(sorted.size(), 80);
+
+    for (size_t threads : {1, 4}) {
+        Metrics metrics;
+        FinderOptions options;
+        options.engine = MatchEngine::ROLLING_HASH;
+        options.threads = threads;
+        options.metrics = &metrics;
+        EXPECT_EQ(DuplicateFinder(options).find_duplicates(*store, 25), sorted) << "Threads: " << threads;
+        EXPECT_EQ(metrics.count("pairs_kept"), sorted.size());
+        EXPECT_GT(metrics.count("anchors"), 0);
+        EXPECT_EQ(metrics.phase("hash_matches").calls, 1);
+        EXPECT_EQ(metrics.phase("build_suffix_array").calls, 0);
+
+        options.prefilter = true;
+        EXPECT_EQ(DuplicateFinder(options).find_duplicates(*store, 25), sorted);
+        options.prefilter = false;
+        options.top_k = 3;
+        EXPECT_EQ(DuplicateFinder(options).find_duplicates(*store, 25),
+                  std::vector<Match>(sorted.begin(), sorted.begin() + 3));
+        options.any_match = true;
+        auto any = DuplicateFinder(options).find_duplicates(*store, 25);
+        ASSERT_EQ(any.size(), 1);
+        EXPECT_GE(any[0].length, 25);
+    }
+
+    EXPECT_EQ(DuplicateFinder::engine_from_string("hash"), MatchEngine::ROLLING_HASH);
+    EXPECT_EQ(DuplicateFinder::engine_from_string("suffix-array"), MatchEngine::SUFFIX_ARRAY);
+    EXPECT_THROW(DuplicateFinder::engine_from_string("bloom"), std::invalid_argument);
+}
+
+TEST_F(DuplicateFinderTest, ExternalBuilderMatchesNaive) {
+    std::mt19937 rng(17);
+    std::vector<std::string> blocks = {"გამარჯობა მსოფლიო", "hello world", "ჩემო კარგო"};
+    for (int b = 0; b < 20; ++b) {
+        std::string block;
+        for (int i = 0; i < 40; ++i) {
+            block += static_cast<char>('a' + rng() % 6);
+        }
+        blocks.push_back(block);
+    }
+    for (int64_t id = 1; id <= 200; ++id) {
+        std::string doc;
+        for (int part = 0; part < 3; ++part) {
+            doc += blocks[rng() % blocks.size()] + static_cast<char>('A' + rng() % 26);
+        }
+        store->add_document(UTF8String(doc), id);
+    }
+
+    // A small budget spreads the suffixes over many buckets
+    FinderOptions options;
+    options.builder_type = SuffixArrayBuilder::BuilderType::EXTERNAL;
+    options.memory_budget = 4096;
+    options.threads = 2;
+    DuplicateFinder external(options);
+    EXPECT_EQ(external.find_duplicates(*store, 10), finder->find_duplicates(*store, 10));
+    EXPECT_EQ(external.find_duplicates(*store, 0), finder->find_duplicates(*store, 0));
+}
+
+class ClusterTest : public DuplicateFinderTest {
+protected:
+    // Every maximal repeat by enumerating all substrings of the documents
+    static std::vector<Cluster> brute_force_clusters(const std::vector<std::string>& documents, size_t min_length) {
+        std::vector<std::vector<std::string>> chars(documents.size());
+        for (size_t d = 0; d < documents.size(); ++d) {
+            for (size_t b = 0; b < documents[d].size();) {
+                size_t e = b + 1;
+                while (e < documents[d].size() && (static_cast<unsigned char>(documents[d][e]) & 0xC0) == 0x80) ++e;
+                chars[d].push_back(documents[d].substr(b, e - b));
+                b = e;
+            }
+        }
+
+        std::map<std::string, std::vector<std::pair<size_t, size_t>>> found;
+        for (size_t d = 0; d < chars.size(); ++d) {
+            for (size_t start = 0; start < chars[d].size(); ++start) {
+                std::string substring;
+                for (size_t end = start; end < chars[d].size(); ++end) {
+                    substring += chars[d][end];
+                    if (end + 1 - start >= std::max<size_t>(min_length, 1)) {
+                        found[substring].emplace_back(d, start);
+                    }
+                }
+            }
+        }
+
+        std::vector<Cluster> clusters;
+        for (const auto& [substring, places] : found) {
+            size_t count = 0;
+            for (size_t b = 0; b < substring.size(); ++b) {
+                count += (static_cast<unsigned char>(substring[b]) & 0xC0) != 0x80;
+            }
+            // Neighbouring characters, empty at document boundaries which never repeat
+            std::set<std::string> before;
+            std::set<std::string> after;
+            std::set<size_t> docs;
+            bool start = false;
+            bool end = false;
+            for (const auto& [d, pos] : places) {
+                docs.insert(d);
+                if (pos == 0) start = true; else before.insert(chars[d][pos - 1]);
+                if (pos + count == chars[d].size()) end = true; else after.insert(chars[d][pos + count]);
+            }
+            const bool left_maximal = start || before.size() > 1;
+            const bool right_maximal = end || after.size() > 1;
+            if (docs.size() < 2 || !left_maximal || !right_maximal) continue;
+
+            Cluster cluster{count, {}};
+            for (const auto& [d, pos] : places) {
+                cluster.occurrences.push_back({static_cast<int64_t>(d + 1), pos});
+            }
+            std::sort(cluster.occurrences.begin(), cluster.occurrences.end());
+            clusters.push_back(cluster);
+        }
+        std::sort(clusters.begin(), clusters.end());
+        return clusters;
+    }
+
+    void add_documents(const std::vector<std::string>& documents) {
+        for (size_t i = 0; i < documents.size(); ++i) {
+            store->add_document(UTF8String(documents[i]), static_cast<int64_t>(i + 1));
+        }
+    }
+
+    static std::vector<std::string> random_documents(size_t count, unsigned seed) {
+        std::mt19937 rng(seed);
+        const std::vector<std::string> blocks = {"გამარჯობა", "hello world", "ჩემო კარგო", "say hello", "abcab"};
+        std::vector<std::string> documents;
+        for (size_t i = 0; i < count; ++i) {
+            std::string doc;
+            for (int part = 0; part < 3; ++part) {
+                doc += blocks[rng() % blocks.size()] + static_cast<char>('a' + rng() % 4);
+            }
+            documents.push_back(doc);
+        }
+        return documents;
+    }
+};
+
+TEST_F(ClusterTest, BoilerplateIsOneCluster) {
+    const std::string boilerplate = "Copyright 2024 Example Inc.";
+    std::vector<std::string> documents;
+    // Preceded by a different character in every document, so no longer repeat covers some of them
+    for (int i = 0; i < 26; ++i) {
+        documents.push_back("Article " + std::to_string(i * 7919) + static_cast<char>('A' + i) + boilerplate);
+    }
+    add_documents(documents);
+
+    auto clusters = finder->find_clusters(*store, 20);
+    ASSERT_EQ(clusters.size(), 1);
+    EXPECT_EQ(clusters[0].length, boilerplate.size());
+    ASSERT_EQ(clusters[0].occurrences.size(), documents.size());
+    for (size_t i = 0; i < documents.size(); ++i) {
+        EXPECT_EQ(clusters[0].occurrences[i], (Occurrence{static_cast<int64_t>(i + 1), documents[i].size() - boilerplate.size()}));
+    }
+    // Pairwise matching reports the same text once per document pair
+    EXPECT_GT(finder->find_duplicates(*store, 20).size(), clusters.size());
+}
+
+TEST_F(ClusterTest, OnlyMaximalRepeats) {
+    // "xabcy" repeats, so its substrings like "abc" or "bcy" are not reported on their own
+    add_documents({"xabcy", "1xabcy", "xabcy2"});
+    auto clusters = finder->find_clusters(*store, 2);
+    ASSERT_EQ(clusters.size(), 1);
+    EXPECT_EQ(clusters[0], (Cluster{5, {{1, 0}, {2, 1}, {3, 0}}}));
+
+    // Occurring once more by itself, "abc" becomes a cluster of its own
+    store->add_document(UTF8String("-abc-"), 4);
+    clusters = finder->find_clusters(*store, 2);
+    ASSERT_EQ(clusters.size(), 2);
+    EXPECT_EQ(clusters[1], (Cluster{3, {{1, 1}, {2, 2}, {3, 1}, {4, 1}}}));
+
+    // Repeats within one document are not duplicates
+    DocumentStore single;
+    single.add_document(UTF8String("abcabcabc"), 1);
+    EXPECT_TRUE(finder->find_clusters(single, 1).empty());
+    EXPECT_TRUE(finder->find_clusters(DocumentStore(), 1).empty());
+}
+
+TEST_F(ClusterTest, MatchesBruteForce) {
+    const auto documents = random_documents(30, 21);
+    add_documents(documents);
+    for (auto type : {SuffixArrayBuilder::BuilderType::NAIVE, SuffixArrayBuilder::BuilderType::SAIS,
+                      SuffixArrayBuilder::BuilderType::BYTE, SuffixArrayBuilder::BuilderType::EXTERNAL}) {
+        FinderOptions options;
+        options.builder_type = type;
+        options.memory_budget = 2048;
+        DuplicateFinder typed(options);
+        for (size_t threshold : {0, 1, 4, 10, 20}) {
+            EXPECT_EQ(typed.find_clusters(*store, threshold), brute_force_clusters(documents, threshold))
+                << "Builder: " << static_cast<int>(type) << ", threshold: " << threshold;
+        }
+    }
+}
+
+TEST_F(ClusterTest, ShardedClustersAreDeterministic) {
+    std::mt19937 rng(13);
+    std::vector<std::string> blocks;
+    for (int b = 0; b < 40; ++b) {
+        std::string block;
+        for (int i = 0; i < 60; ++i) {
+            block += static_cast<char>('a' + rng() % 8);
+        }
+        blocks.push_back(block);
+    }
+    for (int64_t id = 1; id <= 600; ++id) {
+        std::string doc;
+        for (int part = 0; part < 4; ++part) {
+            doc += blocks[rng() % blocks.size()] + static_cast<char>('A' + rng() % 26);
+        }
+        store->add_document(UTF8String(doc), id);
+    }
+
+    auto expected = finder->find_clusters(*store, 20);
+    ASSERT_GT(expected.size(), 40);
+    for (size_t threads : {2, 3}) {
+        FinderOptions options;
+        options.threads = threads;
+        DuplicateFinder sharded(options);
+        EXPECT_EQ(sharded.find_clusters(*store, 20), expected) << "Threads: " << threads;
+    }
+    FinderOptions options;
+    options.builder_type = SuffixArrayBuilder::BuilderType::EXTERNAL;
+    options.memory_budget = 1 << 16;
+    options.threads = 2;
+    DuplicateFinder external(options);
+    EXPECT_EQ(external.find_clusters(*store, 20), expected);
+}
+
+class PrefixShardTest : public DuplicateFinderTest {
+protected:
+    // Documents stitched from shared blocks, with multi-byte characters in some of them
+    void fill_store(unsigned seed, int documents) {
+        std::mt19937 rng(seed);
+        std::vector<std::string> blocks = {"გამარჯობა მსოფლიო", "hello world", "ჩემო კარგო", "კარგი დღე"};
+        for (int b = 0; b < 20; ++b) {
+            std::string block;
+            for (int i = 0; i < 30; ++i) {
+                block += static_cast<char>('a' + rng() % 6);
+            }
+            blocks.push_back(block);
+        }
+        for (int64_t id = 1; id <= documents; ++id) {
+            std::string doc;
+            for (int part = 0; part < 3; ++part) {
+                doc += blocks[rng() % blocks.size()] + static_cast<char>('A' + rng() % 26);
+            }
+            store->add_document(UTF8String(doc), id);
+        }
+    }
+
+    static std::vector<Match> run_shards(const DuplicateFinder& sharded, const DocumentStore& documents,
+                                         size_t min_length, size_t shards) {
+        std::vector<ShardResult> results;
+        // Any order of the results merges the same
+        for (size_t shard = shards; shard-- > 0;) {
+            results.push_back(sharded.find_shard(documents, min_length, shard, shards));
+        }
+        return sharded.merge_shards(documents, std::move(results));
+    }
+};
+
+// Test that merged shards equal an unsharded run, ties included, for any shard count and bucket size
+TEST_F(PrefixShardTest, MatchesUnshardedRun) {
+    fill_store(19, 150);
+    for (size_t budget : {size_t{0}, size_t{2048}}) {
+        FinderOptions options;
+        options.memory_budget = budget;
+        options.threads = 2;
+        DuplicateFinder sharded(options);
+        for (size_t min_length : {1, 10, 40}) {
+            const auto expected = finder->find_duplicates(*store, min_length);
+            for (size_t shards : {1, 2, 5, 40}) {
+                EXPECT_EQ(run_shards(sharded, *store, min_length, shards), expected)
+                    << "Budget: " << budget << ", threshold: " << min_length << ", shards: " << shards;
+            }
+            EXPECT_EQ(sharded.find_duplicates_sharded(*store, min_length, 7), expected);
+        }
+    }
+}
+
+// Test that shards split the suffixes into contiguous parts of about equal size
+TEST_F(PrefixShardTest, ShardsPartitionTheSuffixes) {
+    fill_store(23, 300);
+    const size_t suffixes = store->get_concatenated_text().length();
+    const size_t shards = 4;
+    uint64_t next = 0;
+    for (size_t shard = 0; shard < shards; ++shard) {
+        const auto result = finder->find_shard(*store, 20, shard, shards);
+        EXPECT_EQ(result.suffix_begin, next);
+        EXPECT_GT(result.suffix_count, suffixes / shards / 2) << "Shard: " << shard;
+        EXPECT_LT(result.suffix_count, suffixes / shards * 2) << "Shard: " << shard;
+        EXPECT_EQ(result.text_size, store->get_concatenated_text().str().size());
+        next += result.suffix_count;
+    }
+    EXPECT_EQ(next, suffixes);
+}
+
+TEST_F(PrefixShardTest, EmptyAndTinyStores) {
+    EXPECT_TRUE(finder->find_duplicates_sharded(*store, 5, 3).empty());
+    EXPECT_EQ(finder->find_shard(*store, 5, 0, 1).suffix_count, 0);
+
+    store->add_document(UTF8String("hello world"), 1);
+    store->add_document(UTF8String("say hello world"), 2);
+    EXPECT_EQ(run_shards(*finder, *store, 5, 100), finder->find_duplicates(*store, 5));
+}
+
+TEST_F(PrefixShardTest, RejectsIncompleteResults) {
+    fill_store(29, 40);
+    EXPECT_THROW((void) finder->find_shard(*store, 5, 3, 3), std::invalid_argument);
+
+    std::vector<ShardResult> results = {finder->find_shard(*store, 5, 0, 3), finder->find_shard(*store, 5, 2, 3)};
+    EXPECT_THROW((void) finder->merge_shards(*store, results), std::invalid_argument);
+
+    results.insert(results.begin() + 1, finder->find_shard(*store, 6, 1, 3));
+    EXPECT_THROW((void) finder->merge_shards(*store, results), std::invalid_argument);
+
+    results[1] = finder->find_shard(*store, 5, 1, 3);
+    EXPECT_EQ(finder->merge_shards(*store, results), finder->find_duplicates(*store, 5));
+
+    // Planned with another budget, the shards do not line up
+    FinderOptions options;
+    options.memory_budget = 256;
+    results[1] = DuplicateFinder(options).find_shard(*store, 5, 1, 3);
+    EXPECT_THROW((void) finder->merge_shards(*store, results), std::invalid_argument);
+}
+
+// Test that dropping documents without shared fingerprints leaves the matches unchanged
+TEST_F(PrefixShardTest, PrefilterKeepsMatches) {
+    fill_store(31, 120);
+    // Documents that share nothing with the others
+    std::mt19937 rng(37);
+    for (int64_t id = 1000; id < 1040; ++id) {
+        std::string doc;
+        for (int i = 0; i < 200; ++i) {
+            doc += static_cast<char>('a' + rng() % 26);
+        }
+        store->add_document(UTF8String(doc), id);
+    }
+    for (auto type : {SuffixArrayBuilder::BuilderType::NAIVE, SuffixArrayBuilder::BuilderType::SAIS,
+                      SuffixArrayBuilder::BuilderType::BYTE}) {
+        Metrics metrics;
+        FinderOptions options;
+        options.builder_type = type;
+        options.threads = 2;
+        options.prefilter = true;
+        options.metrics = &metrics;
+        DuplicateFinder filtered(options);
+        for (size_t min_length : {8, 20, 50}) {
+            EXPECT_EQ(filtered.find_duplicates(*store, min_length), finder->find_duplicates(*store, min_length))
+                << "Threshold: " << min_length;
+        }
+        EXPECT_EQ(metrics.phase("prefilter").calls, 3);
+        EXPECT_GE(metrics.count("dropped_documents"), 3 * 40);
+        EXPECT_EQ(metrics.count("candidate_documents") + metrics.count("dropped_documents"), 3 * 160);
+        EXPECT_GT(metrics.count("fingerprints"), 0);
+    }
+
+    // Below the smallest threshold of the filter every document is kept
+    Metrics metrics;
+    FinderOptions options;
+    options.prefilter = true;
+    options.metrics = &metrics;
+    EXPECT_EQ(DuplicateFinder(options).find_duplicates(*store, 5), finder->find_duplicates(*store, 5));
+    EXPECT_EQ(metrics.phase("prefilter").calls, 0);
+}
+
+// Test that dropped documents between the candidates change only the pairs of documents ending alike
+TEST_F(PrefixShardTest, PrefilterWithInterleavedDocumentsAndSharedEnds) {
+    std::mt19937 rng(41);
+    std::vector<std::string> blocks = {"გამარჯობა მსოფლიო", "hello world", "ჩემო კარგო", "კარგი დღე"};
+    for (int b = 0; b < 12; ++b) {
+        std::string block;
+        for (int i = 0; i < 30; ++i) {
+            block += static_cast<char>('a' + rng() % 6);
+        }
+        blocks.push_back(block);
+    }
+    // Endings of at least the largest threshold, so suffixes of candidates run into the separator
+    const std::vector<std::string> endings = {"ბოლო სიტყვა ბოლო სიტყვა ბოლო სიტყვა ბოლო სიტყვა ბოლო",
+                                              "the very same closing words of several documents here"};
+
+    const auto text_of = [](const DocumentStore &documents, int64_t id, size_t pos, size_t length) {
+        for (size_t d = 0; d < documents.document_count(); ++d) {
+            const auto &doc = documents.document(d);
+            if (doc.sql_id == id) {
+                return documents.get_concatenated_text().substr(doc.start_pos + pos, length).str();
+            }
+        }
+        ADD_FAILURE() << "No document " << id;
+        return std::string();
+    };
+
+    for (bool shared_ends : {false, true}) {
+        store->clear();
+        for (int64_t id = 1; id <= 120; ++id) {
+            std::string doc;
+            for (int part = 0; part < 3; ++part) {
+                doc += blocks[rng() % blocks.size()] + static_cast<char>('A' + rng() % 26);
+            }
+            // Ends unique to the document, unless it gets one of the shared endings
+            doc += std::to_string(id);
+            if (shared_ends && id % 4 == 0) {
+                doc += endings[rng() % endings.size()];
+            }
+            store->add_document(UTF8String(doc), id);
+            // A document sharing nothing with the others after every candidate
+            std::string unique;
+            for (int i = 0; i < 200; ++i) {
+                unique += static_cast<char>('a' + rng() % 26);
+            }
+            store->add_document(UTF8String(unique), 1000 + id);
+        }
+
+        for (auto type : {SuffixArrayBuilder::BuilderType::NAIVE, SuffixArrayBuilder::BuilderType::SAIS,
+                          SuffixArrayBuilder::BuilderType::BYTE}) {
+            Metrics metrics;
+            FinderOptions options;
+            options.builder_type = type;
+            options.prefilter = true;
+            options.metrics = &metrics;
+            DuplicateFinder filtered(options);
+            for (size_t min_length : {8, 20, 50}) {
+                const auto expected = finder->find_duplicates(*store, min_length);
+                const auto matches = filtered.find_duplicates(*store, min_length);
+
+                // Documents whose last min_length characters also end another document
+                std::map<std::string, std::vector<int64_t>> by_ending;
+                for (size_t d = 0; d < store->document_count(); ++d) {
+                    const auto &doc = store->document(d);
+                    if (doc.length >= min_length) {
+                        by_ending[text_of(*store, doc.sql_id, doc.length - min_length, min_length)]
+                            .push_back(doc.sql_id);
+                    }
+                }
+                std::set<int64_t> ending_alike;
+                for (const auto &[ending, ids] : by_ending) {
+                    if (ids.size() > 1) ending_alike.insert(ids.begin(), ids.end());
+                }
+                // Without them the matches are unchanged
+                EXPECT_EQ(ending_alike.empty(), !shared_ends);
+
+                const auto other_pairs = [&](const std::vector<Match> &all) {
+                    std::vector<Match> kept;
+                    for (const auto &match : all) {
+                        if (!ending_alike.count(match.doc1_id) && !ending_alike.count(match.doc2_id)) {
+                            kept.push_back(match);
+                        }
+                    }
+                    return kept;
+                };
+                EXPECT_EQ(other_pairs(matches), other_pairs(expected)) << "Threshold: " << min_length;
+                // The pairs of documents ending alike still get common substrings only
+                for (const auto &match : matches) {
+                    EXPECT_GE(match.length, min_length);
+                    EXPECT_EQ(text_of(*store, match.doc1_id, match.start_pos1, match.length),
+                              text_of(*store, match.doc2_id, match.start_pos2, match.length));
+                }
+            }
+            EXPECT_GE(metrics.count("dropped_documents"), 3 * 120);
+        }
+    }
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include "text_processing/duplicate_finder.hpp"
+#include "text_processing/duplicate_remover.hpp"
+
+using namespace text_processing;
+
+class DuplicateRemoverTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        store.add_document(UTF8String("გამარჯობა hello world"), 1);
+        store.add_document(UTF8String("say hello world!"), 2);
+        store.add_document(UTF8String("nothing shared"), 3);
+        store.add_document(UTF8String("hello world and გამარჯობა"), 5);
+    }
+
+    DocumentStore store;
+};
+
+TEST_F(DuplicateRemoverTest, CutsSecondCopies) {
+    auto edits = remove_duplicate_spans(store, {
+        {1, 2, 10, 4, 11},  // "hello world" of document 2
+        {1, 5, 0, 16, 9},   // "გამარჯობა" of document 5
+        {2, 5, 4, 0, 11},   // "hello world" of document 5
+    });
+    ASSERT_EQ(edits.sql_ids, (std::vector<int64_t>{2, 5}));
+    EXPECT_EQ(edits.contents, (std::vector<std::string>{"say !", " and "}));
+    EXPECT_EQ(edits.removed, 31);
+}
+
+TEST_F(DuplicateRemoverTest, MergesOverlappingSpans) {
+    auto edits = remove_duplicate_spans(store, {
+        {1, 5, 10, 0, 5},   // "hello"
+        {2, 5, 6, 2, 9},    // "llo world"
+        {1, 5, 0, 16, 9},   // "გამარჯობა", up to the end
+        {1, 5, 0, 20, 100}, // Past the end
+    });
+    ASSERT_EQ(edits.sql_ids, (std::vector<int64_t>{5}));
+    EXPECT_EQ(edits.contents[0], " and ");
+    EXPECT_EQ(edits.removed, 20);
+}
+
+TEST_F(DuplicateRemoverTest, IgnoresUnknownAndEmptyMatches) {
+    EXPECT_TRUE(remove_duplicate_spans(store, {}).sql_ids.empty());
+    auto edits = remove_duplicate_spans(store, {{1, 4, 0, 0, 5}, {1, 2, 0, 0, 0}, {1, 3, 0, 14, 3}});
+    EXPECT_TRUE(edits.sql_ids.empty());
+    EXPECT_EQ(edits.removed, 0);
+}
+
+// Test that every removed match still has a copy left after the cut
+TEST_F(DuplicateRemoverTest, KeepsOneCopyOfFoundDuplicates) {
+    auto matches = DuplicateFinder().find_duplicates(store, 5);
+    ASSERT_FALSE(matches.empty());
+    auto edits = remove_duplicate_spans(store, matches);
+
+    std::string remaining;
+    for (size_t i = 0, e = 0; i < store.document_count(); ++i) {
+        const auto &doc = store.document(i);
+        if (e < edits.sql_ids.size() && edits.sql_ids[e] == doc.sql_id) {
+            remaining += edits.contents[e++] + "\n";
+        } else {
+            remaining += store.get_concatenated_text().str().substr(doc.byte_start, doc.byte_length) + "\n";
+        }
+    }
+    EXPECT_NE(remaining.find("hello world"), std::string::npos);
+    EXPECT_NE(remaining.find("გამარჯობა"), std::string::npos);
+    EXPECT_EQ(remaining.find("hello world"), remaining.rfind("hello world"));
+}
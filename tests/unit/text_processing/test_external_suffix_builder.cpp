@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <filesystem>
+#include <random>
+#include "text_processing/byte_suffix_builder.hpp"
+#include "text_processing/external_suffix_builder.hpp"
+#include "text_processing/suffix_array_builder.hpp"
+
+using namespace text_processing;
+
+class ExternalSuffixBuilderTest : public ::testing::Test {
+protected:
+    // Helper to compare both arrays against the in-memory byte builder
+    static void expectSameAsByte(const std::string& input, size_t memory_budget) {
+        UTF8String text(input);
+        ByteSuffixBuilder reference;
+        ExternalSuffixBuilder builder(memory_budget);
+        ASSERT_TRUE(reference.build(text));
+        ASSERT_TRUE(builder.build(text));
+
+        ASSERT_EQ(builder.suffix_count(), reference.get_array().size()) << "Input: " << input;
+        EXPECT_EQ(builder.get_array(), reference.get_array()) << "Input: " << input;
+        EXPECT_EQ(builder.get_lcp_array(), reference.get_lcp_array()) << "Input: " << input;
+        // The caller's text, not a copy
+        EXPECT_EQ(&builder.get_text(), &text);
+    }
+};
+
+TEST_F(ExternalSuffixBuilderTest, EmptyString) {
+    ExternalSuffixBuilder builder;
+    EXPECT_THROW(builder.build(UTF8String("")), std::runtime_error);
+    EXPECT_FALSE(builder.is_built());
+    EXPECT_THROW((void) builder.suffix_count(), std::runtime_error);
+    EXPECT_EQ(builder.get_text().length(), 0);
+}
+
+TEST_F(ExternalSuffixBuilderTest, AsciiMatchesByteBuilder) {
+    ExternalSuffixBuilder builder;
+    ASSERT_TRUE(builder.build(UTF8String("banana$")));
+    EXPECT_EQ(builder.get_array(), std::vector<size_t>({6, 5, 3, 1, 0, 4, 2}));
+    EXPECT_EQ(builder.get_lcp_array(), std::vector<size_t>({0, 1, 3, 0, 0, 2}));
+    EXPECT_EQ(builder.unit(), SuffixArrayBuilder::Unit::BYTE);
+    EXPECT_FALSE(builder.in_memory());
+    EXPECT_EQ(builder.bucket_count(), 1);
+}
+
+TEST_F(ExternalSuffixBuilderTest, SmallBudgetSplitsIntoBuckets) {
+    // Two 32-bit entries per bucket force a split on almost every prefix
+    ExternalSuffixBuilder builder(16);
+    ASSERT_TRUE(builder.build(UTF8String("banana$")));
+    EXPECT_EQ(builder.get_array(), std::vector<size_t>({6, 5, 3, 1, 0, 4, 2}));
+    EXPECT_EQ(builder.get_lcp_array(), std::vector<size_t>({0, 1, 3, 0, 0, 2}));
+    EXPECT_GT(builder.bucket_count(), 3);
+}
+
+TEST_F(ExternalSuffixBuilderTest, LcpStopsAtCharacterBoundary) {
+    // "é" (C3 A9) and "è" (C3 A8) share their lead byte
+    expectSameAsByte("xé$xè", 16);
+    expectSameAsByte("გამარჯობა მსოფლიო$გამარჯობა კარგო$ჩემო კარგო$", 16);
+    expectSameAsByte("👋🌍👋🌍$", 8);
+}
+
+TEST_F(ExternalSuffixBuilderTest, RepetitiveText) {
+    // A long shared prefix is skipped by one extension instead of a split per byte
+    std::string input;
+    for (int i = 0; i < 50; ++i) {
+        input += "abcabcabc";
+    }
+    expectSameAsByte(input, 16);
+    expectSameAsByte(std::string(300, 'a'), 16);
+    expectSameAsByte(std::string(300, 'a') + "b" + std::string(300, 'a'), 64);
+}
+
+TEST_F(ExternalSuffixBuilderTest, TextWithNulCharacters) {
+    expectSameAsByte(std::string("a\0b\0a\0b", 7), 8);
+    expectSameAsByte(std::string("\0\0\0", 3), 8);
+}
+
+TEST_F(ExternalSuffixBuilderTest, MatchesByteBuilderOnRandomText) {
+    std::mt19937 rng(11);
+    const std::vector<std::string> alphabet = {"a", "b", "$", "é", "è", "ა", "👋", "🌍"};
+    for (size_t round = 0; round < 200; ++round) {
+        std::uniform_int_distribution<size_t> len_dist(1, 150);
+        std::uniform_int_distribution<size_t> sigma_dist(1, alphabet.size());
+        std::uniform_int_distribution<size_t> budget_dist(1, 256);
+        size_t sigma = sigma_dist(rng);
+        std::uniform_int_distribution<size_t> char_dist(0, sigma - 1);
+
+        std::string input;
+        size_t len = len_dist(rng);
+        for (size_t i = 0; i < len; ++i) {
+            input += alphabet[char_dist(rng)];
+        }
+        expectSameAsByte(input, budget_dist(rng));
+    }
+}
+
+TEST_F(ExternalSuffixBuilderTest, ReadArraysReturnsRanges) {
+    std::string input;
+    for (int i = 0; i < 40; ++i) {
+        input += "hello world $ გამარჯობა " + std::to_string(i);
+    }
+    UTF8String text(input);
+    ByteSuffixBuilder reference;
+    ExternalSuffixBuilder builder(256);
+    ASSERT_TRUE(reference.build(text));
+    ASSERT_TRUE(builder.build(text));
+
+    const auto& sa = reference.get_array();
+    const auto& lcp = reference.get_lcp_array();
+    std::vector<size_t> block_sa;
+    std::vector<size_t> block_lcp;
+    for (auto [begin, end] : {std::pair<size_t, size_t>{0, 0}, {0, 17}, {100, 333}, {lcp.size() - 5, lcp.size()}}) {
+        builder.read_arrays(begin, end, block_sa, block_lcp);
+        std::vector<size_t> expected_sa;
+        std::vector<size_t> expected_lcp;
+        for (size_t i = begin; i <= end; ++i) {
+            expected_sa.push_back(sa[i]);
+            if (i < end) expected_lcp.push_back(lcp[i]);
+        }
+        EXPECT_EQ(block_sa, expected_sa);
+        EXPECT_EQ(block_lcp, expected_lcp);
+    }
+}
+
+TEST_F(ExternalSuffixBuilderTest, ScratchFilesAreRemoved) {
+    auto dir = std::filesystem::temp_directory_path() / "external_suffix_builder_test";
+    std::filesystem::remove_all(dir);
+    std::string first;
+    {
+        ExternalSuffixBuilder builder(0, dir.string());
+        ASSERT_TRUE(builder.build(UTF8String("hello$world")));
+        first = builder.scratch_path();
+        EXPECT_TRUE(std::filesystem::exists(std::filesystem::path(first) / "sa.bin"));
+
+        // A rebuild replaces the files of the previous one
+        ASSERT_TRUE(builder.build(UTF8String("another text")));
+        EXPECT_FALSE(std::filesystem::exists(first));
+        EXPECT_TRUE(std::filesystem::exists(builder.scratch_path()));
+    }
+    EXPECT_TRUE(std::filesystem::is_empty(dir));
+    std::filesystem::remove_all(dir);
+}
+
+TEST_F(ExternalSuffixBuilderTest, FactoryCreation) {
+    SuffixArrayBuilder::Options options;
+    options.memory_budget = 64;
+    auto factory_builder = SuffixArrayBuilder::create(SuffixArrayBuilder::BuilderType::EXTERNAL, options);
+    ASSERT_NE(factory_builder, nullptr);
+    EXPECT_TRUE(factory_builder->build(UTF8String("test$")));
+    EXPECT_EQ(factory_builder->unit(), SuffixArrayBuilder::Unit::BYTE);
+    EXPECT_FALSE(factory_builder->in_memory());
+    EXPECT_EQ(SuffixArrayBuilder::type_from_string("external"), SuffixArrayBuilder::BuilderType::EXTERNAL);
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <random>
+#include "text_processing/duplicate_finder.hpp"
+#include "text_processing/hash_matcher.hpp"
+
+using namespace text_processing;
+
+class HashMatcherTest : public ::testing::Test {
+protected:
+    std::mt19937 rng{23};
+    DocumentStore store{UTF8String("\x01")};
+    std::vector<std::vector<std::string>> documents; ///< Characters of every document, in store order
+    std::vector<int64_t> ids;
+
+    std::vector<std::string> random_text(size_t characters, const std::vector<std::string> &alphabet) {
+        std::vector<std::string> text;
+        for (size_t i = 0; i < characters; ++i) {
+            text.push_back(alphabet[rng() % alphabet.size()]);
+        }
+        return text;
+    }
+
+    void add(const std::vector<std::string> &characters, int64_t id) {
+        std::string text;
+        for (const auto &c: characters) {
+            text += c;
+        }
+        store.add_document(UTF8String(text), id);
+        documents.push_back(characters);
+        ids.push_back(id);
+    }
+
+    // Longest common substring of every pair by dynamic programming, with the same tie rule
+    std::map<std::pair<int64_t, int64_t>, Match> brute_force(size_t min_length) const {
+        std::map<std::pair<int64_t, int64_t>, Match> best;
+        for (size_t b = 0; b < documents.size(); ++b) {
+            for (size_t a = 0; a < b; ++a) {
+                const auto &x = documents[a];
+                const auto &y = documents[b];
+                std::vector<std::vector<size_t>> common(x.size() + 1, std::vector<size_t>(y.size() + 1));
+                size_t length = 0;
+                size_t pos_a = 0;
+                size_t pos_b = 0;
+                for (size_t i = 1; i <= x.size(); ++i) {
+                    for (size_t j = 1; j <= y.size(); ++j) {
+                        common[i][j] = x[i - 1] == y[j - 1] ? common[i - 1][j - 1] + 1 : 0;
+                        const size_t l = common[i][j];
+                        if (l == 0) continue;
+                        if (l > length || (l == length && (j - l < pos_b || (j - l == pos_b && i - l < pos_a)))) {
+                            length = l;
+                            pos_a = i - l;
+                            pos_b = j - l;
+                        }
+                    }
+                }
+                if (length < min_length) continue;
+                const Match match = ids[a] < ids[b]
+                                        ? Match{ids[a], ids[b], pos_a, pos_b, length}
+                                        : Match{ids[b], ids[a], pos_b, pos_a, length};
+                best[{match.doc1_id, match.doc2_id}] = match;
+            }
+        }
+        return best;
+    }
+
+    static std::map<std::pair<int64_t, int64_t>, Match> by_pair(const std::vector<Match> &matches) {
+        std::map<std::pair<int64_t, int64_t>, Match> pairs;
+        for (const auto &match: matches) {
+            EXPECT_TRUE(pairs.emplace(std::make_pair(match.doc1_id, match.doc2_id), match).second);
+        }
+        return pairs;
+    }
+
+    const std::vector<std::string> latin = {"a", "b", "c"};
+    const std::vector<std::string> mixed = {"a", "b", "ა", "ბ", "😀"};
+};
+
+TEST_F(HashMatcherTest, MatchesBruteForce) {
+    for (const auto *alphabet: {&latin, &mixed}) {
+        store.clear();
+        documents.clear();
+        ids.clear();
+        const auto shared = random_text(30, *alphabet);
+        for (int64_t d = 0; d < 12; ++d) {
+            auto text = random_text(rng() % 80, *alphabet);
+            if (d % 3 == 0) {
+                text.insert(text.begin() + static_cast<std::ptrdiff_t>(rng() % (text.size() + 1)),
+                            shared.begin(), shared.begin() + static_cast<std::ptrdiff_t>(10 + rng() % 20));
+            }
+            // IDs out of store order, so both orientations of a pair occur
+            add(text, d % 2 == 0 ? 100 - d : d);
+        }
+        for (size_t min_length: {1, 2, 5, 8, 13, 25}) {
+            for (size_t threads: {1, 3}) {
+                EXPECT_EQ(by_pair(find_hashed_matches(store, min_length, threads)), brute_force(min_length))
+                    << "Threshold: " << min_length << ", threads: " << threads;
+            }
+        }
+    }
+}
+
+TEST_F(HashMatcherTest, AgreesWithSuffixArrays) {
+    // Two documents: their longest common substring is always between adjacent suffixes
+    add(random_text(400, latin), 1);
+    add(random_text(400, latin), 2);
+    const auto hashed = find_hashed_matches(store, 6);
+    const auto sorted = DuplicateFinder().find_duplicates(store, 6);
+    ASSERT_EQ(hashed.size(), 1);
+    ASSERT_EQ(sorted.size(), 1);
+    EXPECT_EQ(hashed[0].length, sorted[0].length);
+
+    // More documents: every pair of the suffix arrays, at most as long
+    for (int64_t id = 3; id <= 20; ++id) {
+        add(random_text(200, latin), id);
+    }
+    const auto all = by_pair(find_hashed_matches(store, 9, 2));
+    for (const auto &match: DuplicateFinder().find_duplicates(store, 9)) {
+        const auto found = all.find({match.doc1_id, match.doc2_id});
+        ASSERT_NE(found, all.end());
+        EXPECT_GE(found->second.length, match.length);
+    }
+    EXPECT_EQ(all, brute_force(9));
+}
+
+TEST_F(HashMatcherTest, FirstOnlyAndStats) {
+    add(random_text(100, latin), 5);
+    add({"x", "y", "z"}, 6);
+    add(random_text(100, latin), 7);
+    HashMatchStats stats;
+    const auto all = find_hashed_matches(store, 4, 1, false, &stats);
+    EXPECT_EQ(by_pair(all), brute_force(4));
+    // Threshold 4 samples every 2nd window of the first two documents, where they are long enough
+    EXPECT_EQ(stats.anchors, 49);
+    EXPECT_GE(stats.anchor_hits, all.size());
+    EXPECT_GT(stats.anchor_bytes, 0);
+
+    const auto first = find_hashed_matches(store, 4, 1, true);
+    ASSERT_EQ(first.size(), 1);
+    EXPECT_EQ(first[0].doc1_id, 5);
+    EXPECT_EQ(first[0].doc2_id, 7);
+    EXPECT_GE(first[0].length, 4);
+
+    EXPECT_TRUE(find_hashed_matches(store, 101).empty());
+    DocumentStore single;
+    single.add_document(UTF8String("only one document"), 1);
+    EXPECT_TRUE(find_hashed_matches(single, 1, 1, false, &stats).empty());
+    EXPECT_EQ(stats.anchors, 0);
+}
+
+TEST_F(HashMatcherTest, FirstOnlyIsTheSameForEveryThreadCount) {
+    // Several pairs share a block, so parts scanned by different threads hold matches
+    const auto shared = random_text(40, mixed);
+    for (int64_t d = 0; d < 60; ++d) {
+        auto text = random_text(100 + rng() % 100, mixed);
+        if (d % 7 == 3) {
+            text.insert(text.begin() + static_cast<std::ptrdiff_t>(rng() % text.size()), shared.begin(),
+                        shared.end());
+        }
+        add(text, 1000 - d);
+    }
+    const auto expected = find_hashed_matches(store, 20, 1, true);
+    ASSERT_EQ(expected.size(), 1);
+    // Documents 3 and 10 are the first pair in store order
+    EXPECT_EQ(expected[0].doc1_id, 990);
+    EXPECT_EQ(expected[0].doc2_id, 997);
+    for (size_t threads: {2, 3, 4, 8}) {
+        for (int run = 0; run < 3; ++run) {
+            EXPECT_EQ(find_hashed_matches(store, 20, threads, true), expected) << "Threads: " << threads;
+        }
+    }
+}
@@ -0,0 +1,324 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include "text_processing/duplicate_finder.hpp"
+#include "text_processing/index_file.hpp"
+
+using namespace text_processing;
+
+class IndexFileTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        path = (std::filesystem::temp_directory_path() / ("index_file_test_" + name + ".idx")).string();
+        store = std::make_unique<DocumentStore>();
+        store->add_document(UTF8String("გამარჯობა მსოფლიო"), 1);
+        store->add_document(UTF8String("გამარჯობა კარგო"), 2);
+        store->add_document(UTF8String("ჩემო კარგო"), 3);
+        store->add_document(UTF8String("hello world"), 5);
+        store->add_document(UTF8String("Say hello world"), 6);
+        store->add_document(UTF8String(""), 7);
+        store->add_document(UTF8String("hello"), 8);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    std::string path;
+    std::unique_ptr<DocumentStore> store;
+};
+
+TEST_F(IndexFileTest, RoundTripsDocumentsAndText) {
+    DuplicateFinder finder(SuffixArrayBuilder::BuilderType::BYTE);
+    finder.build_index(*store, path, "example.com");
+
+    IndexFile index(path);
+    EXPECT_EQ(index.label(), "example.com");
+    EXPECT_EQ(index.text(), store->get_concatenated_text().str());
+    EXPECT_EQ(index.char_count(), store->get_concatenated_text().length());
+    EXPECT_EQ(index.unit(), SuffixArrayBuilder::Unit::BYTE);
+    EXPECT_EQ(index.suffix_count(), store->get_concatenated_text().length());
+    ASSERT_EQ(index.document_count(), store->document_count());
+    for (size_t i = 0; i < store->document_count(); ++i) {
+        const auto expected = store->document(i);
+        const auto actual = index.document(i);
+        EXPECT_EQ(actual.sql_id, expected.sql_id);
+        EXPECT_EQ(actual.start_pos, expected.start_pos);
+        EXPECT_EQ(actual.length, expected.length);
+        EXPECT_EQ(actual.byte_start, expected.byte_start);
+        EXPECT_EQ(actual.byte_length, expected.byte_length);
+    }
+
+    const auto& text = store->get_concatenated_text();
+    for (size_t byte = 0; byte <= text.str().length(); ++byte) {
+        if (byte == text.str().length() || (static_cast<unsigned char>(text.str()[byte]) & 0xC0) != 0x80) {
+            EXPECT_EQ(index.char_index(byte), text.char_index(byte)) << "Byte: " << byte;
+        }
+        if (byte < text.str().length()) {
+            EXPECT_EQ(index.document_index(byte), store->document_index_by_byte(byte)) << "Byte: " << byte;
+        }
+    }
+}
+
+TEST_F(IndexFileTest, ByteOffsetsAndIds) {
+    // Long enough for several 64-character samples
+    for (int i = 0; i < 30; ++i) {
+        store->add_document(UTF8String("ჩემო კარგო hello " + std::to_string(i)), 100 + i);
+    }
+    DuplicateFinder finder(SuffixArrayBuilder::BuilderType::SAIS);
+    finder.build_index(*store, path);
+
+    IndexFile index(path);
+    EXPECT_EQ(index.max_sql_id(), 129);
+    const auto& text = store->get_concatenated_text();
+    for (size_t pos = 0; pos <= text.length(); ++pos) {
+        EXPECT_EQ(index.byte_offset(pos), text.byte_offset(pos)) << "Char: " << pos;
+        if (pos < text.length()) {
+            EXPECT_EQ(index.document_index(pos), store->document_index(pos)) << "Char: " << pos;
+            EXPECT_EQ(index.document_index_by_byte(text.byte_offset(pos)), store->document_index(pos));
+        }
+    }
+}
+
+TEST_F(IndexFileTest, MatchesStoreForEveryThreshold) {
+    for (auto type : {SuffixArrayBuilder::BuilderType::NAIVE, SuffixArrayBuilder::BuilderType::BYTE,
+                      SuffixArrayBuilder::BuilderType::EXTERNAL}) {
+        DuplicateFinder finder(type);
+        finder.build_index(*store, path);
+        IndexFile index(path);
+        DuplicateFinder reference;
+        for (size_t threshold : {0, 1, 3, 5, 10, 100}) {
+            EXPECT_EQ(finder.find_duplicates(index, threshold), reference.find_duplicates(*store, threshold))
+                << "Threshold: " << threshold;
+        }
+    }
+}
+
+TEST_F(IndexFileTest, ClustersMatchStore) {
+    for (auto type : {SuffixArrayBuilder::BuilderType::SAIS, SuffixArrayBuilder::BuilderType::BYTE}) {
+        DuplicateFinder finder(type);
+        finder.build_index(*store, path);
+        IndexFile index(path);
+        DuplicateFinder reference;
+        for (size_t threshold : {1, 3, 5, 100}) {
+            EXPECT_EQ(finder.find_clusters(index, threshold), reference.find_clusters(*store, threshold))
+                << "Threshold: " << threshold;
+        }
+    }
+    EXPECT_FALSE(DuplicateFinder().find_clusters(*store, 5).empty());
+}
+
+TEST_F(IndexFileTest, ShardedQueryIsDeterministic) {
+    std::mt19937 rng(5);
+    std::vector<std::string> blocks;
+    for (int b = 0; b < 40; ++b) {
+        std::string block;
+        for (int i = 0; i < 60; ++i) {
+            block += static_cast<char>('a' + rng() % 8);
+        }
+        blocks.push_back(block);
+    }
+    DocumentStore large;
+    for (int64_t id = 1; id <= 600; ++id) {
+        std::string doc;
+        for (int part = 0; part < 4; ++part) {
+            doc += blocks[rng() % blocks.size()] + static_cast<char>('A' + rng() % 26);
+        }
+        large.add_document(UTF8String(doc), id);
+    }
+
+    DuplicateFinder finder(SuffixArrayBuilder::BuilderType::SAIS, 4);
+    finder.build_index(large, path);
+    IndexFile index(path);
+    EXPECT_EQ(finder.find_duplicates(index, 20), DuplicateFinder().find_duplicates(large, 20));
+}
+
+TEST_F(IndexFileTest, EmptyStore) {
+    DocumentStore empty;
+    DuplicateFinder finder;
+    finder.build_index(empty, path);
+    IndexFile index(path);
+    EXPECT_EQ(index.document_count(), 0);
+    EXPECT_EQ(index.max_sql_id(), std::numeric_limits<int64_t>::min());
+    EXPECT_TRUE(finder.find_duplicates(index, 0).empty());
+}
+
+TEST_F(IndexFileTest, MoveKeepsMapping) {
+    DuplicateFinder finder(SuffixArrayBuilder::BuilderType::SAIS);
+    finder.build_index(*store, path);
+    IndexFile index(path);
+    IndexFile moved(std::move(index));
+    EXPECT_EQ(moved.text(), store->get_concatenated_text().str());
+    EXPECT_EQ(finder.find_duplicates(moved, 5), finder.find_duplicates(*store, 5));
+}
+
+TEST_F(IndexFileTest, RejectsInvalidFiles) {
+    EXPECT_THROW(IndexFile("/nonexistent/index.idx"), std::runtime_error);
+
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "not an index";
+    }
+    EXPECT_THROW(IndexFile{path}, std::runtime_error);
+
+    DuplicateFinder finder;
+    finder.build_index(*store, path);
+    std::string bytes;
+    {
+        std::ifstream in(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), {});
+    }
+
+    // Another version
+    std::string other = bytes;
+    other[8] = static_cast<char>(IndexFile::VERSION + 1);
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << other;
+    }
+    EXPECT_THROW(IndexFile{path}, std::runtime_error);
+
+    // Truncated
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << bytes.substr(0, bytes.size() - 8);
+    }
+    EXPECT_THROW(IndexFile{path}, std::runtime_error);
+}
+
+// Test the shard worker flow: a shared file without arrays, shard files, and a merge
+TEST_F(IndexFileTest, ShardsFromDocumentsFile) {
+    for (int i = 0; i < 40; ++i) {
+        store->add_document(UTF8String("ჩემო კარგო hello world " + std::to_string(i % 7)), 100 + i);
+    }
+    IndexFile::write_documents(path, *store, "example.com");
+    IndexFile index(path);
+    EXPECT_FALSE(index.has_arrays());
+    EXPECT_EQ(index.label(), "example.com");
+    EXPECT_EQ(index.text(), store->get_concatenated_text().str());
+    EXPECT_EQ(index.suffix_count(), 0);
+
+    FinderOptions options;
+    options.memory_budget = 1024;
+    DuplicateFinder finder(options);
+    std::vector<ShardResult> results;
+    for (size_t shard = 0; shard < 3; ++shard) {
+        const std::string shard_path = path + ".shard" + std::to_string(shard);
+        const auto result = finder.find_shard(index, 5, shard, 3);
+        EXPECT_EQ(result.matches, finder.find_shard(*store, 5, shard, 3).matches);
+        result.save(shard_path);
+        results.push_back(ShardResult::load(shard_path));
+        EXPECT_EQ(results.back().matches, result.matches);
+        EXPECT_EQ(results.back().last_suffix, result.last_suffix);
+        std::filesystem::remove(shard_path);
+    }
+    EXPECT_EQ(finder.merge_shards(index, results), DuplicateFinder().find_duplicates(*store, 5));
+
+    DuplicateFinder full;
+    full.build_index(*store, path);
+    EXPECT_TRUE(IndexFile(path).has_arrays());
+    EXPECT_EQ(finder.merge_shards(IndexFile(path), results), full.find_duplicates(*store, 5));
+}
+
+TEST_F(IndexFileTest, RejectsInvalidShardFiles) {
+    EXPECT_THROW(ShardResult::load("/nonexistent/shard.bin"), std::runtime_error);
+    ShardResult result = DuplicateFinder().find_shard(*store, 3, 0, 1);
+    ASSERT_FALSE(result.matches.empty());
+    result.save(path);
+    std::string bytes;
+    {
+        std::ifstream in(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), {});
+    }
+    EXPECT_EQ(bytes.size(), ShardResult::HEADER_SIZE + result.matches.size() * ShardResult::RECORD_SIZE);
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << bytes.substr(0, bytes.size() - 1);
+    }
+    EXPECT_THROW(ShardResult::load(path), std::runtime_error);
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << "not a shard";
+    }
+    EXPECT_THROW(ShardResult::load(path), std::runtime_error);
+}
+
+class IncrementalTest : public IndexFileTest {
+protected:
+    // Documents stitched from shared blocks, so new documents repeat indexed text and each other
+    static std::vector<std::string> make_documents(size_t count, unsigned seed) {
+        std::mt19937 rng(seed);
+        const std::vector<std::string> blocks = {
+            "გამარჯობა მსოფლიო", "hello world", "ჩემო კარგო", "say hello", "კარგი დღე", "quick brown fox"
+        };
+        std::vector<std::string> documents;
+        for (size_t i = 0; i < count; ++i) {
+            std::string doc;
+            for (int part = 0; part < 3; ++part) {
+                doc += blocks[rng() % blocks.size()] + std::to_string(rng() % 7);
+            }
+            documents.push_back(doc);
+        }
+        return documents;
+    }
+
+    // Matches of a full rebuild that involve a document with ID above last_old
+    static std::vector<Match> rebuilt_new_matches(const std::vector<std::string>& documents, int64_t last_old,
+                                                  size_t min_length) {
+        DocumentStore full;
+        for (size_t i = 0; i < documents.size(); ++i) {
+            full.add_document(UTF8String(documents[i]), static_cast<int64_t>(i + 1));
+        }
+        std::vector<Match> matches;
+        for (const auto& match : DuplicateFinder().find_duplicates(full, min_length)) {
+            if (match.doc2_id > last_old) {
+                matches.push_back(match);
+            }
+        }
+        return matches;
+    }
+};
+
+TEST_F(IncrementalTest, MatchesRebuildForNewDocuments) {
+    // The last indexed document shares no text, see the tie caveat of find_new_duplicates()
+    auto documents = make_documents(120, 3);
+    const int64_t last_old = 100;
+    documents[last_old - 1] = "unindexed tail ǂ";
+    DocumentStore old_store;
+    DocumentStore delta;
+    for (size_t i = 0; i < documents.size(); ++i) {
+        auto& target = static_cast<int64_t>(i + 1) <= last_old ? old_store : delta;
+        target.add_document(UTF8String(documents[i]), static_cast<int64_t>(i + 1));
+    }
+
+    for (auto type : {SuffixArrayBuilder::BuilderType::SAIS, SuffixArrayBuilder::BuilderType::BYTE}) {
+        DuplicateFinder finder(type, 3);
+        finder.build_index(old_store, path);
+        IndexFile index(path);
+        EXPECT_EQ(index.max_sql_id(), last_old);
+        for (size_t threshold : {1, 5, 12}) {
+            EXPECT_EQ(finder.find_new_duplicates(index, delta, threshold),
+                      rebuilt_new_matches(documents, last_old, threshold))
+                << "Threshold: " << threshold;
+        }
+    }
+}
+
+TEST_F(IncrementalTest, EmptyIndexOrDelta) {
+    const auto documents = make_documents(10, 4);
+    DocumentStore empty;
+    DocumentStore delta;
+    for (size_t i = 0; i < documents.size(); ++i) {
+        delta.add_document(UTF8String(documents[i]), static_cast<int64_t>(i + 1));
+    }
+
+    DuplicateFinder finder;
+    finder.build_index(empty, path);
+    IndexFile index(path);
+    EXPECT_EQ(finder.find_new_duplicates(index, delta, 5), rebuilt_new_matches(documents, 0, 5));
+    EXPECT_TRUE(finder.find_new_duplicates(index, empty, 5).empty());
+}
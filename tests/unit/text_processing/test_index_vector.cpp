@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include "text_processing/index_vector.hpp"
+
+using namespace text_processing;
+
+TEST(IndexVectorTest, WidthSelection) {
+    EXPECT_EQ(IndexVector::width_for(0), IndexVector::Width::UINT32);
+    EXPECT_EQ(IndexVector::width_for(4000000000ull), IndexVector::Width::UINT32);
+    EXPECT_EQ(IndexVector::width_for(std::numeric_limits<uint32_t>::max()), IndexVector::Width::UINT64);
+}
+
+TEST(IndexVectorTest, ValueAccessInBothWidths) {
+    for (auto width : {IndexVector::Width::UINT32, IndexVector::Width::UINT64}) {
+        IndexVector vec(width, 3);
+        vec.set(0, 7);
+        vec.set(2, 9);
+        EXPECT_EQ(vec.size(), 3);
+        EXPECT_EQ(vec[0], 7);
+        EXPECT_EQ(vec[1], 0);
+        EXPECT_EQ(vec[2], 9);
+        EXPECT_EQ(vec, std::vector<size_t>({7, 0, 9}));
+        EXPECT_EQ(vec.to_vector(), std::vector<size_t>({7, 0, 9}));
+    }
+}
+
+TEST(IndexVectorTest, HalvesMemoryBelowFourBillion) {
+    IndexVector narrow(IndexVector::Width::UINT32, 1000);
+    IndexVector wide(IndexVector::Width::UINT64, 1000);
+    EXPECT_EQ(narrow.memory_bytes() * 2, wide.memory_bytes());
+    EXPECT_EQ(narrow, wide);
+}
+
+TEST(IndexVectorTest, PushBackWidensOnOverflow) {
+    IndexVector vec;
+    vec.push_back(1);
+    vec.push_back(2);
+    EXPECT_EQ(vec.width(), IndexVector::Width::UINT32);
+
+    const size_t big = 5000000000ull;
+    vec.push_back(big);
+    EXPECT_EQ(vec.width(), IndexVector::Width::UINT64);
+    EXPECT_EQ(vec, std::vector<size_t>({1, 2, big}));
+}
+
+TEST(IndexVectorTest, AdoptsTypedStorage) {
+    IndexVector vec(std::vector<uint32_t>{3, 1, 2});
+    EXPECT_EQ(vec.width(), IndexVector::Width::UINT32);
+
+    size_t sum = 0;
+    for (size_t value : vec) {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 6);
+
+    vec.visit([](auto &values) { values.push_back(4); });
+    EXPECT_EQ(vec.size(), 4);
+    EXPECT_EQ(vec[3], 4);
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "text_processing/integer_text.hpp"
+
+using namespace text_processing;
+
+namespace {
+    // Encode a code point as UTF-8
+    std::string encode(uint32_t cp) {
+        std::string out;
+        if (cp < 0x80) {
+            out += static_cast<char>(cp);
+        } else if (cp < 0x800) {
+            out += static_cast<char>(0xC0 | (cp >> 6));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            out += static_cast<char>(0xE0 | (cp >> 12));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (cp >> 18));
+            out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+        return out;
+    }
+}
+
+TEST(IntegerTextTest, EmptyText) {
+    IntegerText view(UTF8String(""));
+    EXPECT_EQ(view.length(), 0);
+    EXPECT_EQ(view.alphabet_size(), 0);
+    EXPECT_EQ(view[0], 0);
+    EXPECT_THROW((void) view[1], std::out_of_range);
+}
+
+TEST(IntegerTextTest, RanksPreserveOrder) {
+    IntegerText view(UTF8String("banana"));
+    EXPECT_EQ(view.length(), 6);
+    EXPECT_EQ(view.alphabet_size(), 3);
+    EXPECT_EQ(view.width(), IntegerText::Width::UINT8);
+
+    std::vector<uint32_t> expected = {2, 1, 3, 1, 3, 1, 0};
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(view[i], expected[i]) << "at " << i;
+    }
+    EXPECT_EQ(view.code_point(1), 'a');
+    EXPECT_EQ(view.code_point(3), 'n');
+    EXPECT_THROW((void) view.code_point(0), std::out_of_range);
+    EXPECT_THROW((void) view.code_point(4), std::out_of_range);
+}
+
+TEST(IntegerTextTest, MultiByteCharacters) {
+    IntegerText view(UTF8String("aგ👋ა"));
+    EXPECT_EQ(view.length(), 4);
+    // Code point order: 'a' < 'ა' (U+10D0) < 'გ' (U+10D2) < '👋' (U+1F44B)
+    EXPECT_EQ(view[0], 1);
+    EXPECT_EQ(view[1], 3);
+    EXPECT_EQ(view[2], 4);
+    EXPECT_EQ(view[3], 2);
+    EXPECT_EQ(view.code_point(4), 0x1F44B);
+}
+
+TEST(IntegerTextTest, VisitExposesSentinel) {
+    IntegerText view(UTF8String("abc"));
+    view.visit([](const auto* symbols) {
+        EXPECT_EQ(symbols[0], 1);
+        EXPECT_EQ(symbols[2], 3);
+        EXPECT_EQ(symbols[3], 0);
+    });
+}
+
+TEST(IntegerTextTest, WidensForLargeAlphabets) {
+    std::string text;
+    for (uint32_t cp = 0x4E00; cp < 0x4E00 + 300; ++cp) {
+        text += encode(cp);
+    }
+    IntegerText view{UTF8String(text)};
+    EXPECT_EQ(view.width(), IntegerText::Width::UINT16);
+    EXPECT_EQ(view.alphabet_size(), 300);
+    EXPECT_EQ(view[299], 300);
+
+    // 255 distinct characters still fit a byte next to the sentinel
+    std::string narrow;
+    for (uint32_t cp = 0x4E00; cp < 0x4E00 + 255; ++cp) {
+        narrow += encode(cp);
+    }
+    EXPECT_EQ(IntegerText(UTF8String(narrow)).width(), IntegerText::Width::UINT8);
+}
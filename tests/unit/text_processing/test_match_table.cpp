@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <random>
+#include "text_processing/match_table.hpp"
+
+using namespace text_processing;
+
+TEST(MatchTableTest, KeepsLongestAndFirstOfEqual) {
+    MatchTable table;
+    table.update(0, 1, Match{1, 2, 0, 0, 5});
+    table.update(0, 1, Match{1, 2, 3, 3, 5}); // equally long, first one stays
+    table.update(0, 2, Match{1, 3, 0, 0, 4});
+    table.update(0, 2, Match{1, 3, 7, 8, 9}); // longer, replaces
+    EXPECT_EQ(table.size(), 2);
+
+    std::map<std::pair<size_t, size_t>, Match> seen;
+    table.for_each([&seen](size_t key1, size_t key2, const Match& match) {
+        seen[{key1, key2}] = match;
+    });
+    EXPECT_EQ(seen.at({0, 1}), (Match{1, 2, 0, 0, 5}));
+    EXPECT_EQ(seen.at({0, 2}), (Match{1, 3, 7, 8, 9}));
+}
+
+TEST(MatchTableTest, MatchesOrderedMapUnderGrowth) {
+    std::mt19937 rng(4);
+    MatchTable table;
+    std::map<std::pair<size_t, size_t>, Match> expected;
+    for (size_t i = 0; i < 20000; ++i) {
+        size_t key1 = rng() % 300;
+        size_t key2 = key1 + 1 + rng() % 300;
+        Match match{static_cast<int64_t>(key1), static_cast<int64_t>(key2), i, i, rng() % 50};
+        table.update(key1, key2, match);
+        auto it = expected.find({key1, key2});
+        if (it == expected.end() || match.length > it->second.length) {
+            expected[{key1, key2}] = match;
+        }
+    }
+
+    ASSERT_EQ(table.size(), expected.size());
+    table.for_each([&expected](size_t key1, size_t key2, const Match& match) {
+        EXPECT_EQ(expected.at({key1, key2}), match);
+    });
+}
+
+// Test that the held pairs are the first of a full table's sorted matches, ties included
+TEST(TopMatchesTest, HoldsBestPairsOfFullTable) {
+    std::mt19937 rng(8);
+    for (size_t limit : {1, 5, 40, 100000}) {
+        MatchTable table;
+        TopMatches top(limit);
+        for (size_t i = 0; i < 20000; ++i) {
+            size_t key1 = rng() % 100;
+            size_t key2 = key1 + 1 + rng() % 100;
+            Match match{static_cast<int64_t>(key1), static_cast<int64_t>(key2), i, i, rng() % 50};
+            table.update(key1, key2, match);
+            top.update(key1, key2, match);
+        }
+        std::vector<Match> expected;
+        table.for_each([&expected](size_t, size_t, const Match& match) {
+            expected.push_back(match);
+        });
+        std::sort(expected.begin(), expected.end());
+        expected.resize(std::min(limit, expected.size()));
+
+        std::vector<Match> held;
+        top.for_each([&held](size_t key1, size_t key2, const Match& match) {
+            EXPECT_EQ(match.doc1_id, static_cast<int64_t>(key1));
+            EXPECT_EQ(match.doc2_id, static_cast<int64_t>(key2));
+            held.push_back(match);
+        });
+        EXPECT_EQ(held, expected) << "Limit: " << limit;
+        EXPECT_EQ(top.size(), expected.size());
+    }
+}
+
+TEST(TopMatchesTest, EvictedPairComesBackLonger) {
+    TopMatches top(2);
+    top.update(0, 1, Match{1, 2, 0, 0, 5});
+    top.update(0, 2, Match{1, 3, 0, 0, 6});
+    top.update(1, 2, Match{2, 3, 0, 0, 7}); // evicts (0, 1)
+    top.update(0, 1, Match{1, 2, 4, 4, 5}); // still too short
+    top.update(0, 1, Match{1, 2, 9, 9, 8}); // back, evicts (0, 2)
+    top.update(1, 2, Match{2, 3, 1, 1, 7}); // equally long, first one stays
+
+    std::vector<Match> held;
+    top.for_each([&held](size_t, size_t, const Match& match) {
+        held.push_back(match);
+    });
+    EXPECT_EQ(held, (std::vector<Match>{{1, 2, 9, 9, 8}, {2, 3, 0, 0, 7}}));
+    EXPECT_GT(top.memory_bytes(), 0);
+    TopMatches none(0);
+    none.update(0, 1, Match{1, 2, 0, 0, 5});
+    EXPECT_EQ(none.size(), 0);
+}
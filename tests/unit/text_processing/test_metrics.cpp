@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include "text_processing/duplicate_finder.hpp"
+#include "text_processing/metrics.hpp"
+
+using namespace text_processing;
+
+TEST(MetricsTest, RecordsPhasesCountsAndPeaks) {
+    Metrics metrics;
+    metrics.add_time("load", 0.5);
+    metrics.add_time("load", 0.25);
+    metrics.add_count("documents", 3);
+    metrics.add_count("documents", 4);
+    metrics.record_peak("text", 100);
+    metrics.record_peak("text", 40);
+    metrics.record_peak("text", 120);
+
+    EXPECT_DOUBLE_EQ(metrics.phase("load").seconds, 0.75);
+    EXPECT_EQ(metrics.phase("load").calls, 2);
+    EXPECT_EQ(metrics.phase("missing").calls, 0);
+    EXPECT_EQ(metrics.count("documents"), 7);
+    EXPECT_EQ(metrics.count("missing"), 0);
+    EXPECT_EQ(metrics.peak("text"), 120);
+
+    Metrics copy = metrics;
+    metrics.clear();
+    EXPECT_EQ(metrics.count("documents"), 0);
+    EXPECT_EQ(copy.count("documents"), 7);
+}
+
+TEST(MetricsTest, ScopedTimer) {
+    Metrics metrics;
+    {
+        ScopedTimer timer(&metrics, "sleep");
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        timer.stop();
+        timer.stop();
+    }
+    EXPECT_EQ(metrics.phase("sleep").calls, 1);
+    EXPECT_GT(metrics.phase("sleep").seconds, 0);
+
+    // Without metrics nothing is recorded
+    ScopedTimer unused(nullptr, "nothing");
+}
+
+TEST(MetricsTest, Json) {
+    Metrics metrics;
+    EXPECT_EQ(metrics.to_json(), R"({"info": {}, "phases": {}, "counts": {}, "peak_bytes": {}})");
+
+    metrics.set_info("domain", "a \"quoted\"\n\x01");
+    metrics.add_time("scan", 1.5);
+    metrics.add_count("pairs_kept", 12);
+    metrics.add_count("documents", 2);
+    metrics.record_peak("lcp_array", 4096);
+    EXPECT_EQ(metrics.to_json(),
+              R"({"info": {"domain": "a \"quoted\"\n\u0001"}, "phases": {"scan": {"seconds": 1.500000, "calls": 1}}, )"
+              R"("counts": {"documents": 2, "pairs_kept": 12}, "peak_bytes": {"lcp_array": 4096}})");
+
+    const auto path = (std::filesystem::temp_directory_path() / "metrics_test.json").string();
+    metrics.save(path);
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line);
+    EXPECT_EQ(line, metrics.to_json());
+
+    Metrics::write_json(path, "[" + metrics.to_json() + "]");
+    std::ifstream again(path);
+    std::getline(again, line);
+    EXPECT_EQ(line, "[" + metrics.to_json() + "]");
+    std::filesystem::remove(path);
+    EXPECT_THROW(metrics.save("/nonexistent/stats.json"), std::runtime_error);
+    EXPECT_THROW(Metrics::write_json("/nonexistent/stats.json", "{}"), std::runtime_error);
+}
+
+TEST(MetricsTest, ConcurrentRecords) {
+    Metrics metrics;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&metrics, t] {
+            for (int i = 0; i < 1000; ++i) {
+                metrics.add_count("items", 1);
+                metrics.record_peak("size", static_cast<uint64_t>(t * 1000 + i));
+            }
+        });
+    }
+    for (auto &thread: threads) {
+        thread.join();
+    }
+    EXPECT_EQ(metrics.count("items"), 4000);
+    EXPECT_EQ(metrics.peak("size"), 3999);
+}
+
+// Test what the finder records, and that recording leaves the results alone
+TEST(MetricsTest, DuplicateFinder) {
+    DocumentStore store;
+    store.add_document(UTF8String("გამარჯობა მსოფლიო hello"), 1);
+    store.add_document(UTF8String("გამარჯობა კარგო hello"), 2);
+    store.add_document(UTF8String("ჩემო კარგო"), 3);
+
+    for (auto type: {SuffixArrayBuilder::BuilderType::SAIS, SuffixArrayBuilder::BuilderType::EXTERNAL}) {
+        Metrics metrics;
+        FinderOptions options;
+        options.builder_type = type;
+        options.threads = 2;
+        options.metrics = &metrics;
+        DuplicateFinder finder(options);
+        const auto matches = finder.find_duplicates(store, 4);
+        EXPECT_EQ(matches, DuplicateFinder(type).find_duplicates(store, 4));
+
+        const size_t length = store.get_concatenated_text().length();
+        EXPECT_EQ(metrics.phase("build_suffix_array").calls, 1);
+        EXPECT_EQ(metrics.phase("scan_matches").calls, 1);
+        EXPECT_EQ(metrics.phase("sort_matches").calls, 1);
+        EXPECT_EQ(metrics.count("suffixes"), length);
+        EXPECT_EQ(metrics.count("pairs_scanned"), length - 1);
+        EXPECT_EQ(metrics.count("pairs_kept"), matches.size());
+        EXPECT_GT(metrics.peak("match_tables"), 0);
+        if (type == SuffixArrayBuilder::BuilderType::SAIS) {
+            EXPECT_GE(metrics.peak("suffix_array"), length);
+            EXPECT_GE(metrics.peak("lcp_array"), length - 1);
+        } else {
+            // Arrays kept on disk are not held in memory
+            EXPECT_EQ(metrics.peak("suffix_array"), 0);
+        }
+
+        finder.set_metrics(nullptr);
+        (void) finder.find_duplicates(store, 4);
+        EXPECT_EQ(metrics.phase("build_suffix_array").calls, 1);
+    }
+
+    Metrics metrics;
+    DuplicateFinder finder(SuffixArrayBuilder::BuilderType::SAIS);
+    finder.set_metrics(&metrics);
+    const auto clusters = finder.find_clusters(store, 4);
+    EXPECT_EQ(metrics.count("clusters"), clusters.size());
+    EXPECT_EQ(metrics.phase("scan_clusters").calls, 1);
+}
+
+TEST(MetricsTest, LatencyPercentiles) {
+    Metrics metrics;
+    EXPECT_EQ(metrics.latency("query").percentile(0.5), 0);
+    for (int i = 1; i <= 100; ++i) {
+        metrics.record_latency("query", i * 1e-3);
+    }
+    const auto latency = metrics.latency("query");
+    EXPECT_EQ(latency.count, 100);
+    EXPECT_DOUBLE_EQ(latency.max, 0.1);
+    EXPECT_NEAR(latency.seconds, 5.05, 1e-9);
+    EXPECT_NEAR(latency.percentile(0.5), 0.05, 0.05 * 0.05);
+    EXPECT_NEAR(latency.percentile(0.99), 0.099, 0.099 * 0.05);
+    EXPECT_NEAR(latency.percentile(1), 0.1, 0.1 * 0.05);
+
+    // Below a microsecond, and only in the JSON once recorded
+    metrics.record_latency("tiny", 1e-8);
+    EXPECT_LE(metrics.latency("tiny").percentile(0.5), 1e-8);
+    EXPECT_NE(metrics.to_json().find(R"(, "latencies": {"query": {"count": 100, "p50_ms": )"), std::string::npos);
+    metrics.clear();
+    EXPECT_EQ(metrics.to_json().find("latencies"), std::string::npos);
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <algorithm>
+#include <random>
 #include "text_processing/naive_suffix_builder.hpp"
 #include "text_processing/suffix_array_builder.hpp"
 
@@ -58,6 +60,11 @@ TEST_F(NaiveSuffixBuilderTest, BasicPattern) {
     EXPECT_TRUE(buildAndVerify("abab$", {4, 2, 0, 3, 1}));
 }
 
+// Terminator that is not unique: suffix order, not cyclic shift order
+TEST_F(NaiveSuffixBuilderTest, NonUniqueTerminator) {
+    EXPECT_TRUE(buildAndVerify("ab$ab$", {5, 2, 3, 0, 4, 1}));
+}
+
 // UTF-8 Test Cases
 TEST_F(NaiveSuffixBuilderTest, GeorgianText) {
     EXPECT_TRUE(buildAndVerify("აბგ$", {3, 0, 1, 2}));
@@ -134,7 +141,7 @@ TEST_F(NaiveSuffixBuilderTest, SuffixArrayProperties) {
     }
     
     // Property 3: Uniqueness of indices
-    std::vector<size_t> sorted_sa = sa;
+    std::vector<size_t> sorted_sa = sa.to_vector();
     std::sort(sorted_sa.begin(), sorted_sa.end());
     for (size_t i = 0; i < sorted_sa.size(); ++i) {
         EXPECT_EQ(sorted_sa[i], i);
@@ -164,4 +171,177 @@ TEST_F(NaiveSuffixBuilderTest, LCPArrayProperties) {
         size_t max_possible_lcp = text.length() - std::max(sa[i], sa[i+1]);
         EXPECT_LE(lcp[i], max_possible_lcp);
     }
-}
\ No newline at end of file
+}
+// Test sorting only to a fixed depth
+TEST_F(NaiveSuffixBuilderTest, DepthLimitedBuild) {
+    const std::string input = "abcabcabcx$abcabcabcy$";
+    NaiveSuffixBuilder full;
+    ASSERT_TRUE(full.build(UTF8String(input)));
+    EXPECT_EQ(full.depth_limit(), 0);
+
+    ASSERT_TRUE(builder->build_to_depth(UTF8String(input), 3));
+    EXPECT_EQ(builder->depth_limit(), 3);
+    const auto& sa = builder->get_array();
+    const auto& lcp = builder->get_lcp_array();
+    ASSERT_EQ(sa.size(), full.get_array().size());
+
+    // Sorted by the first 3 characters, LCP capped at 3
+    UTF8String text(input);
+    for (size_t i = 0; i + 1 < sa.size(); ++i) {
+        auto a = text.substr(sa[i], std::min<size_t>(3, text.length() - sa[i])).str();
+        auto b = text.substr(sa[i + 1], std::min<size_t>(3, text.length() - sa[i + 1])).str();
+        EXPECT_LE(a, b) << "at " << i;
+        size_t expected = 0;
+        while (expected < 3 && sa[i] + expected < text.length() && sa[i + 1] + expected < text.length() &&
+               text[sa[i] + expected] == text[sa[i + 1] + expected]) {
+            expected++;
+        }
+        EXPECT_EQ(lcp[i], expected) << "at " << i;
+    }
+}
+
+// Test that a depth beyond the longest repeat gives the full result
+TEST_F(NaiveSuffixBuilderTest, DepthLimitedBuildFinishesEarly) {
+    ASSERT_TRUE(builder->build_to_depth(UTF8String("banana$"), 100));
+    EXPECT_EQ(builder->depth_limit(), 0);
+    EXPECT_EQ(builder->get_array(), std::vector<size_t>({6, 5, 3, 1, 0, 4, 2}));
+    EXPECT_EQ(builder->get_lcp_array(), std::vector<size_t>({0, 1, 3, 0, 0, 2}));
+}
+
+// Test that rebuilding with the kept workspace gives the results of a fresh builder
+TEST_F(NaiveSuffixBuilderTest, ReusesWorkspaceAcrossBuilds) {
+    const UTF8String large(std::string(2000, 'a') + "banana" + std::string(500, 'b'));
+    const UTF8String small("გამარჯობა მსოფლიო");
+    ASSERT_TRUE(builder->build(large));
+    const size_t reserved = builder->workspace().memory_bytes();
+    EXPECT_GE(reserved, 3 * large.length() * sizeof(uint32_t));
+
+    for (const auto* text : {&small, &large, &small}) {
+        for (size_t depth : {0, 3}) {
+            NaiveSuffixBuilder fresh;
+            ASSERT_TRUE(fresh.build_to_depth(*text, depth));
+            ASSERT_TRUE(builder->build_to_depth(*text, depth));
+            EXPECT_EQ(builder->get_array(), fresh.get_array()) << "Depth: " << depth;
+            EXPECT_EQ(builder->get_lcp_array(), fresh.get_lcp_array()) << "Depth: " << depth;
+            EXPECT_EQ(&builder->get_text(), text);
+        }
+    }
+    // Smaller texts reuse the arrays of larger ones
+    EXPECT_EQ(builder->workspace().memory_bytes(), reserved);
+
+    builder->release_workspace();
+    EXPECT_EQ(builder->workspace().memory_bytes(), 0);
+    ASSERT_TRUE(builder->build(UTF8String("banana")));
+    EXPECT_EQ(builder->get_array(), std::vector<size_t>({5, 3, 1, 0, 4, 2}));
+}
+
+TEST_F(NaiveSuffixBuilderTest, HugePagesGiveSameArrays) {
+    const UTF8String text("abracadabra გამარჯობა abracadabra");
+    SuffixArrayBuilder::Options options;
+    options.huge_pages = true;
+    auto huge = SuffixArrayBuilder::create(SuffixArrayBuilder::BuilderType::NAIVE, options);
+    ASSERT_TRUE(huge->build(text));
+    ASSERT_TRUE(builder->build(text));
+    EXPECT_EQ(huge->get_array(), builder->get_array());
+    EXPECT_EQ(huge->get_lcp_array(), builder->get_lcp_array());
+}
+
+// Test that an array large enough to be advised is usable and zeroed
+TEST(SuffixWorkspaceTest, HugePageBuffers) {
+    SuffixWorkspace workspace(true);
+    EXPECT_TRUE(workspace.huge_pages());
+    const size_t size = SuffixWorkspace::HUGE_PAGE_BYTES / sizeof(uint64_t) * 2 + 3;
+    auto& order = workspace.get<uint64_t>(SuffixWorkspace::Buffer::ORDER, size);
+    ASSERT_EQ(order.size(), size);
+    EXPECT_EQ(std::count(order.begin(), order.end(), 0), size);
+    order.back() = 1;
+    EXPECT_EQ(workspace.get<uint64_t>(SuffixWorkspace::Buffer::ORDER, size).back(), 1);
+}
+
+TEST(SuffixWorkspaceTest, BuffersKeepCapacityAndWidth) {
+    SuffixWorkspace workspace;
+    EXPECT_FALSE(workspace.huge_pages());
+    auto& classes = workspace.get<uint32_t>(SuffixWorkspace::Buffer::CLASSES, 100);
+    classes[0] = 7;
+    EXPECT_EQ(workspace.memory_bytes(), 100 * sizeof(uint32_t));
+
+    // Shrinking and growing within the capacity keeps the entries
+    EXPECT_EQ(workspace.get<uint32_t>(SuffixWorkspace::Buffer::CLASSES, 10)[0], 7);
+    EXPECT_EQ(&workspace.get<uint32_t>(SuffixWorkspace::Buffer::CLASSES, 100), &classes);
+    EXPECT_EQ(workspace.memory_bytes(), 100 * sizeof(uint32_t));
+
+    workspace.get<uint32_t>(SuffixWorkspace::Buffer::NEXT_CLASSES, 5)[0] = 3;
+    workspace.swap(SuffixWorkspace::Buffer::CLASSES, SuffixWorkspace::Buffer::NEXT_CLASSES);
+    EXPECT_EQ(classes.size(), 5);
+    EXPECT_EQ(classes[0], 3);
+
+    // The other index type replaces the buffer
+    workspace.get<uint64_t>(SuffixWorkspace::Buffer::CLASSES, 4);
+    EXPECT_TRUE(classes.empty());
+    EXPECT_EQ(workspace.memory_bytes(), 100 * sizeof(uint32_t) + 4 * sizeof(uint64_t));
+
+    workspace.release();
+    EXPECT_EQ(workspace.memory_bytes(), 0);
+}
+
+TEST(SuffixWorkspaceTest, GrowingPastCapacityZeroesEntries) {
+    SuffixWorkspace workspace;
+    auto& counts = workspace.get<uint64_t>(SuffixWorkspace::Buffer::COUNTS, 8);
+    std::fill(counts.begin(), counts.end(), 5);
+    const auto& grown = workspace.get<uint64_t>(SuffixWorkspace::Buffer::COUNTS, counts.capacity() + 1);
+    EXPECT_EQ(std::count(grown.begin(), grown.end(), 0), grown.size());
+}
+
+// Test that texts long enough to sort several characters at once match SA-IS, fully and to a depth
+TEST_F(NaiveSuffixBuilderTest, PackedInitialSortMatchesSAIS) {
+    std::mt19937 rng(11);
+    const std::vector<std::vector<std::string>> alphabets = {
+        {"a", "b"},
+        {"a", "b", "c", "d", " ", "$"},
+        {"a", "b", "ა", "ბ", "გ", " "},
+    };
+    for (const auto& alphabet : alphabets) {
+        // Random text with copied runs, so doubling takes several rounds
+        std::vector<std::string> characters;
+        while (characters.size() < 20000) {
+            if (characters.size() > 100 && rng() % 4 == 0) {
+                const size_t start = rng() % (characters.size() - 50);
+                const size_t length = 10 + rng() % 40;
+                for (size_t i = start; i < start + length; ++i) {
+                    characters.push_back(characters[i]);
+                }
+            } else {
+                characters.push_back(alphabet[rng() % alphabet.size()]);
+            }
+        }
+        std::string input;
+        for (const auto& character : characters) {
+            input += character;
+        }
+        const UTF8String text(input);
+        auto sais = SuffixArrayBuilder::create(SuffixArrayBuilder::BuilderType::SAIS);
+        ASSERT_TRUE(sais->build(text));
+        ASSERT_TRUE(builder->build(text));
+        EXPECT_EQ(builder->get_array(), sais->get_array());
+        EXPECT_EQ(builder->get_lcp_array(), sais->get_lcp_array());
+
+        for (size_t depth : {2, 3, 7}) {
+            ASSERT_TRUE(builder->build_to_depth(text, depth));
+            const auto& sa = builder->get_array();
+            const auto& lcp = builder->get_lcp_array();
+            for (size_t i = 0; i + 1 < sa.size(); ++i) {
+                size_t common = 0;
+                while (common < depth && sa[i] + common < text.length() && sa[i + 1] + common < text.length() &&
+                       text[sa[i] + common] == text[sa[i + 1] + common]) {
+                    common++;
+                }
+                ASSERT_EQ(lcp[i], common) << "Depth: " << depth << ", at " << i;
+                auto prefix = [&text, depth](size_t pos) {
+                    return text.substr(pos, std::min(depth, text.length() - pos)).str();
+                };
+                ASSERT_LE(prefix(sa[i]), prefix(sa[i + 1]))
+                    << "Depth: " << depth << ", at " << i;
+            }
+        }
+    }
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <random>
+#include "text_processing/parallel_suffix_builder.hpp"
+#include "text_processing/naive_suffix_builder.hpp"
+#include "text_processing/kasai_lcp.hpp"
+#include "text_processing/parallel.hpp"
+#include "text_processing/suffix_array_builder.hpp"
+
+using namespace text_processing;
+
+class ParallelSuffixBuilderTest : public ::testing::Test {
+protected:
+    // Helper to compare against the naive builder for several thread counts
+    static void expectSameAsNaive(const std::string& input, std::vector<size_t> thread_counts = {1, 2, 3, 8}) {
+        UTF8String text(input);
+        NaiveSuffixBuilder naive;
+        ASSERT_TRUE(naive.build(text));
+        for (size_t threads : thread_counts) {
+            ParallelSuffixBuilder builder(threads);
+            ASSERT_TRUE(builder.build(text));
+            EXPECT_EQ(builder.get_array(), naive.get_array()) << "Threads: " << threads;
+            EXPECT_EQ(builder.get_lcp_array(), naive.get_lcp_array()) << "Threads: " << threads;
+        }
+    }
+
+    static std::string random_text(std::mt19937& rng, size_t length, const std::vector<std::string>& alphabet) {
+        std::uniform_int_distribution<size_t> char_dist(0, alphabet.size() - 1);
+        std::string input;
+        for (size_t i = 0; i < length; ++i) {
+            input += alphabet[char_dist(rng)];
+        }
+        return input;
+    }
+};
+
+TEST_F(ParallelSuffixBuilderTest, EmptyString) {
+    ParallelSuffixBuilder builder(2);
+    EXPECT_THROW(builder.build(UTF8String("")), std::runtime_error);
+    EXPECT_FALSE(builder.is_built());
+    EXPECT_THROW((void) builder.get_array(), std::runtime_error);
+}
+
+TEST_F(ParallelSuffixBuilderTest, BananaTest) {
+    ParallelSuffixBuilder builder(4);
+    ASSERT_TRUE(builder.build(UTF8String("banana$")));
+    EXPECT_EQ(builder.get_array(), std::vector<size_t>({6, 5, 3, 1, 0, 4, 2}));
+    EXPECT_EQ(builder.get_lcp_array(), std::vector<size_t>({0, 1, 3, 0, 0, 2}));
+    EXPECT_EQ(builder.get_text(), UTF8String("banana$"));
+}
+
+TEST_F(ParallelSuffixBuilderTest, FactoryCreation) {
+    auto builder = SuffixArrayBuilder::create(SuffixArrayBuilder::BuilderType::PARALLEL, 3);
+    ASSERT_NE(builder, nullptr);
+    EXPECT_EQ(dynamic_cast<ParallelSuffixBuilder&>(*builder).threads(), 3);
+    EXPECT_TRUE(builder->build(UTF8String("test$")));
+    EXPECT_EQ(SuffixArrayBuilder::type_from_string("parallel"), SuffixArrayBuilder::BuilderType::PARALLEL);
+    EXPECT_GE(ParallelSuffixBuilder(0).threads(), 1);
+}
+
+TEST_F(ParallelSuffixBuilderTest, MatchesNaiveOnSmallInputs) {
+    expectSameAsNaive("a");
+    expectSameAsNaive("aaaa");
+    expectSameAsNaive("hello world$Say hello world$");
+    expectSameAsNaive("გამარჯობა მსოფლიო$გამარჯობა კარგო$ჩემო კარგო$");
+    expectSameAsNaive("👋🌍👋🌍$");
+}
+
+TEST_F(ParallelSuffixBuilderTest, MatchesNaiveOnRandomText) {
+    std::mt19937 rng(11);
+    const std::vector<std::string> alphabet = {"a", "b", "c", "$", "ა", "ბ"};
+    for (size_t round = 0; round < 100; ++round) {
+        std::uniform_int_distribution<size_t> len_dist(1, 80);
+        std::uniform_int_distribution<size_t> sigma_dist(1, alphabet.size());
+        std::vector<std::string> sub(alphabet.begin(), alphabet.begin() + sigma_dist(rng));
+        expectSameAsNaive(random_text(rng, len_dist(rng), sub), {1, 3});
+    }
+}
+
+TEST_F(ParallelSuffixBuilderTest, MatchesNaiveOnLargeGroups) {
+    // Groups above the parallel sort threshold, long repeats and a single run
+    std::mt19937 rng(5);
+    expectSameAsNaive(random_text(rng, 100000, {"a", "b"}), {1, 4});
+    std::string block = random_text(rng, 5000, {"x", "y", "z", "ჯ"});
+    expectSameAsNaive(block + block + block + "$" + block, {1, 4});
+    expectSameAsNaive(std::string(70000, 'a'), {1, 5});
+}
+
+TEST(ParallelLcpTest, MatchesKasai) {
+    std::mt19937 rng(3);
+    for (size_t round = 0; round < 50; ++round) {
+        std::uniform_int_distribution<size_t> len_dist(1, 2000);
+        std::string input;
+        size_t len = len_dist(rng);
+        for (size_t i = 0; i < len; ++i) {
+            input += static_cast<char>('a' + rng() % 3);
+        }
+        UTF8String text(input);
+        NaiveSuffixBuilder naive;
+        ASSERT_TRUE(naive.build(text));
+        auto sa_values = naive.get_array().to_vector();
+        std::vector<uint32_t> sa(sa_values.begin(), sa_values.end());
+
+        IntegerText symbols(text);
+        std::vector<uint32_t> expected;
+        std::vector<uint32_t> actual;
+        symbols.visit([&](const auto* s) {
+            kasai_lcp(s, sa, expected);
+            parallel_plcp_lcp(s, sa, actual, 1 + round % 7);
+        });
+        EXPECT_EQ(actual, expected);
+    }
+}
+
+TEST(ParallelTest, ParallelForCoversRangeInChunks) {
+    std::vector<int> hits(1000, 0);
+    std::vector<size_t> chunk_begin(4, 0);
+    parallel_for(0, hits.size(), 4, [&](size_t begin, size_t end, size_t chunk) {
+        chunk_begin[chunk] = begin;
+        for (size_t i = begin; i < end; ++i) hits[i]++;
+    });
+    EXPECT_THAT(hits, ::testing::Each(1));
+    EXPECT_THAT(chunk_begin, ::testing::ElementsAre(0, 250, 500, 750));
+
+    EXPECT_THROW(parallel_for(0, 10, 3, [](size_t begin, size_t, size_t) {
+        if (begin > 0) throw std::runtime_error("chunk failed");
+    }), std::runtime_error);
+}
+
+TEST(ParallelTest, ParallelSortMatchesSort) {
+    std::mt19937 rng(9);
+    std::vector<uint32_t> values(50000);
+    for (auto& v : values) v = rng() % 1000;
+    std::vector<uint32_t> expected = values;
+    std::sort(expected.begin(), expected.end());
+    parallel_sort(values.begin(), values.end(), 6, std::less<>());
+    EXPECT_EQ(values, expected);
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <sstream>
+#include "text_processing/duplicate_finder.hpp"
+#include "text_processing/query_server.hpp"
+
+using namespace text_processing;
+
+class QueryServerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        const auto dir = std::filesystem::temp_directory_path();
+        first_path = (dir / ("query_server_test_" + name + "_a.idx")).string();
+        second_path = (dir / ("query_server_test_" + name + "_b.idx")).string();
+
+        DocumentStore first{UTF8String("\x01")};
+        first.add_document(UTF8String("the quick brown fox jumps over the lazy dog"), 3);
+        first.add_document(UTF8String("გამარჯობა მსოფლიო"), 7);
+        DuplicateFinder(SuffixArrayBuilder::BuilderType::BYTE).build_index(first, first_path, "a.com");
+
+        DocumentStore second{UTF8String("\x01")};
+        second.add_document(UTF8String("lorem ipsum dolor sit amet"), 1);
+        DuplicateFinder().build_index(second, second_path, "b.com");
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(first_path);
+        std::filesystem::remove(second_path);
+    }
+
+    std::string first_path;
+    std::string second_path;
+};
+
+TEST_F(QueryServerTest, ParsesRequests) {
+    auto request = QueryRequest::parse(
+        R"({"id": "x\"1", "domain": "a.com", "text": "line\nnext გ😀 \/", "threshold": 12, "extra": null})");
+    EXPECT_EQ(request.id, "x\"1");
+    EXPECT_EQ(request.domain, "a.com");
+    EXPECT_EQ(request.text, "line\nnext გ😀 /");
+    EXPECT_EQ(request.threshold, 12);
+    EXPECT_TRUE(request.command.empty());
+
+    request = QueryRequest::parse(R"( {"id": 42, "score": -1.5e3, "flag": true, "text": "გამარჯობა"} )");
+    EXPECT_EQ(request.id, "42");
+    EXPECT_EQ(request.text, "გამარჯობა");
+    EXPECT_EQ(request.threshold, 0);
+    EXPECT_EQ(QueryRequest::parse(R"({"command": "stats"})").command, "stats");
+    EXPECT_EQ(QueryRequest::parse("{}").id, "");
+    EXPECT_EQ(QueryRequest::parse(R"({"id": 18446744073709551615})").id, "18446744073709551615");
+
+    for (const char *invalid : {"", "text", R"({"text": "open)", R"({"text": 1)", R"({"tags": ["a"]})",
+                                R"({"threshold": -3})", R"({"threshold": 99999999999999999999})",
+                                R"({"id": 18446744073709551616})", R"({"text": "\ud83d"})",
+                                R"({"id": "1"} trailing)"}) {
+        EXPECT_THROW(QueryRequest::parse(invalid), std::invalid_argument) << invalid;
+    }
+}
+
+TEST_F(QueryServerTest, AnswersFromTheDomainsIndex) {
+    QueryServer server(QueryServerOptions{2, 8, 10, nullptr});
+    server.add_index(first_path);
+    server.add_index(second_path);
+    EXPECT_EQ(server.domains(), (std::vector<std::string>{"a.com", "b.com"}));
+    EXPECT_THROW(server.add_index(first_path), std::runtime_error);
+
+    std::vector<QueryRequest> requests(5);
+    requests[0] = {"1", "a.com", "see the lazy dog run", 0, ""};
+    requests[1] = {"2", "b.com", "ipsum dolor", 5, ""};
+    requests[2] = {"3", "a.com", "ipsum dolor", 5, ""};
+    requests[3] = {"4", "c.com", "anything", 0, ""};
+    requests[4] = {"5", "a.com", "\xff broken", 0, ""};
+    auto responses = server.answer(requests);
+    ASSERT_EQ(responses.size(), 5);
+    EXPECT_EQ(responses[0].id, "1");
+    ASSERT_EQ(responses[0].hits.size(), 1);
+    EXPECT_EQ(responses[0].hits[0], (QueryHit{3, 13, 3, 30}));
+    EXPECT_EQ(responses[0].to_json(),
+              R"({"id": "1", "hits": [{"query_pos": 3, "length": 13, "doc_id": 3, "doc_pos": 30}]})");
+    ASSERT_EQ(responses[1].hits.size(), 1);
+    EXPECT_EQ(responses[1].hits[0], (QueryHit{0, 11, 1, 6}));
+    EXPECT_TRUE(responses[2].hits.empty());
+    EXPECT_TRUE(responses[2].error.empty());
+    EXPECT_NE(responses[3].error.find("c.com"), std::string::npos);
+    EXPECT_FALSE(responses[4].error.empty());
+
+    // A request without a domain needs a single index
+    EXPECT_FALSE(server.answer({QueryRequest{"6", "", "the lazy dog", 0, ""}})[0].error.empty());
+    QueryServer single(QueryServerOptions{1, 8, 5, nullptr});
+    single.add_index(second_path);
+    EXPECT_EQ(single.answer({QueryRequest{"7", "", "dolor sit", 0, ""}})[0].hits.size(), 1);
+}
+
+TEST_F(QueryServerTest, ServesLinesInBatches) {
+    Metrics metrics;
+    QueryServer server(QueryServerOptions{2, 2, 5, &metrics});
+    server.add_index(first_path);
+    std::istringstream in(
+        R"({"id": "1", "text": "a brown fox jumps"})" "\n"
+        "\n"
+        R"({"id": "2", "text": "no match"})" "\n"
+        "not json\n"
+        R"({"id": "4", "text": "მსოფლიო", "domain": "a.com", "threshold": 3})" "\n"
+        R"({"id": "5", "command": "stats"})" "\n");
+    std::ostringstream out;
+    EXPECT_EQ(server.serve(in, out), 5);
+
+    std::vector<std::string> lines;
+    std::istringstream written(out.str());
+    for (std::string line; std::getline(written, line);) {
+        lines.push_back(line);
+    }
+    ASSERT_EQ(lines.size(), 5);
+    EXPECT_EQ(lines[0], R"({"id": "1", "hits": [{"query_pos": 1, "length": 16, "doc_id": 3, "doc_pos": 9}]})");
+    EXPECT_EQ(lines[1], R"({"id": "2", "hits": []})");
+    EXPECT_EQ(lines[2].rfind(R"({"id": "", "error": "Invalid request)", 0), 0);
+    EXPECT_EQ(lines[3], R"({"id": "4", "hits": [{"query_pos": 0, "length": 7, "doc_id": 7, "doc_pos": 10}]})");
+    EXPECT_EQ(lines[4].rfind(R"({"id": "5", "stats": {"info": {})", 0), 0);
+
+    EXPECT_EQ(metrics.count("queries"), 4);
+    EXPECT_EQ(metrics.count("batches"), 3);
+    EXPECT_EQ(metrics.count("query_hits"), 2);
+    EXPECT_EQ(metrics.count("query_errors"), 1);
+    EXPECT_EQ(metrics.phase("answer_batch").calls, 3);
+    const auto latency = metrics.latency("query");
+    EXPECT_EQ(latency.count, 5);
+    EXPECT_GT(latency.max, 0);
+    EXPECT_LE(latency.percentile(0.5), latency.percentile(0.99));
+    EXPECT_NE(metrics.to_json().find(R"("latencies": {"query": {"count": 5, "p50_ms": )"), std::string::npos);
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "text_processing/rank_bitvector.hpp"
+
+using namespace text_processing;
+
+TEST(RankBitvectorTest, EmptyVector) {
+    RankBitvector bits;
+    EXPECT_EQ(bits.size(), 0);
+    EXPECT_EQ(bits.ones(), 0);
+    EXPECT_EQ(bits.rank1(0), 0);
+}
+
+TEST(RankBitvectorTest, PushAndRank) {
+    RankBitvector bits;
+    bits.push_back(true);
+    bits.append_zeros(9);
+    bits.push_back(true);
+    bits.push_back(false);
+
+    EXPECT_EQ(bits.size(), 12);
+    EXPECT_TRUE(bits[0]);
+    EXPECT_FALSE(bits[5]);
+    EXPECT_TRUE(bits[10]);
+    EXPECT_EQ(bits.rank1(0), 0);
+    EXPECT_EQ(bits.rank1(1), 1);
+    EXPECT_EQ(bits.rank1(10), 1);
+    EXPECT_EQ(bits.rank1(11), 2);
+    EXPECT_EQ(bits.rank1(12), 2);
+}
+
+TEST(RankBitvectorTest, MatchesPrefixCountsAcrossBlocks) {
+    std::mt19937 rng(17);
+    RankBitvector bits;
+    std::vector<size_t> prefix = {0};
+    for (size_t i = 0; i < 5000; ++i) {
+        // Mix single bits with long zero runs that cross block boundaries
+        if (rng() % 50 == 0) {
+            size_t run = rng() % 1500;
+            bits.append_zeros(run);
+            for (size_t j = 0; j < run; ++j) prefix.push_back(prefix.back());
+        } else {
+            bool bit = rng() % 3 == 0;
+            bits.push_back(bit);
+            prefix.push_back(prefix.back() + bit);
+        }
+    }
+    ASSERT_EQ(bits.size() + 1, prefix.size());
+    for (size_t pos = 0; pos <= bits.size(); ++pos) {
+        ASSERT_EQ(bits.rank1(pos), prefix[pos]) << "at " << pos;
+    }
+    EXPECT_EQ(bits.ones(), prefix.back());
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <random>
+#include "text_processing/sais_suffix_builder.hpp"
+#include "text_processing/naive_suffix_builder.hpp"
+#include "text_processing/suffix_array_builder.hpp"
+
+using namespace text_processing;
+
+class SAISSuffixBuilderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        builder = std::make_unique<SAISSuffixBuilder>();
+    }
+
+    void TearDown() override {
+        builder.reset();
+    }
+
+    // Helper function to build and verify
+    bool buildAndVerify(const std::string& input, const std::vector<size_t>& expected_sa) {
+        UTF8String text(input);
+        if (!builder->build(text)) return false;
+        const auto& sa = builder->get_array();
+        return sa == expected_sa;
+    }
+
+    // Helper to compare against the naive builder on the same input
+    void expectSameAsNaive(const std::string& input) {
+        UTF8String text(input);
+        NaiveSuffixBuilder naive;
+        ASSERT_TRUE(naive.build(text));
+        ASSERT_TRUE(builder->build(text));
+        EXPECT_EQ(builder->get_array(), naive.get_array()) << "Input: " << input;
+        EXPECT_EQ(builder->get_lcp_array(), naive.get_lcp_array()) << "Input: " << input;
+    }
+
+    std::unique_ptr<SAISSuffixBuilder> builder;
+};
+
+TEST_F(SAISSuffixBuilderTest, EmptyString) {
+    EXPECT_THROW(builder->build(UTF8String("")), std::runtime_error);
+    EXPECT_FALSE(builder->is_built());
+}
+
+TEST_F(SAISSuffixBuilderTest, SingleCharacter) {
+    EXPECT_TRUE(buildAndVerify("a", {0}));
+    EXPECT_TRUE(buildAndVerify("a$", {1, 0}));
+}
+
+TEST_F(SAISSuffixBuilderTest, RepeatingChars) {
+    EXPECT_TRUE(buildAndVerify("aaa$", {3, 2, 1, 0}));
+    EXPECT_TRUE(buildAndVerify("aaaa", {3, 2, 1, 0}));
+}
+
+TEST_F(SAISSuffixBuilderTest, BananaTest) {
+    EXPECT_TRUE(buildAndVerify("banana$", {6, 5, 3, 1, 0, 4, 2}));
+    EXPECT_TRUE(buildAndVerify("banana", {5, 3, 1, 0, 4, 2}));
+}
+
+TEST_F(SAISSuffixBuilderTest, GeorgianText) {
+    EXPECT_TRUE(buildAndVerify("აბგ$", {3, 0, 1, 2}));
+}
+
+TEST_F(SAISSuffixBuilderTest, SimpleLCPTest) {
+    ASSERT_TRUE(builder->build(UTF8String("abcab$")));
+    EXPECT_EQ(builder->get_lcp_array(), std::vector<size_t>({0, 2, 0, 1, 0}));
+}
+
+TEST_F(SAISSuffixBuilderTest, FactoryCreation) {
+    auto factory_builder = SuffixArrayBuilder::create(SuffixArrayBuilder::BuilderType::SAIS);
+    ASSERT_NE(factory_builder, nullptr);
+    EXPECT_TRUE(factory_builder->build(UTF8String("test$")));
+    EXPECT_EQ(factory_builder->get_array().size(), 5);
+    EXPECT_EQ(SuffixArrayBuilder::type_from_string("sais"), SuffixArrayBuilder::BuilderType::SAIS);
+    EXPECT_THROW(SuffixArrayBuilder::type_from_string("unknown"), std::invalid_argument);
+}
+
+TEST_F(SAISSuffixBuilderTest, BuilderStateTransitions) {
+    EXPECT_FALSE(builder->is_built());
+    EXPECT_THROW(builder->get_array(), std::runtime_error);
+    EXPECT_THROW(builder->get_lcp_array(), std::runtime_error);
+    EXPECT_TRUE(builder->build(UTF8String("test$")));
+    EXPECT_TRUE(builder->is_built());
+    EXPECT_EQ(builder->get_text(), UTF8String("test$"));
+}
+
+TEST_F(SAISSuffixBuilderTest, MatchesNaiveOnDocumentLikeText) {
+    expectSameAsNaive("hello world$Say hello world$");
+    expectSameAsNaive("გამარჯობა მსოფლიო$გამარჯობა კარგო$ჩემო კარგო$");
+    expectSameAsNaive("!@#$%^&*()");
+    expectSameAsNaive("👋🌍👋🌍$");
+}
+
+TEST_F(SAISSuffixBuilderTest, MatchesNaiveOnRandomText) {
+    std::mt19937 rng(42);
+    const std::vector<std::string> alphabet = {"a", "b", "c", "$", "ა", "ბ"};
+    for (size_t round = 0; round < 200; ++round) {
+        std::uniform_int_distribution<size_t> len_dist(1, 64);
+        std::uniform_int_distribution<size_t> sigma_dist(1, alphabet.size());
+        size_t sigma = sigma_dist(rng);
+        std::uniform_int_distribution<size_t> char_dist(0, sigma - 1);
+
+        std::string input;
+        size_t len = len_dist(rng);
+        for (size_t i = 0; i < len; ++i) {
+            input += alphabet[char_dist(rng)];
+        }
+        expectSameAsNaive(input);
+    }
+}
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <random>
 #include "text_processing/utf8_handler.hpp"
 
 using namespace text_processing;
@@ -296,4 +297,236 @@ TEST_F(UTF8StringTest, StringBoundaries) {
     EXPECT_NO_THROW(str[2]);
     // Test that accessing past the end throws
     EXPECT_THROW(str[3], std::out_of_range);
-}
\ No newline at end of file
+}
+// Test the sampled character index across block boundaries
+TEST_F(UTF8StringTest, SampledIndexAcrossBlocks) {
+    std::string content;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 300; ++i) {
+        // ASCII runs with occasional multi-byte characters
+        std::string ch = (i % 37 == 0) ? "გ" : (i % 101 == 0 ? "👋" : std::string(1, 'a' + i % 26));
+        content += ch;
+        expected.push_back(ch);
+    }
+
+    UTF8String str(content);
+    EXPECT_FALSE(str.is_ascii());
+    ASSERT_EQ(str.length(), expected.size());
+
+    size_t byte = 0;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(str.byte_offset(i), byte) << "at " << i;
+        EXPECT_EQ(str[i].str(), expected[i]) << "at " << i;
+        byte += expected[i].size();
+    }
+    EXPECT_EQ(str.byte_offset(str.length()), content.size());
+    EXPECT_THROW((void) str.byte_offset(str.length() + 1), std::out_of_range);
+    EXPECT_EQ(str.substr(70, 40).str(), content.substr(str.byte_offset(70), str.byte_offset(110) - str.byte_offset(70)));
+}
+
+// Test that pure ASCII strings keep no index
+TEST_F(UTF8StringTest, AsciiStringsKeepNoIndex) {
+    UTF8String str(std::string(10000, 'x'));
+    EXPECT_TRUE(str.is_ascii());
+    EXPECT_EQ(str.index_memory_bytes(), 0);
+    EXPECT_EQ(str.byte_offset(1234), 1234);
+
+    // Appending a multi-byte character builds the index on demand
+    str += UTF8String("ბ");
+    EXPECT_FALSE(str.is_ascii());
+    EXPECT_EQ(str.length(), 10001);
+    EXPECT_EQ(str[10000].str(), "ბ");
+    EXPECT_EQ(str[9999].str(), "x");
+    EXPECT_LT(str.index_memory_bytes(), str.length());
+
+    str += UTF8String("yz");
+    EXPECT_EQ(str[10001].str(), "y");
+    EXPECT_EQ(str.byte_offset(10002), 10000 + 3 + 1);
+}
+
+// Test appending into a partially filled block
+TEST_F(UTF8StringTest, AppendIntoPartialBlock) {
+    UTF8String str;
+    std::string expected;
+    for (int i = 0; i < 50; ++i) {
+        std::string piece = (i % 3 == 0) ? "ab" : "ჯო";
+        str += UTF8String(piece);
+        expected += piece;
+    }
+    EXPECT_EQ(str, UTF8String(expected));
+    EXPECT_EQ(str.length(), 100);
+    for (size_t i = 0; i < str.length(); ++i) {
+        EXPECT_EQ(str.byte_offset(i), UTF8String(expected).byte_offset(i)) << "at " << i;
+    }
+}
+
+// Test mapping byte offsets back to character indices
+TEST_F(UTF8StringTest, CharIndexInvertsByteOffset) {
+    std::string content;
+    for (int i = 0; i < 200; ++i) {
+        content += (i % 5 == 0) ? "ჯ" : (i % 7 == 0 ? "🌍" : "a");
+    }
+    UTF8String str(content);
+    for (size_t i = 0; i <= str.length(); ++i) {
+        EXPECT_EQ(str.char_index(str.byte_offset(i)), i) << "at " << i;
+    }
+    // A continuation byte maps to the character containing it
+    EXPECT_EQ(str.char_index(1), 0);
+    EXPECT_EQ(str.char_index(2), 0);
+    EXPECT_THROW((void) str.char_index(content.size() + 1), std::out_of_range);
+
+    UTF8String ascii("plain");
+    EXPECT_EQ(ascii.char_index(3), 3);
+}
+
+// Test ASCII runs of every length and alignment between multi-byte characters
+TEST_F(UTF8StringTest, AsciiRunsBetweenMultiByteCharacters) {
+    std::mt19937 rng(7);
+    const std::vector<std::string> wide = {"ა", "é", "🌍", "中"};
+    std::string content;
+    std::vector<size_t> offsets;
+    for (int piece = 0; piece < 300; ++piece) {
+        size_t run = rng() % 80;
+        for (size_t i = 0; i < run; ++i) {
+            offsets.push_back(content.size());
+            content += static_cast<char>('a' + rng() % 26);
+        }
+        offsets.push_back(content.size());
+        content += wide[rng() % wide.size()];
+    }
+
+    UTF8String str(content);
+    ASSERT_EQ(str.length(), offsets.size());
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        ASSERT_EQ(str.byte_offset(i), offsets[i]) << "at " << i;
+        ASSERT_EQ(str.char_index(offsets[i]), i) << "at " << i;
+    }
+
+    // Appending trusted data indexes the same way
+    UTF8String appended;
+    for (size_t begin = 0; begin < content.size();) {
+        // Cut pieces of about 997 bytes at character boundaries
+        size_t end = std::min(content.size(), begin + 997);
+        while (end < content.size() && (static_cast<unsigned char>(content[end]) & 0xC0) == 0x80) end++;
+        appended += UTF8String(content.substr(begin, end - begin));
+        begin = end;
+    }
+    EXPECT_EQ(appended, str);
+    for (size_t i = 0; i < offsets.size(); i += 13) {
+        EXPECT_EQ(appended.byte_offset(i), offsets[i]) << "at " << i;
+    }
+}
+
+// Test that invalid bytes right after long ASCII runs are still rejected
+TEST_F(UTF8StringTest, InvalidByteAfterAsciiRun) {
+    for (size_t run : {0, 1, 15, 16, 17, 31, 32, 33, 64, 100}) {
+        std::string prefix(run, 'x');
+        EXPECT_THROW(UTF8String(prefix + "\xFF" + "tail"), UTF8Error) << run;
+        EXPECT_THROW(UTF8String(prefix + "\xC3"), UTF8Error) << run;
+        EXPECT_THROW(UTF8String(prefix + "\xE2\x28\xA1"), UTF8Error) << run;
+        EXPECT_EQ(UTF8String(prefix + "ჯ" + prefix).length(), 2 * run + 1);
+    }
+}
+
+// Test appending raw bytes, and that invalid bytes leave the string unchanged
+TEST_F(UTF8StringTest, AppendBytes) {
+    UTF8String str("ab");
+    std::string expected = "ab";
+    for (int i = 0; i < 40; ++i) {
+        const std::string piece = (i % 4 == 0) ? std::string(70, 'x') : "ჯო" + std::to_string(i);
+        str.append(piece);
+        expected += piece;
+    }
+    EXPECT_EQ(str, UTF8String(expected));
+    for (size_t i = 0; i < str.length(); i += 7) {
+        EXPECT_EQ(str.byte_offset(i), UTF8String(expected).byte_offset(i)) << "at " << i;
+    }
+
+    UTF8String ascii("abc");
+    ascii.append(std::string_view("defgh", 3));
+    EXPECT_TRUE(ascii.is_ascii());
+    EXPECT_EQ(ascii, UTF8String("abcdef"));
+
+    EXPECT_THROW(str.append(std::string(20, 'y') + "\xC3"), UTF8Error);
+    EXPECT_THROW(ascii.append("ok\xFF"), UTF8Error);
+    EXPECT_EQ(str, UTF8String(expected));
+    EXPECT_EQ(ascii, UTF8String("abcdef"));
+    EXPECT_TRUE(ascii.is_ascii());
+}
+
+// Test that every kernel the CPU supports validates, counts and indexes like the scalar one
+TEST_F(UTF8StringTest, KernelsAgreeWithScalar) {
+    const UTF8String::Kernel original = UTF8String::kernel();
+    std::mt19937 rng(12);
+    // Surrogates and code points above U+10FFFF pass the scalar checks, so the vector ones must defer
+    const std::vector<std::string> pieces = {"a", "xyz", "é", "ж", "ა", "你", "😀", "\xED\xA0\x80", "\xF4\x90\x80\x80",
+                                             std::string(40, 'q')};
+    std::vector<std::string> inputs = {"", "\xC3", "\xE0\x80\x80", "\xF0\x80\x80\x80", "\x80", "\xF8\x80"};
+    for (int i = 0; i < 300; ++i) {
+        std::string text;
+        const size_t count = rng() % 60;
+        for (size_t k = 0; k < count; ++k) {
+            text += pieces[rng() % pieces.size()];
+        }
+        inputs.push_back(text);
+        if (!text.empty()) {
+            // One byte replaced, and the text cut off, anywhere including block edges
+            std::string broken = text;
+            broken[rng() % broken.size()] = static_cast<char>(rng() % 256);
+            inputs.push_back(broken);
+            inputs.push_back(text.substr(0, rng() % text.size()));
+        }
+    }
+
+    struct Outcome {
+        std::string error;
+        size_t characters = 0;
+        std::vector<size_t> offsets;
+    };
+    auto run = [](const std::string &bytes) {
+        Outcome outcome;
+        outcome.characters = UTF8String::is_valid(bytes) ? UTF8String::count_characters(bytes) : 0;
+        try {
+            const UTF8String str(bytes);
+            for (size_t i = 0; i <= str.length(); ++i) {
+                outcome.offsets.push_back(str.byte_offset(i));
+                EXPECT_EQ(str.char_index(outcome.offsets.back()), i);
+            }
+        } catch (const UTF8Error &e) {
+            outcome.error = e.what();
+        }
+        EXPECT_EQ(UTF8String::is_valid(bytes), outcome.error.empty());
+        return outcome;
+    };
+
+    ASSERT_TRUE(UTF8String::set_kernel(UTF8String::Kernel::SCALAR));
+    std::vector<Outcome> expected;
+    for (const auto &input: inputs) {
+        expected.push_back(run(input));
+    }
+    for (auto kernel: {UTF8String::Kernel::SSSE3, UTF8String::Kernel::AVX2, UTF8String::Kernel::NEON}) {
+        if (!UTF8String::set_kernel(kernel)) continue;
+        EXPECT_EQ(UTF8String::kernel(), kernel);
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            const Outcome outcome = run(inputs[i]);
+            EXPECT_EQ(outcome.error, expected[i].error) << "kernel " << static_cast<int>(kernel) << ", input " << i;
+            EXPECT_EQ(outcome.characters, expected[i].characters) << "input " << i;
+            EXPECT_EQ(outcome.offsets, expected[i].offsets) << "input " << i;
+        }
+    }
+    UTF8String::set_kernel(original);
+}
+
+// Test the vector validator's error classes on their own, past the ASCII fast path
+TEST_F(UTF8StringTest, IsValidRejectsWhatConstructorsReject) {
+    const std::string lead(50, 'a');
+    for (const std::string bad: {"\xC0\xAF", "\xC1\x81", "\xE0\x9F\x80", "\xF0\x8F\x80\x80", "\xE2\x28\xA1",
+                                 "\xE2\x82", "\x82", "\xFF", "\xC3\xA9\xA9", "\xF0\x9F\x98"}) {
+        EXPECT_FALSE(UTF8String::is_valid(bad)) << bad;
+        EXPECT_FALSE(UTF8String::is_valid(lead + bad + lead)) << bad;
+        EXPECT_FALSE(UTF8String::is_valid(lead + "ჯ" + bad)) << bad;
+    }
+    EXPECT_TRUE(UTF8String::is_valid(lead + "ჯ😀é" + lead));
+    EXPECT_EQ(UTF8String::count_characters(lead + "ჯ😀é" + lead), 103);
+    EXPECT_EQ(UTF8String::count_characters(""), 0);
+}